@@ -11,7 +11,8 @@
 // framework that does not aim for PG wire-protocol compatibility. Each deviation:
 //
 //   pg_namespace  — no `nspowner`           : no role/user system today.
-//   pg_class      — no `reltuples/relpages` : optimizer reads counts live from data_table_t.
+//   pg_class      — no `reltuples/relpages` : optimizer reads counts live from data_table_t
+//                                              (and from pg_statistic.stanrows once analyzed).
 //                 — no `reltype`             : composite-row types not implemented.
 //                 — adds `relstoragemode`    : 'd'/'m' for DISK/IN_MEMORY (otterbrix-specific).
 //                 — relkind 'g' = computing : doc proposed 'c', but 'c' collides with
@@ -24,7 +25,8 @@
 //                 — adds `attdefspec`        : flat-text encoded default value (replaces
 //                                              text `attdefval` — survives roundtrip).
 //                 — adds `atthasdefault`/`attisdropped` : tombstone; attnum is never reused.
-//                 — no `attstattarget`       : no statistics layer yet.
+//                 — no `attstattarget`       : ANALYZE covers every column with fixed
+//                                              sample / histogram / MCV sizes.
 //   pg_type       — no `typlen/typbyval/typtype` : not used by current resolution path.
 //                 — adds `typdefspec`        : flat-text encoded type tree (mirrors
 //                                              `pg_attribute.atttypspec`).
@@ -43,6 +45,13 @@
 //                                              picker not exposed via SQL DDL yet.
 //   pg_database   — added                     : full hierarchy database → namespace → relation.
 //                                              10th system table beyond PG's 9.
+//   pg_statistic  — no `stakindN/staopN/stacollN` slots : fixed column per statistic kind.
+//                 — `stadistinct` is an absolute count (PG stores a negative fraction
+//                                              for "scales with the table").
+//                 — adds `stasketch`          : HyperLogLog registers, so a later ANALYZE
+//                                              or planner can merge sketches.
+//                 — values as text            : histogram bounds / MCVs are encoded with
+//                                              encode_value_list (no anyarray type).
 //
 // These deltas are intentional; do not revert them to plain PostgreSQL shapes.
 
@@ -227,6 +236,23 @@ namespace components::catalog {
             return c;
         }
 
+        std::vector<column_definition_t> pg_statistic_columns() {
+            std::vector<column_definition_t> c;
+            c.emplace_back("starelid", oid_col(), true);     // 0: pg_class.oid
+            c.emplace_back("staattnum", i32_col(), true);    // 1: 1-based storage column position
+            c.emplace_back("stanrows", i64_col(), true);     // 2: live rows when analyzed
+            c.emplace_back("stanullcount", i64_col(), true); // 3
+            c.emplace_back("stadistinct", i64_col(), true);  // 4: estimated distinct non-NULL values
+            c.emplace_back("stasketch", str_col(), false);   // 5: serialized HyperLogLog
+            // 6..8: encode_value_list-encoded equi-depth histogram bounds (first = min,
+            // last = max) and most common values; stamccounts is the CSV of the
+            // estimated row count of each MCV, most frequent first.
+            c.emplace_back("stahistogram", str_col(), false);
+            c.emplace_back("stamcvals", str_col(), false);
+            c.emplace_back("stamccounts", str_col(), false);
+            return c;
+        }
+
         std::vector<column_definition_t> pg_computed_column_columns() {
             std::vector<column_definition_t> c;
             c.emplace_back("relid",
@@ -254,9 +280,9 @@ namespace components::catalog {
         // relation, type, function) is conceptually scoped to a database. The default "main"
         // database row is seeded with well_known_oid::main_database in
         // manager_disk_t::bootstrap_system_tables_sync.
-        static const std::array<system_table_def_t, 13> tables = []() {
+        static const std::array<system_table_def_t, 14> tables = []() {
             const oid_t pg_catalog = well_known_oid::pg_catalog_namespace;
-            return std::array<system_table_def_t, 13>{{
+            return std::array<system_table_def_t, 14>{{
                 {"pg_database", well_known_oid::pg_database_table, pg_catalog, relkind::regular, pg_database_columns()},
                 {"pg_namespace",
                  well_known_oid::pg_namespace_table,
@@ -286,6 +312,11 @@ namespace components::catalog {
                 {"pg_sequence", well_known_oid::pg_sequence_table, pg_catalog, relkind::regular, pg_sequence_columns()},
                 {"pg_rewrite", well_known_oid::pg_rewrite_table, pg_catalog, relkind::regular, pg_rewrite_columns()},
                 {"pg_settings", well_known_oid::pg_settings_table, pg_catalog, relkind::regular, pg_settings_columns()},
+                {"pg_statistic",
+                 well_known_oid::pg_statistic_table,
+                 pg_catalog,
+                 relkind::regular,
+                 pg_statistic_columns()},
             }};
         }();
         return tables;
@@ -1024,4 +1055,42 @@ namespace components::catalog {
         }
     }
 
+    std::string encode_value_list(std::span<const types::logical_value_t> values) {
+        std::string out;
+        for (const auto& v : values) {
+            auto spec = encode_default_spec(v);
+            if (spec.empty()) {
+                return "";
+            }
+            out += std::to_string(spec.size());
+            out += ':';
+            out += spec;
+        }
+        return out;
+    }
+
+    std::vector<types::logical_value_t> decode_value_list(std::pmr::memory_resource* resource,
+                                                          std::string_view encoded) {
+        std::vector<types::logical_value_t> out;
+        size_t pos = 0;
+        while (pos < encoded.size()) {
+            const auto colon = encoded.find(':', pos);
+            if (colon == std::string_view::npos) {
+                return {};
+            }
+            size_t length = 0;
+            auto [p, ec] = std::from_chars(encoded.data() + pos, encoded.data() + colon, length);
+            if (ec != std::errc{} || p != encoded.data() + colon || colon + 1 + length > encoded.size()) {
+                return {};
+            }
+            auto value = decode_default_spec(resource, std::string(encoded.substr(colon + 1, length)));
+            if (!value) {
+                return {};
+            }
+            out.push_back(std::move(*value));
+            pos = colon + 1 + length;
+        }
+        return out;
+    }
+
 } // namespace components::catalog
@@ -45,8 +45,8 @@ namespace components::catalog {
     // PG features, so storing the columns would be dead schema):
     //
     //   pg_namespace      — no `nspowner` (otterbrix has no role/user concept).
-    //   pg_class          — no `reltuples`/`relpages`/`reltype` (no cost-based optimizer using
-    //                       cardinality stats; no row composite types). Carries an otterbrix-
+    //   pg_class          — no `reltuples`/`relpages`/`reltype` (row counts live in storage and
+    //                       pg_statistic; no row composite types). Carries an otterbrix-
     //                       specific `relstoragemode` ('d'=disk, 'm'=in-memory) instead.
     //   pg_attribute      — no `attstattarget` (no stats target). `attdefval` (raw default
     //                       expression text) is replaced by `attdefspec` (flat-text-encoded
@@ -74,6 +74,8 @@ namespace components::catalog {
     //                         to pg_class.oid; no own OID column.
     //   pg_rewrite  (oid=35): view/macro body persistence — own OID column (oid); ev_class FK
     //                         to pg_class.oid; ev_action stores the SQL or macro body text.
+    //   pg_statistic (oid=40): per-column ANALYZE results — starelid FK to pg_class.oid,
+    //                         one row per (starelid, staattnum); no own OID column.
     //
     // pg_database is bootstrapped with a single row for the default "main" database
     // (well_known_oid::main_database). otterbrix has no cluster-vs-database split, but a
@@ -144,4 +146,13 @@ namespace components::catalog {
     std::optional<types::logical_value_t> decode_default_spec(std::pmr::memory_resource* resource,
                                                               const std::string& spec);
 
+    // Encode/decode a list of scalar values for pg_statistic (histogram bounds, MCVs).
+    // Each value is its encode_default_spec text prefixed with the text's length:
+    // "<len>:<spec><len>:<spec>...", so string values may contain any character.
+    // encode returns "" when any value is not encodable; decode returns an empty
+    // vector on malformed input.
+    std::string encode_value_list(std::span<const types::logical_value_t> values);
+    std::vector<types::logical_value_t> decode_value_list(std::pmr::memory_resource* resource,
+                                                          std::string_view encoded);
+
 } // namespace components::catalog
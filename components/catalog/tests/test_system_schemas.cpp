@@ -6,10 +6,11 @@
 
 using namespace components::catalog;
 
-// 1. The catalog has exactly 13 system tables (10 original + pg_sequence + pg_rewrite + pg_settings).
+// 1. The catalog has exactly 14 system tables (10 original + pg_sequence + pg_rewrite + pg_settings
+//    + pg_statistic).
 TEST_CASE("catalog::system_schemas::tables_count_10") {
     auto tables = all_system_tables();
-    REQUIRE(tables.size() == 13);
+    REQUIRE(tables.size() == 14);
 }
 
 // 2. Every system table has a unique relation_oid drawn from the well-known range.
@@ -17,7 +18,7 @@ TEST_CASE("catalog::system_schemas::distinct_well_known_oids") {
     std::unordered_set<oid_t> seen;
     for (const auto& def : all_system_tables()) {
         REQUIRE(def.relation_oid >= well_known_oid::pg_namespace_table);
-        REQUIRE(def.relation_oid <= well_known_oid::pg_settings_table);
+        REQUIRE(def.relation_oid <= well_known_oid::pg_statistic_table);
         REQUIRE(seen.insert(def.relation_oid).second);
         REQUIRE(def.namespace_oid == well_known_oid::pg_catalog_namespace);
         REQUIRE(def.relkind == 'r');
@@ -90,3 +91,29 @@ TEST_CASE("catalog::system_schemas::pg_database_minimal_columns") {
     REQUIRE(col_names.count("datname") == 1);
     REQUIRE(def->columns.size() == 2);
 }
+
+// 8. pg_statistic is keyed by (starelid, staattnum) and its value lists round-trip,
+//    including strings that contain the list's own separators.
+TEST_CASE("catalog::system_schemas::pg_statistic_value_lists") {
+    const auto* def = find_system_table("pg_statistic");
+    REQUIRE(def != nullptr);
+    REQUIRE(def->relation_oid == well_known_oid::pg_statistic_table);
+    REQUIRE(def->columns[0].name() == "starelid");
+    REQUIRE(def->columns[1].name() == "staattnum");
+
+    auto* resource = std::pmr::get_default_resource();
+    std::vector<components::types::logical_value_t> values;
+    values.emplace_back(resource, int64_t{-7});
+    values.emplace_back(resource, std::string{"a:3:b"});
+    values.emplace_back(resource, std::string{});
+    const auto encoded = encode_value_list(values);
+    REQUIRE(!encoded.empty());
+    auto decoded = decode_value_list(resource, encoded);
+    REQUIRE(decoded.size() == 3);
+    REQUIRE(decoded[0].value<int64_t>() == -7);
+    REQUIRE(decoded[1].value<std::string_view>() == "a:3:b");
+    REQUIRE(decoded[2].value<std::string_view>().empty());
+
+    REQUIRE(decode_value_list(resource, "").empty());
+    REQUIRE(decode_value_list(resource, "99:int64:1").empty());
+}
@@ -3,6 +3,8 @@
 
 #include <cassert>
 #include <cstddef>
+#include <iterator>
+#include <optional>
 #include <regex>
 #include <string>
 #include <string_view>
@@ -143,7 +145,18 @@ namespace {
     // ------------------------------------------------------------------
     // REGEXP_REPLACE(s, pattern, replacement) — std::regex ECMAScript.
     // Invalid pattern => kernel_error.
+    // The state keeps the last compiled pattern, so rows sharing one (the
+    // usual constant pattern) compile it once per execution, not per row.
     // ------------------------------------------------------------------
+    struct regexp_replace_state final : kernel_state {
+        std::string pattern;
+        std::optional<std::regex> regex;
+    };
+
+    static core::result_wrapper_t<kernel_state_ptr> init_regexp_replace(kernel_context&, kernel_init_args) {
+        return kernel_state_ptr(std::make_unique<regexp_replace_state>());
+    }
+
     static core::error_t row_regexp_replace(kernel_context& ctx,
                                             const std::pmr::vector<logical_value_t>& inputs,
                                             std::pmr::vector<logical_value_t>& output) {
@@ -161,9 +174,19 @@ namespace {
         const auto pattern_sv = inputs[1].value<std::string_view>();
         const auto replacement_sv = inputs[2].value<std::string_view>();
 
+        regexp_replace_state local;
+        auto* state = ctx.state() ? static_cast<regexp_replace_state*>(ctx.state()) : &local;
         try {
-            std::regex re(pattern_sv.data(), pattern_sv.size(), std::regex::ECMAScript);
-            std::string result = std::regex_replace(std::string(s), re, std::string(replacement_sv));
+            if (!state->regex || state->pattern != pattern_sv) {
+                state->regex.emplace(pattern_sv.data(), pattern_sv.size(), std::regex::ECMAScript);
+                state->pattern = std::string(pattern_sv);
+            }
+            std::string result;
+            std::regex_replace(std::back_inserter(result),
+                               s.begin(),
+                               s.end(),
+                               *state->regex,
+                               std::string(replacement_sv));
             output.emplace_back(resource, std::move(result));
         } catch (const std::regex_error& e) {
             return core::error_t(
@@ -230,7 +253,7 @@ namespace {
         kernel_signature_t sig(function_type_t::row,
                                {input_type::make_string(), input_type::make_string(), input_type::make_string()},
                                {output_type::fixed(logical_type::STRING_LITERAL)});
-        row_kernel k(std::move(sig), row_regexp_replace);
+        row_kernel k(std::move(sig), row_regexp_replace, init_regexp_replace);
         (void) fn->add_kernel(resource, std::move(k));
 
         return fn;
@@ -23,6 +23,12 @@ namespace configuration {
         // WAL_AUTO_CHECKPOINT_THRESHOLD_BYTES: trigger checkpoint_all when cumulative WAL
         // bytes since the last checkpoint exceed this value. Default 16 MB (4 segments).
         std::uintmax_t auto_checkpoint_threshold_bytes{16 * 1024 * 1024};
+        // Group commit (wal_sync_mode::FULL): COMMIT records that arrive while others are still being
+        // appended share one fsync. A group closes once it holds group_commit_max_size commits, no
+        // other commit is mid-append, or group_commit_window_us elapsed since it opened.
+        // group_commit_max_size <= 1 restores one fsync per commit.
+        uint32_t group_commit_window_us{100};
+        uint32_t group_commit_max_size{32};
 
         explicit config_wal(const std::filesystem::path& path = std::filesystem::current_path())
             : path(path / "wal") {}
@@ -32,6 +38,13 @@ namespace configuration {
         std::filesystem::path path{std::filesystem::current_path() / "disk"};
         bool on{true};
         int agent = 2;
+        // Workers of a morsel-parallel table scan (per scan, the agent thread included; the rest come
+        // from the shared core::worker_pool_t). 1 = serial one-batch-per-fetch scans, the default;
+        // 0 = std::thread::hardware_concurrency().
+        uint32_t scan_threads{1};
+        // Batches a fetch-next scan cursor reads ahead and ships per round trip (bounded queue);
+        // 1 = one batch per round trip.
+        uint32_t scan_read_ahead{8};
         uint64_t bitcask_flush_threshold{1000};
         uint64_t bitcask_segment_record_limit{100};
         uint64_t btree_flush_threshold{1000};
@@ -40,6 +53,26 @@ namespace configuration {
             : path(path / "wal") {}
     };
 
+    struct config_spill final {
+        std::filesystem::path path{std::filesystem::current_path() / "spill"};
+        // Bytes a blocking operator (ORDER BY) may buffer before it writes sorted runs under `path`;
+        // 0 = never spill. A query overrides it through execution_plan_t::memory_budget.
+        uint64_t memory_budget{256 * 1024 * 1024};
+        // Workers a high-cardinality GROUP BY pre-aggregates its input on, taken
+        // from the shared worker pool; 1 = serial aggregation, the default;
+        // 0 = std::thread::hardware_concurrency().
+        uint32_t operator_threads{1};
+
+        explicit config_spill(const std::filesystem::path& path = std::filesystem::current_path())
+            : path(path / "spill") {}
+    };
+
+    struct config_statistics final {
+        // Committed rows an autocommitted INSERT must append to a table since its last ANALYZE before the
+        // table is re-analyzed in the background once that INSERT has replied; 0 = no auto-analyze.
+        uint64_t auto_analyze_rows{0};
+    };
+
     struct config_pandas final {
         uint64_t analyze_sample_size{1000};
     };
@@ -48,6 +81,8 @@ namespace configuration {
         config_log log;
         config_wal wal;
         config_disk disk;
+        config_spill spill;
+        config_statistics statistics;
         config_pandas pandas;
         std::filesystem::path main_path; // mainly used for checking, because log, wal and disk could be missing
 
@@ -61,6 +96,8 @@ namespace configuration {
         : log(path)
         , wal(path)
         , disk(path)
+        , spill(path)
+        , statistics()
         , pandas()
         , main_path(path) {}
 } // namespace configuration
@@ -0,0 +1,38 @@
+#include "analyze_tracker.hpp"
+
+namespace components {
+
+    void analyze_tracker_t::set_threshold(uint64_t rows) noexcept {
+        std::lock_guard lock(mutex_);
+        threshold_ = rows;
+    }
+
+    uint64_t analyze_tracker_t::threshold() const noexcept {
+        std::lock_guard lock(mutex_);
+        return threshold_;
+    }
+
+    bool analyze_tracker_t::record_appends(catalog::oid_t table_oid, uint64_t rows) {
+        std::lock_guard lock(mutex_);
+        if (threshold_ == 0 || rows == 0) {
+            return false;
+        }
+        auto& appended = appended_[table_oid];
+        appended += rows;
+        if (appended < threshold_) {
+            return false;
+        }
+        appended = 0;
+        return true;
+    }
+
+    void analyze_tracker_t::reset(catalog::oid_t table_oid) {
+        std::lock_guard lock(mutex_);
+        if (table_oid == catalog::INVALID_OID) {
+            appended_.clear();
+        } else {
+            appended_.erase(table_oid);
+        }
+    }
+
+} // namespace components
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <components/catalog/catalog_oids.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace components {
+
+    // Rows appended to each table since it was last analyzed; drives
+    // auto-analyze. Owned by the dispatcher and handed to every executor, like
+    // catalog_cache_t, so INSERTs spread over the executors count together.
+    //
+    // Thread-safe: the executors commit concurrently.
+    class analyze_tracker_t {
+    public:
+        // threshold 0 = auto-analyze off.
+        void set_threshold(uint64_t rows) noexcept;
+        uint64_t threshold() const noexcept;
+
+        // Adds committed appended rows of `table_oid`. True when they take the
+        // table to the threshold: the count restarts, so exactly one caller
+        // runs the ANALYZE.
+        bool record_appends(catalog::oid_t table_oid, uint64_t rows);
+
+        // ANALYZE ran on `table_oid`, or on every table for INVALID_OID.
+        void reset(catalog::oid_t table_oid);
+
+    private:
+        mutable std::mutex mutex_;
+        uint64_t threshold_{0};
+        std::unordered_map<catalog::oid_t, uint64_t> appended_;
+    };
+
+} // namespace components
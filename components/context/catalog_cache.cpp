@@ -0,0 +1,143 @@
+#include "catalog_cache.hpp"
+
+#include <algorithm>
+
+namespace components {
+
+    namespace {
+        template<typename Map, typename Key, typename Value>
+        void store_capped(Map& map, Key&& key, Value&& value) {
+            if (map.size() >= catalog_cache_t::max_entries) {
+                map.clear();
+            }
+            map.insert_or_assign(std::forward<Key>(key), std::forward<Value>(value));
+        }
+    } // namespace
+
+    bool catalog_cache_t::admits(const table::transaction_data& txn) const noexcept {
+        // The snapshot must see the newest invalidated commit and every older
+        // one: nothing at or below version_ may still be in flight for it.
+        if (version_ > txn.snapshot_horizon) {
+            return false;
+        }
+        return txn.in_flight_snapshot.empty() ||
+               *std::min_element(txn.in_flight_snapshot.begin(), txn.in_flight_snapshot.end()) > version_;
+    }
+
+    std::optional<catalog::oid_t> catalog_cache_t::find_namespace(const table::transaction_data& txn,
+                                                                  std::string_view name) const {
+        std::lock_guard guard(mutex_);
+        if (!admits(txn)) {
+            return std::nullopt;
+        }
+        auto it = namespaces_.find(name);
+        if (it == namespaces_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void catalog_cache_t::store_namespace(const table::transaction_data& txn, std::string name, catalog::oid_t oid) {
+        std::lock_guard guard(mutex_);
+        // Re-checked under the lock: an invalidate() that landed while the
+        // caller was scanning raises version_ past what its snapshot sees.
+        if (admits(txn)) {
+            store_capped(namespaces_, std::move(name), oid);
+        }
+    }
+
+    std::optional<logical_plan::resolved_table_metadata_t>
+    catalog_cache_t::find_table(const table::transaction_data& txn,
+                                catalog::oid_t namespace_oid,
+                                const std::string& relname) const {
+        std::lock_guard guard(mutex_);
+        if (!admits(txn)) {
+            return std::nullopt;
+        }
+        auto it = tables_.find(name_key_t{namespace_oid, relname});
+        if (it == tables_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void catalog_cache_t::store_table(const table::transaction_data& txn,
+                                      catalog::oid_t namespace_oid,
+                                      std::string relname,
+                                      logical_plan::resolved_table_metadata_t metadata) {
+        std::lock_guard guard(mutex_);
+        if (admits(txn)) {
+            store_capped(tables_, name_key_t{namespace_oid, std::move(relname)}, std::move(metadata));
+        }
+    }
+
+    std::optional<logical_plan::resolved_type_metadata_t>
+    catalog_cache_t::find_type(const table::transaction_data& txn,
+                               catalog::oid_t namespace_oid,
+                               const std::string& name) const {
+        std::lock_guard guard(mutex_);
+        if (!admits(txn)) {
+            return std::nullopt;
+        }
+        auto it = types_.find(name_key_t{namespace_oid, name});
+        if (it == types_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void catalog_cache_t::store_type(const table::transaction_data& txn,
+                                     catalog::oid_t namespace_oid,
+                                     std::string name,
+                                     logical_plan::resolved_type_metadata_t metadata) {
+        std::lock_guard guard(mutex_);
+        if (admits(txn)) {
+            store_capped(types_, name_key_t{namespace_oid, std::move(name)}, std::move(metadata));
+        }
+    }
+
+    std::optional<planner::optimizer::table_stats_estimate_t>
+    catalog_cache_t::find_statistics(const table::transaction_data& txn, catalog::oid_t table_oid) const {
+        std::lock_guard guard(mutex_);
+        if (!admits(txn)) {
+            return std::nullopt;
+        }
+        auto it = statistics_.find(table_oid);
+        if (it == statistics_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void catalog_cache_t::store_statistics(const table::transaction_data& txn,
+                                           catalog::oid_t table_oid,
+                                           planner::optimizer::table_stats_estimate_t statistics) {
+        std::lock_guard guard(mutex_);
+        if (admits(txn)) {
+            store_capped(statistics_, table_oid, std::move(statistics));
+        }
+    }
+
+    void catalog_cache_t::invalidate(uint64_t commit_id) {
+        std::lock_guard guard(mutex_);
+        version_ = std::max(version_, commit_id);
+        namespaces_.clear();
+        tables_.clear();
+        types_.clear();
+        statistics_.clear();
+    }
+
+    uint64_t catalog_cache_t::version() const {
+        std::lock_guard guard(mutex_);
+        return version_;
+    }
+
+    std::optional<uint64_t> catalog_cache_t::admitted_version(const table::transaction_data& txn) const {
+        std::lock_guard guard(mutex_);
+        if (!admits(txn)) {
+            return std::nullopt;
+        }
+        return version_;
+    }
+
+} // namespace components
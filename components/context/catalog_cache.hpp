@@ -0,0 +1,99 @@
+#pragma once
+
+#include <components/catalog/catalog_oids.hpp>
+#include <components/logical_plan/node_catalog_resolve.hpp>
+#include <components/planner/optimizer/statistics.hpp>
+#include <components/table/row_version_manager.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace components {
+
+    // Shared cache of resolved catalog metadata: namespace name -> oid,
+    // (namespace_oid, relname) -> resolved_table_metadata_t and
+    // (namespace_oid, typname) -> resolved_type_metadata_t. Owned by the
+    // dispatcher and handed to every executor, so the resolve operators of hot
+    // point queries skip the pg_namespace / pg_class / pg_attribute / pg_type
+    // scans. It also keeps each table's pg_statistic rows, merged into a
+    // planner estimate, so the optimizer does not probe pg_statistic on every
+    // statement; an ANALYZE commit appends to pg_statistic and so invalidates
+    // them like any other catalog write.
+    //
+    // MVCC: the cached state is the committed catalog as of version(), the
+    // highest commit_id of a txn that changed pg_catalog. The commit operator
+    // calls invalidate(commit_id) for such a txn BEFORE its ProcArray publish,
+    // so no snapshot can observe the new catalog while pre-commit entries are
+    // still cached. A snapshot is admitted (lookups and stores) only when it sees
+    // version() and has no in-flight commit at or below it — i.e. when it sees
+    // exactly the invalidated catalog history. Older or concurrent snapshots
+    // fall back to the catalog scans, as does a txn with its own uncommitted
+    // catalog writes (the executor never hands it the cache). Misses are not
+    // cached: a name that does not resolve always goes to disk.
+    //
+    // Thread-safe: the executors resolve concurrently.
+    class catalog_cache_t {
+    public:
+        // Caps each map; a full map is dropped wholesale rather than evicted
+        // piecemeal — catalogs this size do not have a hot working set to keep.
+        static constexpr std::size_t max_entries = 4096;
+
+        std::optional<catalog::oid_t> find_namespace(const table::transaction_data& txn, std::string_view name) const;
+        void store_namespace(const table::transaction_data& txn, std::string name, catalog::oid_t oid);
+
+        std::optional<logical_plan::resolved_table_metadata_t>
+        find_table(const table::transaction_data& txn, catalog::oid_t namespace_oid, const std::string& relname) const;
+        void store_table(const table::transaction_data& txn,
+                         catalog::oid_t namespace_oid,
+                         std::string relname,
+                         logical_plan::resolved_table_metadata_t metadata);
+
+        std::optional<logical_plan::resolved_type_metadata_t>
+        find_type(const table::transaction_data& txn, catalog::oid_t namespace_oid, const std::string& name) const;
+        void store_type(const table::transaction_data& txn,
+                        catalog::oid_t namespace_oid,
+                        std::string name,
+                        logical_plan::resolved_type_metadata_t metadata);
+
+        // pg_statistic rows of `table_oid` merged into an empty estimate (see
+        // planner::optimizer::merge_analyzed); analyzed == false when the table
+        // has none. Unlike a missing name, a table without statistics is cached:
+        // most tables are never analyzed.
+        std::optional<planner::optimizer::table_stats_estimate_t> find_statistics(const table::transaction_data& txn,
+                                                                                  catalog::oid_t table_oid) const;
+        void store_statistics(const table::transaction_data& txn,
+                              catalog::oid_t table_oid,
+                              planner::optimizer::table_stats_estimate_t statistics);
+
+        // Drops every entry and raises version() to commit_id. Called with the
+        // commit_id of a txn that appended to or deleted from pg_catalog, after
+        // the commit_id is allocated and before it is published.
+        void invalidate(uint64_t commit_id);
+
+        uint64_t version() const;
+        // version() when `txn` is admitted, i.e. sees exactly the catalog as of
+        // that version; nullopt otherwise. Lets a cache kept elsewhere (the
+        // executors' plan caches) tag its entries with the catalog they were
+        // built from and serve them only to snapshots that see the same one.
+        std::optional<uint64_t> admitted_version(const table::transaction_data& txn) const;
+
+    private:
+        using name_key_t = std::pair<catalog::oid_t, std::string>;
+
+        bool admits(const table::transaction_data& txn) const noexcept;
+
+        mutable std::mutex mutex_;
+        uint64_t version_{0};
+        std::map<std::string, catalog::oid_t, std::less<>> namespaces_;
+        std::map<name_key_t, logical_plan::resolved_table_metadata_t> tables_;
+        std::map<name_key_t, logical_plan::resolved_type_metadata_t> types_;
+        std::map<catalog::oid_t, planner::optimizer::table_stats_estimate_t> statistics_;
+    };
+
+} // namespace components
@@ -9,13 +9,22 @@
 #include <components/session/session.hpp>
 #include <components/table/row_version_manager.hpp>
 #include <components/table/transaction.hpp>
+#include <filesystem>
 #include <set>
 #include <vector>
 
+namespace components {
+    class catalog_cache_t;
+} // namespace components
+
 namespace components::compute {
     class function_registry_t;
 } // namespace components::compute
 
+namespace components::cursor {
+    class chunk_stream_t;
+} // namespace components::cursor
+
 namespace components::pipeline {
 
     // Forward-declared (NOT included): context_t holds only a raw, non-owning
@@ -61,6 +70,36 @@ namespace components::pipeline {
         // operators); callers must null-check before use.
         subplan_runner_t* runner{nullptr};
 
+        // Shared resolve cache (dispatcher-owned, internally locked). Always set
+        // by the executor: operator_commit_transaction_t invalidates it for a
+        // txn that changed pg_catalog. The resolve operators read and fill it
+        // only when use_catalog_cache is set — the executor clears the flag for
+        // a txn holding uncommitted catalog writes, which must scan to see them.
+        catalog_cache_t* catalog_cache{nullptr};
+        bool use_catalog_cache{false};
+
+        // Bytes a blocking operator (operator_sort_t, operator_group_t) may
+        // buffer before it spills to files under spill_path; 0 = keep
+        // everything in memory.
+        // Set by the executor from the plan or the engine configuration.
+        uint64_t memory_budget{0};
+        std::filesystem::path spill_path;
+        // Threads a blocking operator (operator_group_t) may fan its work out
+        // to, the calling thread included; 1 = run everything inline.
+        uint64_t worker_threads{1};
+
+        // EXPLAIN ANALYZE: execute_pipeline records each operator's
+        // operator_profile_t (rows, batches, time, peak memory).
+        bool profile{false};
+
+        // Streaming statement: execute_pipeline pushes the ROOT's result chunks
+        // here as they are produced (parking while the client is behind)
+        // instead of collecting them, and stops early once result_limit rows
+        // (0 = no limit) went out. Set by execute_sub_plan_ on the statement's
+        // root sub-plan only; non-owning, the stream outlives the statement.
+        cursor::chunk_stream_t* result_stream{nullptr};
+        uint64_t result_limit{0};
+
         // Aggregated by operators that touch pg_catalog. Drained by
         // execute_sub_plan_ into result_tracking after pipeline runs.
         std::vector<pg_catalog_append_range_t> pg_catalog_appends;
@@ -0,0 +1,92 @@
+#include "arrow_stream.hpp"
+
+#include <components/vector/arrow/arrow_converter.hpp>
+
+#include <cassert>
+#include <cerrno>
+#include <exception>
+#include <string>
+
+namespace components::cursor {
+
+    namespace {
+
+        struct arrow_stream_state_t {
+            cursor_t_ptr cursor;
+            std::string last_error;
+        };
+
+        arrow_stream_state_t* stream_state(ArrowArrayStream* stream) {
+            return static_cast<arrow_stream_state_t*>(stream->private_data);
+        }
+
+        int fail(arrow_stream_state_t* state, int code, std::string message) {
+            state->last_error = std::move(message);
+            return code;
+        }
+
+        int cursor_failure(arrow_stream_state_t* state) {
+            return fail(state, EIO, std::string(state->cursor->get_error().what));
+        }
+
+        int get_schema(ArrowArrayStream* stream, ArrowSchema* out) {
+            auto* state = stream_state(stream);
+            if (state->cursor->is_error()) {
+                return cursor_failure(state);
+            }
+            try {
+                vector::arrow::to_arrow_schema(out, state->cursor->type_data());
+            } catch (const std::exception& e) {
+                return fail(state, EINVAL, e.what());
+            }
+            return 0;
+        }
+
+        int get_next(ArrowArrayStream* stream, ArrowArray* out) {
+            auto* state = stream_state(stream);
+            auto& cursor = *state->cursor;
+            if (!cursor.next_chunk()) {
+                if (cursor.is_error()) {
+                    return cursor_failure(state);
+                }
+                out->release = nullptr; // end of stream
+                return 0;
+            }
+            auto& chunk = cursor.current_chunk();
+            if (chunk.column_count() != cursor.type_data().size()) {
+                return fail(state, EINVAL, "result chunk does not match the stream schema");
+            }
+            try {
+                vector::arrow::to_arrow_array(chunk, out);
+            } catch (const std::exception& e) {
+                return fail(state, EINVAL, e.what());
+            }
+            return 0;
+        }
+
+        const char* get_last_error(ArrowArrayStream* stream) {
+            auto* state = stream_state(stream);
+            return state->last_error.empty() ? nullptr : state->last_error.c_str();
+        }
+
+        void release(ArrowArrayStream* stream) {
+            if (!stream || !stream->release) {
+                return;
+            }
+            stream->release = nullptr;
+            delete stream_state(stream);
+        }
+
+    } // namespace
+
+    void to_arrow_stream(cursor_t_ptr cursor, ArrowArrayStream* out) {
+        assert(cursor);
+        assert(out);
+        out->get_schema = get_schema;
+        out->get_next = get_next;
+        out->get_last_error = get_last_error;
+        out->release = release;
+        out->private_data = new arrow_stream_state_t{std::move(cursor), {}};
+    }
+
+} // namespace components::cursor
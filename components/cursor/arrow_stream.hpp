@@ -0,0 +1,17 @@
+#pragma once
+
+#include "cursor.hpp"
+
+#include <components/vector/arrow/arrow.hpp>
+
+namespace components::cursor {
+
+    // Exports a result as an Arrow C stream: one record batch per non-empty chunk, read through
+    // next_chunk(), so a streaming cursor hands each batch over as the statement produces it. Columns
+    // follow vector::arrow::to_arrow_array: flat fixed-width numerics are shared, not copied. The
+    // stream holds its own reference to the cursor and is released with out->release; a statement
+    // that failed, before or while streaming, is reported by get_schema / get_next with
+    // get_last_error() carrying its message.
+    void to_arrow_stream(cursor_t_ptr cursor, ArrowArrayStream* out);
+
+} // namespace components::cursor
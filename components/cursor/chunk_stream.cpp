@@ -0,0 +1,101 @@
+#include "chunk_stream.hpp"
+
+namespace components::cursor {
+
+    chunk_stream_t::chunk_stream_t(std::size_t capacity)
+        : capacity_(capacity > 0 ? capacity : 1) {}
+
+    chunk_stream_t::push_result_t chunk_stream_t::try_push(vector::data_chunk_t& chunk) {
+        std::lock_guard lock(mutex_);
+        if (cancelled_) {
+            return push_result_t::cancelled;
+        }
+        if (chunks_.size() >= capacity_) {
+            producer_waiting_ = true;
+            return push_result_t::full;
+        }
+        producer_waiting_ = false;
+        chunks_.push_back(std::move(chunk));
+        not_empty_.notify_one();
+        return push_result_t::pushed;
+    }
+
+    bool chunk_stream_t::push(vector::data_chunk_t&& chunk) {
+        std::unique_lock lock(mutex_);
+        not_full_.wait(lock, [this] { return cancelled_ || chunks_.size() < capacity_; });
+        if (cancelled_) {
+            return false;
+        }
+        chunks_.push_back(std::move(chunk));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    void chunk_stream_t::finish(core::error_t error) {
+        std::lock_guard lock(mutex_);
+        if (finished_) {
+            return;
+        }
+        finished_ = true;
+        error_ = std::move(error);
+        not_empty_.notify_all();
+    }
+
+    bool chunk_stream_t::producer_may_resume() const {
+        std::lock_guard lock(mutex_);
+        return producer_waiting_ && (cancelled_ || chunks_.size() < capacity_);
+    }
+
+    void chunk_stream_t::set_waker(std::function<void()> waker) {
+        std::lock_guard lock(mutex_);
+        waker_ = std::move(waker);
+    }
+
+    void chunk_stream_t::wake_producer() {
+        // Under the lock, so set_waker({}) returning means no call is still running.
+        if (producer_waiting_ && waker_) {
+            waker_();
+        }
+    }
+
+    bool chunk_stream_t::pop(vector::data_chunk_t& chunk) {
+        std::unique_lock lock(mutex_);
+        not_empty_.wait(lock, [this] { return finished_ || cancelled_ || !chunks_.empty(); });
+        if (chunks_.empty()) {
+            return false;
+        }
+        chunk = std::move(chunks_.front());
+        chunks_.pop_front();
+        not_full_.notify_one();
+        wake_producer();
+        return true;
+    }
+
+    void chunk_stream_t::cancel() {
+        std::lock_guard lock(mutex_);
+        cancelled_ = true;
+        if (!finished_) {
+            finished_ = true;
+            error_ = core::error_t(core::error_code_t::query_cancelled,
+                                   std::pmr::string{"result stream closed by the client"});
+        }
+        // The chunks nobody will read go now, not when the last reference does.
+        chunks_.clear();
+        not_full_.notify_all();
+        not_empty_.notify_all();
+        wake_producer();
+    }
+
+    bool chunk_stream_t::is_cancelled() const {
+        std::lock_guard lock(mutex_);
+        return cancelled_;
+    }
+
+    core::error_t chunk_stream_t::error() const {
+        std::lock_guard lock(mutex_);
+        return error_;
+    }
+
+    chunk_stream_ptr make_chunk_stream(std::size_t capacity) { return chunk_stream_ptr{new chunk_stream_t(capacity)}; }
+
+} // namespace components::cursor
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <core/result_wrapper.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+#include <components/vector/data_chunk.hpp>
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+#include <boost/smart_ptr/intrusive_ref_counter.hpp>
+
+namespace components::cursor {
+
+    // Bounded hand-off of result chunks from the executor running a statement to the client reading
+    // it. The executor hands chunks over as its root pipeline produces them; while `capacity` chunks
+    // are waiting try_push() refuses, and the executor parks its coroutine until the client makes
+    // room, so a client that reads slowly pauses the pipeline instead of the result piling up in
+    // memory — without holding a scheduler thread. finish() closes the stream with the statement's
+    // status once everything is pushed; cancel() is the client walking away, which releases a
+    // waiting producer, makes every later push fail and ends an unfinished stream with
+    // query_cancelled.
+    class chunk_stream_t : public boost::intrusive_ref_counter<chunk_stream_t> {
+    public:
+        static constexpr std::size_t default_capacity = 4;
+
+        enum class push_result_t
+        {
+            pushed,
+            // The chunk stays with the caller; retry once producer_may_resume().
+            full,
+            // The chunk is dropped.
+            cancelled,
+        };
+
+        explicit chunk_stream_t(std::size_t capacity = default_capacity);
+
+        // Producer side. Never blocks.
+        push_result_t try_push(vector::data_chunk_t& chunk);
+        // Blocking push for a producer on a thread of its own; false, dropping the chunk, once the
+        // stream is cancelled. The executor uses try_push().
+        bool push(vector::data_chunk_t&& chunk);
+        void finish(core::error_t error);
+        // A try_push() was refused as full and the client has since made room, or cancelled.
+        bool producer_may_resume() const;
+        // Called, under the stream's lock, whenever pop() or cancel() releases a refused producer.
+        // The dispatcher sets it to wake its loop; an empty function clears it.
+        void set_waker(std::function<void()> waker);
+
+        // Consumer side. Blocks until a chunk is waiting or the stream is finished; returns false at
+        // the end of the stream, whose status is then error().
+        bool pop(vector::data_chunk_t& chunk);
+        void cancel();
+
+        bool is_cancelled() const;
+        core::error_t error() const;
+
+    private:
+        void wake_producer();
+
+        const std::size_t capacity_;
+        mutable std::mutex mutex_;
+        std::condition_variable not_full_;
+        std::condition_variable not_empty_;
+        std::deque<vector::data_chunk_t> chunks_;
+        std::function<void()> waker_;
+        bool producer_waiting_{false};
+        bool finished_{false};
+        bool cancelled_{false};
+        core::error_t error_{core::error_t::no_error()};
+    };
+
+    using chunk_stream_ptr = boost::intrusive_ptr<chunk_stream_t>;
+
+    chunk_stream_ptr make_chunk_stream(std::size_t capacity = chunk_stream_t::default_capacity);
+
+} // namespace components::cursor
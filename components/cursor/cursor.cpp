@@ -74,6 +74,18 @@ namespace components::cursor {
         chunks_.emplace_back(empty_chunk(resource));
     }
 
+    cursor_t::cursor_t(std::pmr::memory_resource* resource, chunk_stream_ptr stream)
+        : chunks_(resource)
+        , type_data_(resource)
+        , error_(core::error_t::no_error())
+        , streaming_(true)
+        , stream_(std::move(stream)) {
+        chunks_.emplace_back(empty_chunk(resource));
+        pull_();
+    }
+
+    cursor_t::~cursor_t() { close(); }
+
     // Column shape/types are shared by every chunk; row access that may span chunks goes
     // through value()/row(), which locate the owning chunk. chunks() is for callers that
     // genuinely need raw per-chunk column vectors (and must iterate chunks themselves).
@@ -85,15 +97,105 @@ namespace components::cursor {
     std::size_t cursor_t::size() const { return size_; }
     std::size_t cursor_t::column_count() const { return type_data_.size(); }
     std::size_t cursor_t::column_index(std::string_view key) const { return chunks_.front().column_index(key); }
-    bool cursor_t::has_next() const { return static_cast<std::size_t>(current_index_ + 1) < size_; }
+    bool cursor_t::has_next() {
+        if (static_cast<std::size_t>(current_index_ + 1) < size_) {
+            return true;
+        }
+        if (stream_ && pull_()) {
+            chunk_index_ = received_chunks_;
+            return true;
+        }
+        return false;
+    }
     void cursor_t::advance() { ++current_index_; }
     index_t cursor_t::current_index() const { return current_index_; }
 
+    bool cursor_t::next_chunk() {
+        if (streaming_) {
+            if (chunk_index_ < received_chunks_) {
+                // the first chunk, received by the constructor
+                chunk_index_ = received_chunks_;
+                return true;
+            }
+            if (!stream_ || !pull_()) {
+                return false;
+            }
+            chunk_index_ = received_chunks_;
+            return true;
+        }
+        while (chunk_index_ < chunks_.size()) {
+            if (chunks_[chunk_index_++].size() > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    vector::data_chunk_t& cursor_t::current_chunk() {
+        if (streaming_ || chunk_index_ == 0) {
+            return chunks_.front();
+        }
+        return chunks_[chunk_index_ - 1];
+    }
+
+    const vector::data_chunk_t& cursor_t::current_chunk() const {
+        if (streaming_ || chunk_index_ == 0) {
+            return chunks_.front();
+        }
+        return chunks_[chunk_index_ - 1];
+    }
+
+    void cursor_t::close() {
+        if (stream_) {
+            stream_->cancel();
+            stream_.reset();
+        }
+    }
+
+    bool cursor_t::pull_() {
+        auto chunk = empty_chunk(chunks_.get_allocator().resource());
+        while (stream_->pop(chunk)) {
+            chunk.drop_unprojected_placeholders();
+            if (type_data_.empty()) {
+                const auto& chunk_types = chunk.types();
+                type_data_.assign(chunk_types.begin(), chunk_types.end());
+            }
+            if (chunk.size() == 0) {
+                // Only the first chunk matters when empty: it carries the column shape.
+                if (chunks_.front().column_count() == 0) {
+                    chunks_.front() = std::move(chunk);
+                }
+                continue;
+            }
+            chunk_base_ = size_;
+            size_ += chunk.size();
+            chunks_.front() = std::move(chunk);
+            ++received_chunks_;
+            return true;
+        }
+        error_ = stream_->error();
+        stream_.reset();
+        return false;
+    }
+
     types::logical_value_t cursor_t::value(uint64_t col_idx) const {
         return value(col_idx, static_cast<uint64_t>(current_index_));
     }
 
+    bool cursor_t::holds_row(uint64_t row_idx) const {
+        if (streaming_) {
+            return row_idx >= chunk_base_ && row_idx - chunk_base_ < chunks_.front().size();
+        }
+        return row_idx < size_;
+    }
+
     types::logical_value_t cursor_t::value(uint64_t col_idx, uint64_t row_idx) const {
+        if (!holds_row(row_idx)) {
+            return types::logical_value_t(chunks_.front().resource(), nullptr);
+        }
+        if (streaming_) {
+            return chunks_.front().value(col_idx, row_idx - chunk_base_);
+        }
         // Locate the chunk holding the global row_idx (chunks are ≤CAP each).
         uint64_t base = 0;
         for (const auto& chunk : chunks_) {
@@ -103,7 +205,7 @@ namespace components::cursor {
             }
             base += rows;
         }
-        return chunks_.front().value(col_idx, row_idx);
+        return types::logical_value_t(chunks_.front().resource(), nullptr);
     }
 
     std::pmr::vector<types::logical_value_t> cursor_t::row() const {
@@ -113,6 +215,9 @@ namespace components::cursor {
     std::pmr::vector<types::logical_value_t> cursor_t::row(uint64_t row_idx) const {
         const auto cols = chunks_.front().column_count();
         std::pmr::vector<types::logical_value_t> result(chunks_.front().resource());
+        if (!holds_row(row_idx)) {
+            return result;
+        }
         result.reserve(cols);
         for (uint64_t col = 0; col < cols; ++col) {
             result.push_back(value(col, row_idx));
@@ -148,4 +253,8 @@ namespace components::cursor {
                              std::pmr::vector<components::types::complex_logical_type>&& types) {
         return cursor_t_ptr{new cursor_t(resource, std::move(types))};
     }
+
+    cursor_t_ptr make_cursor(std::pmr::memory_resource* resource, chunk_stream_ptr stream) {
+        return cursor_t_ptr{new cursor_t(resource, std::move(stream))};
+    }
 } // namespace components::cursor
@@ -9,6 +9,8 @@
 #include <components/types/types.hpp>
 #include <components/vector/data_chunk.hpp>
 
+#include "chunk_stream.hpp"
+
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 #include <boost/smart_ptr/intrusive_ref_counter.hpp>
 
@@ -26,6 +28,12 @@ namespace components::cursor {
         explicit cursor_t(std::pmr::memory_resource* resource, std::pmr::vector<vector::data_chunk_t>&& chunks);
         explicit cursor_t(std::pmr::memory_resource* resource,
                           std::pmr::vector<components::types::complex_logical_type>&& types);
+        // Streaming cursor over a statement that is still running: waits for the first chunk (or the
+        // statement's failure) and then hands out rows as the executor produces them. Only the current
+        // chunk is held, so value()/row() reach the rows of that chunk alone; size() counts the rows
+        // received so far and is_error() turns true when the statement fails midway.
+        explicit cursor_t(std::pmr::memory_resource* resource, chunk_stream_ptr stream);
+        ~cursor_t();
 
         // Raw access to the result batch. Row access that may span chunks must go
         // through value()/row() — never index a single chunk by a global row id.
@@ -38,10 +46,24 @@ namespace components::cursor {
         std::size_t column_count() const;
         std::size_t column_index(std::string_view key) const;
 
-        bool has_next() const;
+        // Streaming cursors receive the next chunk here once the current one is read through.
+        bool has_next();
         void advance();
         index_t current_index() const;
 
+        // Chunk-at-a-time reading, for materialized and streaming cursors alike: moves to the next
+        // non-empty chunk, returning false past the last one. current_chunk() is valid after a
+        // successful next_chunk().
+        bool next_chunk();
+        vector::data_chunk_t& current_chunk();
+        const vector::data_chunk_t& current_chunk() const;
+        // Stops a streaming statement early; no-op for a materialized cursor.
+        void close();
+
+        // Whether value()/row() reach global row row_idx: any row below size() of a materialized
+        // cursor, only the rows of the chunk currently held by a streaming one. Outside it value()
+        // is null and row() empty.
+        bool holds_row(uint64_t row_idx) const;
         types::logical_value_t value(uint64_t col_idx) const;
         types::logical_value_t value(uint64_t col_idx, uint64_t row_idx) const;
         std::pmr::vector<types::logical_value_t> row() const;
@@ -60,6 +82,15 @@ namespace components::cursor {
         std::pmr::vector<vector::data_chunk_t> chunks_;
         std::pmr::vector<components::types::complex_logical_type> type_data_;
         core::error_t error_;
+
+        // Streaming mode: chunks_ holds the latest received chunk only, whose first row is global row
+        // chunk_base_. stream_ is dropped once it ends.
+        bool pull_();
+        bool streaming_{false};
+        chunk_stream_ptr stream_;
+        std::size_t chunk_base_{0};
+        std::size_t received_chunks_{0};
+        std::size_t chunk_index_{0}; // chunks handed out by next_chunk() so far
     };
 
     using cursor_t_ptr = boost::intrusive_ptr<cursor_t>;
@@ -71,5 +102,6 @@ namespace components::cursor {
     cursor_t_ptr make_cursor(std::pmr::memory_resource* resource, std::pmr::vector<vector::data_chunk_t>&& chunks);
     cursor_t_ptr make_cursor(std::pmr::memory_resource* resource,
                              std::pmr::vector<components::types::complex_logical_type>&& types);
+    cursor_t_ptr make_cursor(std::pmr::memory_resource* resource, chunk_stream_ptr stream);
 
 } // namespace components::cursor
@@ -1,9 +1,14 @@
 #include <catch2/catch.hpp>
+#include <components/cursor/arrow_stream.hpp>
 #include <components/cursor/cursor.hpp>
 #include <components/tests/generaty.hpp>
 #include <core/pmr.hpp>
 
+#include <atomic>
+#include <cerrno>
+#include <cstring>
 #include <memory>
+#include <thread>
 
 using namespace core::pmr;
 
@@ -48,3 +53,176 @@ TEST_CASE("components::cursor::data_chunk") {
         REQUIRE(cursor->size() == 0);
     }
 }
+
+TEST_CASE("components::cursor::streaming") {
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    SECTION("rows and chunks arrive as they are pushed") {
+        auto stream = components::cursor::make_chunk_stream(2);
+        std::thread producer([&] {
+            REQUIRE(stream->push(gen_data_chunk(0, &resource)));
+            for (int i = 0; i < 5; ++i) {
+                REQUIRE(stream->push(gen_data_chunk(10, i * 10, &resource)));
+            }
+            stream->finish(core::error_t::no_error());
+        });
+        auto cursor = components::cursor::make_cursor(&resource, stream);
+        REQUIRE(cursor->is_success());
+        REQUIRE(cursor->column_count() > 0);
+
+        REQUIRE(cursor->next_chunk());
+        REQUIRE(cursor->current_chunk().size() == 10);
+        REQUIRE(cursor->value(0, 10).is_null());
+        REQUIRE(cursor->row(10).empty());
+        std::size_t rows = 0;
+        while (cursor->has_next()) {
+            cursor->advance();
+            REQUIRE(cursor->value(0).value<int64_t>() == static_cast<int64_t>(cursor->current_index()) + 1);
+            ++rows;
+        }
+        REQUIRE(rows == 50);
+        REQUIRE(cursor->size() == 50);
+        REQUIRE(cursor->value(0, 49).value<int64_t>() == 50);
+        REQUIRE(cursor->value(0, 0).is_null());
+        REQUIRE(cursor->row(0).empty());
+        REQUIRE_FALSE(cursor->next_chunk());
+        REQUIRE(cursor->is_success());
+        producer.join();
+    }
+
+    SECTION("a failure midway ends the cursor with the error") {
+        auto stream = components::cursor::make_chunk_stream();
+        std::thread producer([&] {
+            REQUIRE(stream->push(gen_data_chunk(10, &resource)));
+            stream->finish(core::error_t(core::error_code_t::other_error, std::pmr::string{"failed", &resource}));
+        });
+        auto cursor = components::cursor::make_cursor(&resource, stream);
+        std::size_t chunks = 0;
+        while (cursor->next_chunk()) {
+            ++chunks;
+        }
+        REQUIRE(chunks == 1);
+        REQUIRE(cursor->is_error());
+        REQUIRE(cursor->get_error().type == core::error_code_t::other_error);
+        producer.join();
+    }
+
+    SECTION("closing the cursor stops a blocked producer") {
+        auto stream = components::cursor::make_chunk_stream(1);
+        std::atomic_bool stopped = false;
+        std::thread producer([&] {
+            while (stream->push(gen_data_chunk(10, &resource))) {
+            }
+            stopped = true;
+        });
+        auto cursor = components::cursor::make_cursor(&resource, stream);
+        REQUIRE(cursor->next_chunk());
+        cursor.reset();
+        producer.join();
+        REQUIRE(stopped);
+        REQUIRE(stream->is_cancelled());
+    }
+
+    SECTION("a refused push waits for the reader without blocking") {
+        using push_result_t = components::cursor::chunk_stream_t::push_result_t;
+        auto stream = components::cursor::make_chunk_stream(1);
+        int wakes = 0;
+        stream->set_waker([&] { ++wakes; });
+        auto first = gen_data_chunk(10, &resource);
+        REQUIRE(stream->try_push(first) == push_result_t::pushed);
+        auto second = gen_data_chunk(10, 10, &resource);
+        REQUIRE(stream->try_push(second) == push_result_t::full);
+        REQUIRE(second.size() == 10);
+        REQUIRE_FALSE(stream->producer_may_resume());
+
+        components::vector::data_chunk_t popped(&resource, std::pmr::vector<components::types::complex_logical_type>{&resource});
+        REQUIRE(stream->pop(popped));
+        REQUIRE(wakes == 1);
+        REQUIRE(stream->producer_may_resume());
+        REQUIRE(stream->try_push(second) == push_result_t::pushed);
+        REQUIRE_FALSE(stream->producer_may_resume());
+
+        auto third = gen_data_chunk(10, &resource);
+        REQUIRE(stream->try_push(third) == push_result_t::full);
+        stream->cancel();
+        REQUIRE(wakes == 2);
+        REQUIRE(stream->producer_may_resume());
+        REQUIRE(stream->try_push(third) == push_result_t::cancelled);
+    }
+}
+
+TEST_CASE("components::cursor::arrow_stream") {
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    // Sums the `count` column over every batch of the stream.
+    auto drain = [](ArrowArrayStream& stream, std::size_t& batches, int64_t& sum) {
+        ArrowArray array;
+        int code;
+        while ((code = stream.get_next(&stream, &array)) == 0 && array.release) {
+            REQUIRE(array.n_children == 6);
+            auto* count = array.children[0];
+            auto* values = static_cast<const int64_t*>(count->buffers[1]);
+            for (int64_t row = 0; row < count->length; ++row) {
+                sum += values[count->offset + row];
+            }
+            ++batches;
+            array.release(&array);
+        }
+        return code;
+    };
+
+    SECTION("one batch per chunk of a materialized result") {
+        std::pmr::vector<components::vector::data_chunk_t> chunks(&resource);
+        chunks.push_back(gen_data_chunk(10, &resource));
+        chunks.push_back(gen_data_chunk(5, 10, &resource));
+        ArrowArrayStream stream;
+        components::cursor::to_arrow_stream(components::cursor::make_cursor(&resource, std::move(chunks)), &stream);
+
+        ArrowSchema schema;
+        REQUIRE(stream.get_schema(&stream, &schema) == 0);
+        REQUIRE(schema.n_children == 6);
+        REQUIRE(std::strcmp(schema.children[0]->name, "count") == 0);
+        REQUIRE(std::strcmp(schema.children[0]->format, "l") == 0);
+        schema.release(&schema);
+
+        std::size_t batches = 0;
+        int64_t sum = 0;
+        REQUIRE(drain(stream, batches, sum) == 0);
+        REQUIRE(batches == 2);
+        REQUIRE(sum == 15 * 16 / 2);
+        stream.release(&stream);
+        REQUIRE(stream.release == nullptr);
+    }
+
+    SECTION("a streaming statement that fails midway fails get_next") {
+        auto stream = components::cursor::make_chunk_stream();
+        std::thread producer([&] {
+            REQUIRE(stream->push(gen_data_chunk(10, &resource)));
+            stream->finish(core::error_t(core::error_code_t::other_error, std::pmr::string{"failed", &resource}));
+        });
+        ArrowArrayStream arrow_stream;
+        components::cursor::to_arrow_stream(components::cursor::make_cursor(&resource, stream), &arrow_stream);
+
+        std::size_t batches = 0;
+        int64_t sum = 0;
+        REQUIRE(drain(arrow_stream, batches, sum) == EIO);
+        REQUIRE(batches == 1);
+        REQUIRE(sum == 10 * 11 / 2);
+        REQUIRE(std::strcmp(arrow_stream.get_last_error(&arrow_stream), "failed") == 0);
+        arrow_stream.release(&arrow_stream);
+        producer.join();
+    }
+
+    SECTION("an error cursor fails get_schema") {
+        ArrowArrayStream stream;
+        components::cursor::to_arrow_stream(
+            components::cursor::make_cursor(&resource,
+                                            core::error_t(core::error_code_t::other_error,
+                                                          std::pmr::string{"no such table", &resource})),
+            &stream);
+        ArrowSchema schema;
+        REQUIRE(stream.get_schema(&stream, &schema) == EIO);
+        REQUIRE(std::strcmp(stream.get_last_error(&stream), "no such table") == 0);
+        stream.release(&stream);
+    }
+}
@@ -5,11 +5,13 @@ namespace components::logical_plan {
     execution_plan_t::execution_plan_t(std::pmr::memory_resource* resource)
         : sub_queries(resource)
         , sub_query_results(resource)
-        , parameters(make_parameter_node(resource)) {}
+        , parameters(make_parameter_node(resource))
+        , cache_key(resource) {}
 
     execution_plan_t::execution_plan_t(std::pmr::memory_resource* resource, node_ptr node, parameter_node_ptr params)
         : sub_queries({node}, resource)
         , sub_query_results(resource)
-        , parameters(params) {}
+        , parameters(params)
+        , cache_key(resource) {}
 
 } // namespace components::logical_plan
\ No newline at end of file
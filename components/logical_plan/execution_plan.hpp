@@ -3,6 +3,7 @@
 #include "node.hpp"
 #include "param_storage.hpp"
 
+#include <components/cursor/chunk_stream.hpp>
 #include <components/vector/data_chunk.hpp>
 #include <core/result_wrapper.hpp>
 
@@ -15,6 +16,15 @@ namespace components::logical_plan {
         core::parameter_id_t id;
     };
 
+    // EXPLAIN returns the plan instead of the statement's result; ANALYZE also
+    // runs the statement and reports what each operator did.
+    enum class explain_mode : uint8_t
+    {
+        none,
+        plan,
+        analyze
+    };
+
     struct execution_plan_t {
         // default is null_memory_resource to make it non-usable, but also be able to send over actor-zeta
         explicit execution_plan_t(std::pmr::memory_resource* resource);
@@ -32,6 +42,24 @@ namespace components::logical_plan {
 
         // hold various parameters for the whole execution_plan_t, including subquery mapping
         parameter_node_ptr parameters;
+
+        // bytes a blocking operator of this query may buffer before spilling to disk
+        // 0 -> the engine-wide configuration::config_spill::memory_budget; set per statement through
+        // wrapper_dispatcher_t::execute_sql_with_budget (execute_sql_with_budget in the C API)
+        uint64_t memory_budget{0};
+
+        explain_mode explain{explain_mode::none};
+        // EXPLAIN (FORMAT JSON): one JSON document instead of indented text lines
+        bool explain_json{false};
+
+        // set -> the executor may keep the statement's optimized plan and re-run it for the next
+        // execution with the same key (see executor_t::plan_cache_). Identifies the statement text
+        // and the parser extensions it was parsed under; empty -> plan from scratch every time
+        std::pmr::string cache_key;
+
+        // set -> the client reads the result while the statement runs: the root pipeline pushes its
+        // chunks here as they are produced instead of collecting them into the returned cursor
+        cursor::chunk_stream_ptr stream;
     };
 
 } // namespace components::logical_plan
\ No newline at end of file
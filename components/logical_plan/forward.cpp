@@ -56,6 +56,8 @@ namespace components::logical_plan {
                 return "checkpoint_t";
             case node_type::vacuum_t:
                 return "vacuum_t";
+            case node_type::analyze_t:
+                return "analyze_t";
             case node_type::having_t:
                 return "having_t";
             case node_type::alter_table_t:
@@ -39,6 +39,8 @@ namespace components::logical_plan {
         refresh_matview_t,
         checkpoint_t,
         vacuum_t,
+        // ANALYZE [table [(columns)]]: refreshes pg_statistic.
+        analyze_t,
         having_t,
         alter_table_t,
         create_constraint_t,
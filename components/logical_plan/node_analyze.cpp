@@ -0,0 +1,37 @@
+#include "node_analyze.hpp"
+
+#include <boost/container_hash/hash.hpp>
+#include <sstream>
+
+namespace components::logical_plan {
+
+    node_analyze_t::node_analyze_t(std::pmr::memory_resource* resource)
+        : node_t(resource, node_type::analyze_t)
+        , columns_(resource) {}
+
+    hash_t node_analyze_t::hash_impl() const {
+        hash_t hash_{0};
+        for (const auto& column : columns_) {
+            boost::hash_combine(hash_, std::hash<std::string_view>{}(column));
+        }
+        return hash_;
+    }
+
+    std::string node_analyze_t::to_string_impl() const {
+        std::stringstream stream;
+        stream << "$analyze";
+        if (!columns_.empty()) {
+            stream << ": {";
+            bool first = true;
+            for (const auto& column : columns_) {
+                stream << (first ? "" : ", ") << column;
+                first = false;
+            }
+            stream << "}";
+        }
+        return stream.str();
+    }
+
+    node_analyze_ptr make_node_analyze(std::pmr::memory_resource* resource) { return {new node_analyze_t{resource}}; }
+
+} // namespace components::logical_plan
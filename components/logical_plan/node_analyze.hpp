@@ -0,0 +1,28 @@
+#pragma once
+
+#include "node.hpp"
+
+namespace components::logical_plan {
+
+    // ANALYZE [table [(columns)]]. Without a table every user table is
+    // analyzed; the target table oid is stamped by enrich from the
+    // catalog_resolve_table child of the surrounding sequence.
+    class node_analyze_t final : public node_t {
+    public:
+        explicit node_analyze_t(std::pmr::memory_resource* resource);
+
+        // Empty: every column.
+        const std::pmr::vector<std::pmr::string>& columns() const noexcept { return columns_; }
+        void append_column(std::string_view name) { columns_.emplace_back(name); }
+
+    private:
+        hash_t hash_impl() const override;
+        std::string to_string_impl() const override;
+
+        std::pmr::vector<std::pmr::string> columns_;
+    };
+
+    using node_analyze_ptr = boost::intrusive_ptr<node_analyze_t>;
+    node_analyze_ptr make_node_analyze(std::pmr::memory_resource* resource);
+
+} // namespace components::logical_plan
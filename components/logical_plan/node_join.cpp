@@ -1,6 +1,7 @@
 #include "node_join.hpp"
 
 #include <boost/container_hash/hash.hpp>
+#include <cassert>
 #include <sstream>
 
 namespace components::logical_plan {
@@ -29,7 +30,10 @@ namespace components::logical_plan {
         : node_t(resource, node_type::join_t)
         , dbname_(std::move(static_cast<std::string&>(dbname)))
         , relname_(std::move(static_cast<std::string&>(relname)))
-        , type_(type) {}
+        , type_(type)
+        , left_cols_(resource)
+        , right_cols_(resource)
+        , output_order_(resource) {}
 
     join_type node_join_t::type() const { return type_; }
 
@@ -37,24 +41,42 @@ namespace components::logical_plan {
 
     void node_join_t::set_algo(join_algo algo) noexcept { algo_ = algo; }
 
-    std::size_t node_join_t::left_col() const noexcept { return left_col_; }
+    const std::pmr::vector<std::size_t>& node_join_t::left_cols() const noexcept { return left_cols_; }
 
-    std::size_t node_join_t::right_col() const noexcept { return right_col_; }
+    const std::pmr::vector<std::size_t>& node_join_t::right_cols() const noexcept { return right_cols_; }
 
-    void node_join_t::set_equi_columns(std::size_t left, std::size_t right) noexcept {
-        left_col_ = left;
-        right_col_ = right;
+    const expression_ptr& node_join_t::residual() const noexcept { return residual_; }
+
+    void node_join_t::set_equi_columns(std::pmr::vector<std::size_t> left,
+                                       std::pmr::vector<std::size_t> right,
+                                       expression_ptr residual) {
+        assert(!left.empty() && left.size() == right.size());
+        left_cols_ = std::move(left);
+        right_cols_ = std::move(right);
+        residual_ = std::move(residual);
         algo_ = join_algo::hash;
     }
 
+    const std::pmr::vector<std::size_t>& node_join_t::output_order() const noexcept { return output_order_; }
+
+    void node_join_t::set_output_order(std::pmr::vector<std::size_t> order) { output_order_ = std::move(order); }
+
     hash_t node_join_t::hash_impl() const {
         // node_t::hash() combines type_ + hash_impl(); a hash-annotated join carries
         // the same node_type::join_t as a nested-loop one, so fold the annotation in
         // here to keep them in distinct buckets.
         hash_t hash_value{0};
         boost::hash_combine(hash_value, static_cast<uint8_t>(algo_));
-        boost::hash_combine(hash_value, left_col_);
-        boost::hash_combine(hash_value, right_col_);
+        for (std::size_t i = 0; i < left_cols_.size(); ++i) {
+            boost::hash_combine(hash_value, left_cols_[i]);
+            boost::hash_combine(hash_value, right_cols_[i]);
+        }
+        if (residual_) {
+            boost::hash_combine(hash_value, residual_->hash());
+        }
+        for (auto column : output_order_) {
+            boost::hash_combine(hash_value, column);
+        }
         return hash_value;
     }
 
@@ -63,7 +85,21 @@ namespace components::logical_plan {
         stream << "$join: {";
         stream << "$type: " << logical_plan::to_string(type_);
         if (algo_ == join_algo::hash) {
-            stream << ", $algo: hash, $left_col: " << left_col_ << ", $right_col: " << right_col_;
+            stream << ", $algo: hash, $keys: [";
+            for (std::size_t i = 0; i < left_cols_.size(); ++i) {
+                stream << (i == 0 ? "" : ", ") << left_cols_[i] << " = " << right_cols_[i];
+            }
+            stream << "]";
+            if (residual_) {
+                stream << ", $residual: " << residual_->to_string();
+            }
+        }
+        if (!output_order_.empty()) {
+            stream << ", $output_order: [";
+            for (std::size_t i = 0; i < output_order_.size(); ++i) {
+                stream << (i == 0 ? "" : ", ") << output_order_[i];
+            }
+            stream << "]";
         }
         for (const auto& child : children_) {
             stream << ", " << child->to_string();
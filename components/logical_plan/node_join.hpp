@@ -35,11 +35,24 @@ namespace components::logical_plan {
 
         join_algo algo() const noexcept;
         void set_algo(join_algo algo) noexcept;
-        std::size_t left_col() const noexcept;
-        std::size_t right_col() const noexcept;
-        // Records the detected equi-key column indices (into each side's input chunk)
-        // and switches algo() to hash. Called by rewrite_hash_joins.
-        void set_equi_columns(std::size_t left, std::size_t right) noexcept;
+        // Equi-key column indices into each side's input chunk, pairwise:
+        // left_cols()[i] = right_cols()[i]. Empty unless algo() == hash.
+        const std::pmr::vector<std::size_t>& left_cols() const noexcept;
+        const std::pmr::vector<std::size_t>& right_cols() const noexcept;
+        // The ON conjuncts that are not equi-keys, AND-ed; nullptr when there are none.
+        // The hash join evaluates it on every key-matched (left, right) pair.
+        const expression_ptr& residual() const noexcept;
+        // Records the detected equi-key column pairs and the residual condition and
+        // switches algo() to hash. Called by rewrite_hash_joins.
+        void set_equi_columns(std::pmr::vector<std::size_t> left,
+                              std::pmr::vector<std::size_t> right,
+                              expression_ptr residual = nullptr);
+        // Output column k is column output_order()[k] of the left-then-right input
+        // layout. Stamped by reorder_joins on the root of a reordered join tree so
+        // the nodes above still see the columns in the order the query wrote the
+        // tables. Empty means the plain left-then-right layout.
+        const std::pmr::vector<std::size_t>& output_order() const noexcept;
+        void set_output_order(std::pmr::vector<std::size_t> order);
 
         const std::string& relname() const noexcept { return relname_; }
         const std::string& dbname() const noexcept { return dbname_; }
@@ -49,8 +62,10 @@ namespace components::logical_plan {
         std::string relname_;
         join_type type_;
         join_algo algo_{join_algo::nested};
-        std::size_t left_col_{0};
-        std::size_t right_col_{0};
+        std::pmr::vector<std::size_t> left_cols_;
+        std::pmr::vector<std::size_t> right_cols_;
+        expression_ptr residual_;
+        std::pmr::vector<std::size_t> output_order_;
 
         hash_t hash_impl() const override;
         std::string to_string_impl() const override;
@@ -246,6 +246,79 @@ namespace components::operators::aggregate {
         }
     }
 
+    void
+    merge_state(builtin_agg agg, types::logical_type col_type, raw_agg_state_t& into, const raw_agg_state_t& from) {
+        if (!from.initialized) {
+            return;
+        }
+        if (!into.initialized) {
+            into = from;
+            return;
+        }
+        into.count += from.count;
+        if (agg == builtin_agg::COUNT) {
+            into.u64 += from.u64;
+            return;
+        }
+        if (agg == builtin_agg::AVG) {
+            into.f64 += from.f64;
+            return;
+        }
+        // SUM / MIN / MAX keep the member update_loop promoted the column to.
+        enum class member
+        {
+            i64,
+            u64,
+            f64
+        };
+        member m = member::i64;
+        switch (col_type) {
+            case types::logical_type::FLOAT:
+            case types::logical_type::DOUBLE:
+                m = member::f64;
+                break;
+            case types::logical_type::UTINYINT:
+            case types::logical_type::USMALLINT:
+            case types::logical_type::UINTEGER:
+            case types::logical_type::UBIGINT:
+                m = member::u64;
+                break;
+            default:
+                break;
+        }
+        switch (agg) {
+            case builtin_agg::SUM:
+                if (m == member::f64) {
+                    into.f64 += from.f64;
+                } else if (m == member::u64) {
+                    into.u64 += from.u64;
+                } else {
+                    into.i64 += from.i64;
+                }
+                break;
+            case builtin_agg::MIN:
+                if (m == member::f64) {
+                    into.f64 = std::min(into.f64, from.f64);
+                } else if (m == member::u64) {
+                    into.u64 = std::min(into.u64, from.u64);
+                } else {
+                    into.i64 = std::min(into.i64, from.i64);
+                }
+                break;
+            case builtin_agg::MAX:
+                if (m == member::f64) {
+                    into.f64 = std::max(into.f64, from.f64);
+                } else if (m == member::u64) {
+                    into.u64 = std::max(into.u64, from.u64);
+                } else {
+                    into.i64 = std::max(into.i64, from.i64);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
     types::logical_value_t finalize_state(std::pmr::memory_resource* resource,
                                           builtin_agg agg,
                                           const raw_agg_state_t& state,
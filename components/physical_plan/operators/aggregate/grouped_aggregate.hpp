@@ -54,6 +54,11 @@ namespace components::operators::aggregate {
                     uint64_t count,
                     std::pmr::vector<raw_agg_state_t>& states);
 
+    // Fold a partial state of the same aggregate (a thread-local or spilled
+    // pre-aggregate) into `into`. `col_type` is the argument column type the
+    // states were updated from; it picks the accumulator member.
+    void merge_state(builtin_agg agg, types::logical_type col_type, raw_agg_state_t& into, const raw_agg_state_t& from);
+
     // Convert finalized state to logical_value_t
     types::logical_value_t finalize_state(std::pmr::memory_resource* resource,
                                           builtin_agg agg,
@@ -0,0 +1,126 @@
+#include "explain.hpp"
+
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace components::operators {
+
+    namespace {
+
+        constexpr const char* column_name = "QUERY PLAN";
+
+        double milliseconds(uint64_t ns) { return static_cast<double>(ns) / 1e6; }
+
+        std::string json_escape(const std::string& text) {
+            std::ostringstream out;
+            for (unsigned char c : text) {
+                switch (c) {
+                    case '"':
+                        out << "\\\"";
+                        break;
+                    case '\\':
+                        out << "\\\\";
+                        break;
+                    case '\n':
+                        out << "\\n";
+                        break;
+                    case '\t':
+                        out << "\\t";
+                        break;
+                    default:
+                        if (c < 0x20) {
+                            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                                << std::dec << std::setfill(' ');
+                        } else {
+                            out << c;
+                        }
+                }
+            }
+            return out.str();
+        }
+
+        void text_metrics(std::ostringstream& out, const operator_profile_t& p) {
+            out << std::fixed << std::setprecision(3) << " (rows in=" << p.rows_in << " out=" << p.rows_out
+                << ", batches in=" << p.batches_in << " out=" << p.batches_out
+                << ", time source=" << milliseconds(p.source_ns) << " push=" << milliseconds(p.push_ns)
+                << " finalize=" << milliseconds(p.finalize_ns) << " await=" << milliseconds(p.await_ns)
+                << " ms, peak memory=" << p.peak_bytes << " bytes";
+            if (p.spill_partitions != 0) {
+                out << ", spill partitions=" << p.spill_partitions;
+            }
+            out << ')';
+        }
+
+        void json_metrics(std::ostringstream& out, const operator_profile_t& p) {
+            out << ",\"rows_in\":" << p.rows_in << ",\"rows_out\":" << p.rows_out << ",\"batches_in\":" << p.batches_in
+                << ",\"batches_out\":" << p.batches_out << ",\"source_ns\":" << p.source_ns
+                << ",\"push_ns\":" << p.push_ns << ",\"finalize_ns\":" << p.finalize_ns
+                << ",\"await_ns\":" << p.await_ns << ",\"peak_bytes\":" << p.peak_bytes
+                << ",\"spill_partitions\":" << p.spill_partitions;
+        }
+
+        void text_rows(const operator_t& op, size_t depth, bool analyze, std::vector<std::string>& rows) {
+            std::ostringstream line;
+            line << std::string(depth * 2, ' ') << "-> " << to_string(op.type());
+            if (analyze) {
+                text_metrics(line, op.profile());
+            }
+            rows.push_back(line.str());
+            if (op.left()) {
+                text_rows(*op.left(), depth + 1, analyze, rows);
+            }
+            if (op.right()) {
+                text_rows(*op.right(), depth + 1, analyze, rows);
+            }
+        }
+
+        void json_node(const operator_t& op, bool analyze, std::ostringstream& out) {
+            out << "{\"operator\":\"" << to_string(op.type()) << '"';
+            if (analyze) {
+                json_metrics(out, op.profile());
+            }
+            out << ",\"children\":[";
+            if (op.left()) {
+                json_node(*op.left(), analyze, out);
+            }
+            if (op.right()) {
+                if (op.left()) {
+                    out << ',';
+                }
+                json_node(*op.right(), analyze, out);
+            }
+            out << "]}";
+        }
+
+    } // namespace
+
+    vector::data_chunk_t render_explain(std::pmr::memory_resource* resource,
+                                        const std::string& logical_plan,
+                                        const operator_t& root,
+                                        bool analyze,
+                                        bool json) {
+        std::vector<std::string> rows;
+        if (json) {
+            std::ostringstream out;
+            out << "{\"logical\":\"" << json_escape(logical_plan) << "\",\"analyze\":" << (analyze ? "true" : "false")
+                << ",\"plan\":";
+            json_node(root, analyze, out);
+            out << '}';
+            rows.push_back(out.str());
+        } else {
+            rows.push_back("logical: " + logical_plan);
+            text_rows(root, 0, analyze, rows);
+        }
+
+        std::pmr::vector<types::complex_logical_type> column_types(resource);
+        column_types.emplace_back(types::logical_type::STRING_LITERAL, column_name);
+        vector::data_chunk_t chunk(resource, column_types, rows.size());
+        chunk.set_cardinality(rows.size());
+        for (size_t i = 0; i < rows.size(); ++i) {
+            chunk.set_value(0, i, types::logical_value_t(resource, std::move(rows[i])));
+        }
+        return chunk;
+    }
+
+} // namespace components::operators
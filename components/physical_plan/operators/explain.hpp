@@ -0,0 +1,23 @@
+#pragma once
+
+#include <components/physical_plan/operators/operator.hpp>
+
+#include <string>
+
+namespace components::operators {
+
+    // EXPLAIN result: one STRING_LITERAL column "QUERY PLAN".
+    //
+    // Text: the optimized logical plan on the first row, then one row per
+    // physical operator, each child indented under its parent (left child,
+    // then right). JSON: a single row holding
+    //   {"logical": "...", "plan": {"operator": "...", "children": [...]}}.
+    //
+    // With `analyze` every operator also reports its operator_profile_t.
+    vector::data_chunk_t render_explain(std::pmr::memory_resource* resource,
+                                        const std::string& logical_plan,
+                                        const operator_t& root,
+                                        bool analyze,
+                                        bool json);
+
+} // namespace components::operators
@@ -0,0 +1,146 @@
+#include "join_hash_table.hpp"
+
+#include <components/vector/vector_buffer.hpp>
+#include <core/hash_mix.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace components::operators::hash_join_detail {
+
+    namespace {
+        constexpr uint64_t min_slot_count = 16;
+
+        inline void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address);
+#else
+            (void) address;
+#endif
+        }
+    } // namespace
+
+    join_hash_table_t::join_hash_table_t(std::pmr::memory_resource* resource)
+        : staged_(resource)
+        , slots_(resource)
+        , groups_(resource)
+        , refs_(resource) {}
+
+    // A bijection, so distinct hashes stay distinct.
+    uint64_t join_hash_table_t::mix(uint64_t hash) noexcept { return core::fmix64(hash); }
+
+    void join_hash_table_t::clear() {
+        staged_.clear();
+        slots_.clear();
+        groups_.clear();
+        refs_.clear();
+        mask_ = 0;
+    }
+
+    uint64_t join_hash_table_t::memory_usage() const noexcept {
+        return staged_.capacity() * sizeof(staged_t) + slots_.capacity() * sizeof(slot_t) +
+               groups_.capacity() * sizeof(group_t) + refs_.capacity() * sizeof(row_ref);
+    }
+
+    void join_hash_table_t::reserve(uint64_t rows) { staged_.reserve(rows); }
+
+    void join_hash_table_t::insert(uint64_t hash, row_ref ref) { staged_.push_back({mix(hash), ref}); }
+
+    void join_hash_table_t::finalize() {
+        slots_.clear();
+        groups_.clear();
+        refs_.clear();
+        mask_ = 0;
+        if (staged_.empty()) {
+            return;
+        }
+        const uint64_t rows = staged_.size();
+        assert(rows < UINT32_MAX && "hash-join build side exceeds the 32-bit chain index");
+        // Slots stay at most two thirds full, so a linear probe run is short.
+        const uint64_t slot_count = std::max(min_slot_count, vector::next_power_of_two(rows + rows / 2));
+        slots_.assign(slot_count, slot_t{0, 0});
+        mask_ = slot_count - 1;
+
+        // Pass 1: one group per distinct hash, counting its rows.
+        std::pmr::vector<uint32_t> group_of(rows, staged_.get_allocator().resource());
+        for (uint64_t i = 0; i < rows; ++i) {
+            const auto& entry = staged_[i];
+            const uint32_t tag = tag_of(entry.hash);
+            uint64_t idx = entry.hash & mask_;
+            while (true) {
+                auto& slot = slots_[idx];
+                if (slot.group == 0) {
+                    groups_.push_back({entry.hash, 0, 1});
+                    slot = {tag, static_cast<uint32_t>(groups_.size())};
+                    group_of[i] = slot.group - 1;
+                    break;
+                }
+                if (slot.tag == tag && groups_[slot.group - 1].hash == entry.hash) {
+                    ++groups_[slot.group - 1].count;
+                    group_of[i] = slot.group - 1;
+                    break;
+                }
+                idx = (idx + 1) & mask_;
+            }
+        }
+
+        // Chains are laid out back to back; count becomes the fill cursor.
+        uint32_t offset = 0;
+        for (auto& group : groups_) {
+            group.begin = offset;
+            offset += group.count;
+            group.count = 0;
+        }
+
+        // Pass 2: scatter the rows into their chains, in insertion order.
+        refs_.resize(rows);
+        for (uint64_t i = 0; i < rows; ++i) {
+            auto& group = groups_[group_of[i]];
+            refs_[group.begin + group.count++] = staged_[i].ref;
+        }
+
+        staged_.clear();
+        staged_.shrink_to_fit();
+    }
+
+    const join_hash_table_t::group_t* join_hash_table_t::find_group(uint64_t mixed) const {
+        const uint32_t tag = tag_of(mixed);
+        uint64_t idx = mixed & mask_;
+        while (true) {
+            const auto& slot = slots_[idx];
+            if (slot.group == 0) {
+                return nullptr;
+            }
+            if (slot.tag == tag && groups_[slot.group - 1].hash == mixed) {
+                return &groups_[slot.group - 1];
+            }
+            idx = (idx + 1) & mask_;
+        }
+    }
+
+    join_hash_table_t::range_t join_hash_table_t::find(uint64_t hash) const {
+        if (slots_.empty()) {
+            return {0, 0};
+        }
+        const auto* group = find_group(mix(hash));
+        return group ? range_t{group->begin, group->count} : range_t{0, 0};
+    }
+
+    void join_hash_table_t::find_batch(const uint64_t* hashes, uint64_t count, std::vector<range_t>& out) const {
+        out.resize(count);
+        if (slots_.empty()) {
+            std::fill(out.begin(), out.end(), range_t{0, 0});
+            return;
+        }
+        std::vector<uint64_t> mixed(count);
+        for (uint64_t i = 0; i < count; ++i) {
+            mixed[i] = mix(hashes[i]);
+            prefetch(&slots_[mixed[i] & mask_]);
+        }
+        for (uint64_t i = 0; i < count; ++i) {
+            const auto* group = find_group(mixed[i]);
+            out[i] = group ? range_t{group->begin, group->count} : range_t{0, 0};
+        }
+    }
+
+} // namespace components::operators::hash_join_detail
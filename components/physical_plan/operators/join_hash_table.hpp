@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace components::operators::hash_join_detail {
+
+    // Identifies one materialized build row by (chunk, row). A small struct
+    // (no std::tuple / std::pair-of-many, R14): the chain entry that a typed
+    // key hash resolves to.
+    struct row_ref {
+        uint32_t chunk_index;
+        uint32_t row_index;
+    };
+
+    // Flat hash+verify index of the hash-join build side.
+    //
+    // Layout (three arrays, no per-row allocation):
+    //  - slots_: open addressing with linear probing. A slot is 8 bytes: the
+    //    upper 32 bits of the key hash as a tag, and the index of its group.
+    //    A probe compares tags in the slot array and only touches a group
+    //    when the tag matches, so most misses never leave the slot array;
+    //  - groups_: one entry per distinct hash, holding the full hash and the
+    //    [begin, begin + count) range of its chain in refs_;
+    //  - refs_: the build rows, duplicates of one hash stored contiguously in
+    //    insertion (scan) order.
+    //
+    // The index is built in two phases: insert() stages (hash, row) pairs,
+    // finalize() counts them per distinct hash and lays the chains out. A hash
+    // equality is not a key equality — callers confirm every chain entry with
+    // a typed key comparison, so a collision only costs a failed verify.
+    //
+    // Hashes are mixed on the way in: data_chunk_t::hash is the identity for
+    // integers, and dense keys would otherwise fill one run of slots.
+    class join_hash_table_t {
+    public:
+        // A chain in refs(); count == 0 when the hash is absent.
+        struct range_t {
+            uint32_t begin;
+            uint32_t count;
+        };
+
+        explicit join_hash_table_t(std::pmr::memory_resource* resource);
+
+        void clear();
+        // Staging capacity for the rows about to be inserted.
+        void reserve(uint64_t rows);
+        void insert(uint64_t hash, row_ref ref);
+        // Lay out slots, groups and chains from the staged rows and release the
+        // staging buffer. Must run before any probe.
+        void finalize();
+
+        range_t find(uint64_t hash) const;
+        // find() for a whole probe vector. The slot of every row is computed and
+        // prefetched first, so the cache misses of one vector overlap instead of
+        // being taken one probe at a time. `out` is resized to `count`.
+        void find_batch(const uint64_t* hashes, uint64_t count, std::vector<range_t>& out) const;
+
+        const row_ref* refs() const noexcept { return refs_.data(); }
+        uint64_t size() const noexcept { return refs_.size(); }
+        bool empty() const noexcept { return refs_.empty(); }
+        // Bytes held by the staging buffer, slots, groups and chains.
+        uint64_t memory_usage() const noexcept;
+
+        // core::fmix64, applied to every hash on the way in. Spill
+        // partitioning uses it too: the top bits of a raw integer hash are
+        // zero for any small key.
+        static uint64_t mix(uint64_t hash) noexcept;
+
+    private:
+        struct slot_t {
+            uint32_t tag;
+            // group index + 1; 0 marks an empty slot
+            uint32_t group;
+        };
+
+        struct group_t {
+            uint64_t hash;
+            uint32_t begin;
+            uint32_t count;
+        };
+
+        struct staged_t {
+            uint64_t hash;
+            row_ref ref;
+        };
+
+        static uint32_t tag_of(uint64_t mixed) noexcept { return static_cast<uint32_t>(mixed >> 32); }
+
+        // The group of an already mixed hash; nullptr when it is absent.
+        const group_t* find_group(uint64_t mixed) const;
+
+        std::pmr::vector<staged_t> staged_;
+        std::pmr::vector<slot_t> slots_;
+        std::pmr::vector<group_t> groups_;
+        std::pmr::vector<row_ref> refs_;
+        uint64_t mask_{0};
+    };
+
+} // namespace components::operators::hash_join_detail
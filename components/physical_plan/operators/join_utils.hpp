@@ -5,6 +5,7 @@
 #include <components/vector/vector_operations.hpp>
 
 #include <algorithm>
+#include <cassert>
 #include <vector>
 
 // Shared building blocks for the join operators. operator_join_t (nested-loop,
@@ -52,6 +53,33 @@ namespace components::operators::join_detail {
         }
     }
 
+    // Permutes a layout from compute_join_layout so that output column k is input
+    // column order[k] (node_join_t::output_order, set by the join-order rule on the
+    // root of a reordered join tree). An empty order keeps the layout as is.
+    inline void apply_output_order(const std::vector<size_t>& order,
+                                   std::pmr::vector<types::complex_logical_type>& res_types,
+                                   std::vector<size_t>& indices_left,
+                                   std::vector<size_t>& indices_right) {
+        if (order.empty()) {
+            return;
+        }
+        assert(order.size() == res_types.size());
+        std::pmr::vector<types::complex_logical_type> permuted(res_types.get_allocator());
+        permuted.reserve(order.size());
+        std::vector<size_t> slot_of(order.size());
+        for (size_t k = 0; k < order.size(); ++k) {
+            permuted.push_back(res_types[order[k]]);
+            slot_of[order[k]] = k;
+        }
+        res_types = std::move(permuted);
+        for (auto& index : indices_left) {
+            index = slot_of[index];
+        }
+        for (auto& index : indices_right) {
+            index = slot_of[index];
+        }
+    }
+
     // Streams join output into a chunks_vector_t where every chunk is
     // ≤ DEFAULT_VECTOR_CAPACITY (1024) rows. Emits rows one at a time via
     // vector_ops::copy and flushes on each full chunk.
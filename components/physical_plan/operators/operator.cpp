@@ -2,6 +2,102 @@
 
 namespace components::operators {
 
+    std::string to_string(operator_type type) {
+        switch (type) {
+            case operator_type::unused:
+                return "unused";
+            case operator_type::empty:
+                return "empty";
+            case operator_type::match:
+                return "match";
+            case operator_type::full_scan:
+                return "full_scan";
+            case operator_type::transfer_scan:
+                return "transfer_scan";
+            case operator_type::index_scan:
+                return "index_scan";
+            case operator_type::insert:
+                return "insert";
+            case operator_type::remove:
+                return "remove";
+            case operator_type::update:
+                return "update";
+            case operator_type::sort:
+                return "sort";
+            case operator_type::select:
+                return "select";
+            case operator_type::join:
+                return "join";
+            case operator_type::hash_join:
+                return "hash_join";
+            case operator_type::aggregate:
+                return "aggregate";
+            case operator_type::raw_data:
+                return "raw_data";
+            case operator_type::union_op:
+                return "union_op";
+            case operator_type::recursive_cte:
+                return "recursive_cte";
+            case operator_type::cte_scan:
+                return "cte_scan";
+            case operator_type::check_constraint:
+                return "check_constraint";
+            case operator_type::fk_check:
+                return "fk_check";
+            case operator_type::fk_cascade:
+                return "fk_cascade";
+            case operator_type::sequence:
+                return "sequence";
+            case operator_type::create_collection:
+                return "create_collection";
+            case operator_type::alter_column_add:
+                return "alter_column_add";
+            case operator_type::alter_column_rename:
+                return "alter_column_rename";
+            case operator_type::alter_column_drop:
+                return "alter_column_drop";
+            case operator_type::dynamic_cascade_delete:
+                return "dynamic_cascade_delete";
+            case operator_type::checkpoint:
+                return "checkpoint";
+            case operator_type::set_timezone:
+                return "set_timezone";
+            case operator_type::vacuum:
+                return "vacuum";
+            case operator_type::analyze:
+                return "analyze";
+            case operator_type::register_udf:
+                return "register_udf";
+            case operator_type::unregister_udf:
+                return "unregister_udf";
+            case operator_type::commit_transaction:
+                return "commit_transaction";
+            case operator_type::abort_transaction:
+                return "abort_transaction";
+            case operator_type::begin_transaction:
+                return "begin_transaction";
+            case operator_type::computed_field_register:
+                return "computed_field_register";
+            case operator_type::computed_field_unregister:
+                return "computed_field_unregister";
+            case operator_type::resolve_table:
+                return "resolve_table";
+            case operator_type::resolve_namespace:
+                return "resolve_namespace";
+            case operator_type::resolve_database:
+                return "resolve_database";
+            case operator_type::resolve_type:
+                return "resolve_type";
+            case operator_type::resolve_constraint:
+                return "resolve_constraint";
+            case operator_type::allocate_oids:
+                return "allocate_oids";
+            case operator_type::batch:
+                return "batch";
+        }
+        return "unknown";
+    }
+
     operator_t::operator_t(std::pmr::memory_resource* resource, log_t log, operator_type type)
         : resource_(resource)
         , log_(std::move(log))
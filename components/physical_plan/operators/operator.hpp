@@ -65,6 +65,9 @@ namespace components::operators {
         // cleanup index versions, rebuild and re-populate indexes per table.
         // Iterates pg_class to discover user tables (no dispatcher state).
         vacuum,
+        // ANALYZE — per-column row/NULL/distinct counts, MCVs and histograms of
+        // user tables, written to pg_statistic.
+        analyze,
         // REGISTER_UDF / UNREGISTER_UDF — operator-pipeline replacements
         // for inline manager_dispatcher_t::{register,unregister}_udf.
         // operator_register_udf_t fans out to per-executor registries, mirrors
@@ -135,6 +138,9 @@ namespace components::operators {
         batch
     };
 
+    // Snake-case name of an operator type, as EXPLAIN prints it.
+    std::string to_string(operator_type type);
+
     inline bool is_scan(operator_type t) {
         return t == operator_type::full_scan || t == operator_type::transfer_scan || t == operator_type::index_scan;
     }
@@ -157,6 +163,27 @@ namespace components::operators {
         sink       // accumulates bounded state in push(), emits in finalize() (hash build, group/agg, sort)
     };
 
+    // What one operator did during an EXPLAIN ANALYZE run. execute_pipeline fills
+    // it only when pipeline::context_t::profile is set; otherwise it stays zero.
+    struct operator_profile_t {
+        uint64_t rows_in{0};
+        uint64_t rows_out{0};
+        uint64_t batches_in{0};
+        uint64_t batches_out{0};
+        // Wall time inside source_next (including its storage round-trip),
+        // push and finalize.
+        uint64_t source_ns{0};
+        uint64_t push_ns{0};
+        uint64_t finalize_ns{0};
+        // Wall time awaiting await_async_and_resume: the cross-actor round-trips
+        // of DML, DDL and catalog operators.
+        uint64_t await_ns{0};
+        // Largest memory_usage() seen, counting the input batch in flight.
+        uint64_t peak_bytes{0};
+        // Spill partitions that received rows; zero when the operator stayed in memory.
+        uint64_t spill_partitions{0};
+    };
+
     class operator_t : public boost::intrusive_ref_counter<operator_t> {
     public:
         using ptr = boost::intrusive_ptr<operator_t>;
@@ -221,6 +248,14 @@ namespace components::operators {
         // EVERY node before each pass. Default no-op.
         virtual void reset_pipeline_state() noexcept {}
 
+        // Bytes of state the operator currently holds across batches (a sort's
+        // buffered input, a hash join's index, a group table). Sampled by the
+        // EXPLAIN ANALYZE profile; streaming operators hold none.
+        [[nodiscard]] virtual uint64_t memory_usage() const noexcept { return 0; }
+
+        operator_profile_t& profile() noexcept { return profile_; }
+        const operator_profile_t& profile() const noexcept { return profile_; }
+
         bool is_executed() const;
         bool is_root() const noexcept;
         void set_as_root() noexcept;
@@ -284,6 +319,7 @@ namespace components::operators {
         bool root{false};
         bool prepared_{false};
         core::error_t error_;
+        operator_profile_t profile_;
     };
 
     class read_only_operator_t : public operator_t {
@@ -0,0 +1,285 @@
+#include "operator_analyze.hpp"
+#include "operator_data.hpp"
+
+#include <components/catalog/catalog_codes.hpp>
+#include <components/catalog/system_table_schemas.hpp>
+#include <components/context/context.hpp>
+#include <components/context/execution_context.hpp>
+#include <components/table/column_analyzer.hpp>
+#include <components/types/logical_value.hpp>
+#include <components/vector/data_chunk.hpp>
+#include <services/disk/manager_disk.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace components::operators {
+
+    namespace catalog = components::catalog;
+
+    namespace {
+
+        // pg_statistic layout: 0=starelid 1=staattnum 2=stanrows 3=stanullcount
+        // 4=stadistinct 5=stasketch 6=stahistogram 7=stamcvals 8=stamccounts.
+        constexpr uint64_t pg_statistic_column_count = 9;
+
+        std::string join_counts(const std::vector<uint64_t>& counts) {
+            std::string out;
+            for (size_t i = 0; i < counts.size(); ++i) {
+                if (i > 0) {
+                    out += ',';
+                }
+                out += std::to_string(counts[i]);
+            }
+            return out;
+        }
+
+    } // namespace
+
+    operator_analyze_t::operator_analyze_t(std::pmr::memory_resource* resource,
+                                           log_t log,
+                                           catalog::oid_t table_oid,
+                                           std::vector<size_t> columns)
+        : read_write_operator_t(resource, std::move(log), operator_type::analyze)
+        , table_oid_(table_oid)
+        , columns_(std::move(columns)) {}
+
+    actor_zeta::unique_future<void> operator_analyze_t::await_async_and_resume(pipeline::context_t* ctx) {
+        // No disk actor: no storage to read and no pg_statistic to write.
+        if (ctx->disk_address == actor_zeta::address_t::empty_address()) {
+            mark_executed();
+            co_return;
+        }
+
+        std::vector<catalog::oid_t> targets;
+        if (table_oid_ != catalog::INVALID_OID) {
+            targets.push_back(table_oid_);
+        } else {
+            auto [_sc, scf] = actor_zeta::send(ctx->disk_address,
+                                               &services::disk::manager_disk_t::storage_scan,
+                                               ctx->session,
+                                               catalog::well_known_oid::pg_class_table,
+                                               std::unique_ptr<components::table::table_filter_t>{},
+                                               /*limit=*/int64_t{-1},
+                                               std::vector<size_t>{},
+                                               ctx->txn);
+            auto scan_r = co_await std::move(scf);
+            if (scan_r.has_error()) {
+                set_error(scan_r.error());
+                mark_failed();
+                co_return;
+            }
+            for (const auto& pg_class_rows : scan_r.value()) {
+                for (uint64_t i = 0; i < pg_class_rows.size(); ++i) {
+                    // pg_class columns: 0=oid, 1=relname, 2=relnamespace, 3=relkind
+                    auto rk_v = pg_class_rows.value(3, i);
+                    const auto rkv = rk_v.is_null() ? std::string_view{"r"} : rk_v.value<std::string_view>();
+                    if (!rkv.empty() && rkv[0] != catalog::relkind::regular) {
+                        continue;
+                    }
+                    auto oid_v = pg_class_rows.value(0, i);
+                    if (oid_v.is_null()) {
+                        continue;
+                    }
+                    const auto oid = static_cast<catalog::oid_t>(oid_v.value<std::uint32_t>());
+                    if (oid == catalog::INVALID_OID || catalog::is_catalog_table(oid)) {
+                        continue;
+                    }
+                    targets.push_back(oid);
+                }
+            }
+        }
+
+        for (const auto oid : targets) {
+            auto err = co_await analyze_table_(ctx, oid);
+            if (err.contains_error()) {
+                set_error(err);
+                mark_failed();
+                co_return;
+            }
+        }
+        mark_executed();
+    }
+
+    actor_zeta::unique_future<core::error_t> operator_analyze_t::analyze_table_(pipeline::context_t* ctx,
+                                                                                 catalog::oid_t table_oid) {
+        auto* res = resource_;
+
+        uint64_t column_count = 0;
+        {
+            auto [_t, tf] = actor_zeta::send(ctx->disk_address,
+                                             &services::disk::manager_disk_t::storage_types,
+                                             ctx->session,
+                                             table_oid);
+            column_count = (co_await std::move(tf)).size();
+        }
+        std::vector<size_t> positions;
+        if (columns_.empty()) {
+            positions.resize(column_count);
+            for (size_t i = 0; i < positions.size(); ++i) {
+                positions[i] = i;
+            }
+        } else {
+            for (auto pos : columns_) {
+                if (pos < column_count) {
+                    positions.push_back(pos);
+                }
+            }
+        }
+
+        std::vector<components::table::column_analyzer_t> analyzers;
+        analyzers.reserve(positions.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            analyzers.emplace_back(res);
+        }
+
+        // Fold the table in one fetch-next reply at a time: only the analyzed
+        // columns are read (projected batches keep storage positions), and a
+        // batch is dropped as soon as the analyzers have seen it.
+        auto fold = [&](vector::data_chunk_t& batch) {
+            if (batch.column_count() < column_count) {
+                return;
+            }
+            for (size_t i = 0; i < positions.size(); ++i) {
+                analyzers[i].update(batch.data[positions[i]], batch.size());
+            }
+        };
+        const std::vector<size_t> projection = columns_.empty() ? std::vector<size_t>{} : positions;
+        uint64_t cursor_id = 0;
+        while (!positions.empty()) {
+            auto [_s, sf] = actor_zeta::send(ctx->disk_address,
+                                             &services::disk::manager_disk_t::storage_fetch_next_batch,
+                                             ctx->session,
+                                             table_oid,
+                                             cursor_id, // 0 == OPEN
+                                             std::unique_ptr<components::table::table_filter_t>{},
+                                             /*limit=*/int64_t{-1},
+                                             projection,
+                                             ctx->txn);
+            auto fetch_r = co_await std::move(sf);
+            if (fetch_r.has_error()) {
+                co_return fetch_r.error();
+            }
+            auto reply = std::move(fetch_r.value());
+            cursor_id = reply.cursor_id;
+            // A cardinality-0 batch means drained; the agent has closed the cursor.
+            if (!reply.batch || reply.batch->size() == 0) {
+                break;
+            }
+            fold(*reply.batch);
+            reply.batch.reset();
+            for (auto& ahead : reply.read_ahead) {
+                fold(ahead);
+            }
+        }
+
+        components::execution_context_t exec_ctx{ctx->session, ctx->txn, ctx->session_tz};
+        constexpr catalog::oid_t kPgStatistic = catalog::well_known_oid::pg_statistic_table;
+
+        // With a column list the other columns keep their statistics: read them
+        // back before the delete and re-append them below.
+        std::pmr::vector<vector::data_chunk_t> kept(res);
+        if (!columns_.empty()) {
+            std::pmr::vector<std::string> keys(res);
+            keys.emplace_back("starelid");
+            std::pmr::vector<types::logical_value_t> values(res);
+            values.emplace_back(res, table_oid);
+            auto [_rk, rkf] = actor_zeta::send(ctx->disk_address,
+                                               &services::disk::manager_disk_t::read_chunks_by_key,
+                                               exec_ctx,
+                                               kPgStatistic,
+                                               std::move(keys),
+                                               make_key_chunk(res, std::move(values)));
+            kept = co_await std::move(rkf);
+        }
+
+        {
+            std::pmr::vector<services::disk::pg_catalog_delete_spec_t> specs(res);
+            specs.push_back({kPgStatistic, std::int64_t{0}, table_oid});
+            auto [_d, df] = actor_zeta::send(ctx->disk_address,
+                                             &services::disk::manager_disk_t::delete_pg_catalog_rows_many,
+                                             exec_ctx,
+                                             std::move(specs));
+            co_await std::move(df);
+            if (ctx->txn.transaction_id != 0) {
+                ctx->pg_catalog_delete_tables.insert(kPgStatistic);
+            }
+        }
+
+        const auto* def = catalog::find_system_table("pg_statistic");
+        if (def == nullptr) {
+            co_return core::error_t::no_error();
+        }
+        std::pmr::vector<types::complex_logical_type> column_types(res);
+        for (const auto& col : def->columns) {
+            column_types.push_back(col.type());
+        }
+
+        std::vector<std::vector<types::logical_value_t>> rows;
+        for (const auto& chunk : kept) {
+            if (chunk.column_count() < pg_statistic_column_count) {
+                continue;
+            }
+            for (uint64_t r = 0; r < chunk.size(); ++r) {
+                auto attnum_v = chunk.value(1, r);
+                if (attnum_v.is_null()) {
+                    continue;
+                }
+                const auto pos = static_cast<size_t>(attnum_v.value<std::int32_t>() - 1);
+                if (std::find(positions.begin(), positions.end(), pos) != positions.end()) {
+                    continue;
+                }
+                std::vector<types::logical_value_t> row;
+                row.reserve(pg_statistic_column_count);
+                for (uint64_t c = 0; c < pg_statistic_column_count; ++c) {
+                    row.push_back(chunk.value(c, r));
+                }
+                rows.push_back(std::move(row));
+            }
+        }
+        for (size_t i = 0; i < analyzers.size(); ++i) {
+            auto result = analyzers[i].finish();
+            std::vector<types::logical_value_t> row;
+            row.reserve(pg_statistic_column_count);
+            row.emplace_back(res, table_oid);
+            row.emplace_back(res, static_cast<std::int32_t>(positions[i] + 1));
+            row.emplace_back(res, static_cast<std::int64_t>(result.row_count));
+            row.emplace_back(res, static_cast<std::int64_t>(result.null_count));
+            row.emplace_back(res, static_cast<std::int64_t>(result.distinct_count));
+            row.emplace_back(res, result.sketch.serialize());
+            row.emplace_back(res, catalog::encode_value_list(result.histogram));
+            // The MCV values and their counts must stay aligned: drop both when
+            // a value cannot be encoded.
+            auto mcvs = catalog::encode_value_list(result.mcv_values);
+            auto counts = mcvs.empty() ? std::string{} : join_counts(result.mcv_counts);
+            row.emplace_back(res, std::move(mcvs));
+            row.emplace_back(res, std::move(counts));
+            rows.push_back(std::move(row));
+        }
+        if (rows.empty()) {
+            co_return core::error_t::no_error();
+        }
+
+        vector::data_chunk_t chunk(res, column_types, rows.size());
+        chunk.set_cardinality(rows.size());
+        for (size_t r = 0; r < rows.size(); ++r) {
+            for (size_t c = 0; c < pg_statistic_column_count; ++c) {
+                chunk.set_value(c, r, std::move(rows[r][c]));
+            }
+        }
+        auto [_a, af] = actor_zeta::send(ctx->disk_address,
+                                         &services::disk::manager_disk_t::append_pg_catalog_row,
+                                         exec_ctx,
+                                         kPgStatistic,
+                                         std::move(chunk));
+        auto rng = co_await std::move(af);
+        if (rng.count > 0) {
+            ctx->pg_catalog_appends.push_back(std::move(rng));
+        }
+        co_return core::error_t::no_error();
+    }
+
+} // namespace components::operators
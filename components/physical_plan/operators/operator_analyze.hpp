@@ -0,0 +1,47 @@
+#pragma once
+
+#include <components/catalog/catalog_oids.hpp>
+#include <components/physical_plan/operators/operator.hpp>
+
+#include <vector>
+
+namespace components::operators {
+
+    // ANALYZE [table [(columns)]].
+    //
+    // Steps (in await_async_and_resume), per target table:
+    //   1. storage_fetch_next_batch(oid) under ctx->txn — the rows the
+    //      statement sees, projected to the analyzed columns.
+    //   2. One components::table::column_analyzer_t per analyzed column, fed
+    //      batch by batch as the cursor advances: row, NULL and distinct counts
+    //      (HyperLogLog), MCVs and an equi-depth histogram from a fixed-size
+    //      reservoir sample. Memory stays at one fetch reply plus the sketches.
+    //   3. Replace the table's pg_statistic rows (delete by starelid, append one
+    //      row per column). With a column list the rows of the other columns
+    //      are carried over. The appends are recorded in ctx->pg_catalog_appends
+    //      so the statement's commit publishes them.
+    //
+    // Without a table every regular table outside pg_catalog (pg_class relkind
+    // 'r') is analyzed.
+    class operator_analyze_t final : public read_write_operator_t {
+    public:
+        // `columns`: storage positions to analyze, empty for all.
+        operator_analyze_t(std::pmr::memory_resource* resource,
+                           log_t log,
+                           catalog::oid_t table_oid,
+                           std::vector<size_t> columns);
+
+        // Sourceless SINK leaf, driven like operator_vacuum_t.
+        [[nodiscard]] bool needs_async_finalize() const noexcept override { return true; }
+
+        actor_zeta::unique_future<void> await_async_and_resume(pipeline::context_t* ctx) override;
+
+    private:
+        // Steps 1-3 for one table.
+        actor_zeta::unique_future<core::error_t> analyze_table_(pipeline::context_t* ctx, catalog::oid_t table_oid);
+
+        catalog::oid_t table_oid_;
+        std::vector<size_t> columns_;
+    };
+
+} // namespace components::operators
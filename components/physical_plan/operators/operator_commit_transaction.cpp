@@ -1,5 +1,6 @@
 #include "operator_commit_transaction.hpp"
 
+#include <components/context/catalog_cache.hpp>
 #include <components/context/context.hpp>
 #include <components/context/execution_context.hpp>
 #include <services/disk/manager_disk.hpp>
@@ -88,6 +89,9 @@ namespace components::operators {
         // value-space remap below, keyed off ACTUAL drops rather than the lower
         // mode flag.
         std::vector<components::catalog::oid_t> dropped_storage_oids;
+        // Captured before the publish block moves swap_appends / swap_deletes out:
+        // a txn that changed pg_catalog invalidates the shared resolve cache.
+        bool catalog_changed = false;
         // Null-sender guard: with no dispatcher to talk to there is no txn to
         // drain — leave commit_id_ = 0 and skip.
         if (ctx->current_message_sender != actor_zeta::address_t::empty_address()) {
@@ -103,6 +107,7 @@ namespace components::operators {
             base_delete_tables = std::move(drain.base_delete_tables);
             dropped_storage_oids = std::move(drain.dropped_storage_oids);
             commit_id_ = drain.commit_id;
+            catalog_changed = !swap_appends.empty() || !swap_deletes.empty();
         }
 
         // Commit back-channel: surface the just-allocated commit_id to the
@@ -319,6 +324,16 @@ namespace components::operators {
         // Routed to the dispatcher (sole txn_manager owner) via txn_publish_msg —
         // the drain handler deliberately left this barrier un-advanced. Returns
         // the compact watermark (visible-to-all commit-id horizon) used below.
+        //
+        // The catalog cache is invalidated just before the barrier: once it
+        // drops the pre-commit entries and takes this commit_id as its version,
+        // only snapshots that see this commit may use it again — and none exist
+        // until the publish below. Invalidating any later would let a fresh
+        // snapshot hit a stale entry; the error paths above return before this
+        // point, so an unpublished commit_id never pins the cache version.
+        if (catalog_changed && commit_id_ > 0 && ctx->catalog_cache) {
+            ctx->catalog_cache->invalidate(commit_id_);
+        }
         uint64_t compact_watermark = 0;
         if (commit_id_ > 0 && ctx->current_message_sender != actor_zeta::address_t::empty_address()) {
             auto [_p, pf] = actor_zeta::send(ctx->current_message_sender,
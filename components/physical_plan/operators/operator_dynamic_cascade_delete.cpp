@@ -52,6 +52,7 @@ namespace components::operators {
                 out.push_back({pg_constraint_table, 4});      // pg_constraint.confrelid
                 out.push_back({pg_depend_table, 1});          // pg_depend.objid
                 out.push_back({pg_depend_table, 3});          // pg_depend.refobjid
+                out.push_back({pg_statistic_table, 0});       // pg_statistic.starelid (ANALYZE)
                 out.push_back({pg_class_table, 0});           // pg_class.oid (last)
             } else if (classid == pg_constraint_table) {
                 out.push_back({pg_constraint_table, 0});
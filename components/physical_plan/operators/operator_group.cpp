@@ -9,7 +9,13 @@
 #include <components/physical_plan/operators/aggregate/operator_func.hpp>
 #include <components/physical_plan/operators/operator_batch.hpp>
 #include <components/vector/vector_operations.hpp>
+#include <core/hash_mix.hpp>
 #include <core/operations_helper.hpp>
+#include <core/worker_pool/worker_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <type_traits>
 
 namespace components::operators {
@@ -21,6 +27,18 @@ namespace components::operators {
             return v.data() == nullptr && v.auxiliary() == nullptr;
         }
 
+        // A single group table is radix-partitioned once it holds this many
+        // groups; below it GROUP BY keeps first-seen group order.
+        constexpr size_t partition_group_threshold = size_t{1} << 14;
+        constexpr uint32_t partition_bits = 5;
+        // Batches buffered per worker before a parallel pre-aggregation round.
+        constexpr uint64_t batches_per_worker = 4;
+
+        // Partition by the top bits of the mixed hash: a raw key hash of small
+        // integers leaves its high bits zero and would route every group to
+        // partition 0.
+        uint64_t partition_of(uint64_t hash, uint32_t bits) { return core::fmix64(hash) >> (64 - bits); }
+
         template<typename T>
         bool cells_equal_typed(const vector::vector_t& a, size_t ra, const vector::vector_t& b, size_t rb) {
             if constexpr (std::is_floating_point_v<T>) {
@@ -238,10 +256,34 @@ namespace components::operators {
         , having_(std::move(having))
         , internal_aggregate_count_(internal_aggregate_count)
         , agg_plan_(resource_)
-        , group_key_chunk_storage_(resource_)
-        , group_hash_index_(resource_)
-        , agg_states_(resource_)
-        , gathered_rows_per_group_(resource_) {}
+        , partitions_(resource_)
+        , pending_(resource_)
+        , gathered_rows_per_group_(resource_) {
+        partitions_.emplace_back(resource_);
+    }
+
+    uint64_t operator_group_t::group_partition_t::memory_usage() const noexcept {
+        uint64_t bytes = 0;
+        for (const auto& chunk : key_chunk) {
+            bytes += chunk.allocation_size();
+        }
+        // Chains hold one group apart from hash collisions; no per-entry walk.
+        bytes += index.bucket_count() * sizeof(void*) +
+                 index.size() * (sizeof(uint64_t) + sizeof(std::pmr::vector<uint32_t>) + sizeof(uint32_t));
+        bytes += hashes.capacity() * sizeof(uint64_t);
+        for (const auto& agg : states) {
+            bytes += agg.capacity() * sizeof(aggregate::raw_agg_state_t);
+        }
+        return bytes;
+    }
+
+    void operator_group_t::group_partition_t::clear() noexcept {
+        key_chunk.clear();
+        index = decltype(index)(index.get_allocator());
+        hashes = decltype(hashes)(hashes.get_allocator());
+        states.clear();
+        group_count = 0;
+    }
 
     void operator_group_t::set_output_types(const std::pmr::vector<types::complex_logical_type>& types) {
         output_types_.assign(types.begin(), types.end());
@@ -391,7 +433,7 @@ namespace components::operators {
         return probe;
     }
 
-    core::error_t operator_group_t::accumulate(pipeline::context_t* pipeline_context, vector::data_chunk_t& input) {
+    core::error_t operator_group_t::prepare_input(pipeline::context_t* pipeline_context, vector::data_chunk_t& input) {
         // Pre-compute arithmetic key columns on this chunk (appended at the tail).
         for (auto& comp : computed_columns_) {
             auto result_vec = evaluate_arithmetic(resource_,
@@ -412,12 +454,56 @@ namespace components::operators {
         }
 
         if (!plan_built_) {
-            auto err = build_plan(input);
-            if (err.contains_error()) {
-                return err;
+            return build_plan(input);
+        }
+        return core::error_t::no_error();
+    }
+
+    uint32_t operator_group_t::find_or_create(group_partition_t& part,
+                                              const vector::data_chunk_t& keys,
+                                              uint64_t row,
+                                              uint64_t hash) {
+        // Lazily create the per-group key chunk from the key column schema.
+        if (part.key_chunk.empty()) {
+            auto key_types = keys.types();
+            key_types.erase(key_types.begin() + static_cast<std::ptrdiff_t>(key_count_), key_types.end());
+            part.key_chunk.emplace_back(resource_, key_types, vector::DEFAULT_VECTOR_CAPACITY);
+        }
+        auto& key_chunk = part.key_chunk.front();
+
+        auto it = part.index.find(hash);
+        if (it != part.index.end()) {
+            for (uint32_t cand : it->second) {
+                bool match = true;
+                for (size_t k = 0; k < key_count_; k++) {
+                    if (!cells_equal_raw(keys.data[k], row, key_chunk.data[k], cand)) {
+                        match = false;
+                        break;
+                    }
+                }
+                if (match) {
+                    return cand;
+                }
             }
         }
 
+        const auto gid = static_cast<uint32_t>(part.group_count);
+        if (part.group_count >= key_chunk.capacity()) {
+            key_chunk.resize(key_chunk.capacity() * 2);
+        }
+        for (size_t k = 0; k < key_count_; k++) {
+            vector::indexing_vector_t idx(resource_, 1);
+            idx.data()[0] = row;
+            vector::vector_ops::copy(keys.data[k], key_chunk.data[k], idx, 1, 0, part.group_count);
+        }
+        part.index[hash].push_back(gid);
+        part.hashes.push_back(hash);
+        part.group_count++;
+        key_chunk.set_cardinality(part.group_count);
+        return gid;
+    }
+
+    void operator_group_t::fold_batch(group_partition_t& part, vector::data_chunk_t& input, const uint64_t* hashes) {
         uint64_t n = input.size();
 
         // Assign each row to a group id (find-or-create). With GROUP BY keys this
@@ -427,80 +513,46 @@ namespace components::operators {
         row_group.assign(n, 0);
 
         if (keys_.empty()) {
-            if (n > 0 && group_count_ == 0) {
-                group_count_ = 1;
+            if (n > 0 && part.group_count == 0) {
+                part.group_count = 1;
             }
         } else {
             auto probe = make_key_probe(input);
-            // Lazily create the per-group key chunk from the probe schema.
-            if (group_key_chunk_storage_.empty()) {
+            // The key chunk exists even before the first group, so an empty input
+            // still types the output key columns.
+            if (part.key_chunk.empty()) {
                 auto key_types = probe.types();
-                group_key_chunk_storage_.emplace_back(resource_, key_types, vector::DEFAULT_VECTOR_CAPACITY);
+                part.key_chunk.emplace_back(resource_, key_types, vector::DEFAULT_VECTOR_CAPACITY);
             }
-            auto& key_chunk = group_key_chunk_storage_.front();
 
-            // Batch-hash all key columns of the probe.
+            // Batch-hash all key columns of the probe, unless the caller did.
             vector::vector_t hash_vec(resource_, types::logical_type::UBIGINT, n > 0 ? n : 1);
-            std::vector<uint64_t> col_ids(keys_.size());
-            for (size_t k = 0; k < keys_.size(); k++) {
-                col_ids[k] = k;
-            }
-            if (n > 0) {
+            if (!hashes && n > 0) {
+                std::vector<uint64_t> col_ids(keys_.size());
+                std::iota(col_ids.begin(), col_ids.end(), uint64_t{0});
                 probe.hash(col_ids, hash_vec);
+                hashes = hash_vec.data<uint64_t>();
             }
-            const auto* hashes = hash_vec.data<uint64_t>();
 
             for (uint64_t row = 0; row < n; row++) {
-                uint64_t h = hashes[row];
-                uint32_t gid = UINT32_MAX;
-                auto it = group_hash_index_.find(h);
-                if (it != group_hash_index_.end()) {
-                    for (uint32_t cand : it->second) {
-                        bool match = true;
-                        for (size_t k = 0; k < keys_.size(); k++) {
-                            if (!cells_equal_raw(probe.data[k], row, key_chunk.data[k], cand)) {
-                                match = false;
-                                break;
-                            }
-                        }
-                        if (match) {
-                            gid = cand;
-                            break;
-                        }
-                    }
-                }
-                if (gid == UINT32_MAX) {
-                    gid = static_cast<uint32_t>(group_count_);
-                    if (group_count_ >= key_chunk.capacity()) {
-                        key_chunk.resize(key_chunk.capacity() * 2);
-                    }
-                    for (size_t k = 0; k < keys_.size(); k++) {
-                        vector::indexing_vector_t idx(resource_, 1);
-                        idx.data()[0] = static_cast<uint64_t>(row);
-                        vector::vector_ops::copy(probe.data[k], key_chunk.data[k], idx, 1, 0, group_count_);
-                    }
-                    group_hash_index_[h].push_back(gid);
-                    group_count_++;
-                    key_chunk.set_cardinality(group_count_);
-                }
-                row_group[row] = gid;
+                row_group[row] = find_or_create(part, probe, row, hashes[row]);
             }
         }
 
         // Grow per-group accumulator storage to cover newly created groups.
-        if (agg_states_.empty() && !need_row_gather_) {
-            agg_states_.resize(values_.size(), std::pmr::vector<aggregate::raw_agg_state_t>(resource_));
+        if (part.states.empty() && !need_row_gather_) {
+            part.states.resize(values_.size(), std::pmr::vector<aggregate::raw_agg_state_t>(resource_));
         }
         for (size_t a = 0; a < values_.size(); a++) {
             if (agg_plan_[a].vectorizable) {
-                if (agg_states_.size() <= a) {
-                    agg_states_.resize(values_.size(), std::pmr::vector<aggregate::raw_agg_state_t>(resource_));
+                if (part.states.size() <= a) {
+                    part.states.resize(values_.size(), std::pmr::vector<aggregate::raw_agg_state_t>(resource_));
                 }
-                agg_states_[a].resize(group_count_);
+                part.states[a].resize(part.group_count);
             }
         }
         if (need_row_gather_) {
-            while (gathered_rows_per_group_.size() < group_count_) {
+            while (gathered_rows_per_group_.size() < part.group_count) {
                 gathered_rows_per_group_.emplace_back();
             }
         }
@@ -512,7 +564,7 @@ namespace components::operators {
                 continue;
             }
             auto& plan = agg_plan_[a];
-            auto& states = agg_states_[a];
+            auto& states = part.states[a];
             if (plan.is_count_star) {
                 for (uint64_t i = 0; i < n; i++) {
                     states[gids[i]].update_count();
@@ -527,17 +579,18 @@ namespace components::operators {
 
         // Non-vectorizable aggregates: gather the contributing rows per group so the
         // general operator_func_t batch path can run once at finalize. Consecutive
-        // rows that share a group are copied in one indexed gather.
+        // rows that share a group are copied in one indexed gather. Such a table is
+        // never partitioned, so `part` is the only partition here.
         if (need_row_gather_ && n > 0) {
             auto in_types = input.types();
             size_t col_count = in_types.size();
             // Stable per-group row lists for this chunk.
             std::pmr::vector<std::pmr::vector<uint64_t>> rows_by_group(resource_);
-            rows_by_group.resize(group_count_, std::pmr::vector<uint64_t>(resource_));
+            rows_by_group.resize(part.group_count, std::pmr::vector<uint64_t>(resource_));
             for (uint64_t r = 0; r < n; r++) {
                 rows_by_group[gids[r]].push_back(r);
             }
-            for (size_t g = 0; g < group_count_; g++) {
+            for (size_t g = 0; g < part.group_count; g++) {
                 auto& rows = rows_by_group[g];
                 if (rows.empty()) {
                     continue;
@@ -559,6 +612,82 @@ namespace components::operators {
                 gathered_rows_per_group_[g].emplace_back(std::move(grp));
             }
         }
+    }
+
+    void operator_group_t::route_batch(partitions_t& parts, vector::data_chunk_t& input) {
+        const uint64_t n = input.size();
+        if (n == 0) {
+            return;
+        }
+        auto probe = make_key_probe(input);
+        vector::vector_t hash_vec(resource_, types::logical_type::UBIGINT, n);
+        std::vector<uint64_t> col_ids(key_count_);
+        std::iota(col_ids.begin(), col_ids.end(), uint64_t{0});
+        probe.hash(col_ids, hash_vec);
+        const auto* h = hash_vec.data<uint64_t>();
+
+        std::vector<std::vector<uint64_t>> rows(parts.size());
+        for (uint64_t i = 0; i < n; i++) {
+            rows[partition_of(h[i], radix_bits_)].push_back(i);
+        }
+        const auto types = input.types();
+        for (size_t p = 0; p < rows.size(); p++) {
+            const uint64_t count = rows[p].size();
+            if (count == 0) {
+                continue;
+            }
+            if (count == n) {
+                fold_batch(parts[p], input, h);
+                continue;
+            }
+            vector::indexing_vector_t indexing(resource_, count);
+            std::vector<uint64_t> piece_hashes(count);
+            for (uint64_t k = 0; k < count; k++) {
+                indexing.set_index(k, rows[p][k]);
+                piece_hashes[k] = h[rows[p][k]];
+            }
+            vector::data_chunk_t piece(resource_, types, count);
+            input.copy(piece, indexing, count);
+            fold_batch(parts[p], piece, piece_hashes.data());
+        }
+    }
+
+    void operator_group_t::merge_groups(partitions_t& parts, const group_partition_t& from) {
+        if (from.group_count == 0) {
+            return;
+        }
+        const auto& keys = from.key_chunk.front();
+        for (uint64_t g = 0; g < from.group_count; g++) {
+            const uint64_t hash = from.hashes[g];
+            auto& into = parts[radix_bits_ == 0 ? 0 : partition_of(hash, radix_bits_)];
+            const uint32_t gid = find_or_create(into, keys, g, hash);
+            if (into.states.size() < values_.size()) {
+                into.states.resize(values_.size(), std::pmr::vector<aggregate::raw_agg_state_t>(resource_));
+            }
+            for (size_t a = 0; a < values_.size(); a++) {
+                if (!agg_plan_[a].vectorizable) {
+                    continue;
+                }
+                auto& states = into.states[a];
+                if (states.size() < into.group_count) {
+                    states.resize(into.group_count);
+                }
+                aggregate::merge_state(agg_plan_[a].kind, agg_plan_[a].col_type, states[gid], from.states[a][g]);
+            }
+        }
+    }
+
+    core::error_t operator_group_t::accumulate(pipeline::context_t* pipeline_context, vector::data_chunk_t& input) {
+        auto error = prepare_input(pipeline_context, input);
+        if (error.contains_error()) {
+            return error;
+        }
+
+        if (radix_bits_ == 0) {
+            fold_batch(partitions_.front(), input, nullptr);
+        } else {
+            route_batch(partitions_, input);
+        }
 
         // Strip the temporary computed-key columns appended above.
         if (!computed_columns_.empty()) {
@@ -568,17 +697,193 @@ namespace components::operators {
         return core::error_t::no_error();
     }
 
-    void operator_group_t::materialize_groups(pipeline::context_t* pipeline_context, chunks_vector_t& out) {
-        size_t num_groups = group_count_;
+    void operator_group_t::maybe_partition(pipeline::context_t* pipeline_context) {
+        // Non-vectorizable aggregates gather rows per group and have no partial
+        // state to merge; a global aggregate has a single group.
+        if (radix_bits_ != 0 || keys_.empty() || need_row_gather_) {
+            return;
+        }
+        const bool large = partitions_.front().group_count >= partition_group_threshold;
+        const bool over_budget = pipeline_context && pipeline_context->memory_budget != 0 &&
+                                 memory_usage() > pipeline_context->memory_budget;
+        if (!large && !over_budget) {
+            return;
+        }
+        group_partition_t single = std::move(partitions_.front());
+        partitions_.clear();
+        for (size_t p = 0; p < (size_t{1} << partition_bits); p++) {
+            partitions_.emplace_back(resource_);
+        }
+        radix_bits_ = partition_bits;
+        merge_groups(partitions_, single);
+    }
+
+    void operator_group_t::aggregate_pending(pipeline::context_t* pipeline_context) {
+        if (pending_.empty()) {
+            return;
+        }
+        const uint64_t workers = std::clamp<uint64_t>(pipeline_context->worker_threads, 1, pending_.size());
+
+        // Phase 1: every worker claims buffered batches and folds them into its
+        // own partitioned table; nothing is shared but the claim counter.
+        std::vector<partitions_t> locals;
+        locals.reserve(workers);
+        for (uint64_t w = 0; w < workers; w++) {
+            auto& local = locals.emplace_back(resource_);
+            for (size_t p = 0; p < partitions_.size(); p++) {
+                local.emplace_back(resource_);
+            }
+        }
+        std::atomic<size_t> next_batch{0};
+        auto& pool = core::worker_pool_t::shared();
+        pool.run(workers, [&](uint64_t w) {
+            for (size_t b = next_batch.fetch_add(1); b < pending_.size(); b = next_batch.fetch_add(1)) {
+                route_batch(locals[w], pending_[b]);
+            }
+        });
+
+        // Phase 2: every worker claims whole partitions and merges the local
+        // tables' share of them; a partition has a single writer.
+        std::atomic<size_t> next_partition{0};
+        pool.run(workers, [&](uint64_t) {
+            for (size_t p = next_partition.fetch_add(1); p < partitions_.size(); p = next_partition.fetch_add(1)) {
+                for (const auto& local : locals) {
+                    merge_groups(partitions_, local[p]);
+                }
+            }
+        });
+        pending_.clear();
+    }
+
+    core::error_t operator_group_t::evict_partitions(pipeline::context_t* pipeline_context) {
+        if (!pipeline_context || pipeline_context->memory_budget == 0 || !spillable_) {
+            return core::error_t::no_error();
+        }
+        uint64_t usage = memory_usage();
+        if (usage <= pipeline_context->memory_budget) {
+            return core::error_t::no_error();
+        }
+
+        // Record layout: key columns, the key hash, then (state bits, count) per
+        // aggregate; the state bits are NULL for a state that saw no value.
+        std::pmr::vector<types::complex_logical_type> record_types(resource_);
+        for (size_t p = 0; p < partitions_.size() && record_types.empty(); p++) {
+            if (!partitions_[p].key_chunk.empty()) {
+                record_types = partitions_[p].key_chunk.front().types();
+            }
+        }
+        if (record_types.empty()) {
+            return core::error_t::no_error();
+        }
+        record_types.emplace_back(types::logical_type::UBIGINT);
+        for (size_t a = 0; a < values_.size(); a++) {
+            record_types.emplace_back(types::logical_type::UBIGINT);
+            record_types.emplace_back(types::logical_type::UBIGINT);
+        }
+
+        std::vector<size_t> order(partitions_.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+            return partitions_[l].memory_usage() > partitions_[r].memory_usage();
+        });
+        for (size_t p : order) {
+            auto& part = partitions_[p];
+            if (usage <= pipeline_context->memory_budget / 2 || part.group_count == 0) {
+                break;
+            }
+            const auto& key_chunk = part.key_chunk.front();
+            for (uint64_t first = 0; first < part.group_count; first += vector::DEFAULT_VECTOR_CAPACITY) {
+                const uint64_t count = std::min<uint64_t>(vector::DEFAULT_VECTOR_CAPACITY, part.group_count - first);
+                vector::data_chunk_t record(resource_, record_types, count);
+                record.set_cardinality(count);
+                for (size_t k = 0; k < key_count_; k++) {
+                    vector::vector_ops::copy(key_chunk.data[k], record.data[k], first + count, first, 0);
+                }
+                std::copy_n(part.hashes.data() + first, count, record.data[key_count_].data<uint64_t>());
+                for (size_t a = 0; a < values_.size(); a++) {
+                    auto& bits = record.data[key_count_ + 1 + 2 * a];
+                    auto& counts = record.data[key_count_ + 2 + 2 * a];
+                    for (uint64_t r = 0; r < count; r++) {
+                        const auto& state = part.states[a][first + r];
+                        bits.data<uint64_t>()[r] = state.u64;
+                        counts.data<uint64_t>()[r] = state.count;
+                        if (!state.initialized) {
+                            bits.validity().set_invalid(r);
+                        }
+                    }
+                }
+                if (!spill_) {
+                    if (!spill::spill_file_t::can_spill(record)) {
+                        spillable_ = false;
+                        return core::error_t::no_error();
+                    }
+                    auto file = spill::spill_file_t::create(resource_, pipeline_context->spill_path);
+                    if (file.has_error()) {
+                        return file.error();
+                    }
+                    spill_ = std::move(file.value());
+                }
+                auto offset = spill_->append(record);
+                if (offset.has_error()) {
+                    return offset.error();
+                }
+                part.spilled.push_back(offset.value());
+            }
+            const uint64_t freed = part.memory_usage();
+            part.clear();
+            usage -= std::min(usage, freed);
+        }
+        return core::error_t::no_error();
+    }
+
+    core::error_t operator_group_t::restore_partition(size_t p) {
+        auto spilled = std::move(partitions_[p].spilled);
+        partitions_[p].spilled.clear();
+        for (uint64_t offset : spilled) {
+            auto record = spill_->read(offset, resource_);
+            if (record.has_error()) {
+                return record.error();
+            }
+            auto& chunk = record.value();
+            const uint64_t count = chunk.size();
+            group_partition_t partial(resource_);
+            partial.group_count = count;
+            partial.hashes.assign(chunk.data[key_count_].data<uint64_t>(),
+                                  chunk.data[key_count_].data<uint64_t>() + count);
+            partial.states.resize(values_.size(), std::pmr::vector<aggregate::raw_agg_state_t>(resource_));
+            for (size_t a = 0; a < values_.size(); a++) {
+                const auto& bits = chunk.data[key_count_ + 1 + 2 * a];
+                const auto& counts = chunk.data[key_count_ + 2 + 2 * a];
+                auto& states = partial.states[a];
+                states.resize(count);
+                for (uint64_t r = 0; r < count; r++) {
+                    if (!bits.is_null(r)) {
+                        states[r].u64 = bits.data<uint64_t>()[r];
+                        states[r].initialized = true;
+                    }
+                    states[r].count = counts.data<uint64_t>()[r];
+                }
+            }
+            // Key cells are the record's leading columns; the rest is never read.
+            partial.key_chunk.emplace_back(std::move(chunk));
+            merge_groups(partitions_, partial);
+        }
+        return core::error_t::no_error();
+    }
+
+    void operator_group_t::materialize_groups(pipeline::context_t* pipeline_context,
+                                              const group_partition_t& part,
+                                              chunks_vector_t& out) {
+        size_t num_groups = part.group_count;
 
         // Output types: key column types (straight off the key chunk — always typed,
         // never NA) + one column per aggregate.
         std::pmr::vector<types::complex_logical_type> out_types(resource_);
         out_types.reserve(key_count_ + values_.size());
         for (size_t k = 0; k < key_count_; k++) {
-            out_types.push_back(group_key_chunk_storage_.empty()
+            out_types.push_back(part.key_chunk.empty()
                                     ? types::complex_logical_type{types::logical_type::NA}
-                                    : group_key_chunk_storage_.front().data[k].type());
+                                    : part.key_chunk.front().data[k].type());
         }
 
         // Finalize aggregates into per-group value columns.
@@ -626,7 +931,7 @@ namespace components::operators {
                     auto val =
                         aggregate::finalize_state(resource_,
                                                   plan.kind,
-                                                  g < agg_states_[a].size() ? agg_states_[a][g]
+                                                  g < part.states[a].size() ? part.states[a][g]
                                                                             : aggregate::raw_agg_state_t{},
                                                   plan.col_type);
                     val.set_alias(std::string(values_[a].name));
@@ -692,8 +997,8 @@ namespace components::operators {
             // Key columns: copy the [emitted, emitted+slice) window of the typed per-group
             // key chunk (the key chunk may legally exceed 1024 — it grows via
             // data_chunk_t::resize, which has no capacity assert).
-            if (slice > 0 && key_count_ > 0 && !group_key_chunk_storage_.empty()) {
-                auto& key_chunk = group_key_chunk_storage_.front();
+            if (slice > 0 && key_count_ > 0 && !part.key_chunk.empty()) {
+                auto& key_chunk = part.key_chunk.front();
                 for (size_t k = 0; k < key_count_; k++) {
                     // 5-arg copy is (source, target, source_count, source_offset, target_offset) and
                     // copies source_count - source_offset elements; to copy the [emitted, emitted+slice)
@@ -1011,7 +1316,45 @@ namespace components::operators {
         if (input.size() > 0) {
             any_input_ = true;
         }
-        return accumulate(ctx, input);
+        if (radix_bits_ != 0 && ctx && ctx->worker_threads > 1) {
+            // Partitioned and parallel: buffer the batch for the next
+            // pre-aggregation round.
+            if (input.size() == 0) {
+                return core::error_t::no_error();
+            }
+            auto error = prepare_input(ctx, input);
+            if (error.contains_error()) {
+                return error;
+            }
+            pending_.push_back(std::move(input));
+            if (pending_.size() < ctx->worker_threads * batches_per_worker) {
+                return core::error_t::no_error();
+            }
+            aggregate_pending(ctx);
+        } else {
+            auto error = accumulate(ctx, input);
+            if (error.contains_error()) {
+                return error;
+            }
+            maybe_partition(ctx);
+        }
+        return radix_bits_ != 0 ? evict_partitions(ctx) : core::error_t::no_error();
+    }
+
+    uint64_t operator_group_t::memory_usage() const noexcept {
+        uint64_t bytes = 0;
+        for (const auto& part : partitions_) {
+            bytes += part.memory_usage();
+        }
+        for (const auto& chunk : pending_) {
+            bytes += chunk.allocation_size();
+        }
+        for (const auto& rows : gathered_rows_per_group_) {
+            for (const auto& chunk : rows) {
+                bytes += chunk.allocation_size();
+            }
+        }
+        return bytes;
     }
 
     core::error_t operator_group_t::finalize(pipeline::context_t* ctx, chunks_vector_t& out) {
@@ -1020,10 +1363,35 @@ namespace components::operators {
             // chunks. materialize_groups now slices internally, so no post-hoc
             // split_chunk_into_batches is needed (it was dead code for the >1024-group
             // crash anyway: the oversized chunk aborted in its ctor before finalize ran).
-            materialize_groups(ctx, out);
-            if (has_error()) {
-                return get_error();
+            if (radix_bits_ == 0) {
+                materialize_groups(ctx, partitions_.front(), out);
+                return has_error() ? get_error() : core::error_t::no_error();
+            }
+            // Partitioned: merge each partition's spilled states back and emit it
+            // before the next one is loaded.
+            aggregate_pending(ctx);
+            if (ctx && ctx->profile) {
+                profile().spill_partitions = static_cast<uint64_t>(
+                    std::count_if(partitions_.begin(), partitions_.end(), [](const group_partition_t& part) {
+                        return !part.spilled.empty();
+                    }));
+            }
+            for (size_t p = 0; p < partitions_.size(); p++) {
+                if (!partitions_[p].spilled.empty()) {
+                    auto error = restore_partition(p);
+                    if (error.contains_error()) {
+                        return error;
+                    }
+                }
+                if (partitions_[p].group_count > 0) {
+                    materialize_groups(ctx, partitions_[p], out);
+                    if (has_error()) {
+                        return get_error();
+                    }
+                }
+                partitions_[p].clear();
             }
+            spill_.reset();
             return core::error_t::no_error();
         }
 
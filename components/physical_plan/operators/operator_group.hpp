@@ -10,6 +10,7 @@
 #include <components/physical_plan/operators/aggregate/operator_aggregate.hpp>
 #include <components/physical_plan/operators/operator.hpp>
 #include <components/physical_plan/operators/operator_data.hpp>
+#include <components/physical_plan/operators/spill/spill_file.hpp>
 
 namespace components::operators {
 
@@ -123,10 +124,24 @@ namespace components::operators {
         // finalize() materializes the accumulated groups into the result chunk(s).
         // State is bounded by the number of GROUPS, not by the input row count, so a
         // 4-table-join + GROUP BY no longer materializes every intermediate row.
+        //
+        // High-cardinality GROUP BY: once the table holds partition_group_threshold
+        // groups (or outgrows ctx->memory_budget) and every aggregate is
+        // vectorizable, the table is radix-partitioned on the top bits of the key
+        // hash. With ctx->worker_threads > 1, pushed batches are then buffered and
+        // pre-aggregated in parallel into thread-local partitioned tables, which
+        // are merged partition by partition across the same workers. Over budget,
+        // the largest partitions are written to a spill file as partial states and
+        // restarted empty; finalize() merges each partition's spilled states back
+        // one partition at a time. Partitioned output is emitted partition by
+        // partition, not in first-seen group order.
         [[nodiscard]] core::error_t
         push(pipeline::context_t* ctx, vector::data_chunk_t&& input, chunks_vector_t& out) override;
         [[nodiscard]] core::error_t finalize(pipeline::context_t* ctx, chunks_vector_t& out) override;
 
+        // Group keys, hash index, accumulators, buffered batches and gathered rows.
+        uint64_t memory_usage() const noexcept override;
+
     private:
         std::pmr::vector<group_key_t> keys_;
         std::pmr::vector<group_value_t> values_;
@@ -144,7 +159,6 @@ namespace components::operators {
         // logical_value_t in the per-row accumulate hot path.
         bool plan_built_ = false;           // first-push lazy init of the agg plan + key chunk
         bool any_input_ = false;            // at least one input batch was pushed
-        size_t group_count_ = 0;            // number of live groups
         size_t key_count_ = 0;              // number of group-key columns
         bool need_row_gather_ = false;      // any non-vectorizable aggregate present
 
@@ -160,16 +174,42 @@ namespace components::operators {
         };
         std::pmr::vector<agg_plan_t> agg_plan_;
 
-        // Candidate key cells, one row per group. Column types come from the first
-        // probe chunk's key columns (stable, never NA), so output key types are read
-        // straight off this chunk — no group_keys_[0][k].type() NA hazard.
-        // Held by pointer because data_chunk_t has no default ctor and its schema is
-        // only known on first push.
-        std::pmr::vector<vector::data_chunk_t> group_key_chunk_storage_; // 0 or 1 element
-        std::pmr::unordered_map<uint64_t, std::pmr::vector<uint32_t>> group_hash_index_;
+        // One radix partition of the group table: the groups whose key hash falls
+        // into it. An unpartitioned table is a single partition.
+        struct group_partition_t {
+            // Candidate key cells, one row per group. Column types come from the first
+            // probe chunk's key columns (stable, never NA), so output key types are read
+            // straight off this chunk — no group_keys_[0][k].type() NA hazard.
+            // Held in a vector because data_chunk_t has no default ctor and its schema
+            // is only known on first push.
+            std::pmr::vector<vector::data_chunk_t> key_chunk; // 0 or 1 element
+            std::pmr::unordered_map<uint64_t, std::pmr::vector<uint32_t>> index;
+            // Key hash of every group, so merging and repartitioning never rehash.
+            std::pmr::vector<uint64_t> hashes;
+            // Vectorizable path: running typed accumulators, [agg_idx][group_id].
+            std::pmr::vector<std::pmr::vector<aggregate::raw_agg_state_t>> states;
+            size_t group_count = 0;
+            // Spill record offsets of the partial states evicted from this partition.
+            std::vector<uint64_t> spilled;
+
+            explicit group_partition_t(std::pmr::memory_resource* r)
+                : key_chunk(r)
+                , index(r)
+                , hashes(r)
+                , states(r) {}
+            uint64_t memory_usage() const noexcept;
+            void clear() noexcept;
+        };
+        using partitions_t = std::pmr::vector<group_partition_t>;
 
-        // Vectorizable path: running typed accumulators, [agg_idx][group_id].
-        std::pmr::vector<std::pmr::vector<aggregate::raw_agg_state_t>> agg_states_;
+        // Always at least one partition; 1 << radix_bits_ of them once partitioned.
+        partitions_t partitions_;
+        uint32_t radix_bits_ = 0;
+        // Buffered batches awaiting a parallel pre-aggregation round, with their
+        // computed-key columns already appended.
+        chunks_vector_t pending_;
+        std::unique_ptr<spill::spill_file_t> spill_;
+        bool spillable_ = true;
 
         // Non-vectorizable path (DISTINCT / custom funcs / non-numeric args): the
         // contributing source rows gathered per group, fused + aggregated once in
@@ -182,6 +222,40 @@ namespace components::operators {
         // appended to `input` for the duration of the call.
         core::error_t accumulate(pipeline::context_t* pipeline_context, vector::data_chunk_t& input);
 
+        // Appends the computed-key columns to `input` and resolves the plan on
+        // the first batch.
+        core::error_t prepare_input(pipeline::context_t* pipeline_context, vector::data_chunk_t& input);
+
+        // Folds `input` into one partition. `hashes` are the key hashes of its
+        // rows when the caller already has them, else nullptr.
+        void fold_batch(group_partition_t& part, vector::data_chunk_t& input, const uint64_t* hashes);
+
+        // Splits `input` by the top radix_bits_ of its key hash and folds every
+        // piece into its partition of `parts`.
+        void route_batch(partitions_t& parts, vector::data_chunk_t& input);
+
+        // Returns the group of `part` whose key cells equal row `row` of key
+        // columns [0, key_count_) of `keys`, creating it when absent.
+        uint32_t find_or_create(group_partition_t& part, const vector::data_chunk_t& keys, uint64_t row, uint64_t hash);
+
+        // Folds every group of `from` into its partition of `parts`, combining
+        // accumulators.
+        void merge_groups(partitions_t& parts, const group_partition_t& from);
+
+        // Radix-partitions the single group table once it is large enough.
+        void maybe_partition(pipeline::context_t* pipeline_context);
+
+        // Pre-aggregates pending_ on ctx->worker_threads threads into
+        // thread-local tables, then merges them partition by partition.
+        void aggregate_pending(pipeline::context_t* pipeline_context);
+
+        // Over budget: writes the largest partitions' partial states to spill_
+        // and restarts them empty, until usage is back under half the budget.
+        core::error_t evict_partitions(pipeline::context_t* pipeline_context);
+
+        // Merges the partial states spilled from partition `p` back into it.
+        core::error_t restore_partition(size_t p);
+
         // First-push lazy setup: resolve the per-aggregate plan + key column schema.
         core::error_t build_plan(const vector::data_chunk_t& probe);
 
@@ -196,7 +270,8 @@ namespace components::operators {
         // post-aggregate arithmetic + HAVING per slice. Slicing here (never building a
         // chunk with capacity > 1024) is what keeps the data_chunk_t ctor invariant for
         // an unbounded number of groups. Errors are reported via set_error()/has_error().
-        void materialize_groups(pipeline::context_t* pipeline_context, chunks_vector_t& out);
+        void
+        materialize_groups(pipeline::context_t* pipeline_context, const group_partition_t& part, chunks_vector_t& out);
 
         // Builds the single-row result for a global aggregate (no GROUP BY keys) over
         // an EMPTY input — e.g. SELECT COUNT(*) FROM empty_table.
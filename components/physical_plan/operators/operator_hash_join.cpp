@@ -2,16 +2,17 @@
 #include "join_utils.hpp"
 
 #include <components/types/types.hpp>
+#include <components/vector/data_chunk_binary.hpp>
 #include <components/vector/vector.hpp>
 #include <core/operations_helper.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <type_traits>
 
 namespace components::operators {
 
     using join_detail::join_builder;
-    using hash_join_detail::right_index_t;
     using hash_join_detail::row_ref;
 
     namespace {
@@ -106,29 +107,99 @@ namespace components::operators {
             std::vector<uint64_t> col_ids(key_cols.begin(), key_cols.end());
             const_cast<vector::data_chunk_t&>(chunk).hash(col_ids, out_hashes);
         }
+
+        // Partitions grow until each holds about half the budget; past 256 of
+        // them the per-partition chunks get too small to be worth a record.
+        constexpr uint32_t max_partition_bits = 8;
+        // What the index of a resident partition costs per build row on top of
+        // the row itself: slots at up to 2/3 load, a group, a chain entry and
+        // the matched flag, with vector growth slack.
+        constexpr uint64_t index_bytes_per_row = 64;
+
+        bool spillable_types(const std::pmr::vector<types::complex_logical_type>& types) {
+            return std::all_of(types.begin(), types.end(), [](const auto& type) {
+                return vector::is_binary_serializable(type);
+            });
+        }
+
+        uint64_t partition_of(uint64_t hash, uint32_t bits) {
+            return hash_join_detail::join_hash_table_t::mix(hash) >> (64 - bits);
+        }
+
+        // Split `chunk` by the top `bits` bits of its mixed key hash and hand each
+        // non-empty piece to sink(partition, piece). Unprojected placeholder
+        // columns come out as all-NULL columns: they are never read by the join,
+        // and a real column is what the spill record format can hold.
+        template<typename Sink>
+        core::error_t partition_chunk(std::pmr::memory_resource* resource,
+                                      const vector::data_chunk_t& chunk,
+                                      const std::pmr::vector<uint64_t>& key_cols,
+                                      uint32_t bits,
+                                      Sink&& sink) {
+            const uint64_t n = chunk.size();
+            if (n == 0) {
+                return core::error_t::no_error();
+            }
+            vector::vector_t hashes(resource, types::logical_type::UBIGINT, n);
+            hash_key_columns(chunk, key_cols, hashes);
+            const auto* h = hashes.data<uint64_t>();
+            std::vector<std::vector<uint64_t>> rows(size_t{1} << bits);
+            for (uint64_t i = 0; i < n; ++i) {
+                rows[partition_of(h[i], bits)].push_back(i);
+            }
+
+            const auto types = chunk.types();
+            for (size_t p = 0; p < rows.size(); ++p) {
+                const uint64_t count = rows[p].size();
+                if (count == 0) {
+                    continue;
+                }
+                vector::indexing_vector_t indexing(resource, count);
+                for (uint64_t k = 0; k < count; ++k) {
+                    indexing.set_index(k, rows[p][k]);
+                }
+                vector::data_chunk_t piece(resource, types, count);
+                chunk.copy(piece, indexing, count);
+                for (size_t c = 0; c < chunk.column_count(); ++c) {
+                    if (!join_detail::is_placeholder(chunk.data[c])) {
+                        continue;
+                    }
+                    piece.data[c].validity().set_all_invalid(count);
+                    if (types[c].to_physical_type() == types::physical_type::STRING) {
+                        std::fill_n(piece.data[c].data<std::string_view>(), count, std::string_view{});
+                    }
+                }
+                auto error = sink(p, std::move(piece));
+                if (error.contains_error()) {
+                    return error;
+                }
+            }
+            return core::error_t::no_error();
+        }
     } // namespace
 
     operator_hash_join_t::operator_hash_join_t(std::pmr::memory_resource* resource,
                                                log_t log,
                                                type join_type,
-                                               size_t left_col,
-                                               size_t right_col)
+                                               const std::pmr::vector<size_t>& left_cols,
+                                               const std::pmr::vector<size_t>& right_cols,
+                                               expressions::expression_ptr residual)
         : read_only_operator_t(resource, std::move(log), operator_type::hash_join)
-        , join_type_(join_type) {
-        // Single-column equi-key today (the optimizer stamps one eq(left,right));
-        // stored as one-element lists so the build/probe path is arity-agnostic.
-        probe_key_cols_.push_back(static_cast<uint64_t>(left_col));
-        build_key_cols_.push_back(static_cast<uint64_t>(right_col));
+        , join_type_(join_type)
+        , residual_expr_(std::move(residual)) {
+        assert(left_cols.size() == right_cols.size());
+        probe_key_cols_.assign(left_cols.begin(), left_cols.end());
+        build_key_cols_.assign(right_cols.begin(), right_cols.end());
     }
 
     void operator_hash_join_t::build_index_() {
         right_index_.clear();
         build_matched_.clear();
         build_chunk_offsets_.clear();
-        if (!right_ || !right_->output()) {
+        if (!build_chunks_) {
             return;
         }
-        const auto& build_chunks = right_->output()->chunks();
+        const auto& build_chunks = *build_chunks_;
 
         const bool track_matched = (join_type_ == type::right || join_type_ == type::full);
 
@@ -157,15 +228,16 @@ namespace components::operators {
                 if (!keys_all_valid(B, build_key_cols_, rj)) {
                     continue;
                 }
-                right_index_.emplace(h[rj], row_ref{static_cast<uint32_t>(ci), static_cast<uint32_t>(rj)});
+                right_index_.insert(h[rj], row_ref{static_cast<uint32_t>(ci), static_cast<uint32_t>(rj)});
             }
         }
+        right_index_.finalize();
     }
 
-    void operator_hash_join_t::probe_batch_(const vector::data_chunk_t& probe, chunks_vector_t& out) {
+    core::error_t operator_hash_join_t::probe_batch_(const vector::data_chunk_t& probe, chunks_vector_t& out) {
         // build_chunks are needed to (a) verify a candidate and (b) copy matched
-        // build rows into the output; both reference the materialized snapshot.
-        const auto& build_chunks = right_->output()->chunks();
+        // build rows into the output; both reference the indexed snapshot.
+        const auto& build_chunks = *build_chunks_;
         const bool left_outer = (join_type_ == type::left || join_type_ == type::full);
         const bool mark_matched = (join_type_ == type::right || join_type_ == type::full);
 
@@ -174,25 +246,37 @@ namespace components::operators {
         const uint64_t n = probe.size();
         if (n == 0) {
             builder.flush();
-            return;
+            return core::error_t::no_error();
         }
 
         vector::vector_t hashes(resource_, types::logical_type::UBIGINT, n);
         hash_key_columns(probe, probe_key_cols_, hashes);
-        const auto* h = hashes.data<uint64_t>();
+        // Resolve the whole vector first: the slot lookups are prefetched together.
+        right_index_.find_batch(hashes.data<uint64_t>(), n, probe_ranges_);
+        const row_ref* refs = right_index_.refs();
 
         for (uint64_t li = 0; li < n; ++li) {
             bool matched = false;
             // A NULL probe key matches nothing (left-outer still emits the row).
-            if (keys_all_valid(probe, probe_key_cols_, li)) {
-                auto range = right_index_.equal_range(h[li]);
-                for (auto it = range.first; it != range.second; ++it) {
-                    const row_ref& ref = it->second;
+            const auto range = probe_ranges_[li];
+            if (range.count != 0 && keys_all_valid(probe, probe_key_cols_, li)) {
+                for (uint32_t k = range.begin; k < range.begin + range.count; ++k) {
+                    const row_ref& ref = refs[k];
                     const auto& B = build_chunks[ref.chunk_index];
                     // Collision-safe: confirm by a typed key comparison.
                     if (!keys_verify(probe, probe_key_cols_, li, B, build_key_cols_, ref.row_index)) {
                         continue;
                     }
+                    if (residual_) {
+                        auto passed = residual_->check(probe, B, li, ref.row_index);
+                        if (passed.has_error()) {
+                            builder.flush();
+                            return passed.error();
+                        }
+                        if (!passed.value()) {
+                            continue;
+                        }
+                    }
                     builder.emit_matched(probe, li, B, ref.row_index);
                     matched = true;
                     if (mark_matched) {
@@ -205,16 +289,17 @@ namespace components::operators {
             }
         }
         builder.flush();
+        return core::error_t::no_error();
     }
 
     void operator_hash_join_t::emit_unmatched_build_(chunks_vector_t& out) {
         if (join_type_ != type::right && join_type_ != type::full) {
             return;
         }
-        if (!right_ || !right_->output()) {
+        if (!build_chunks_) {
             return;
         }
-        const auto& build_chunks = right_->output()->chunks();
+        const auto& build_chunks = *build_chunks_;
         join_builder builder(resource_, res_types_, indices_left_, indices_right_, out);
         for (size_t ci = 0; ci < build_chunks.size(); ++ci) {
             const auto& B = build_chunks[ci];
@@ -230,8 +315,188 @@ namespace components::operators {
         builder.flush();
     }
 
+    uint32_t operator_hash_join_t::choose_partition_bits_(pipeline::context_t* ctx,
+                                                          const vector::data_chunk_t& probe) const {
+        if (!ctx || ctx->memory_budget == 0) {
+            return 0;
+        }
+        uint64_t build_bytes = 0;
+        for (const auto& B : right_->output()->chunks()) {
+            build_bytes += B.allocation_size() + B.size() * index_bytes_per_row;
+        }
+        if (build_bytes <= ctx->memory_budget || !spillable_types(build_types_) || !spillable_types(probe.types())) {
+            return 0;
+        }
+        // Half the budget per resident partition leaves the other half to the
+        // probe batch in flight and the joined output.
+        uint32_t bits = 1;
+        while (bits < max_partition_bits && (build_bytes >> bits) > ctx->memory_budget / 2) {
+            ++bits;
+        }
+        return bits;
+    }
+
+    core::error_t operator_hash_join_t::partition_build_(pipeline::context_t* ctx, uint32_t bits) {
+        auto file = spill::spill_file_t::create(resource_, ctx->spill_path);
+        if (file.has_error()) {
+            return file.error();
+        }
+        spill_ = std::move(file.value());
+        partition_bits_ = bits;
+        build_partitions_.assign(size_t{1} << bits, {});
+
+        auto& build_chunks = right_->output()->chunks();
+        for (const auto& B : build_chunks) {
+            auto error = partition_chunk(resource_,
+                                         B,
+                                         build_key_cols_,
+                                         partition_bits_,
+                                         [&](size_t p, vector::data_chunk_t&& piece) -> core::error_t {
+                                             auto offset = spill_->append(piece);
+                                             if (offset.has_error()) {
+                                                 return offset.error();
+                                             }
+                                             build_partitions_[p].push_back(offset.value());
+                                             return core::error_t::no_error();
+                                         });
+            if (error.contains_error()) {
+                return error;
+            }
+        }
+        if (ctx->profile) {
+            profile().spill_partitions = static_cast<uint64_t>(
+                std::count_if(build_partitions_.begin(), build_partitions_.end(), [](const auto& offsets) {
+                    return !offsets.empty();
+                }));
+        }
+        // The build side now lives in the spill file; drop the materialized copy.
+        build_chunks.clear();
+        drained_build_ = right_->output();
+        return core::error_t::no_error();
+    }
+
+    core::error_t operator_hash_join_t::load_partition_(size_t p) {
+        resident_build_.clear();
+        for (uint64_t offset : build_partitions_[p]) {
+            auto chunk = spill_->read(offset, resource_);
+            if (chunk.has_error()) {
+                return chunk.error();
+            }
+            resident_build_.emplace_back(std::move(chunk.value()));
+        }
+        build_chunks_ = &resident_build_;
+        build_index_();
+        return core::error_t::no_error();
+    }
+
+    core::error_t operator_hash_join_t::prepare_build_(pipeline::context_t* ctx, const vector::data_chunk_t& probe) {
+        // Re-driven over a build output this operator already partitioned: its
+        // chunks are gone, the partitions in spill_ are still valid.
+        const bool reuse = drained_build_ && drained_build_ == right_->output();
+        if (!reuse) {
+            const auto& build_chunks = right_->output()->chunks();
+            // operator_data_t always holds at least one (possibly empty) chunk.
+            assert(!build_chunks.empty());
+            drained_build_.reset();
+            spill_.reset();
+            build_partitions_.clear();
+            partition_bits_ = 0;
+            build_types_ = build_chunks.front().types();
+        }
+
+        res_types_ = std::pmr::vector<types::complex_logical_type>{resource_};
+        join_detail::compute_join_layout(probe,
+                                         vector::data_chunk_t(resource_, build_types_, 0),
+                                         res_types_,
+                                         indices_left_,
+                                         indices_right_);
+        join_detail::apply_output_order(output_order_, res_types_, indices_left_, indices_right_);
+        residual_ = nullptr;
+        if (residual_expr_) {
+            // The residual needs the context's function registry and parameters;
+            // building without it would silently widen the join.
+            if (!ctx) {
+                return core::error_t(core::error_code_t::physical_plan_error,
+                                     std::pmr::string{"hash join: residual predicate needs a pipeline context",
+                                                      resource_});
+            }
+            residual_ = predicates::create_predicate(resource_,
+                                                     ctx->function_registry,
+                                                     residual_expr_,
+                                                     probe.types(),
+                                                     build_types_,
+                                                     &ctx->parameters,
+                                                     ctx->session_tz);
+        }
+
+        if (!reuse) {
+            const uint32_t bits = choose_partition_bits_(ctx, probe);
+            if (bits != 0) {
+                auto error = partition_build_(ctx, bits);
+                if (error.contains_error()) {
+                    return error;
+                }
+            }
+        }
+        if (partition_bits_ == 0) {
+            build_chunks_ = &right_->output()->chunks();
+            build_index_();
+            return core::error_t::no_error();
+        }
+        probe_partitions_.assign(build_partitions_.size(), {});
+        return load_partition_(0);
+    }
+
+    core::error_t operator_hash_join_t::partition_probe_(const vector::data_chunk_t& probe, chunks_vector_t& out) {
+        return partition_chunk(resource_,
+                               probe,
+                               probe_key_cols_,
+                               partition_bits_,
+                               [&](size_t p, vector::data_chunk_t&& piece) -> core::error_t {
+                                   if (p == 0) {
+                                       return probe_batch_(piece, out);
+                                   }
+                                   auto offset = spill_->append(piece);
+                                   if (offset.has_error()) {
+                                       return offset.error();
+                                   }
+                                   probe_partitions_[p].push_back(offset.value());
+                                   return core::error_t::no_error();
+                               });
+    }
+
+    core::error_t operator_hash_join_t::join_spilled_partitions_(pipeline::context_t* ctx, chunks_vector_t& out) {
+        // Partition 0 was probed while the probe side streamed in.
+        emit_unmatched_build_(out);
+        for (size_t p = 1; p < build_partitions_.size(); ++p) {
+            auto error = load_partition_(p);
+            if (error.contains_error()) {
+                return error;
+            }
+            if (ctx && ctx->profile) {
+                // execute_pipeline samples memory around push(); partitions
+                // loaded here would otherwise never reach the peak.
+                profile().peak_bytes = std::max(profile().peak_bytes, memory_usage());
+            }
+            for (uint64_t offset : probe_partitions_[p]) {
+                auto probe = spill_->read(offset, resource_);
+                if (probe.has_error()) {
+                    return probe.error();
+                }
+                auto probe_error = probe_batch_(probe.value(), out);
+                if (probe_error.contains_error()) {
+                    return probe_error;
+                }
+            }
+            emit_unmatched_build_(out);
+        }
+        resident_build_.clear();
+        build_chunks_ = nullptr;
+        return core::error_t::no_error();
+    }
+
     core::error_t
-    operator_hash_join_t::push(pipeline::context_t*, vector::data_chunk_t&& input, chunks_vector_t& out) {
+    operator_hash_join_t::push(pipeline::context_t* ctx, vector::data_chunk_t&& input, chunks_vector_t& out) {
         // The build (right) side is materialized by a separate sub-plan before the
         // first push and always holds at least one (possibly empty) chunk. A truly
         // absent right_ is a degenerate plan: emit nothing (no left layout to
@@ -243,24 +508,28 @@ namespace components::operators {
 
         // Build the index + derive the output layout once, lazily.
         if (!index_built_) {
-            const auto& build_chunks = right_->output()->chunks();
-            // operator_data_t always holds at least one (possibly empty) chunk.
-            assert(!build_chunks.empty());
-            res_types_ = std::pmr::vector<types::complex_logical_type>{resource_};
-            join_detail::compute_join_layout(input,
-                                             build_chunks.front(),
-                                             res_types_,
-                                             indices_left_,
-                                             indices_right_);
-            build_index_();
+            auto error = prepare_build_(ctx, input);
+            if (error.contains_error()) {
+                return error;
+            }
             index_built_ = true;
         }
 
-        probe_batch_(input, out);
-        return core::error_t::no_error();
+        if (partition_bits_ != 0) {
+            return partition_probe_(input, out);
+        }
+        return probe_batch_(input, out);
     }
 
-    core::error_t operator_hash_join_t::finalize(pipeline::context_t*, chunks_vector_t& out) {
+    uint64_t operator_hash_join_t::memory_usage() const noexcept {
+        uint64_t bytes = right_index_.memory_usage() + build_matched_.capacity();
+        for (const auto& chunk : resident_build_) {
+            bytes += chunk.allocation_size();
+        }
+        return bytes;
+    }
+
+    core::error_t operator_hash_join_t::finalize(pipeline::context_t* ctx, chunks_vector_t& out) {
         // Right/full: drain build rows that no probe row matched, NULL-padded on the
         // left side. Other join types finalize to a no-op.
         //
@@ -272,12 +541,18 @@ namespace components::operators {
         // The common 0-row-probe case still pushes a schema'd batch, so res_types_
         // is set there and this branch is not taken.
         if (!index_built_) {
+            if (right_ && right_->output()) {
+                build_chunks_ = &right_->output()->chunks();
+            }
             build_index_();
             index_built_ = true;
         }
         if (res_types_.empty()) {
             return core::error_t::no_error();
         }
+        if (partition_bits_ != 0) {
+            return join_spilled_partitions_(ctx, out);
+        }
         emit_unmatched_build_(out);
         return core::error_t::no_error();
     }
@@ -1,52 +1,52 @@
 #pragma once
 
 #include <components/logical_plan/node_join.hpp>
+#include <components/physical_plan/operators/join_hash_table.hpp>
 #include <components/physical_plan/operators/operator.hpp>
 #include <components/physical_plan/operators/operator_data.hpp>
+#include <components/physical_plan/operators/predicates/predicate.hpp>
+#include <components/physical_plan/operators/spill/spill_file.hpp>
 #include <components/vector/data_chunk.hpp>
 
 #include <cstdint>
-#include <unordered_map>
+#include <memory>
+#include <vector>
 
 namespace components::operators {
 
-    namespace hash_join_detail {
-        // Identifies one materialized build row by (chunk, row). A small struct
-        // (no std::tuple / std::pair-of-many, R14): the multimap payload that the
-        // typed hash key resolves to.
-        struct row_ref {
-            uint32_t chunk_index;
-            uint32_t row_index;
-        };
-
-        // Alt-3 hash+verify index: bucket on a uint64 hash of the join-key cells
-        // (typed per physical_type via data_chunk_t::hash) and resolve to the build
-        // rows that hashed there. A *multimap* because equi-join keys need not be
-        // unique on the build side, and because distinct keys may collide on the
-        // hash — the probe always CONFIRMS by a typed cell-by-cell comparison, so a
-        // collision only costs an extra failed verify, never a wrong row.
-        using right_index_t = std::pmr::unordered_multimap<uint64_t, row_ref>;
-    } // namespace hash_join_detail
-
-    // Equi-join fast path: substituted for operator_join_t only when the ON
-    // condition is a single eq(left.key, right.key); the matching columns
-    // (`left_col`/`right_col`, into the respective input chunks) are detected at
-    // plan time and passed in.
+    // Equi-join fast path: substituted for operator_join_t when the ON condition
+    // has at least one eq(left.key, right.key) conjunct. The matching columns
+    // (`left_cols`/`right_cols`, pairwise, into the respective input chunks) form
+    // the hash key and are detected at plan time; the remaining conjuncts arrive
+    // as `residual` and are checked on every key-matched pair. A pair that fails
+    // the residual is not a match, so outer joins still pad those rows.
     //
     // Builds a hash table over the right (build) side once and probes it with the
     // left (probe) side, turning the nested-loop O(L·R) join into O(L + R). Output
     // layout, NULL padding and chunk-streaming match operator_join_t exactly
     // (shared join_detail helpers), so results are identical to the nested-loop path.
     //
-    // The index is HASH+VERIFY and TYPED: the bucket key is a uint64 hash of the
-    // key cells (per physical_type), the payload is a build-row ref, and every
-    // probe match is confirmed by a typed cell-by-cell comparison — no
+    // The index is HASH+VERIFY and TYPED: a flat join_hash_table_t keyed by a
+    // uint64 hash of the key cells (per physical_type) resolves to a contiguous
+    // chain of build-row refs, and every probe match is confirmed by a typed
+    // cell-by-cell comparison — no
     // logical_value_t on the build or probe hot path. ONE uniform build+probe path
     // serves single- AND multi-column keys (the key column list is iterated) and
-    // ALL hash-join types (inner / left / right / full).
+    // ALL hash-join types (inner / left / right / full). Only the residual, when
+    // present, goes through a row predicate, and only for key-matched pairs.
     //
     // Only inner / left / right / full are ever substituted (cross is not an
     // equi-join); any other join_type is treated as a no-op.
+    //
+    // Grace / hybrid mode: when the materialized build side exceeds
+    // ctx->memory_budget, the first push radix-partitions it on the top bits of
+    // the key hash, writes every partition to a spill file and releases the
+    // materialized chunks. Partition 0 is loaded back and probed as batches
+    // stream in; probe rows of the other partitions are spilled alongside.
+    // finalize() then joins the remaining partitions one at a time, so only one
+    // build partition and its index are resident at once. A partition is
+    // joined exactly like the whole build side in the in-memory mode, so
+    // results match it (row order aside).
     class operator_hash_join_t final : public read_only_operator_t {
     public:
         using type = logical_plan::join_type;
@@ -54,8 +54,9 @@ namespace components::operators {
         operator_hash_join_t(std::pmr::memory_resource* resource,
                              log_t log,
                              type join_type,
-                             size_t left_col,
-                             size_t right_col);
+                             const std::pmr::vector<size_t>& left_cols,
+                             const std::pmr::vector<size_t>& right_cols,
+                             expressions::expression_ptr residual = nullptr);
 
         // The join is a SINK on its build side (it must fully retain the right
         // input before any match can be decided) and STREAMING on its probe side
@@ -70,33 +71,68 @@ namespace components::operators {
 
         [[nodiscard]] core::error_t finalize(pipeline::context_t* ctx, chunks_vector_t& out) override;
 
+        // Output column permutation of the logical join (node_join_t::output_order);
+        // applied to the layout when it is built. Empty: left columns, then right.
+        void set_output_order(const std::pmr::vector<size_t>& order) {
+            output_order_.assign(order.begin(), order.end());
+        }
+
+        // Runtime join filters (push_runtime_filters): only inner and right joins
+        // drop probe rows without a key match, and a build side already released
+        // to the spill file has nothing left to summarize.
+        bool filters_probe_side() const noexcept {
+            return (join_type_ == type::inner || join_type_ == type::right) && right_ && right_->output() &&
+                   drained_build_ != right_->output();
+        }
+        const std::pmr::vector<uint64_t>& probe_key_cols() const noexcept { return probe_key_cols_; }
+        const std::pmr::vector<uint64_t>& build_key_cols() const noexcept { return build_key_cols_; }
+
+        // The index, the matched markers and a loaded build partition; the
+        // build side itself is accounted to the sub-plan that produced it.
+        uint64_t memory_usage() const noexcept override;
+
         // Drop the lazily-built index + derived layout so a re-driven sub-plan (the
         // recursive-CTE recursive term, re-run per fixpoint iteration over a repointed
         // working set) rebuilds the hash table from the NEW build side instead of reusing
         // the stale one. reset_for_reuse() clears state_/output_ but not this build state.
+        //
+        // A partitioned build side stays on disk: its materialized chunks were
+        // released, so a re-drive over the same build output reloads the spilled
+        // partitions instead (see drained_build_).
         void reset_pipeline_state() noexcept override {
             index_built_ = false;
             right_index_.clear();
+            probe_ranges_.clear();
+            residual_ = nullptr;
             res_types_.clear();
             build_matched_.clear();
             build_chunk_offsets_.clear();
             indices_left_.clear();
             indices_right_.clear();
+            build_chunks_ = nullptr;
+            resident_build_.clear();
+            probe_partitions_.clear();
         }
 
     private:
         type join_type_;
         // Equi-key column indices into the left (probe) / right (build) input
-        // chunks. Stored as one-element lists so the build/probe machinery iterates
-        // a key column list uniformly for single- and (future) multi-column keys.
+        // chunks, pairwise. The build/probe machinery iterates the key column list
+        // uniformly for single- and multi-column keys.
         std::pmr::vector<uint64_t> probe_key_cols_{resource_};
         std::pmr::vector<uint64_t> build_key_cols_{resource_};
+        // Non-key ON conjuncts; its predicate is built with the output layout.
+        expressions::expression_ptr residual_expr_;
+        predicates::predicate_ptr residual_{nullptr};
         std::vector<size_t> indices_left_;
         std::vector<size_t> indices_right_;
+        std::vector<size_t> output_order_;
 
         // --- Build/probe state (shared by push) ---
         bool index_built_{false};
-        hash_join_detail::right_index_t right_index_{resource_};
+        hash_join_detail::join_hash_table_t right_index_{resource_};
+        // Per-probe-row chains of the batch being probed; reused across batches.
+        std::vector<hash_join_detail::join_hash_table_t::range_t> probe_ranges_;
         std::pmr::vector<types::complex_logical_type> res_types_{resource_};
         // RIGHT/FULL only: a flat "matched" marker (one byte per build row) over all
         // build chunks, with per-chunk start offsets so a row_ref{chunk,row} maps to
@@ -105,14 +141,46 @@ namespace components::operators {
         // marker branch-free. Unmatched build rows are NULL-padded at finalize().
         std::pmr::vector<uint8_t> build_matched_{resource_};
         std::pmr::vector<uint64_t> build_chunk_offsets_{resource_};
+        // The build chunks the index covers: right_->output()'s chunks, or
+        // resident_build_ when the build side is partitioned.
+        const chunks_vector_t* build_chunks_{nullptr};
+
+        // --- Grace partitioning state (partition_bits_ == 0: in-memory join) ---
+        uint32_t partition_bits_{0};
+        std::unique_ptr<spill::spill_file_t> spill_;
+        // Spill record offsets of each partition's build / probe chunks.
+        std::vector<std::vector<uint64_t>> build_partitions_;
+        std::vector<std::vector<uint64_t>> probe_partitions_;
+        // The build partition currently joined, loaded from spill_.
+        chunks_vector_t resident_build_{resource_};
+        std::pmr::vector<types::complex_logical_type> build_types_{resource_};
+        // The build output whose chunks were partitioned and released. Holding
+        // the reference keeps the identity check in prepare_build_ sound.
+        operator_data_ptr drained_build_{nullptr};
+
+        // Derive the output layout from the first probe batch, partition the
+        // build side if it is over budget, and build the first index.
+        [[nodiscard]] core::error_t prepare_build_(pipeline::context_t* ctx, const vector::data_chunk_t& probe);
+        // Number of radix bits to partition the build side on; 0 keeps it in memory.
+        uint32_t choose_partition_bits_(pipeline::context_t* ctx, const vector::data_chunk_t& probe) const;
+        // Spill the materialized build side partition by partition and release it.
+        [[nodiscard]] core::error_t partition_build_(pipeline::context_t* ctx, uint32_t bits);
+        // Load build partition `p` into resident_build_ and index it.
+        [[nodiscard]] core::error_t load_partition_(size_t p);
+        // Probe one batch in partitioned mode: partition 0 rows are probed now,
+        // the rest are spilled for finalize().
+        [[nodiscard]] core::error_t partition_probe_(const vector::data_chunk_t& probe, chunks_vector_t& out);
+        // Join the spilled partitions 1..N after the probe side is drained.
+        [[nodiscard]] core::error_t join_spilled_partitions_(pipeline::context_t* ctx, chunks_vector_t& out);
 
-        // Build the hash+verify index over the materialized build (right) chunks.
-        // NULL build keys are skipped — they never join under SQL equi-join
-        // semantics. Also (re)sizes build_matched_ for right/full.
+        // Build the hash+verify index over build_chunks_. NULL build keys are
+        // skipped — they never join under SQL equi-join semantics. Also
+        // (re)sizes build_matched_ for right/full.
         void build_index_();
         // Probe one left batch against the index and emit per join_type_ via the
-        // shared join_builder. Marks matched build rows for right/full.
-        void probe_batch_(const vector::data_chunk_t& probe, chunks_vector_t& out);
+        // shared join_builder. Marks matched build rows for right/full. Fails only
+        // when the residual predicate does.
+        [[nodiscard]] core::error_t probe_batch_(const vector::data_chunk_t& probe, chunks_vector_t& out);
         // Emit unmatched build rows (right/full) NULL-padded on the left side.
         void emit_unmatched_build_(chunks_vector_t& out);
     };
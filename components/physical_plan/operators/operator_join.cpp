@@ -30,6 +30,7 @@ namespace components::operators {
                                          res_types_,
                                          indices_left_,
                                          indices_right_);
+        join_detail::apply_output_order(output_order_, res_types_, indices_left_, indices_right_);
 
         predicate_ = expression_ ? predicates::create_predicate(resource_,
                                                                 context->function_registry,
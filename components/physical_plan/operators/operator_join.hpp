@@ -45,6 +45,12 @@ namespace components::operators {
 
         [[nodiscard]] core::error_t finalize(pipeline::context_t* ctx, chunks_vector_t& out) override;
 
+        // Output column permutation of the logical join (node_join_t::output_order);
+        // applied to the layout when it is built. Empty: left columns, then right.
+        void set_output_order(const std::pmr::vector<size_t>& order) {
+            output_order_.assign(order.begin(), order.end());
+        }
+
         // Drop the lazily-built layout/predicate + matched marker so a re-driven sub-plan
         // (recursive-CTE recursive term, re-run per fixpoint iteration over a repointed
         // working set) rebuilds from the NEW build side. reset_for_reuse() clears
@@ -64,6 +70,7 @@ namespace components::operators {
         expressions::expression_ptr expression_;
         std::vector<size_t> indices_left_;
         std::vector<size_t> indices_right_;
+        std::vector<size_t> output_order_;
 
         // --- Build/probe state ---
         bool layout_built_{false};
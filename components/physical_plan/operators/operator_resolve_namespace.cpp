@@ -3,6 +3,7 @@
 #include "catalog_write_helpers.hpp"
 
 #include <components/catalog/catalog_oids.hpp>
+#include <components/context/catalog_cache.hpp>
 #include <components/context/context.hpp>
 #include <components/logical_plan/node_catalog_resolve.hpp>
 #include <components/types/logical_value.hpp>
@@ -66,6 +67,21 @@ namespace components::operators {
             co_return;
         }
 
+        // Shared catalog cache: a hit skips the pg_namespace scan entirely.
+        auto* cache = ctx->use_catalog_cache ? ctx->catalog_cache : nullptr;
+        if (cache) {
+            if (auto cached = cache->find_namespace(ctx->txn, name_)) {
+                out_chunk.set_cardinality(1);
+                set_uint32(out_chunk, 0, 0, static_cast<std::uint32_t>(*cached));
+                if (target_node_) {
+                    target_node_->set_namespace_oid(*cached);
+                }
+                set_output(make_operator_data(resource_, std::move(out_chunk)));
+                mark_executed();
+                co_return;
+            }
+        }
+
         components::execution_context_t exec_ctx{ctx->session, ctx->txn, {}};
 
         // pg_namespace schema: [oid (uint32), nspname (string)].
@@ -100,6 +116,9 @@ namespace components::operators {
                 if (target_node_) {
                     target_node_->set_namespace_oid(oid_val);
                 }
+                if (cache) {
+                    cache->store_namespace(ctx->txn, name_, oid_val);
+                }
                 resolved = true;
             }
         }
@@ -5,6 +5,7 @@
 #include <components/catalog/catalog_codes.hpp>
 #include <components/catalog/catalog_oids.hpp>
 #include <components/catalog/system_table_schemas.hpp>
+#include <components/context/catalog_cache.hpp>
 #include <components/context/context.hpp>
 #include <components/logical_plan/node_catalog_resolve.hpp>
 #include <components/types/logical_value.hpp>
@@ -38,6 +39,25 @@ namespace components::operators {
             out_types.emplace_back(types::logical_type::UINTEGER);       // atttypid
             out_types.emplace_back(types::logical_type::STRING_LITERAL); // atttypspec
         }
+
+        // Position is a synthetic 1-based ordinal (matches
+        // manager_disk_resolve.cpp's synthetic attnum for relkind='g').
+        void fill_output(vector::data_chunk_t& out_chunk,
+                         const std::vector<components::logical_plan::resolved_column_metadata_t>& columns,
+                         std::pmr::memory_resource* resource) {
+            for (std::size_t i = 0; i < columns.size(); ++i) {
+                const auto& c = columns[i];
+                // Direct typed writes — schema is INTEGER, UINTEGER, STRING,
+                // UINTEGER, STRING; sources are already in the matching C++ types
+                // on the column metadata, so no variant detour needed.
+                set_int32(out_chunk, 0, i, static_cast<std::int32_t>(i + 1));
+                set_uint32(out_chunk, 1, i, static_cast<std::uint32_t>(c.attoid));
+                set_str(out_chunk, 2, i, std::string_view{c.attname}, resource);
+                set_uint32(out_chunk, 3, i, static_cast<std::uint32_t>(c.atttypid));
+                set_str(out_chunk, 4, i, std::string_view{c.atttypspec}, resource);
+            }
+            out_chunk.set_cardinality(columns.size());
+        }
     } // namespace
 
     operator_resolve_table_t::operator_resolve_table_t(std::pmr::memory_resource* resource,
@@ -95,6 +115,30 @@ namespace components::operators {
             co_return;
         }
 
+        // Shared catalog cache, name form only. Computed tables ('g') are never
+        // cached: their storage positions move with DML, not only with DDL.
+        const bool cacheable =
+            table_oid_ == catalog::INVALID_OID && input_namespace_oid_ != catalog::INVALID_OID && !relname_.empty();
+        auto* cache = ctx->use_catalog_cache && cacheable ? ctx->catalog_cache : nullptr;
+        if (cache) {
+            if (auto cached = cache->find_table(ctx->txn, input_namespace_oid_, relname_)) {
+                found_ = true;
+                table_oid_ = cached->table_oid;
+                namespace_oid_ = cached->namespace_oid;
+                relkind_ = cached->relkind;
+                const uint64_t capacity = std::max<uint64_t>(cached->columns.size(), vector::DEFAULT_VECTOR_CAPACITY);
+                output_ = make_operator_data(resource_, output_schema_, capacity);
+                fill_output(output_->chunks().front(), cached->columns, resource_);
+                if (target_node_) {
+                    target_node_->set_namespace_oid(namespace_oid_);
+                    target_node_->set_table_oid(table_oid_);
+                    target_node_->set_resolved_metadata(std::move(*cached));
+                }
+                mark_executed();
+                co_return;
+            }
+        }
+
         // (name-form only): when only (namespace_oid, relname) is known,
         // first resolve table_oid via pg_class scan by (relname, relnamespace).
         // If relname_ is empty we cannot resolve — emit empty output.
@@ -444,61 +488,50 @@ namespace components::operators {
             });
         }
 
-        // Stamp full resolved_table_metadata_t on the logical resolve node
-        // so enrich/validate can read the columns + not-null / default flags
-        // from the plan tree. Built from the same `rows` we use for the
-        // operator output chunk; decoded type derived from atttypspec or
-        // atttypid via the existing catalog helpers.
-        if (target_node_) {
-            components::logical_plan::resolved_table_metadata_t md;
-            md.table_oid = table_oid_;
-            md.namespace_oid = namespace_oid_;
-            md.relkind = relkind_;
-            md.name = relname_;
-            md.view_sql = std::move(view_sql);
-            md.columns.reserve(rows.size());
-            for (const auto& r : rows) {
-                components::logical_plan::resolved_column_metadata_t cm;
-                cm.attname = r.attname;
-                cm.attnum = r.attnum;
-                cm.chunk_position = r.chunk_position;
-                cm.attoid = r.attoid;
-                cm.atttypid = r.atttypid;
-                cm.attnotnull = r.attnotnull;
-                cm.atthasdefault = r.atthasdefault;
-                cm.attdefspec = r.attdefspec;
-                cm.atttypspec = r.atttypspec;
-                if (!r.atttypspec.empty()) {
-                    cm.type = catalog::decode_type_spec(resource_, r.atttypspec);
-                } else if (r.atttypid != catalog::INVALID_OID) {
-                    cm.type = types::complex_logical_type(catalog::oid_to_builtin_type(r.atttypid));
-                }
-                if (!cm.attname.empty() && !cm.type.has_alias()) {
-                    cm.type.set_alias(cm.attname);
-                }
-                md.columns.push_back(std::move(cm));
+        // Full resolved_table_metadata_t, built from `rows`: stamped on the
+        // logical resolve node so enrich/validate can read the columns +
+        // not-null / default flags from the plan tree, stored in the catalog
+        // cache, and rendered into the operator output chunk. Decoded type
+        // derived from atttypspec or atttypid via the existing catalog helpers.
+        components::logical_plan::resolved_table_metadata_t md;
+        md.table_oid = table_oid_;
+        md.namespace_oid = namespace_oid_;
+        md.relkind = relkind_;
+        md.name = relname_;
+        md.view_sql = std::move(view_sql);
+        md.columns.reserve(rows.size());
+        for (auto& r : rows) {
+            components::logical_plan::resolved_column_metadata_t cm;
+            cm.attname = std::move(r.attname);
+            cm.attnum = r.attnum;
+            cm.chunk_position = r.chunk_position;
+            cm.attoid = r.attoid;
+            cm.atttypid = r.atttypid;
+            cm.attnotnull = r.attnotnull;
+            cm.atthasdefault = r.atthasdefault;
+            cm.attdefspec = std::move(r.attdefspec);
+            cm.atttypspec = std::move(r.atttypspec);
+            if (!cm.atttypspec.empty()) {
+                cm.type = catalog::decode_type_spec(resource_, cm.atttypspec);
+            } else if (cm.atttypid != catalog::INVALID_OID) {
+                cm.type = types::complex_logical_type(catalog::oid_to_builtin_type(cm.atttypid));
             }
-            target_node_->set_resolved_metadata(std::move(md));
+            if (!cm.attname.empty() && !cm.type.has_alias()) {
+                cm.type.set_alias(cm.attname);
+            }
+            md.columns.push_back(std::move(cm));
         }
 
-        // Position is a synthetic 1-based ordinal (matches
-        // manager_disk_resolve.cpp's synthetic attnum for relkind='g').
-        const auto row_count = rows.size();
-        const uint64_t capacity = std::max<uint64_t>(row_count, vector::DEFAULT_VECTOR_CAPACITY);
+        const uint64_t capacity = std::max<uint64_t>(md.columns.size(), vector::DEFAULT_VECTOR_CAPACITY);
         output_ = make_operator_data(resource_, output_schema_, capacity);
-        auto& out_chunk = output_->chunks().front();
-        for (std::size_t i = 0; i < row_count; ++i) {
-            const auto& r = rows[i];
-            // Direct typed writes — schema is INTEGER, UINTEGER, STRING,
-            // UINTEGER, STRING; sources are already in the matching C++ types
-            // on the out_row_t struct, so no variant detour needed.
-            set_int32(out_chunk, 0, i, static_cast<std::int32_t>(i + 1));
-            set_uint32(out_chunk, 1, i, static_cast<std::uint32_t>(r.attoid));
-            set_str(out_chunk, 2, i, std::string_view{r.attname}, resource_);
-            set_uint32(out_chunk, 3, i, static_cast<std::uint32_t>(r.atttypid));
-            set_str(out_chunk, 4, i, std::string_view{r.atttypspec}, resource_);
+        fill_output(output_->chunks().front(), md.columns, resource_);
+
+        if (cache && relkind_ != catalog::relkind::computed) {
+            cache->store_table(ctx->txn, input_namespace_oid_, relname_, md);
+        }
+        if (target_node_) {
+            target_node_->set_resolved_metadata(std::move(md));
         }
-        out_chunk.set_cardinality(row_count);
 
         mark_executed();
     }
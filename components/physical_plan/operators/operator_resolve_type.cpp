@@ -5,6 +5,7 @@
 #include <components/catalog/catalog_codes.hpp>
 #include <components/catalog/helpers.hpp>
 #include <components/catalog/system_table_schemas.hpp>
+#include <components/context/catalog_cache.hpp>
 #include <components/context/context.hpp>
 #include <components/logical_plan/node_catalog_resolve.hpp>
 #include <components/types/logical_value.hpp>
@@ -13,6 +14,7 @@
 #include <services/disk/manager_disk.hpp>
 
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -69,6 +71,7 @@ namespace components::operators {
         // in the constructor (TASK C10).
 
         components::execution_context_t exec_ctx{ctx->session, ctx->txn, {}};
+        auto* cache = ctx->use_catalog_cache ? ctx->catalog_cache : nullptr;
 
         // Dbname-form (back-pointer ctor) — resolve namespace_oid from
         // dbname before pg_type scan. "public" / "pg_catalog" are well-known
@@ -79,6 +82,8 @@ namespace components::operators {
                 namespace_oid_ = catalog::well_known_oid::public_namespace;
             } else if (dbname_ == "pg_catalog") {
                 namespace_oid_ = catalog::well_known_oid::pg_catalog_namespace;
+            } else if (auto cached = cache ? cache->find_namespace(ctx->txn, dbname_) : std::nullopt) {
+                namespace_oid_ = *cached;
             } else if (ctx->disk_address != actor_zeta::address_t::empty_address()) {
                 types::logical_value_t db_lv(resource_, std::string_view{dbname_});
                 std::pmr::vector<std::string> ns_keys(resource_);
@@ -96,6 +101,9 @@ namespace components::operators {
                     auto ns_oid_v = ns_batches[0].value(0, 0);
                     if (!ns_oid_v.is_null()) {
                         namespace_oid_ = static_cast<catalog::oid_t>(ns_oid_v.value<std::uint32_t>());
+                        if (cache) {
+                            cache->store_namespace(ctx->txn, dbname_, namespace_oid_);
+                        }
                     }
                 }
             }
@@ -103,7 +111,24 @@ namespace components::operators {
 
         vector::data_chunk_t chunk(resource_, output_schema_, /*capacity=*/1);
 
-        if (namespace_oid_ != catalog::INVALID_OID && ctx->disk_address != actor_zeta::address_t::empty_address()) {
+        // Shared catalog cache: a hit replays the row the pg_type scan below
+        // would have produced.
+        std::optional<components::logical_plan::resolved_type_metadata_t> cached;
+        if (cache && namespace_oid_ != catalog::INVALID_OID) {
+            cached = cache->find_type(ctx->txn, namespace_oid_, name_);
+        }
+        if (cached) {
+            set_uint32(chunk, 0, 0, static_cast<std::uint32_t>(cached->type_oid));
+            set_str(chunk, 1, 0, std::string_view{cached->name}, resource_);
+            set_uint32(chunk, 2, 0, static_cast<std::uint32_t>(cached->namespace_oid));
+            set_str(chunk, 3, 0, std::string_view{cached->typdefspec}, resource_);
+            chunk.set_cardinality(1);
+            if (target_node_) {
+                target_node_->set_type_oid(cached->type_oid);
+                target_node_->set_resolved_type_metadata(std::move(*cached));
+            }
+        } else if (namespace_oid_ != catalog::INVALID_OID &&
+                   ctx->disk_address != actor_zeta::address_t::empty_address()) {
             types::logical_value_t name_lv(resource_, std::string_view{name_});
             types::logical_value_t ns_lv(resource_, namespace_oid_);
             std::pmr::vector<std::string> typ_keys(resource_);
@@ -142,8 +167,8 @@ namespace components::operators {
 
                     // Stamp resolved metadata on the logical node so
                     // enrich / validate / resolve_type.cpp can read it via
-                    // plan_resolve_index.
-                    if (target_node_) {
+                    // plan_resolve_index, and keep a copy in the catalog cache.
+                    if (target_node_ || cache) {
                         components::logical_plan::resolved_type_metadata_t md;
                         md.type_oid = static_cast<catalog::oid_t>(v0.value<std::uint32_t>());
                         md.namespace_oid = static_cast<catalog::oid_t>(v2.value<std::uint32_t>());
@@ -159,8 +184,13 @@ namespace components::operators {
                                 md.type = types::complex_logical_type{lt};
                             }
                         }
-                        target_node_->set_type_oid(md.type_oid);
-                        target_node_->set_resolved_type_metadata(std::move(md));
+                        if (cache) {
+                            cache->store_type(ctx->txn, namespace_oid_, name_, md);
+                        }
+                        if (target_node_) {
+                            target_node_->set_type_oid(md.type_oid);
+                            target_node_->set_resolved_type_metadata(std::move(md));
+                        }
                     }
                 }
             }
@@ -3,6 +3,7 @@
 #include "arithmetic_eval.hpp"
 
 #include <algorithm>
+#include <components/table/column_state.hpp>
 #include <components/vector/vector_operations.hpp>
 #include <numeric>
 #include <queue>
@@ -19,38 +20,179 @@ namespace components::operators {
 
     void operator_sort_t::add_computed(computed_sort_key_t&& key) { computed_keys_.push_back(std::move(key)); }
 
+    namespace {
+
+        // Largest offset + limit served by the bounded top-N buffer.
+        constexpr uint64_t top_n_max_rows = uint64_t{1} << 14;
+
+        // Gathers merged rows into DEFAULT_VECTOR_CAPACITY chunks holding the
+        // first types.size() columns of their source chunks plus the row ids,
+        // and hands every filled chunk to `sink`.
+        template<typename Sink>
+        class sorted_writer_t {
+        public:
+            sorted_writer_t(std::pmr::memory_resource* resource,
+                            std::pmr::vector<types::complex_logical_type> types,
+                            Sink sink)
+                : resource_(resource)
+                , types_(std::move(types))
+                , sink_(std::move(sink))
+                , current_(resource_, types_, vector::DEFAULT_VECTOR_CAPACITY) {}
+
+            core::error_t append(const vector::data_chunk_t& source, size_t row) {
+                if (filled_ == vector::DEFAULT_VECTOR_CAPACITY) {
+                    auto error = flush();
+                    if (error.contains_error()) {
+                        return error;
+                    }
+                }
+                // vector_ops::copy arg 3 is the END index (exclusive), arg 4 is the start
+                // offset in the source, arg 5 is the target offset. Copy count = end - offset.
+                for (size_t c = 0; c < types_.size(); ++c) {
+                    vector::vector_ops::copy(source.data[c], current_.data[c], row + 1, row, filled_);
+                }
+                vector::vector_ops::copy(source.row_ids, current_.row_ids, row + 1, row, filled_);
+                ++filled_;
+                return core::error_t::no_error();
+            }
+
+            core::error_t flush() {
+                if (filled_ == 0) {
+                    return core::error_t::no_error();
+                }
+                current_.set_cardinality(filled_);
+                auto error = sink_(std::move(current_));
+                current_ = vector::data_chunk_t(resource_, types_, vector::DEFAULT_VECTOR_CAPACITY);
+                filled_ = 0;
+                return error;
+            }
+
+        private:
+            std::pmr::memory_resource* resource_;
+            std::pmr::vector<types::complex_logical_type> types_;
+            Sink sink_;
+            vector::data_chunk_t current_;
+            uint64_t filled_{0};
+        };
+
+        // Phase 2: k-way merge of locally sorted chunks via min-heap. Calls
+        // emit(chunk, row) in sorted order for at most `take` rows.
+        template<typename Emit>
+        core::error_t merge_sorted(const sort::columnar_sorter_t& sorter,
+                                   const chunks_vector_t& chunks,
+                                   const std::vector<std::vector<uint32_t>>& sorted_indices,
+                                   uint64_t take,
+                                   Emit&& emit) {
+            struct cursor_t {
+                uint32_t chunk_idx;
+                uint32_t cursor;
+            };
+            auto cmp = [&](const cursor_t& a, const cursor_t& b) {
+                size_t ra = sorted_indices[a.chunk_idx][a.cursor];
+                size_t rb = sorted_indices[b.chunk_idx][b.cursor];
+                int c = sorter.compare_cross(chunks[a.chunk_idx], ra, chunks[b.chunk_idx], rb);
+                // std::priority_queue is a max-heap; reverse for min-heap behaviour.
+                // Tie-break on chunk_idx then cursor for deterministic order.
+                if (c != 0)
+                    return c > 0;
+                if (a.chunk_idx != b.chunk_idx)
+                    return a.chunk_idx > b.chunk_idx;
+                return a.cursor > b.cursor;
+            };
+            std::priority_queue<cursor_t, std::vector<cursor_t>, decltype(cmp)> heap(cmp);
+            for (uint32_t ci = 0; ci < chunks.size(); ++ci) {
+                if (!sorted_indices[ci].empty()) {
+                    heap.push({ci, uint32_t{0}});
+                }
+            }
+
+            for (uint64_t emitted = 0; !heap.empty() && emitted < take; ++emitted) {
+                auto top = heap.top();
+                heap.pop();
+                auto error = emit(chunks[top.chunk_idx], sorted_indices[top.chunk_idx][top.cursor]);
+                if (error.contains_error()) {
+                    return error;
+                }
+                ++top.cursor;
+                if (top.cursor < sorted_indices[top.chunk_idx].size()) {
+                    heap.push(top);
+                }
+            }
+            return core::error_t::no_error();
+        }
+
+    } // namespace
+
     core::error_t
-    operator_sort_t::push(pipeline::context_t* /*ctx*/, vector::data_chunk_t&& input, chunks_vector_t& /*out*/) {
+    operator_sort_t::push(pipeline::context_t* ctx, vector::data_chunk_t&& input, chunks_vector_t& /*out*/) {
         // Blocking sink: accumulate the batch, emit nothing. The sort cannot
         // produce any ordered output until finalize() has seen every input chunk.
+        if (!input_types_) {
+            // Every batch shares the schema, so the first one decides whether
+            // the input can go to disk at all.
+            input_types_ = input.types();
+            spillable_ = spill::spill_file_t::can_spill(input);
+        }
+        if (is_top_n()) {
+            return push_top_n(ctx, std::move(input));
+        }
+        buffered_bytes_ += input.allocation_size();
         buffered_input_.emplace_back(std::move(input));
+        if (spillable_ && ctx && ctx->memory_budget > 0 && buffered_bytes_ > ctx->memory_budget) {
+            return spill_buffer(ctx);
+        }
         return core::error_t::no_error();
     }
 
     core::error_t operator_sort_t::finalize(pipeline::context_t* ctx, chunks_vector_t& out) {
         // Upstream is drained; run the Phase 1 / Phase 2 logic over the accumulated
         // buffer, writing into the pipeline sink `out`.
-        return sort_merge(ctx, buffered_input_, out);
+        boundary_.reset();
+        buffered_rows_ = 0;
+        if (runs_.empty()) {
+            return sort_merge(ctx, buffered_input_, out);
+        }
+        auto error = spill_buffer(ctx);
+        if (error.contains_error()) {
+            return error;
+        }
+        return merge_runs(out);
     }
 
-    core::error_t operator_sort_t::sort_merge(pipeline::context_t* pipeline_context,
-                                              chunks_vector_t& in_chunks,
-                                              chunks_vector_t& out_chunks) {
-        // All input chunks share the same schema. Capture original (pre-computed) column count
-        // and types from the first chunk.
-        size_t first_computed_col = 0;
-        std::pmr::vector<types::complex_logical_type> out_types{resource_};
-        if (!in_chunks.empty()) {
-            first_computed_col = in_chunks.front().data.size();
-            out_types = in_chunks.front().types();
+    bool operator_sort_t::is_top_n() const noexcept { return rows_to_keep() <= top_n_max_rows; }
+
+    std::unique_ptr<table::top_n_filter_t> operator_sort_t::top_n_filter(size_t& column) {
+        scan_bound_.reset();
+        order order_;
+        if (!is_top_n() || rows_to_keep() == 0 || !computed_keys_.empty() || !sorter_.leading_column(column, order_)) {
+            return nullptr;
         }
+        scan_bound_ = std::make_shared<table::top_n_bound_t>();
+        return std::make_unique<table::top_n_filter_t>(order_ == order::descending,
+                                                       scan_bound_,
+                                                       std::pmr::vector<uint64_t>(resource_));
+    }
 
-        // Phase 1: per-chunk evaluate computed keys (mutating chunk) + local sort.
-        std::vector<std::vector<uint32_t>> sorted_indices;
-        sorted_indices.reserve(in_chunks.size());
+    size_t operator_sort_t::output_column_count(size_t input_columns) const {
+        // Output column count (drop computed sort-key columns).
+        size_t out_cols_effective = expected_output_count_ > 0 ? expected_output_count_ : input_columns;
+        return std::min(out_cols_effective, input_columns);
+    }
+
+    uint64_t operator_sort_t::rows_to_keep() const {
+        int64_t offset_val = limit_.offset();
+        int64_t limit_val = limit_.limit();
+        if (limit_val < 0) {
+            return std::numeric_limits<uint64_t>::max();
+        }
+        return static_cast<uint64_t>(limit_val) + (offset_val > 0 ? static_cast<uint64_t>(offset_val) : 0);
+    }
 
-        bool computed_added = false;
-        for (auto& chunk : in_chunks) {
+    core::error_t operator_sort_t::sort_chunks(pipeline::context_t* pipeline_context,
+                                               chunks_vector_t& chunks,
+                                               std::vector<std::vector<uint32_t>>& sorted_indices) {
+        sorted_indices.reserve(chunks.size());
+        for (auto& chunk : chunks) {
             if (chunk.size() == 0) {
                 sorted_indices.emplace_back();
                 continue;
@@ -65,12 +207,12 @@ namespace components::operators {
                 if (result_vec.has_error()) {
                     return result_vec.error();
                 }
-                if (!computed_added) {
+                if (!computed_keys_registered_) {
                     sorter_.add(chunk.data.size(), ck.order_);
                 }
                 chunk.data.emplace_back(std::move(result_vec.value()));
             }
-            computed_added = true;
+            computed_keys_registered_ = true;
 
             std::vector<uint32_t> idx(chunk.size());
             std::iota(idx.begin(), idx.end(), uint32_t{0});
@@ -78,97 +220,283 @@ namespace components::operators {
             std::sort(idx.begin(), idx.end(), std::ref(sorter_));
             sorted_indices.emplace_back(std::move(idx));
         }
+        return core::error_t::no_error();
+    }
 
-        // Output column count (drop computed sort-key columns).
-        size_t out_cols_effective = expected_output_count_ > 0 ? expected_output_count_ : first_computed_col;
-        if (!computed_keys_.empty() && out_cols_effective > first_computed_col) {
-            out_cols_effective = first_computed_col;
+    core::error_t operator_sort_t::sort_merge(pipeline::context_t* pipeline_context,
+                                              chunks_vector_t& in_chunks,
+                                              chunks_vector_t& out_chunks) {
+        // All input chunks share the same schema. Capture original (pre-computed) column count
+        // and types from the first chunk.
+        size_t first_computed_col = 0;
+        std::pmr::vector<types::complex_logical_type> out_types{resource_};
+        if (!in_chunks.empty()) {
+            first_computed_col = in_chunks.front().data.size();
+            out_types = in_chunks.front().types();
+        }
+
+        // Phase 1: per-chunk evaluate computed keys (mutating chunk) + local sort.
+        std::vector<std::vector<uint32_t>> sorted_indices;
+        auto error = sort_chunks(pipeline_context, in_chunks, sorted_indices);
+        if (error.contains_error()) {
+            return error;
         }
+
+        size_t out_cols_effective = output_column_count(first_computed_col);
         if (out_types.size() > out_cols_effective) {
             out_types.erase(out_types.begin() + static_cast<ptrdiff_t>(out_cols_effective), out_types.end());
         }
 
-        // Phase 2: k-way merge via min-heap.
-        struct cursor_t {
-            uint32_t chunk_idx;
-            uint32_t cursor;
+        // Phase 2: k-way merge, skipping `offset` rows.
+        int64_t offset_val = limit_.offset();
+        uint64_t skip = offset_val > 0 ? static_cast<uint64_t>(offset_val) : 0;
+        sorted_writer_t writer(resource_, out_types, [&](vector::data_chunk_t&& chunk) {
+            out_chunks.emplace_back(std::move(chunk));
+            return core::error_t::no_error();
+        });
+        error = merge_sorted(sorter_,
+                             in_chunks,
+                             sorted_indices,
+                             rows_to_keep(),
+                             [&](const vector::data_chunk_t& chunk, size_t row) {
+                                 if (skip > 0) {
+                                     --skip;
+                                     return core::error_t::no_error();
+                                 }
+                                 return writer.append(chunk, row);
+                             });
+        if (!error.contains_error()) {
+            error = writer.flush();
+        }
+
+        // Restore input chunks: strip the temporary computed-key columns.
+        if (!computed_keys_.empty()) {
+            for (auto& chunk : in_chunks) {
+                if (chunk.data.size() > first_computed_col) {
+                    chunk.data.erase(chunk.data.begin() + static_cast<ptrdiff_t>(first_computed_col), chunk.data.end());
+                }
+            }
+        }
+        if (error.contains_error()) {
+            return error;
+        }
+
+        if (out_chunks.empty()) {
+            out_chunks.emplace_back(resource_, out_types, 0);
+        }
+        return core::error_t::no_error();
+    }
+
+    core::error_t operator_sort_t::push_top_n(pipeline::context_t* pipeline_context, vector::data_chunk_t&& input) {
+        if (boundary_ && computed_keys_.empty() && input.size() != 0) {
+            // Only rows sorting strictly before the boundary can still enter the result: the
+            // boundary was buffered first, so it wins ties.
+            vector::indexing_vector_t indexing(resource_, input.size());
+            uint64_t count = 0;
+            for (uint64_t row = 0; row < input.size(); ++row) {
+                if (sorter_.compare_cross(input, row, *boundary_, 0) < 0) {
+                    indexing.set_index(count++, row);
+                }
+            }
+            if (count == 0) {
+                return core::error_t::no_error();
+            }
+            if (count < input.size()) {
+                vector::data_chunk_t kept(resource_, input.types(), count);
+                input.copy(kept, indexing, count);
+                input = std::move(kept);
+            }
+        }
+        buffered_rows_ += input.size();
+        buffered_bytes_ += input.allocation_size();
+        buffered_input_.emplace_back(std::move(input));
+        if (buffered_rows_ >= 2 * std::max<uint64_t>(rows_to_keep(), vector::DEFAULT_VECTOR_CAPACITY)) {
+            return compact_top_n(pipeline_context);
+        }
+        return core::error_t::no_error();
+    }
+
+    core::error_t operator_sort_t::compact_top_n(pipeline::context_t* pipeline_context) {
+        std::vector<std::vector<uint32_t>> sorted_indices;
+        auto error = sort_chunks(pipeline_context, buffered_input_, sorted_indices);
+        if (error.contains_error()) {
+            return error;
+        }
+
+        // The computed-key columns are dropped; the next compaction or finalize evaluates them again.
+        chunks_vector_t kept(resource_);
+        sorted_writer_t writer(resource_, *input_types_, [&](vector::data_chunk_t&& chunk) {
+            kept.emplace_back(std::move(chunk));
+            return core::error_t::no_error();
+        });
+        error = merge_sorted(sorter_,
+                             buffered_input_,
+                             sorted_indices,
+                             rows_to_keep(),
+                             [&](const vector::data_chunk_t& chunk, size_t row) { return writer.append(chunk, row); });
+        if (!error.contains_error()) {
+            error = writer.flush();
+        }
+        if (error.contains_error()) {
+            return error;
+        }
+
+        buffered_input_ = std::move(kept);
+        buffered_rows_ = 0;
+        buffered_bytes_ = 0;
+        for (const auto& chunk : buffered_input_) {
+            buffered_rows_ += chunk.size();
+            buffered_bytes_ += chunk.allocation_size();
+        }
+        if (buffered_rows_ == 0 || buffered_rows_ < rows_to_keep()) {
+            return core::error_t::no_error();
+        }
+
+        const auto& last = buffered_input_.back();
+        boundary_ = std::make_unique<vector::data_chunk_t>(last.partial_copy(resource_, last.size() - 1, 1));
+        size_t column;
+        order order_;
+        int64_t key;
+        if (scan_bound_ && sorter_.leading_column(column, order_) && column < boundary_->column_count() &&
+            table::bloom_filter_t::integral_key(boundary_->data[column].value(0), key)) {
+            scan_bound_->publish(key);
+        }
+        return core::error_t::no_error();
+    }
+
+    core::error_t operator_sort_t::spill_buffer(pipeline::context_t* pipeline_context) {
+        auto first_rows = std::find_if(buffered_input_.begin(), buffered_input_.end(), [](const auto& chunk) {
+            return chunk.size() != 0;
+        });
+        if (first_rows == buffered_input_.end()) {
+            buffered_input_.clear();
+            buffered_bytes_ = 0;
+            return core::error_t::no_error();
+        }
+        if (!spill_) {
+            auto file = spill::spill_file_t::create(resource_, pipeline_context->spill_path);
+            if (file.has_error()) {
+                return file.error();
+            }
+            spill_ = std::move(file.value());
+        }
+
+        std::vector<std::vector<uint32_t>> sorted_indices;
+        auto error = sort_chunks(pipeline_context, buffered_input_, sorted_indices);
+        if (error.contains_error()) {
+            return error;
+        }
+
+        // The run keeps every column, computed sort keys included, so
+        // merge_runs() compares rows without evaluating anything again.
+        run_t run{spill_->size(), 0};
+        sorted_writer_t writer(resource_, first_rows->types(), [&](vector::data_chunk_t&& chunk) -> core::error_t {
+            auto offset = spill_->append(chunk);
+            if (offset.has_error()) {
+                return offset.error();
+            }
+            ++run.chunks;
+            return core::error_t::no_error();
+        });
+        error = merge_sorted(sorter_,
+                             buffered_input_,
+                             sorted_indices,
+                             rows_to_keep(),
+                             [&](const vector::data_chunk_t& chunk, size_t row) { return writer.append(chunk, row); });
+        if (!error.contains_error()) {
+            error = writer.flush();
+        }
+        if (error.contains_error()) {
+            return error;
+        }
+
+        runs_.push_back(run);
+        buffered_input_.clear();
+        buffered_bytes_ = 0;
+        return core::error_t::no_error();
+    }
+
+    core::error_t operator_sort_t::merge_runs(chunks_vector_t& out_chunks) {
+        struct run_cursor_t {
+            vector::data_chunk_t chunk;
+            size_t row;
+            uint64_t offset;
+            size_t chunks_left;
         };
-        auto cmp = [&](const cursor_t& a, const cursor_t& b) {
-            size_t ra = sorted_indices[a.chunk_idx][a.cursor];
-            size_t rb = sorted_indices[b.chunk_idx][b.cursor];
-            int c = sorter_.compare_cross(in_chunks[a.chunk_idx], ra, in_chunks[b.chunk_idx], rb);
-            // std::priority_queue is a max-heap; reverse for min-heap behaviour.
-            // Tie-break on chunk_idx then cursor for deterministic order.
+        std::vector<run_cursor_t> cursors;
+        cursors.reserve(runs_.size());
+
+        // Loads the run's next chunk; false once the run is exhausted.
+        auto load_next = [&](run_cursor_t& cursor) -> core::result_wrapper_t<bool> {
+            if (cursor.chunks_left == 0) {
+                return false;
+            }
+            auto chunk = spill_->read(cursor.offset, resource_);
+            if (chunk.has_error()) {
+                return chunk.error();
+            }
+            cursor.chunk = std::move(chunk.value());
+            cursor.row = 0;
+            --cursor.chunks_left;
+            return true;
+        };
+
+        auto cmp = [&](uint32_t a, uint32_t b) {
+            int c = sorter_.compare_cross(cursors[a].chunk, cursors[a].row, cursors[b].chunk, cursors[b].row);
+            // Min-heap; equal rows come out in run (i.e. input) order.
             if (c != 0)
                 return c > 0;
-            if (a.chunk_idx != b.chunk_idx)
-                return a.chunk_idx > b.chunk_idx;
-            return a.cursor > b.cursor;
+            return a > b;
         };
-        std::priority_queue<cursor_t, std::vector<cursor_t>, decltype(cmp)> heap(cmp);
-        for (uint32_t ci = 0; ci < in_chunks.size(); ++ci) {
-            if (!sorted_indices[ci].empty()) {
-                heap.push({ci, uint32_t{0}});
+        std::priority_queue<uint32_t, std::vector<uint32_t>, decltype(cmp)> heap(cmp);
+        for (const auto& run : runs_) {
+            cursors.push_back({vector::data_chunk_t(resource_, {}, 0), 0, run.offset, run.chunks});
+            auto loaded = load_next(cursors.back());
+            if (loaded.has_error()) {
+                return loaded.error();
+            }
+            if (loaded.value()) {
+                heap.push(static_cast<uint32_t>(cursors.size() - 1));
             }
         }
 
+        auto out_types = *input_types_;
+        out_types.resize(output_column_count(out_types.size()));
         int64_t offset_val = limit_.offset();
-        int64_t limit_val = limit_.limit();
         uint64_t skip = offset_val > 0 ? static_cast<uint64_t>(offset_val) : 0;
-        uint64_t take = (limit_val >= 0) ? static_cast<uint64_t>(limit_val) : std::numeric_limits<uint64_t>::max();
-
-        vector::data_chunk_t cur(resource_, out_types, vector::DEFAULT_VECTOR_CAPACITY);
-        uint64_t cur_filled = 0;
-        uint64_t produced = 0;
-
-        auto flush_cur = [&]() {
-            if (cur_filled == 0) {
-                return;
-            }
-            cur.set_cardinality(cur_filled);
-            out_chunks.emplace_back(std::move(cur));
-            cur = vector::data_chunk_t(resource_, out_types, vector::DEFAULT_VECTOR_CAPACITY);
-            cur_filled = 0;
-        };
+        sorted_writer_t writer(resource_, out_types, [&](vector::data_chunk_t&& chunk) {
+            out_chunks.emplace_back(std::move(chunk));
+            return core::error_t::no_error();
+        });
 
-        while (!heap.empty() && produced < take) {
+        for (uint64_t emitted = 0, take = rows_to_keep(); !heap.empty() && emitted < take; ++emitted) {
             auto top = heap.top();
             heap.pop();
-            auto& src_chunk = in_chunks[top.chunk_idx];
-            size_t row = sorted_indices[top.chunk_idx][top.cursor];
-
+            auto& cursor = cursors[top];
             if (skip > 0) {
                 --skip;
             } else {
-                if (cur_filled == vector::DEFAULT_VECTOR_CAPACITY) {
-                    flush_cur();
-                }
-                // vector_ops::copy arg 3 is the END index (exclusive), arg 4 is the start
-                // offset in the source, arg 5 is the target offset. Copy count = end - offset.
-                for (size_t c = 0; c < out_cols_effective; ++c) {
-                    vector::vector_ops::copy(src_chunk.data[c], cur.data[c], row + 1, row, cur_filled);
+                auto error = writer.append(cursor.chunk, cursor.row);
+                if (error.contains_error()) {
+                    return error;
                 }
-                vector::vector_ops::copy(src_chunk.row_ids, cur.row_ids, row + 1, row, cur_filled);
-                ++cur_filled;
-                ++produced;
             }
-
-            ++top.cursor;
-            if (top.cursor < sorted_indices[top.chunk_idx].size()) {
+            if (++cursor.row < cursor.chunk.size()) {
                 heap.push(top);
+                continue;
             }
-        }
-
-        flush_cur();
-
-        // Restore input chunks: strip the temporary computed-key columns.
-        if (!computed_keys_.empty()) {
-            for (auto& chunk : in_chunks) {
-                if (chunk.data.size() > first_computed_col) {
-                    chunk.data.erase(chunk.data.begin() + static_cast<ptrdiff_t>(first_computed_col), chunk.data.end());
-                }
+            auto loaded = load_next(cursor);
+            if (loaded.has_error()) {
+                return loaded.error();
+            }
+            if (loaded.value()) {
+                heap.push(top);
             }
         }
+        auto error = writer.flush();
+        if (error.contains_error()) {
+            return error;
+        }
 
         if (out_chunks.empty()) {
             out_chunks.emplace_back(resource_, out_types, 0);
@@ -5,6 +5,15 @@
 #include <components/logical_plan/param_storage.hpp>
 #include <components/physical_plan/operators/operator.hpp>
 #include <components/physical_plan/operators/sort/sort.hpp>
+#include <components/physical_plan/operators/spill/spill_file.hpp>
+
+#include <memory>
+#include <optional>
+
+namespace components::table {
+    struct top_n_bound_t;
+    class top_n_filter_t;
+} // namespace components::table
 
 namespace components::operators {
 
@@ -38,23 +47,89 @@ namespace components::operators {
         // buffered_input_ and emits nothing; finalize() runs the per-chunk
         // key-eval + local sort and the k-way merge over the buffer, emitting the
         // sorted result into `out` via sort_merge().
+        //
+        // External sort: once the buffer outgrows ctx->memory_budget, push()
+        // sorts it into a run, writes the run to a spill file under
+        // ctx->spill_path and drops it from memory. finalize() then spills the
+        // remainder as the last run and k-way merges the runs, holding one chunk
+        // per run. Each run keeps its computed-key columns so the merge never
+        // re-evaluates them, and is cut at offset + limit rows.
+        //
+        // Top-N: when offset + limit is small (is_top_n) the buffer stays bounded.
+        // Once it holds twice that many rows (at least two vectors), push()
+        // sorts it down to the first offset + limit (compact_top_n) and
+        // remembers the last kept row as the boundary; later rows that do not
+        // sort before the boundary are dropped on arrival. The boundary's leading
+        // key is also published to the scan below through top_n_filter(), so the
+        // scan skips those rows and whole segments itself. Nothing is spilled.
         [[nodiscard]] core::error_t
         push(pipeline::context_t* ctx, vector::data_chunk_t&& input, chunks_vector_t& out) override;
         [[nodiscard]] core::error_t finalize(pipeline::context_t* ctx, chunks_vector_t& out) override;
 
+        bool is_top_n() const noexcept;
+
+        // Dynamic filter for the scan feeding this sort (see push_runtime_filters), on the leading
+        // sort key — `column` receives its index in the input. nullptr unless this is a top-N sort
+        // whose leading key is a plain input column. A new call detaches the previous filter.
+        std::unique_ptr<table::top_n_filter_t> top_n_filter(size_t& column);
+
+        size_t spilled_runs() const noexcept { return runs_.size(); }
+
+        uint64_t memory_usage() const noexcept override { return buffered_bytes_; }
+
     private:
+        // `chunks` consecutive spill file records starting at `offset`.
+        struct run_t {
+            uint64_t offset;
+            size_t chunks;
+        };
+
         sort::columnar_sorter_t sorter_;
         std::pmr::vector<computed_sort_key_t> computed_keys_;
+        bool computed_keys_registered_{false};
         size_t expected_output_count_{0};
         logical_plan::limit_t limit_;
         chunks_vector_t buffered_input_{resource_};
+        uint64_t buffered_bytes_{0};
+        // Input column count and types, i.e. without computed-key columns.
+        std::optional<std::pmr::vector<types::complex_logical_type>> input_types_;
+        bool spillable_{true};
+        std::unique_ptr<spill::spill_file_t> spill_;
+        std::vector<run_t> runs_;
+        // Top-N state: rows in buffered_input_, the last kept row once the buffer
+        // has been cut to offset + limit rows, and the bound shared with the scan.
+        uint64_t buffered_rows_{0};
+        std::unique_ptr<vector::data_chunk_t> boundary_;
+        std::shared_ptr<table::top_n_bound_t> scan_bound_;
 
         // Core sort+merge. Sources chunks from `source_chunks` (mutated in place:
         // temporary computed-key columns are appended then stripped) and appends
         // the sorted, limit/offset-applied output chunks to `out`. Used by
-        // finalize (streaming sink).
+        // finalize (streaming sink) when nothing was spilled.
         [[nodiscard]] core::error_t
         sort_merge(pipeline::context_t* pipeline_context, chunks_vector_t& source_chunks, chunks_vector_t& out);
+
+        // Phase 1: appends the computed-key columns to every chunk and sorts each
+        // chunk locally, filling `sorted_indices` with one permutation per chunk.
+        [[nodiscard]] core::error_t sort_chunks(pipeline::context_t* pipeline_context,
+                                                chunks_vector_t& chunks,
+                                                std::vector<std::vector<uint32_t>>& sorted_indices);
+
+        // Sorts buffered_input_ into a run, appends it to the spill file and
+        // clears the buffer.
+        [[nodiscard]] core::error_t spill_buffer(pipeline::context_t* pipeline_context);
+
+        // Merges the spilled runs into `out`.
+        [[nodiscard]] core::error_t merge_runs(chunks_vector_t& out);
+
+        // Top-N: drops the rows of `input` that cannot enter the result and buffers the rest.
+        [[nodiscard]] core::error_t push_top_n(pipeline::context_t* pipeline_context, vector::data_chunk_t&& input);
+        // Top-N: cuts buffered_input_ down to its first offset + limit rows and
+        // moves the boundary (and the scan bound) up to the last of them.
+        [[nodiscard]] core::error_t compact_top_n(pipeline::context_t* pipeline_context);
+
+        size_t output_column_count(size_t input_columns) const;
+        uint64_t rows_to_keep() const;
     };
 
 } // namespace components::operators
@@ -1,7 +1,8 @@
 #include "simple_predicate.hpp"
 #include "utils.hpp"
 
-#include <regex>
+#include <memory>
+#include <optional>
 
 namespace components::operators::predicates {
 
@@ -27,19 +28,33 @@ namespace components::operators::predicates {
                                  std::pmr::string{"incorrect argument type for regex", resource});
         }
 
-        template<typename COMP>
-        core::result_wrapper_t<bool> evaluate_comp(std::pmr::memory_resource*,
-                                                   std::string_view left,
-                                                   std::string_view right) requires(std::is_same_v<COMP, regex<>>) {
-            return std::regex_search(std::string(left), std::regex(std::string(right)));
-        }
+        // Compiled form of the last regex right-hand side seen by one predicate. A constant pattern
+        // (the LIKE and `regexp` case) is compiled on the first row and reused for every row after.
+        class pattern_cache_t {
+        public:
+            core::result_wrapper_t<bool>
+            matches(std::pmr::memory_resource* resource, std::string_view text, std::string_view pattern) {
+                if (!compiled_ || compiled_->pattern() != pattern) {
+                    auto compiled = types::string_pattern_t::compile(resource, pattern);
+                    if (compiled.has_error()) {
+                        return core::error_t(core::error_code_t::comparison_failure, compiled.error().what);
+                    }
+                    compiled_ = std::move(compiled.value());
+                }
+                return compiled_->matches(text);
+            }
+
+        private:
+            std::optional<types::string_pattern_t> compiled_;
+        };
 
         template<typename COMP>
         core::result_wrapper_t<bool>
         evaluate_comp(std::pmr::memory_resource* resource,
+                      pattern_cache_t& cache,
                       const types::logical_value_t& left,
                       const types::logical_value_t& right) requires(std::is_same_v<COMP, regex<>>) {
-            return evaluate_comp<COMP>(resource, left.value<std::string_view>(), right.value<std::string_view>());
+            return cache.matches(resource, left.value<std::string_view>(), right.value<std::string_view>());
         }
 
         template<typename COMP>
@@ -50,8 +65,13 @@ namespace components::operators::predicates {
                                                          core::date::timezone_offset_t session_tz) {
             auto left_getter = impl::create_value_getter(resource, function_registry, expr->left(), parameters);
             auto right_getter = impl::create_value_getter(resource, function_registry, expr->right(), parameters);
-            return [resource, left_getter = std::move(left_getter), right_getter = std::move(right_getter), session_tz](
-                       const vector::data_chunk_t& chunk_left,
+            // std::function needs a copyable callable; copies of one predicate share the cache
+            auto cache = std::make_shared<pattern_cache_t>();
+            return [resource,
+                    left_getter = std::move(left_getter),
+                    right_getter = std::move(right_getter),
+                    cache,
+                    session_tz](const vector::data_chunk_t& chunk_left,
                        const vector::data_chunk_t& chunk_right,
                        size_t index_left,
                        size_t index_right) -> core::result_wrapper_t<bool> {
@@ -67,18 +87,57 @@ namespace components::operators::predicates {
                 if (left_val.value().is_null() || right_val.value().is_null()) {
                     return false;
                 }
+                auto evaluate = [&](const types::logical_value_t& left, const types::logical_value_t& right) {
+                    if constexpr (std::is_same_v<COMP, regex<>>) {
+                        if (left.type().to_physical_type() == types::physical_type::STRING &&
+                            right.type().to_physical_type() == types::physical_type::STRING) {
+                            return evaluate_comp<COMP>(resource, *cache, left, right);
+                        }
+                    }
+                    return evaluate_comp<COMP>(resource, left, right);
+                };
                 auto cast_right = right_val.value().cast_as(left_val.value().type(), session_tz);
                 if (!cast_right.is_null()) {
-                    return evaluate_comp<COMP>(resource, left_val.value(), cast_right);
+                    return evaluate(left_val.value(), cast_right);
                 }
                 auto cast_left = left_val.value().cast_as(right_val.value().type(), session_tz);
                 if (!cast_left.is_null()) {
-                    return evaluate_comp<COMP>(resource, cast_left, right_val.value());
+                    return evaluate(cast_left, right_val.value());
                 }
                 return false;
             };
         }
 
+        // Regex against a single-level column with a string parameter as the pattern: compiled here,
+        // once per predicate, and handed to the batch kernel. Anything else (computed operands, a
+        // pattern that does not compile) stays on the row comparator, which reports the error.
+        std::optional<simple_predicate::pattern_column_t>
+        make_pattern_column(std::pmr::memory_resource* resource,
+                            const expressions::compare_expression_ptr& expr,
+                            const logical_plan::storage_parameters* parameters) {
+            if (!parameters || !std::holds_alternative<expressions::key_t>(expr->left()) ||
+                !std::holds_alternative<core::parameter_id_t>(expr->right())) {
+                return std::nullopt;
+            }
+            const auto& key = std::get<expressions::key_t>(expr->left());
+            if (key.side() == expressions::side_t::undefined || key.path().size() != 1) {
+                return std::nullopt;
+            }
+            auto param = parameters->parameters.find(std::get<core::parameter_id_t>(expr->right()));
+            if (param == parameters->parameters.end() ||
+                param->second.type().to_physical_type() != types::physical_type::STRING) {
+                return std::nullopt;
+            }
+            auto compiled = types::string_pattern_t::compile(resource, param->second.value<std::string_view>());
+            if (compiled.has_error()) {
+                return std::nullopt;
+            }
+            return simple_predicate::pattern_column_t{
+                key.side(),
+                key.path(),
+                std::make_shared<const types::string_pattern_t>(std::move(compiled.value()))};
+        }
+
     } // anonymous namespace
 
     simple_predicate::simple_predicate(std::pmr::memory_resource* resource, row_check_fn_t func)
@@ -86,6 +145,14 @@ namespace components::operators::predicates {
         , func_(std::move(func))
         , nested_(resource_) {}
 
+    simple_predicate::simple_predicate(std::pmr::memory_resource* resource,
+                                       row_check_fn_t func,
+                                       pattern_column_t pattern)
+        : resource_(resource)
+        , func_(std::move(func))
+        , nested_(resource_)
+        , pattern_(std::move(pattern)) {}
+
     simple_predicate::simple_predicate(std::pmr::memory_resource* resource,
                                        std::pmr::vector<predicate_ptr>&& nested,
                                        expressions::compare_type nested_type)
@@ -136,7 +203,26 @@ namespace components::operators::predicates {
                 }
                 return result;
             }
-            default:
+            default: {
+                if (pattern_) {
+                    const auto& chunk = pattern_->side == expressions::side_t::left ? left : right;
+                    const auto& indices = pattern_->side == expressions::side_t::left ? left_indices : right_indices;
+                    const auto* column = chunk.at(pattern_->path);
+                    const auto vtype = column->get_vector_type();
+                    if (column->type().to_physical_type() == types::physical_type::STRING &&
+                        (vtype == vector::vector_type::FLAT || vtype == vector::vector_type::CONSTANT)) {
+                        const auto* strings = column->data<std::string_view>();
+                        const bool constant = vtype == vector::vector_type::CONSTANT;
+                        std::vector<bool> result(count);
+                        for (uint64_t k = 0; k < count; ++k) {
+                            const uint64_t row = constant ? 0 : indices.get_index(k);
+                            // NULL is neither true nor false; false, as in the row comparator
+                            result[k] =
+                                column->validity().row_is_valid(row) && pattern_->pattern->matches(strings[row]);
+                        }
+                        return result;
+                    }
+                }
                 // fallback to row-by-row via func_
                 std::vector<bool> result(count);
                 for (uint64_t k = 0; k < count; ++k) {
@@ -148,6 +234,7 @@ namespace components::operators::predicates {
                     }
                 }
                 return result;
+            }
         }
     }
 
@@ -308,10 +395,13 @@ namespace components::operators::predicates {
                         return !is_any;
                     })};
             }
-            case compare_type::regex:
-                return {new simple_predicate(
-                    resource,
-                    make_comparator<regex<>>(resource, function_registry, expr, parameters, session_tz))};
+            case compare_type::regex: {
+                auto comparator = make_comparator<regex<>>(resource, function_registry, expr, parameters, session_tz);
+                if (auto pattern = make_pattern_column(resource, expr, parameters)) {
+                    return {new simple_predicate(resource, std::move(comparator), std::move(*pattern))};
+                }
+                return {new simple_predicate(resource, std::move(comparator))};
+            }
             case compare_type::all_false:
                 return {new simple_predicate(
                     resource,
@@ -1,13 +1,26 @@
 #pragma once
 
 #include "predicate.hpp"
+#include <components/types/string_pattern.hpp>
 #include <functional>
+#include <memory>
+#include <optional>
 
 namespace components::operators::predicates {
 
     class simple_predicate final : public predicate {
     public:
+        // A string column matched against a pattern compiled at plan time (regex / LIKE with a
+        // constant right-hand side): batch_check reads the column's string_views directly instead
+        // of materializing a logical value per row.
+        struct pattern_column_t {
+            expressions::side_t side;
+            std::pmr::vector<size_t> path;
+            std::shared_ptr<const types::string_pattern_t> pattern;
+        };
+
         explicit simple_predicate(std::pmr::memory_resource* resource, row_check_fn_t func);
+        simple_predicate(std::pmr::memory_resource* resource, row_check_fn_t func, pattern_column_t pattern);
         simple_predicate(std::pmr::memory_resource* resource,
                          std::pmr::vector<predicate_ptr>&& nested,
                          expressions::compare_type nested_type);
@@ -28,6 +41,7 @@ namespace components::operators::predicates {
         row_check_fn_t func_;
         std::pmr::vector<predicate_ptr> nested_;
         expressions::compare_type nested_type_ = expressions::compare_type::invalid;
+        std::optional<pattern_column_t> pattern_;
     };
 
     predicate_ptr create_simple_predicate(std::pmr::memory_resource* resource,
@@ -0,0 +1,120 @@
+#include "runtime_filter.hpp"
+
+#include <components/physical_plan/operators/operator_hash_join.hpp>
+#include <components/physical_plan/operators/operator_sort.hpp>
+#include <components/physical_plan/operators/scan/full_scan.hpp>
+#include <components/physical_plan/operators/scan/transfer_scan.hpp>
+
+namespace components::operators {
+
+    namespace {
+
+        // to_unified_format is non-const but only reads the vector (same const_cast as the
+        // hash join's key hashing).
+        template<typename T>
+        void insert_keys(std::pmr::memory_resource* resource,
+                         const vector::vector_t& column,
+                         uint64_t count,
+                         table::bloom_filter_t& filter) {
+            vector::unified_vector_format uvf(resource, count);
+            const_cast<vector::vector_t&>(column).to_unified_format(count, uvf);
+            const T* data = uvf.get_data<T>();
+            for (uint64_t row = 0; row < count; ++row) {
+                const uint64_t idx = uvf.referenced_indexing->get_index(row);
+                if (uvf.validity.row_is_valid(idx)) {
+                    filter.insert(static_cast<int64_t>(data[idx]));
+                }
+            }
+        }
+
+        // Summarize one build key column; nullptr when it is not an integer column.
+        std::unique_ptr<table::bloom_filter_t>
+        build_filter(std::pmr::memory_resource* resource, const chunks_vector_t& build, uint64_t column) {
+            if (build.empty() || column >= build.front().column_count() ||
+                !table::bloom_filter_t::is_integral_key(build.front().data[column].type().type())) {
+                return nullptr;
+            }
+            uint64_t rows = 0;
+            for (const auto& chunk : build) {
+                rows += chunk.size();
+            }
+            auto filter = std::make_unique<table::bloom_filter_t>(rows, std::pmr::vector<uint64_t>(resource));
+            for (const auto& chunk : build) {
+                const auto& keys = chunk.data[column];
+                switch (keys.type().to_physical_type()) {
+                    case types::physical_type::INT8:
+                        insert_keys<int8_t>(resource, keys, chunk.size(), *filter);
+                        break;
+                    case types::physical_type::INT16:
+                        insert_keys<int16_t>(resource, keys, chunk.size(), *filter);
+                        break;
+                    case types::physical_type::INT32:
+                        insert_keys<int32_t>(resource, keys, chunk.size(), *filter);
+                        break;
+                    case types::physical_type::INT64:
+                        insert_keys<int64_t>(resource, keys, chunk.size(), *filter);
+                        break;
+                    case types::physical_type::UINT8:
+                        insert_keys<uint8_t>(resource, keys, chunk.size(), *filter);
+                        break;
+                    case types::physical_type::UINT16:
+                        insert_keys<uint16_t>(resource, keys, chunk.size(), *filter);
+                        break;
+                    case types::physical_type::UINT32:
+                        insert_keys<uint32_t>(resource, keys, chunk.size(), *filter);
+                        break;
+                    default:
+                        return nullptr;
+                }
+            }
+            return filter;
+        }
+
+        // Hands a top-N sort's dynamic filter to the scan directly below it.
+        void push_top_n_filter(operator_sort_t& sort, operator_t& input) {
+            size_t column = 0;
+            if (input.type() == operator_type::full_scan) {
+                auto& scan = static_cast<full_scan&>(input);
+                scan.clear_runtime_filters();
+                if (auto filter = sort.top_n_filter(column)) {
+                    scan.set_top_n_filter(column, std::move(filter));
+                }
+            } else if (input.type() == operator_type::transfer_scan) {
+                auto& scan = static_cast<transfer_scan&>(input);
+                scan.clear_runtime_filters();
+                if (auto filter = sort.top_n_filter(column)) {
+                    scan.set_top_n_filter(column, std::move(filter));
+                }
+            }
+        }
+
+    } // namespace
+
+    void push_runtime_filters(operator_t* root) {
+        for (operator_t* op = root; op != nullptr; op = op->left().get()) {
+            if (op->type() == operator_type::sort && op->left()) {
+                push_top_n_filter(static_cast<operator_sort_t&>(*op), *op->left());
+                continue;
+            }
+            if (op->type() != operator_type::hash_join || !op->left() ||
+                op->left()->type() != operator_type::full_scan) {
+                continue;
+            }
+            auto* join = static_cast<operator_hash_join_t*>(op);
+            auto* scan = static_cast<full_scan*>(op->left().get());
+            scan->clear_runtime_filters();
+            if (!join->filters_probe_side()) {
+                continue;
+            }
+            const auto& build = join->right()->output()->chunks();
+            const auto& probe_cols = join->probe_key_cols();
+            const auto& build_cols = join->build_key_cols();
+            for (size_t k = 0; k < probe_cols.size(); ++k) {
+                if (auto filter = build_filter(op->resource(), build, build_cols[k])) {
+                    scan->add_runtime_filter(probe_cols[k], std::move(filter));
+                }
+            }
+        }
+    }
+
+} // namespace components::operators
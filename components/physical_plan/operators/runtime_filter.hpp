@@ -0,0 +1,23 @@
+#pragma once
+
+#include <components/physical_plan/operators/operator.hpp>
+
+namespace components::operators {
+
+    // Runtime join filters. Once the build sides of a pipeline are materialized
+    // (and before its source runs), every hash join on the streaming spine whose
+    // probe input is a full_scan summarizes each integer build key column as a
+    // table::bloom_filter_t — the key range plus Bloom bits — and hands it to that
+    // scan. The scan ships it to the disk agent with its predicate, so probe rows
+    // that cannot match are dropped before they are materialized or cross the
+    // mailbox, and row groups outside the key range are skipped by their zone maps.
+    //
+    // Only inner and right joins qualify (left/full must still emit unmatched
+    // probe rows). Re-running this replaces the filters of a re-driven scan.
+    //
+    // Likewise a top-N sort (ORDER BY ... LIMIT k) reading straight from a
+    // full_scan or transfer_scan hands it a table::top_n_filter_t on its leading
+    // key, whose bound the sort tightens while the scan runs.
+    void push_runtime_filters(operator_t* root);
+
+} // namespace components::operators
@@ -212,15 +212,91 @@ namespace components::operators {
         return vector::data_chunk_t{resource_, projected_types, 0};
     }
 
+    void full_scan::stash_read_ahead(std::vector<vector::data_chunk_t>& batches) {
+        for (auto& batch : batches) {
+            read_ahead_.push_back(std::move(batch));
+        }
+    }
+
+    void full_scan::add_runtime_filter(size_t column, std::unique_ptr<table::bloom_filter_t> filter) {
+        runtime_filters_.emplace_back(column, std::move(filter));
+    }
+
+    void full_scan::set_top_n_filter(size_t column, std::unique_ptr<table::top_n_filter_t> filter) {
+        top_n_column_ = column;
+        top_n_filter_ = std::move(filter);
+    }
+
+    std::unique_ptr<table::table_filter_t>
+    full_scan::attach_runtime_filters(std::unique_ptr<table::table_filter_t> filter, bool& excluded) {
+        excluded = false;
+        auto runtime_filters = std::move(runtime_filters_);
+        runtime_filters_.clear();
+        auto top_n = std::move(top_n_filter_);
+        if (limit_.limit() >= 0 || limit_.offset() > 0) {
+            return filter;
+        }
+        // Output column -> integer table column; false when the filter does not apply.
+        auto table_column_of = [&](size_t column, size_t& table_column) {
+            table_column = column;
+            if (!projected_cols_.empty()) {
+                if (column >= projected_cols_.size()) {
+                    return false;
+                }
+                table_column = projected_cols_[column];
+            }
+            return table_column < guard_types_.size() &&
+                   table::bloom_filter_t::is_integral_key(guard_types_[table_column].type());
+        };
+        std::vector<std::unique_ptr<table::table_filter_t>> applicable;
+        size_t table_column;
+        for (auto& [column, bloom] : runtime_filters) {
+            if (!table_column_of(column, table_column)) {
+                continue;
+            }
+            excluded = excluded || bloom->empty();
+            bloom->table_indices = std::pmr::vector<uint64_t>(1, table_column, resource_);
+            applicable.emplace_back(std::move(bloom));
+        }
+        if (top_n && table_column_of(top_n_column_, table_column)) {
+            top_n->table_indices = std::pmr::vector<uint64_t>(1, table_column, resource_);
+            applicable.emplace_back(std::move(top_n));
+        }
+        if (applicable.empty()) {
+            return filter;
+        }
+        if (!filter && applicable.size() == 1) {
+            return std::move(applicable.front());
+        }
+        auto conjunction = std::make_unique<table::conjunction_and_filter_t>();
+        if (filter) {
+            conjunction->child_filters.emplace_back(std::move(filter));
+        }
+        for (auto& runtime_filter : applicable) {
+            conjunction->child_filters.emplace_back(std::move(runtime_filter));
+        }
+        return conjunction;
+    }
+
+    std::unique_ptr<vector::data_chunk_t> full_scan::take_read_ahead() {
+        if (read_ahead_.empty()) {
+            return nullptr;
+        }
+        auto batch = std::make_unique<vector::data_chunk_t>(std::move(read_ahead_.front()));
+        read_ahead_.pop_front();
+        return batch;
+    }
+
     // --- Push-based streaming pipeline source (PER-BATCH FETCH-NEXT, bounded) ---
     // FIRST call: one-time setup (short-circuits, build the filter, the storage_types await for the
     //   empty-guard schema), then OPEN the cursor (storage_fetch_next_batch, cursor_id==0, passing
     //   the filter + offset+limit head cap) and return its first batch.
-    // SUBSEQUENT calls: ADVANCE the SAME cursor (cursor_id_!=0, no filter) and return one batch.
+    // SUBSEQUENT calls: emit the next read-ahead batch, else ADVANCE the SAME cursor (cursor_id_!=0,
+    //   no filter) and return its head batch, queueing the rest of the reply.
     // Each call does at most ONE cross-actor fetch await; the N awaits are sequential across calls
     // in this nested operator coroutine (driven by execute_pipeline), so the single-slot awaited
     // continuation is republished+cleared between awaits — no lost-wakeup. Peak scan memory = one
-    // batch (zero pins survive a round-trip; the agent re-seeks a transient scan state from a
+    // read-ahead window (zero pins survive a round-trip; the agent re-seeks a transient scan state from a
     // stored position).
     actor_zeta::unique_future<core::result_wrapper_t<vector::data_chunk_t>>
     full_scan::source_next(pipeline::context_t* ctx) {
@@ -288,6 +364,15 @@ namespace components::operators {
                 filter = std::move(filter_result.value());
             }
 
+            bool excluded = false;
+            filter = attach_runtime_filters(std::move(filter), excluded);
+            if (excluded) {
+                // The join's build side is empty: no probe row can match.
+                drained_ = true;
+                emitted_any_ = true;
+                co_return make_drain_chunk(guard_types_);
+            }
+
             // OPEN the cursor: offset+limit pushed down as the agent's post-filter matched-row cap;
             // the head OFFSET rows are skipped per-batch below (the agent caps but does not skip).
             const int64_t offset_val = limit_.offset();
@@ -312,10 +397,16 @@ namespace components::operators {
             }
             auto reply = std::move(fetch_result.value());
             cursor_id_ = reply.cursor_id;
+            stash_read_ahead(reply.read_ahead);
             co_return co_await emit_or_skip(ctx, std::move(reply.batch));
         }
 
-        // ADVANCE: read one more batch from the open cursor (filter dropped — the agent owns it).
+        // Batches the agent already read ahead go out first, without a round trip.
+        if (auto ahead = take_read_ahead()) {
+            co_return co_await emit_or_skip(ctx, std::move(ahead));
+        }
+
+        // ADVANCE: read the next batches from the open cursor (filter dropped — the agent owns it).
         auto [_s, sf] = actor_zeta::send(ctx->disk_address,
                                          &services::disk::manager_disk_t::storage_fetch_next_batch,
                                          ctx->session,
@@ -332,6 +423,7 @@ namespace components::operators {
             co_return fetch_result.convert_error<vector::data_chunk_t>();
         }
         auto reply = std::move(fetch_result.value());
+        stash_read_ahead(reply.read_ahead);
         co_return co_await emit_or_skip(ctx, std::move(reply.batch));
     }
 
@@ -358,6 +450,10 @@ namespace components::operators {
             if (remaining_offset_ > 0) {
                 if (sz <= remaining_offset_) {
                     remaining_offset_ -= sz; // whole batch consumed by OFFSET — fetch the next one
+                    if (auto ahead = take_read_ahead()) {
+                        batch = std::move(ahead);
+                        continue;
+                    }
                     auto [_s, sf] = actor_zeta::send(ctx->disk_address,
                                                      &services::disk::manager_disk_t::storage_fetch_next_batch,
                                                      ctx->session,
@@ -373,7 +469,9 @@ namespace components::operators {
                         mark_failed();
                         co_return fetch_result.convert_error<vector::data_chunk_t>();
                     }
-                    batch = std::move(fetch_result.value().batch);
+                    auto reply = std::move(fetch_result.value());
+                    stash_read_ahead(reply.read_ahead);
+                    batch = std::move(reply.batch);
                     continue;
                 }
                 auto trimmed = batch->partial_copy(resource_, remaining_offset_, sz - remaining_offset_);
@@ -7,6 +7,8 @@
 #include <components/table/column_state.hpp>
 #include <core/result_wrapper.hpp>
 
+#include <deque>
+
 namespace components::operators {
 
     class full_scan final : public read_only_operator_t {
@@ -22,14 +24,29 @@ namespace components::operators {
         const expressions::compare_expression_ptr& expression() const { return expression_; }
         const logical_plan::limit_t& limit() const { return limit_; }
 
+        // Runtime join filter from the hash join this scan is the probe side of (see
+        // push_runtime_filters). `column` indexes the scan OUTPUT; at OPEN it is mapped through the
+        // projection and the filter is ANDed onto the predicate shipped to the agent, so rows without
+        // a build-side key are dropped there and the key range prunes row groups via zone maps.
+        // Kept only for an integer table column and an unlimited scan (a LIMIT counts rows before
+        // the join). Filters added after the cursor OPENed are ignored.
+        void add_runtime_filter(size_t column, std::unique_ptr<table::bloom_filter_t> filter);
+        // Dynamic top-N filter from the ORDER BY ... LIMIT sort this scan feeds, same rules.
+        void set_top_n_filter(size_t column, std::unique_ptr<table::top_n_filter_t> filter);
+        void clear_runtime_filters() noexcept {
+            runtime_filters_.clear();
+            top_n_filter_.reset();
+        }
+
         // --- Push-based streaming pipeline source (PER-BATCH FETCH-NEXT, bounded) ---
         // role()==source drives the streaming push/finalize pipeline. The FIRST source_next call
         // OPENs a position-only fetch-next cursor on the owning agent (storage_fetch_next_batch,
         // cursor_id==0), passing the filter + projection + the (offset+limit) head cap; each
-        // subsequent call ADVANCEs the SAME cursor (cursor_id!=0, filter dropped) and reads exactly
-        // ONE batch — zero pins survive the round-trip, so peak scan memory is one batch regardless
-        // of table size. A drained cursor (cardinality-0 reply) yields the 0-column sentinel so
-        // execute_pipeline stops. The N sequential cross-actor co_awaits live in this NESTED
+        // subsequent call emits a batch the agent read ahead or ADVANCEs the SAME cursor (cursor_id!=0,
+        // filter dropped), which ships up to config_disk::scan_read_ahead batches — zero pins survive
+        // the round-trip, so peak scan memory is one read-ahead window regardless of table size.
+        // A drained cursor (cardinality-0 reply) yields the 0-column sentinel so execute_pipeline
+        // stops. The N sequential cross-actor co_awaits live in this NESTED
         // operator coroutine (driven by co_await from execute_pipeline), not in a behavior() handler,
         // so the actor-zeta single-slot awaited continuation is republished+cleared between each
         // sequential await — no lost-wakeup.
@@ -53,6 +70,7 @@ namespace components::operators {
             cursor_id_ = 0;
             remaining_offset_ = 0;
             guard_types_.clear();
+            read_ahead_.clear();
         }
 
     private:
@@ -66,6 +84,16 @@ namespace components::operators {
         actor_zeta::unique_future<core::result_wrapper_t<vector::data_chunk_t>>
         emit_or_skip(pipeline::context_t* ctx, std::unique_ptr<vector::data_chunk_t> batch);
 
+        // AND the applicable runtime filters onto `filter` (null: no scan predicate). Consumes
+        // runtime_filters_ and top_n_filter_; sets `excluded` when an empty build side rules out every row.
+        std::unique_ptr<table::table_filter_t> attach_runtime_filters(std::unique_ptr<table::table_filter_t> filter,
+                                                                      bool& excluded);
+
+        // Queue the batches the agent shipped behind a reply's head batch / pop the next queued one
+        // (nullptr when the queue is empty and the next batch needs an ADVANCE round trip).
+        void stash_read_ahead(std::vector<vector::data_chunk_t>& batches);
+        std::unique_ptr<vector::data_chunk_t> take_read_ahead();
+
         components::catalog::oid_t table_oid_;
         expressions::compare_expression_ptr expression_;
         const logical_plan::limit_t limit_;
@@ -87,6 +115,12 @@ namespace components::operators {
         uint64_t cursor_id_{0};
         uint64_t remaining_offset_{0};
         std::pmr::vector<types::complex_logical_type> guard_types_{resource_};
+        // Batches the agent read ahead (fetch_batch_t::read_ahead), handed out in order before the
+        // next ADVANCE; bounded by one reply (config_disk::scan_read_ahead).
+        std::pmr::deque<vector::data_chunk_t> read_ahead_{resource_};
+        std::vector<std::pair<size_t, std::unique_ptr<table::bloom_filter_t>>> runtime_filters_;
+        size_t top_n_column_{0};
+        std::unique_ptr<table::top_n_filter_t> top_n_filter_;
     };
 
 } // namespace components::operators
@@ -32,10 +32,25 @@ namespace components::operators {
         return vector::data_chunk_t{resource_, projected_types, 0};
     }
 
+    void transfer_scan::stash_read_ahead(std::vector<vector::data_chunk_t>& batches) {
+        for (auto& batch : batches) {
+            read_ahead_.push_back(std::move(batch));
+        }
+    }
+
+    std::unique_ptr<vector::data_chunk_t> transfer_scan::take_read_ahead() {
+        if (read_ahead_.empty()) {
+            return nullptr;
+        }
+        auto batch = std::make_unique<vector::data_chunk_t>(std::move(read_ahead_.front()));
+        read_ahead_.pop_front();
+        return batch;
+    }
+
     // --- Push-based streaming pipeline source (PER-BATCH FETCH-NEXT, bounded) ---
-    // FIRST call OPENs a position-only cursor (no filter); subsequent calls ADVANCE it, one batch
-    // each. At most one cross-actor fetch await per call, sequential across calls in this nested
-    // operator coroutine — no lost-wakeup. Peak scan memory = one batch.
+    // FIRST call OPENs a position-only cursor (no filter); subsequent calls emit a read-ahead batch
+    // or ADVANCE it. At most one cross-actor fetch await per call, sequential across calls in this nested
+    // operator coroutine — no lost-wakeup. Peak scan memory = one read-ahead window.
     actor_zeta::unique_future<core::result_wrapper_t<vector::data_chunk_t>>
     transfer_scan::source_next(pipeline::context_t* ctx) {
         if (drained_) {
@@ -62,14 +77,33 @@ namespace components::operators {
         if (!opened_) {
             opened_ = true;
             remaining_offset_ = offset_val > 0 ? static_cast<uint64_t>(offset_val) : 0;
-            // offset+limit head cap pushed down (post-filter == post-scan here; no filter).
+            // offset+limit head cap pushed down (the top-N filter only exists without one).
             const int64_t scan_limit = (limit_val < 0) ? limit_val : limit_val + offset_val;
+            // The only predicate a transfer_scan ships is the top-N filter of the sort above it, and
+            // only on an integer column (the one await for the schema is paid by top-N scans alone).
+            std::unique_ptr<table::table_filter_t> filter;
+            auto top_n = std::move(top_n_filter_);
+            if (top_n && limit_val < 0 && offset_val <= 0 &&
+                (projected_cols_.empty() || top_n_column_ < projected_cols_.size())) {
+                const size_t table_column = projected_cols_.empty() ? top_n_column_ : projected_cols_[top_n_column_];
+                guard_types_loaded_ = true;
+                auto [_t, tf] = actor_zeta::send(ctx->disk_address,
+                                                 &services::disk::manager_disk_t::storage_types,
+                                                 ctx->session,
+                                                 table_oid_);
+                guard_types_ = co_await std::move(tf);
+                if (table_column < guard_types_.size() &&
+                    table::bloom_filter_t::is_integral_key(guard_types_[table_column].type())) {
+                    top_n->table_indices = std::pmr::vector<uint64_t>(1, table_column, resource_);
+                    filter = std::move(top_n);
+                }
+            }
             auto [_s, sf] = actor_zeta::send(ctx->disk_address,
                                              &services::disk::manager_disk_t::storage_fetch_next_batch,
                                              ctx->session,
                                              table_oid_,
                                              cursor_id_, // 0 == OPEN
-                                             std::unique_ptr<table::table_filter_t>(nullptr),
+                                             std::move(filter),
                                              scan_limit,
                                              projected_cols_,
                                              ctx->txn);
@@ -81,9 +115,15 @@ namespace components::operators {
             }
             auto reply = std::move(fetch_result.value());
             cursor_id_ = reply.cursor_id;
+            stash_read_ahead(reply.read_ahead);
             co_return co_await emit_or_skip(ctx, std::move(reply.batch));
         }
 
+        // Batches the agent already read ahead go out first, without a round trip.
+        if (auto ahead = take_read_ahead()) {
+            co_return co_await emit_or_skip(ctx, std::move(ahead));
+        }
+
         // ADVANCE.
         auto [_s, sf] = actor_zeta::send(ctx->disk_address,
                                          &services::disk::manager_disk_t::storage_fetch_next_batch,
@@ -101,6 +141,7 @@ namespace components::operators {
             co_return fetch_result.convert_error<vector::data_chunk_t>();
         }
         auto reply = std::move(fetch_result.value());
+        stash_read_ahead(reply.read_ahead);
         co_return co_await emit_or_skip(ctx, std::move(reply.batch));
     }
 
@@ -131,6 +172,10 @@ namespace components::operators {
             if (remaining_offset_ > 0) {
                 if (sz <= remaining_offset_) {
                     remaining_offset_ -= sz;
+                    if (auto ahead = take_read_ahead()) {
+                        batch = std::move(ahead);
+                        continue;
+                    }
                     auto [_s, sf] = actor_zeta::send(ctx->disk_address,
                                                      &services::disk::manager_disk_t::storage_fetch_next_batch,
                                                      ctx->session,
@@ -146,7 +191,9 @@ namespace components::operators {
                         mark_failed();
                         co_return fetch_result.convert_error<vector::data_chunk_t>();
                     }
-                    batch = std::move(fetch_result.value().batch);
+                    auto reply = std::move(fetch_result.value());
+                    stash_read_ahead(reply.read_ahead);
+                    batch = std::move(reply.batch);
                     continue;
                 }
                 auto trimmed = batch->partial_copy(resource_, remaining_offset_, sz - remaining_offset_);
@@ -3,7 +3,9 @@
 #include <components/catalog/catalog_oids.hpp>
 #include <components/logical_plan/node_limit.hpp>
 #include <components/physical_plan/operators/operator.hpp>
+#include <components/table/column_state.hpp>
 
+#include <deque>
 #include <vector>
 
 namespace components::operators {
@@ -26,13 +28,24 @@ namespace components::operators {
         components::catalog::oid_t table_oid() const noexcept { return table_oid_; }
         const logical_plan::limit_t& limit() const { return limit_; }
 
+        // Dynamic top-N filter from the ORDER BY ... LIMIT sort this scan feeds (see
+        // push_runtime_filters). `column` indexes the scan OUTPUT; the OPEN ships the filter as the
+        // cursor's only predicate, so the agent drops rows past the sort's current k-th key and
+        // skips segments by their zone maps. Kept only for an unlimited scan; ignored once OPENed.
+        void set_top_n_filter(size_t column, std::unique_ptr<table::top_n_filter_t> filter) {
+            top_n_column_ = column;
+            top_n_filter_ = std::move(filter);
+        }
+        void clear_runtime_filters() noexcept { top_n_filter_.reset(); }
+
         // --- Push-based streaming pipeline source (PER-BATCH FETCH-NEXT, bounded) ---
         // role()==source drives the streaming push/finalize pipeline. The FIRST source_next OPENs a
         // position-only fetch-next cursor (storage_fetch_next_batch, cursor_id==0, no filter —
         // transfer_scan is the unfiltered scan, offset+limit pushed as the head cap); each subsequent
-        // call ADVANCEs the same cursor and reads exactly ONE batch — zero pins survive a round-trip,
-        // so peak scan memory is one batch. The N sequential cross-actor awaits live in this nested
-        // operator coroutine (driven by execute_pipeline), not a behavior() handler — no lost-wakeup.
+        // call emits a read-ahead batch or ADVANCEs the same cursor (up to scan_read_ahead batches per
+        // reply) — zero pins survive a round-trip, so peak scan memory is one read-ahead window.
+        // The N sequential cross-actor awaits live in this nested operator coroutine (driven by
+        // execute_pipeline), not a behavior() handler — no lost-wakeup.
         // A no-table sentinel scan (INVALID_OID, e.g. a no-FROM `SELECT 2+3`) is ALSO a
         // source: source_next emits ONE synthetic single-row batch carrying one
         // placeholder column (so it is not the 0-column drain sentinel), then drains.
@@ -54,6 +67,7 @@ namespace components::operators {
             cursor_id_ = 0;
             remaining_offset_ = 0;
             guard_types_.clear();
+            read_ahead_.clear();
         }
 
     private:
@@ -66,6 +80,11 @@ namespace components::operators {
         actor_zeta::unique_future<core::result_wrapper_t<vector::data_chunk_t>>
         emit_or_skip(pipeline::context_t* ctx, std::unique_ptr<vector::data_chunk_t> batch);
 
+        // Queue the batches the agent shipped behind a reply's head batch / pop the next queued one
+        // (nullptr when the queue is empty and the next batch needs an ADVANCE round trip).
+        void stash_read_ahead(std::vector<vector::data_chunk_t>& batches);
+        std::unique_ptr<vector::data_chunk_t> take_read_ahead();
+
         components::catalog::oid_t table_oid_;
         const logical_plan::limit_t limit_;
         std::vector<size_t> projected_cols_;
@@ -80,6 +99,10 @@ namespace components::operators {
         uint64_t cursor_id_{0};
         uint64_t remaining_offset_{0};
         std::pmr::vector<types::complex_logical_type> guard_types_{resource_};
+        // Read-ahead batches not yet emitted (see full_scan.hpp).
+        std::pmr::deque<vector::data_chunk_t> read_ahead_{resource_};
+        size_t top_n_column_{0};
+        std::unique_ptr<table::top_n_filter_t> top_n_filter_;
     };
 
 } // namespace components::operators
\ No newline at end of file
@@ -48,6 +48,16 @@ namespace components::sort {
         int
         compare_cross(const vector::data_chunk_t& a, size_t row_a, const vector::data_chunk_t& b, size_t row_b) const;
 
+        // Column and order of the leading key; false when there is none or it is a nested path.
+        bool leading_column(size_t& index, order& order_) const {
+            if (keys_.empty() || keys_.front().col_path.size() != 1) {
+                return false;
+            }
+            index = keys_.front().col_path.front();
+            order_ = keys_.front().order_;
+            return true;
+        }
+
     private:
         static int compare_raw(const vector::vector_t& va, size_t a, const vector::vector_t& vb, size_t b);
 
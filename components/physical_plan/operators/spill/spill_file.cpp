@@ -0,0 +1,121 @@
+#include "spill_file.hpp"
+
+#include <components/vector/data_chunk_binary.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+namespace components::spill {
+
+    namespace {
+        constexpr const char* spill_extension = ".spill";
+
+        std::filesystem::path unique_name(const std::filesystem::path& directory) {
+            static std::atomic<uint64_t> counter{0};
+            auto stamp = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+            return directory /
+                   ("run_" + std::to_string(stamp) + "_" + std::to_string(counter.fetch_add(1)) + spill_extension);
+        }
+
+        core::error_t io_error(std::pmr::memory_resource* resource, const std::string& what) {
+            return core::error_t(core::error_code_t::io_error, std::pmr::string{what, resource});
+        }
+    } // namespace
+
+    auto spill_file_t::create(std::pmr::memory_resource* resource, const std::filesystem::path& directory)
+        -> core::result_wrapper_t<std::unique_ptr<spill_file_t>> {
+        core::filesystem::local_file_system_t fs;
+        if (!core::filesystem::create_directory(fs, directory)) {
+            return io_error(resource, "cannot create spill directory " + directory.string());
+        }
+        auto file = std::make_unique<spill_file_t>(resource, unique_name(directory));
+        if (!file->handle_) {
+            return io_error(resource, "cannot create spill file " + file->path_.string());
+        }
+        return file;
+    }
+
+    void spill_file_t::remove_stale(const std::filesystem::path& directory) {
+        core::filesystem::local_file_system_t fs;
+        if (!core::filesystem::directory_exists(fs, directory)) {
+            return;
+        }
+        core::filesystem::list_files(fs, directory, [&](const std::filesystem::path& name, bool is_directory) {
+            if (!is_directory && name.extension() == spill_extension) {
+                core::filesystem::remove_file(fs, directory / name);
+            }
+        });
+    }
+
+    bool spill_file_t::can_spill(const vector::data_chunk_t& chunk) {
+        for (const auto& column : chunk.data) {
+            // An unprojected placeholder column has no buffer to write.
+            if (!column.data() || !vector::is_binary_serializable(column.type())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    spill_file_t::spill_file_t(std::pmr::memory_resource* resource, std::filesystem::path path)
+        : resource_(resource)
+        , path_(std::move(path))
+        , handle_(core::filesystem::open_file(fs_,
+                                              path_,
+                                              core::filesystem::file_flags::READ | core::filesystem::file_flags::WRITE |
+                                                  core::filesystem::file_flags::FILE_CREATE_NEW)) {}
+
+    spill_file_t::~spill_file_t() {
+        if (handle_) {
+            handle_.reset();
+            core::filesystem::remove_file(fs_, path_);
+        }
+    }
+
+    core::result_wrapper_t<uint64_t> spill_file_t::append(vector::data_chunk_t& chunk) {
+        chunk.flatten();
+        chunk.row_ids.flatten(chunk.size());
+
+        services::wal::buffer_t record(resource_);
+        record.resize(sizeof(uint64_t));
+        vector::serialize_binary(chunk, record);
+        const uint64_t payload_size = record.size() - sizeof(uint64_t);
+        std::memcpy(record.data(), &payload_size, sizeof(uint64_t));
+        const size_t row_ids_size = chunk.size() * sizeof(int64_t);
+        record.append(reinterpret_cast<const char*>(chunk.row_ids.data()), row_ids_size);
+
+        const uint64_t offset = size_;
+        if (!handle_->write(record.data(), record.size(), offset)) {
+            return io_error(resource_, "cannot write spill file " + path_.string());
+        }
+        size_ += record.size();
+        return offset;
+    }
+
+    core::result_wrapper_t<vector::data_chunk_t> spill_file_t::read(uint64_t& offset,
+                                                                     std::pmr::memory_resource* resource) {
+        uint64_t payload_size = 0;
+        if (offset + sizeof(uint64_t) > size_ || !handle_->read(&payload_size, sizeof(uint64_t), offset)) {
+            return io_error(resource, "cannot read spill file " + path_.string());
+        }
+        std::pmr::string payload(payload_size, '\0', resource);
+        if (!handle_->read(payload.data(), payload_size, offset + sizeof(uint64_t))) {
+            return io_error(resource, "cannot read spill file " + path_.string());
+        }
+        bool ok = false;
+        auto chunk = vector::deserialize_binary(payload.data(), payload.size(), resource, ok);
+        if (!ok) {
+            return io_error(resource, "corrupt spill record in " + path_.string());
+        }
+        const uint64_t row_ids_size = chunk.size() * sizeof(int64_t);
+        if (row_ids_size != 0 &&
+            !handle_->read(chunk.row_ids.data(), row_ids_size, offset + sizeof(uint64_t) + payload_size)) {
+            return io_error(resource, "cannot read spill file " + path_.string());
+        }
+        offset += sizeof(uint64_t) + payload_size + row_ids_size;
+        return chunk;
+    }
+
+} // namespace components::spill
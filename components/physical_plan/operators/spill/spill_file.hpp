@@ -0,0 +1,50 @@
+#pragma once
+
+#include <components/vector/data_chunk.hpp>
+#include <core/file/local_file_system.hpp>
+#include <core/result_wrapper.hpp>
+
+#include <filesystem>
+#include <memory>
+
+namespace components::spill {
+
+    // Append-only temp file a blocking operator moves buffered chunks into once
+    // it goes over its memory budget. Each record is one flattened chunk:
+    //   [payload_size : 8][serialize_binary payload][row_ids : rows * 8]
+    // append() returns the record offset; read() takes an offset and advances it
+    // past the record, so a run of consecutive records is read back in order.
+    // The file is private to its owner and removed on destruction.
+    class spill_file_t {
+    public:
+        static auto create(std::pmr::memory_resource* resource, const std::filesystem::path& directory)
+            -> core::result_wrapper_t<std::unique_ptr<spill_file_t>>;
+
+        // Deletes *.spill files left in `directory` by a process that did not
+        // shut down cleanly. Called once at startup, before any query runs.
+        static void remove_stale(const std::filesystem::path& directory);
+
+        // True when every column of `chunk` round-trips through the record
+        // format. Chunks with nested, user-typed or unprojected placeholder
+        // columns stay in memory.
+        static bool can_spill(const vector::data_chunk_t& chunk);
+
+        spill_file_t(std::pmr::memory_resource* resource, std::filesystem::path path);
+        ~spill_file_t();
+        spill_file_t(const spill_file_t&) = delete;
+        spill_file_t& operator=(const spill_file_t&) = delete;
+
+        core::result_wrapper_t<uint64_t> append(vector::data_chunk_t& chunk);
+        core::result_wrapper_t<vector::data_chunk_t> read(uint64_t& offset, std::pmr::memory_resource* resource);
+
+        uint64_t size() const noexcept { return size_; }
+
+    private:
+        std::pmr::memory_resource* resource_;
+        std::filesystem::path path_;
+        core::filesystem::local_file_system_t fs_;
+        std::unique_ptr<core::filesystem::file_handle_t> handle_;
+        uint64_t size_{0};
+    };
+
+} // namespace components::spill
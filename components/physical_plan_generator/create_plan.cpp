@@ -6,6 +6,7 @@
 #include "impl/create_plan_alter_column_add.hpp"
 #include "impl/create_plan_alter_column_drop.hpp"
 #include "impl/create_plan_alter_column_rename.hpp"
+#include "impl/create_plan_analyze.hpp"
 #include "impl/create_plan_begin_transaction.hpp"
 #include "impl/create_plan_check_constraint.hpp"
 #include "impl/create_plan_checkpoint.hpp"
@@ -121,6 +122,8 @@ namespace services::planner {
                 return impl::create_plan_set_timezone(context, node);
             case node_type::vacuum_t:
                 return impl::create_plan_vacuum(context, node);
+            case node_type::analyze_t:
+                return impl::create_plan_analyze(context, node);
             case node_type::create_matview_t:
                 return impl::create_plan_create_matview(context, function_registry, node, params);
             case node_type::unregister_udf_t:
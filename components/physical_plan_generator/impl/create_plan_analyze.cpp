@@ -0,0 +1,30 @@
+#include "create_plan_analyze.hpp"
+
+#include <components/logical_plan/node_analyze.hpp>
+#include <components/physical_plan/operators/operator_analyze.hpp>
+
+namespace services::planner::impl {
+
+    components::operators::operator_ptr create_plan_analyze(const context_storage_t& context,
+                                                            const components::logical_plan::node_ptr& node) {
+        const auto* analyze = static_cast<const components::logical_plan::node_analyze_t*>(node.get());
+        // Column names -> storage positions. The executor has already rejected
+        // names the table does not have.
+        std::vector<size_t> columns;
+        if (const auto* md = context.table_metadata_for(node->table_oid())) {
+            for (const auto& name : analyze->columns()) {
+                for (const auto& col : md->columns) {
+                    if (std::string_view(col.attname) == std::string_view(name) && col.chunk_position >= 0) {
+                        columns.push_back(static_cast<size_t>(col.chunk_position));
+                        break;
+                    }
+                }
+            }
+        }
+        return boost::intrusive_ptr(new components::operators::operator_analyze_t(context.resource,
+                                                                                  context.log.clone(),
+                                                                                  node->table_oid(),
+                                                                                  std::move(columns)));
+    }
+
+} // namespace services::planner::impl
@@ -34,17 +34,22 @@ namespace services::planner::impl {
         using join_type = components::logical_plan::join_type;
         using join_algo = components::logical_plan::node_join_t::join_algo;
 
-        // Equi-join fast path: the optimizer rule rewrite_hash_joins detected a single
-        // eq(left.key, right.key) ON condition and stamped algo()==hash plus the matched
-        // equi-key column indices. Lower straight to operator_hash_join_t (O(L+R)). No
-        // detection here — the annotation is the single source of truth.
+        // Equi-join fast path: the optimizer rule rewrite_hash_joins found eq(left.key,
+        // right.key) conjuncts in the ON condition and stamped algo()==hash plus the
+        // equi-key column pairs and the residual condition. Lower straight to
+        // operator_hash_join_t (O(L+R)). No detection here — the annotation is the
+        // single source of truth.
         if (join_node->algo() == join_algo::hash) {
-            components::operators::operator_ptr hash_join =
+            auto hash_join_op =
                 boost::intrusive_ptr(new components::operators::operator_hash_join_t(resource,
                                                                                      log.clone(),
                                                                                      join_node->type(),
-                                                                                     join_node->left_col(),
-                                                                                     join_node->right_col()));
+                                                                                     join_node->left_cols(),
+                                                                                     join_node->right_cols(),
+                                                                                     join_node->residual()));
+            // The root of a reordered join tree restores the query's column order.
+            hash_join_op->set_output_order(join_node->output_order());
+            components::operators::operator_ptr hash_join = std::move(hash_join_op);
             // Push the LIMIT down to whichever side an outer join preserves. The hash
             // path covers inner/left/right/full only (cross never carries an equi-key).
             auto hash_limit_left = components::logical_plan::limit_t::unlimit();
@@ -80,10 +85,12 @@ namespace services::planner::impl {
         const auto& expression = node->expressions()[0];
 
         // Nested-loop join. Equi-join selection (the eq(left.key, right.key) fast
-        // path) happens in the optimizer (rewrite_hash_joins), which stamps the hash
+        // path, composite keys and residuals included) happens in the optimizer (rewrite_hash_joins), which stamps the hash
         // annotation handled above; anything left as a plain join_t lands here.
-        components::operators::operator_ptr join = boost::intrusive_ptr(
+        auto join_op = boost::intrusive_ptr(
             new components::operators::operator_join_t(resource, std::move(log), join_node->type(), expression));
+        join_op->set_output_order(join_node->output_order());
+        components::operators::operator_ptr join = std::move(join_op);
 
         auto limit_left = components::logical_plan::limit_t::unlimit();
         auto limit_right = components::logical_plan::limit_t::unlimit();
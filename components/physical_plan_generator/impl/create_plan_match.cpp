@@ -11,6 +11,9 @@
 #include <components/physical_plan/operators/scan/full_scan.hpp>
 #include <components/physical_plan/operators/scan/index_scan.hpp>
 #include <components/physical_plan/operators/scan/transfer_scan.hpp>
+#include <components/planner/optimizer/selectivity.hpp>
+
+#include <limits>
 
 namespace services::planner::impl {
 
@@ -73,6 +76,45 @@ namespace services::planner::impl {
             return false;
         }
 
+        // An index scan fetches matching rows one at a time; once a predicate
+        // keeps more than this fraction of the table a full scan reads less.
+        constexpr double index_scan_max_selectivity = 0.2;
+
+        // Storage column of `key`: by name through the resolved table metadata,
+        // else the stamped path. SIZE_MAX when unknown.
+        size_t column_position(const components::logical_plan::resolved_table_metadata_t* md,
+                               const expr::key_t& key) {
+            if (md) {
+                const auto name = key.as_string();
+                for (const auto& col : md->columns) {
+                    if (col.attname == name && col.chunk_position >= 0) {
+                        return static_cast<size_t>(col.chunk_position);
+                    }
+                }
+            }
+            return key.path().empty() ? std::numeric_limits<size_t>::max() : key.path()[0];
+        }
+
+        // Only ANALYZE statistics (MCVs, histogram) are trusted to turn an index
+        // down; without them the index is always taken, as before.
+        bool index_pays_off(const context_storage_t& context,
+                            components::catalog::oid_t table_oid,
+                            const expr::compare_expression_ptr& comp) {
+            auto it = context.statistics.find(table_oid);
+            if (it == context.statistics.end() || !it->second.analyzed) {
+                return true;
+            }
+            const auto* md = context.table_metadata_for(table_oid);
+            const auto* stats = &it->second;
+            const double selectivity = components::planner::optimizer::estimate_selectivity(
+                comp,
+                [md, stats](const expr::key_t& key) {
+                    return components::planner::optimizer::column_ref_t{stats, column_position(md, key)};
+                },
+                context.parameters);
+            return selectivity <= index_scan_max_selectivity;
+        }
+
         bool is_pure_compare(const components::expressions::expression_ptr& expr) {
             using namespace components::expressions;
             if (expr->group() != expression_group::compare) {
@@ -109,7 +151,8 @@ namespace services::planner::impl {
                     // Index selection: detect if an index is available for this predicate.
                     if (!comp_expr->is_union()) {
                         bool key_on_left = true;
-                        if (can_use_index(context, *comp_expr, key_on_left)) {
+                        if (can_use_index(context, *comp_expr, key_on_left) &&
+                            index_pays_off(context, table_oid, comp_expr)) {
                             auto& key = key_on_left ? std::get<expr::key_t>(comp_expr->left())
                                                     : std::get<expr::key_t>(comp_expr->right());
                             auto param_id = key_on_left ? std::get<core::parameter_id_t>(comp_expr->right())
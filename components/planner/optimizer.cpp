@@ -2,27 +2,36 @@
 
 #include "optimizer/rules/constant_folding.hpp"
 #include "optimizer/rules/hash_join.hpp"
+#include "optimizer/rules/join_order.hpp"
 #include "optimizer/rules/pushdown_filter.hpp"
 
 namespace components::planner {
 
     logical_plan::node_ptr optimize(std::pmr::memory_resource* resource,
                                     logical_plan::node_ptr node,
-                                    logical_plan::parameter_node_t* parameters) {
+                                    logical_plan::parameter_node_t* parameters,
+                                    const optimizer::statistics_map_t* statistics,
+                                    bool* folded_constants) {
         if (!node) {
             return nullptr;
         }
 
         // Single post-planner pass. Order matters: fold constants on parameter
-        // expressions, push filters down, then select hash joins. Hash-join
+        // expressions, push filters down, reorder joins, then select hash joins.
+        // Join ordering rebuilds inner/cross join trees with nested conditions, so
+        // it must precede hash-join selection, which annotates them. Hash-join
         // selection reads key.side()/key.path() stamped by validate_schema,
         // which has already run. All rules are safe here — the planner wraps
         // DML on top and lowers DDL to sequences, leaving the
         // match_t/join_t/aggregate_t these rules target intact.
-        if (parameters) {
-            optimizer::fold_constants(resource, node, parameters);
+        const bool folded = parameters && optimizer::fold_constants(resource, node, parameters);
+        if (folded_constants) {
+            *folded_constants = folded;
         }
         node = optimizer::pushdown_filter(resource, node);
+        if (statistics && !statistics->empty()) {
+            node = optimizer::reorder_joins(resource, std::move(node), parameters, *statistics);
+        }
         node = optimizer::rewrite_hash_joins(resource, std::move(node));
 
         return node;
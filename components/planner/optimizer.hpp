@@ -3,6 +3,8 @@
 #include <components/logical_plan/node.hpp>
 #include <components/logical_plan/param_storage.hpp>
 
+#include "optimizer/statistics.hpp"
+
 namespace components::planner {
 
     // Single optimization pass. Runs AFTER the planner rewrite, i.e. after
@@ -13,12 +15,18 @@ namespace components::planner {
     // Rules (in order):
     //   - constant_folding (on parameter expressions)
     //   - pushdown_filter
+    //   - join ordering (only with `statistics`: row counts and min/max/NULL
+    //     counts of the joined tables, see optimizer::join_leaf_tables)
     //   - hash_join selection (needs the validate_schema stamps)
     // On DDL trees (sequence_t of primitive writes) it is a harmless no-op:
     // the planner leaves the match_t/join_t/aggregate_t these rules target
     // intact (DML wrappers sit on top; DDL has no such nodes).
+    // `folded_constants`, when given, is set to whether constant_folding
+    // folded anything, i.e. whether the result depends on the parameter values.
     logical_plan::node_ptr optimize(std::pmr::memory_resource* resource,
                                     logical_plan::node_ptr node,
-                                    logical_plan::parameter_node_t* parameters);
+                                    logical_plan::parameter_node_t* parameters,
+                                    const optimizer::statistics_map_t* statistics = nullptr,
+                                    bool* folded_constants = nullptr);
 
 } // namespace components::planner
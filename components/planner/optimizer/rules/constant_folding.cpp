@@ -120,19 +120,19 @@ namespace components::planner::optimizer {
         }
 
         // Try to fold a compare expression where both sides are constant parameters
-        void try_fold_compare(compare_expression_t& expr, parameter_node_t* parameters) {
+        bool try_fold_compare(compare_expression_t& expr, parameter_node_t* parameters) {
             // Only fold leaf comparisons (not union_and/or/not)
             if (is_union_compare_condition(expr.type())) {
-                return;
+                return false;
             }
             if (expr.type() == compare_type::all_true || expr.type() == compare_type::all_false || expr.do_not_fold()) {
-                return;
+                return false;
             }
 
             // Both sides must be parameter_id_t
             if (!std::holds_alternative<core::parameter_id_t>(expr.left()) ||
                 !std::holds_alternative<core::parameter_id_t>(expr.right())) {
-                return;
+                return false;
             }
 
             auto left_id = std::get<core::parameter_id_t>(expr.left());
@@ -147,6 +147,7 @@ namespace components::planner::optimizer {
             } else {
                 assert(false);
             }
+            return ok;
         }
 
         // Check if a union expression's children are all folded to a specific type
@@ -203,34 +204,42 @@ namespace components::planner::optimizer {
             }
         }
 
-        void fold_expression(std::pmr::memory_resource* resource, expression_ptr& expr, parameter_node_t* parameters);
+        // `folded` is raised once any expression is folded.
+        void fold_expression(std::pmr::memory_resource* resource,
+                             expression_ptr& expr,
+                             parameter_node_t* parameters,
+                             bool& folded);
 
-        void
-        fold_scalar(std::pmr::memory_resource* resource, scalar_expression_t* scalar, parameter_node_t* parameters) {
+        void fold_scalar(std::pmr::memory_resource* resource,
+                         scalar_expression_t* scalar,
+                         parameter_node_t* parameters,
+                         bool& folded) {
             for (auto& param : scalar->params()) {
                 if (!std::holds_alternative<expression_ptr>(param)) {
                     continue;
                 }
-                fold_expression(resource, std::get<expression_ptr>(param), parameters);
+                fold_expression(resource, std::get<expression_ptr>(param), parameters, folded);
                 try_promote_scalar(param);
             }
-            try_fold_scalar(resource, *scalar, parameters);
+            folded |= try_fold_scalar(resource, *scalar, parameters);
         }
 
-        void
-        fold_compare(std::pmr::memory_resource* resource, compare_expression_t* comp, parameter_node_t* parameters) {
+        void fold_compare(std::pmr::memory_resource* resource,
+                          compare_expression_t* comp,
+                          parameter_node_t* parameters,
+                          bool& folded) {
             for (auto& child : comp->children()) {
-                fold_expression(resource, child, parameters);
+                fold_expression(resource, child, parameters, folded);
             }
             if (std::holds_alternative<expression_ptr>(comp->left())) {
-                fold_expression(resource, std::get<expression_ptr>(comp->left()), parameters);
+                fold_expression(resource, std::get<expression_ptr>(comp->left()), parameters, folded);
                 try_promote_scalar(comp->left());
             }
             if (std::holds_alternative<expression_ptr>(comp->right())) {
-                fold_expression(resource, std::get<expression_ptr>(comp->right()), parameters);
+                fold_expression(resource, std::get<expression_ptr>(comp->right()), parameters, folded);
                 try_promote_scalar(comp->right());
             }
-            try_fold_compare(*comp, parameters);
+            folded |= try_fold_compare(*comp, parameters);
             simplify_union(comp);
             if (comp->type() == compare_type::union_and || comp->type() == compare_type::union_or) {
                 const auto neutral =
@@ -249,14 +258,17 @@ namespace components::planner::optimizer {
             }
         }
 
-        void fold_expression(std::pmr::memory_resource* resource, expression_ptr& expr, parameter_node_t* parameters) {
+        void fold_expression(std::pmr::memory_resource* resource,
+                             expression_ptr& expr,
+                             parameter_node_t* parameters,
+                             bool& folded) {
             if (!expr) {
                 return;
             }
             if (expr->group() == expression_group::scalar) {
-                fold_scalar(resource, static_cast<scalar_expression_t*>(expr.get()), parameters);
+                fold_scalar(resource, static_cast<scalar_expression_t*>(expr.get()), parameters, folded);
             } else if (expr->group() == expression_group::compare) {
-                fold_compare(resource, static_cast<compare_expression_t*>(expr.get()), parameters);
+                fold_compare(resource, static_cast<compare_expression_t*>(expr.get()), parameters, folded);
                 auto* comp = static_cast<compare_expression_t*>(expr.get());
                 if ((comp->type() == compare_type::union_and || comp->type() == compare_type::union_or) &&
                     comp->children().size() == 1) {
@@ -267,16 +279,17 @@ namespace components::planner::optimizer {
 
     } // namespace
 
-    void fold_constants(std::pmr::memory_resource* resource,
+    bool fold_constants(std::pmr::memory_resource* resource,
                         const logical_plan::node_ptr& node,
                         logical_plan::parameter_node_t* parameters) {
         if (!node) {
-            return;
+            return false;
         }
 
         // BFS collect all nodes, then process in reverse (bottom-up)
         std::vector<logical_plan::node_ptr> stack{node};
         std::vector<logical_plan::node_ptr> order;
+        bool folded = false;
         while (!stack.empty()) {
             auto current = std::move(stack.back());
             stack.pop_back();
@@ -291,9 +304,10 @@ namespace components::planner::optimizer {
                 continue;
             }
             for (auto& expr : (*it)->expressions()) {
-                fold_expression(resource, expr, parameters);
+                fold_expression(resource, expr, parameters, folded);
             }
         }
+        return folded;
     }
 
 } // namespace components::planner::optimizer
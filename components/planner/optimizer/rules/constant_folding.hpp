@@ -5,7 +5,10 @@
 
 namespace components::planner::optimizer {
 
-    void fold_constants(std::pmr::memory_resource* resource,
+    // Folds comparisons and arithmetic over two parameters into their value.
+    // Returns true when anything was folded: the plan then holds this
+    // execution's parameter values and is not reusable with other ones.
+    bool fold_constants(std::pmr::memory_resource* resource,
                         const logical_plan::node_ptr& node,
                         logical_plan::parameter_node_t* parameters);
 
@@ -3,6 +3,7 @@
 #include <optional>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <components/expressions/compare_expression.hpp>
 #include <components/logical_plan/node_join.hpp>
@@ -13,12 +14,11 @@ namespace components::planner::optimizer {
         namespace ce = components::expressions;
         namespace lp = components::logical_plan;
 
-        // Detect a single equi-comparison `eq(left.key, right.key)` and return the
+        // Detect an equi-comparison `eq(left.key, right.key)` and return the
         // (left_col, right_col) column indices into each side's input chunk. The
         // validator stamps key.side()/key.path() during JOIN validation, so we rely on
-        // those. Returns nullopt for anything else — non-eq comparisons, AND/union
-        // conditions (group() == compare but type() != eq), const operands, or two keys
-        // on the same side — and the join is left as a nested-loop join.
+        // those. Returns nullopt for anything else — non-eq comparisons, const
+        // operands, or two keys on the same side.
         std::optional<std::pair<size_t, size_t>> detect_equi_columns(const ce::expression_ptr& expr) {
             if (!expr || expr->group() != ce::expression_group::compare) {
                 return std::nullopt;
@@ -34,8 +34,8 @@ namespace components::planner::optimizer {
             const auto& rk = std::get<ce::key_t>(cmp->right());
             // Only a single top-level column maps to a hash-table probe. A multi-element
             // path is a nested-struct/UDT field access (e.g. `(custom_type).f1`); path()[0]
-            // would address the whole struct column, not the scalar being compared, so we
-            // leave those to the nested-loop join, which evaluates the full path correctly.
+            // would address the whole struct column, not the scalar being compared, so such
+            // a conjunct stays in the residual, which evaluates the full path correctly.
             if (lk.path().size() != 1 || rk.path().size() != 1) {
                 return std::nullopt;
             }
@@ -48,6 +48,20 @@ namespace components::planner::optimizer {
             return std::nullopt;
         }
 
+        // Flatten nested AND conditions into their conjuncts.
+        void split_conjuncts(const ce::expression_ptr& expr, std::vector<ce::expression_ptr>& out) {
+            if (expr && expr->group() == ce::expression_group::compare) {
+                const auto* cmp = static_cast<const ce::compare_expression_t*>(expr.get());
+                if (cmp->type() == ce::compare_type::union_and) {
+                    for (const auto& child : cmp->children()) {
+                        split_conjuncts(child, out);
+                    }
+                    return;
+                }
+            }
+            out.push_back(expr);
+        }
+
         // CROSS has no equi-condition; INVALID is rejected during planning. The hash
         // path implements inner / left / right / full only.
         bool is_equi_joinable(lp::join_type t) {
@@ -59,7 +73,7 @@ namespace components::planner::optimizer {
         // column indices) onto it in place and return it; otherwise return `node`
         // unchanged. The node stays a node_join_t — the choice of hash vs nested-loop
         // is an annotation, not a separate node type.
-        lp::node_ptr try_rewrite_join(const lp::node_ptr& node) {
+        lp::node_ptr try_rewrite_join(std::pmr::memory_resource* resource, const lp::node_ptr& node) {
             if (node->type() != lp::node_type::join_t) {
                 return node;
             }
@@ -67,29 +81,54 @@ namespace components::planner::optimizer {
             if (!is_equi_joinable(join->type()) || node->expressions().empty()) {
                 return node;
             }
-            auto equi = detect_equi_columns(node->expressions().front());
-            if (!equi) {
+            // Every eq(left.key, right.key) conjunct becomes a hash-key column pair;
+            // whatever is left is AND-ed back into the residual the hash join checks
+            // on key-matched pairs. No equi conjunct at all keeps the nested loop.
+            std::vector<ce::expression_ptr> conjuncts;
+            split_conjuncts(node->expressions().front(), conjuncts);
+            std::pmr::vector<size_t> left_cols(resource);
+            std::pmr::vector<size_t> right_cols(resource);
+            std::vector<ce::expression_ptr> residual;
+            for (const auto& conjunct : conjuncts) {
+                if (auto equi = detect_equi_columns(conjunct)) {
+                    left_cols.push_back(equi->first);
+                    right_cols.push_back(equi->second);
+                } else {
+                    residual.push_back(conjunct);
+                }
+            }
+            if (left_cols.empty()) {
                 return node;
             }
-            // The equi-key indices are all the hash-join operator needs; set_equi_columns
-            // also flips algo() to hash so create_plan_join lowers it to operator_hash_join_t.
-            join->set_equi_columns(equi->first, equi->second);
+            ce::expression_ptr residual_expr;
+            if (residual.size() == 1) {
+                residual_expr = residual.front();
+            } else if (!residual.empty()) {
+                auto conj = ce::make_compare_union_expression(resource, ce::compare_type::union_and);
+                for (const auto& conjunct : residual) {
+                    conj->append_child(conjunct);
+                }
+                residual_expr = conj;
+            }
+            // set_equi_columns also flips algo() to hash so create_plan_join lowers
+            // it to operator_hash_join_t.
+            join->set_equi_columns(std::move(left_cols), std::move(right_cols), std::move(residual_expr));
             return node;
         }
 
-        lp::node_ptr walk(const lp::node_ptr& node) {
+        lp::node_ptr walk(std::pmr::memory_resource* resource, const lp::node_ptr& node) {
             if (!node) {
                 return node;
             }
             for (auto& child : node->children()) {
-                child = walk(child);
+                child = walk(resource, child);
             }
-            return try_rewrite_join(node);
+            return try_rewrite_join(resource, node);
         }
     } // namespace
 
-    logical_plan::node_ptr rewrite_hash_joins(std::pmr::memory_resource* /*resource*/, logical_plan::node_ptr root) {
-        return walk(root);
+    logical_plan::node_ptr rewrite_hash_joins(std::pmr::memory_resource* resource, logical_plan::node_ptr root) {
+        return walk(resource, root);
     }
 
 } // namespace components::planner::optimizer
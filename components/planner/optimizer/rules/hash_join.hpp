@@ -4,14 +4,15 @@
 
 namespace components::planner::optimizer {
 
-    // Stamps a hash-algo annotation on every node_join_t whose ON condition is a
-    // single eq(left.key, right.key) — and whose join type is inner/left/right/full —
-    // by calling node_join_t::set_equi_columns(left_col, right_col), which records the
-    // matched column indices and flips node_join_t::algo() to hash. The planner
-    // (create_plan_join) reads the annotation and lowers it to operator_hash_join_t
-    // (O(L+R)); any join the rule leaves as nested keeps the nested-loop
-    // operator_join_t. The equi-detection lives here, not in the planner, so the
-    // planner stays a pure 1:1 lowering.
+    // Stamps a hash-algo annotation on every inner/left/right/full node_join_t whose
+    // ON condition has at least one eq(left.key, right.key) conjunct. The condition is
+    // split on AND: each such conjunct becomes a key column pair of a (possibly
+    // multi-column) hash key, and the other conjuncts are AND-ed into a residual
+    // predicate checked on key-matched pairs. node_join_t::set_equi_columns records
+    // both and flips node_join_t::algo() to hash. The planner (create_plan_join) reads
+    // the annotation and lowers it to operator_hash_join_t (O(L+R)); any join the rule
+    // leaves as nested keeps the nested-loop operator_join_t. The equi-detection lives
+    // here, not in the planner, so the planner stays a pure 1:1 lowering.
     //
     // Must run AFTER validate_schema, which stamps key.side()/key.path() — the rule
     // reads those to identify the equi columns.
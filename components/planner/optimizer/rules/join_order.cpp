@@ -0,0 +1,769 @@
+#include "join_order.hpp"
+
+#include "../selectivity.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <components/catalog/catalog_codes.hpp>
+#include <components/expressions/compare_expression.hpp>
+#include <components/logical_plan/node_aggregate.hpp>
+#include <components/logical_plan/node_catalog_resolve.hpp>
+#include <components/logical_plan/node_join.hpp>
+#include <components/logical_plan/node_match.hpp>
+
+namespace components::planner::optimizer {
+
+    namespace {
+
+        namespace ce = components::expressions;
+        namespace lp = components::logical_plan;
+
+        // Bit i of a relset_t stands for leaf i of the region.
+        using relset_t = uint64_t;
+        constexpr size_t max_region_leaves = 64;
+        constexpr size_t dp_max_leaves = 10;
+        constexpr size_t no_plan = std::numeric_limits<size_t>::max();
+
+        struct table_info_t {
+            size_t column_count;
+            char relkind;
+        };
+        using table_info_map_t = std::unordered_map<catalog::oid_t, table_info_t>;
+
+        // Column counts and relkinds from the catalog_resolve_t (table) nodes that
+        // enrich stamped with resolved_metadata(); same walk as column_pruning.
+        void collect_tables(const lp::node_ptr& root, table_info_map_t& out) {
+            std::vector<const lp::node_t*> stack{root.get()};
+            while (!stack.empty()) {
+                const auto* node = stack.back();
+                stack.pop_back();
+                if (!node) {
+                    continue;
+                }
+                if (node->type() == lp::node_type::catalog_resolve_t) {
+                    const auto* resolve = static_cast<const lp::node_catalog_resolve_t*>(node);
+                    const auto& md = resolve->resolved_metadata();
+                    if (resolve->kind() == lp::resolve_kind::table && md && md->table_oid != catalog::INVALID_OID) {
+                        out[md->table_oid] = table_info_t{md->columns.size(), md->relkind};
+                    }
+                }
+                for (const auto& child : node->children()) {
+                    stack.push_back(child.get());
+                }
+            }
+        }
+
+        bool is_region_join(const lp::node_ptr& node) {
+            if (!node || node->type() != lp::node_type::join_t || node->children().size() != 2) {
+                return false;
+            }
+            const auto* join = static_cast<const lp::node_join_t*>(node.get());
+            return (join->type() == lp::join_type::inner || join->type() == lp::join_type::cross) &&
+                   join->algo() == lp::node_join_t::join_algo::nested && join->output_order().empty();
+        }
+
+        // A scan of a regular table: an aggregate_t bound to a resolved table whose
+        // only children are its own match_t filters (a CTE or subquery reference
+        // carries its body as a child and is not a leaf).
+        bool is_table_leaf(const lp::node_ptr& node, const table_info_map_t& tables, size_t& width) {
+            if (node->type() != lp::node_type::aggregate_t) {
+                return false;
+            }
+            auto it = tables.find(node->table_oid());
+            if (it == tables.end() || it->second.relkind != catalog::relkind::regular) {
+                return false;
+            }
+            for (const auto& child : node->children()) {
+                if (child->type() != lp::node_type::match_t) {
+                    return false;
+                }
+            }
+            width = it->second.column_count;
+            return true;
+        }
+
+        std::vector<ce::expression_ptr> split_conjuncts(const ce::expression_ptr& expr) {
+            std::vector<ce::expression_ptr> result;
+            if (!expr) {
+                return result;
+            }
+            if (expr->group() == ce::expression_group::compare) {
+                const auto* cmp = static_cast<const ce::compare_expression_t*>(expr.get());
+                if (cmp->type() == ce::compare_type::union_and) {
+                    for (const auto& child : cmp->children()) {
+                        auto sub = split_conjuncts(child);
+                        result.insert(result.end(), sub.begin(), sub.end());
+                    }
+                    return result;
+                }
+                if (cmp->type() == ce::compare_type::all_true) {
+                    return result;
+                }
+            }
+            result.push_back(expr);
+            return result;
+        }
+
+        ce::expression_ptr rebuild_conjunction(std::pmr::memory_resource* resource,
+                                               const std::vector<ce::expression_ptr>& conjuncts) {
+            if (conjuncts.empty()) {
+                return nullptr;
+            }
+            if (conjuncts.size() == 1) {
+                return conjuncts.front();
+            }
+            auto conjunction = ce::make_compare_union_expression(resource, ce::compare_type::union_and);
+            for (const auto& conjunct : conjuncts) {
+                conjunction->append_child(conjunct);
+            }
+            return conjunction;
+        }
+
+        // New side and first path element for a key; nullopt rejects the key.
+        using key_target_t = std::optional<std::pair<ce::side_t, size_t>>;
+        using key_remap_t = std::function<key_target_t(const ce::key_t&)>;
+
+        std::optional<ce::param_storage> remap_operand(const ce::param_storage& operand, const key_remap_t& remap) {
+            if (std::holds_alternative<core::parameter_id_t>(operand)) {
+                return operand;
+            }
+            if (!std::holds_alternative<ce::key_t>(operand)) {
+                return std::nullopt;
+            }
+            ce::key_t key = std::get<ce::key_t>(operand);
+            if (key.path().empty()) {
+                return std::nullopt;
+            }
+            auto target = remap(key);
+            if (!target) {
+                return std::nullopt;
+            }
+            key.set_side(target->first);
+            key.path()[0] = target->second;
+            return ce::param_storage{std::move(key)};
+        }
+
+        // Copy of a compare tree with every key re-addressed by `remap`. The plan's
+        // own expressions are never mutated: they may be shared with a cached plan.
+        // nullptr when a leaf is not a compare over keys and parameters.
+        ce::expression_ptr
+        remap_keys(std::pmr::memory_resource* resource, const ce::expression_ptr& expr, const key_remap_t& remap) {
+            if (!expr || expr->group() != ce::expression_group::compare) {
+                return nullptr;
+            }
+            const auto* cmp = static_cast<const ce::compare_expression_t*>(expr.get());
+            if (cmp->is_union()) {
+                auto result = ce::make_compare_union_expression(resource, cmp->type());
+                for (const auto& child : cmp->children()) {
+                    auto remapped = remap_keys(resource, child, remap);
+                    if (!remapped) {
+                        return nullptr;
+                    }
+                    result->append_child(remapped);
+                }
+                return result;
+            }
+            auto left = remap_operand(cmp->left(), remap);
+            auto right = remap_operand(cmp->right(), remap);
+            if (!left || !right) {
+                return nullptr;
+            }
+            auto result = ce::make_compare_expression(resource, cmp->type(), *left, *right);
+            result->set_inner_op(cmp->inner_op());
+            if (cmp->do_not_fold()) {
+                result->make_unfoldable();
+            }
+            return result;
+        }
+
+        void for_each_key(const ce::expression_ptr& expr, const std::function<void(const ce::key_t&)>& fn) {
+            const auto* cmp = static_cast<const ce::compare_expression_t*>(expr.get());
+            if (cmp->is_union()) {
+                for (const auto& child : cmp->children()) {
+                    for_each_key(child, fn);
+                }
+                return;
+            }
+            if (const auto* key = std::get_if<ce::key_t>(&cmp->left())) {
+                fn(*key);
+            }
+            if (const auto* key = std::get_if<ce::key_t>(&cmp->right())) {
+                fn(*key);
+            }
+        }
+
+        // Shapes a table scan evaluates by itself: column-vs-parameter comparisons
+        // (column first) and IS [NOT] NULL, under AND/OR/NOT.
+        bool is_scan_filter(const ce::expression_ptr& expr) {
+            const auto* cmp = static_cast<const ce::compare_expression_t*>(expr.get());
+            if (cmp->is_union()) {
+                return !cmp->children().empty() && std::all_of(cmp->children().begin(),
+                                                               cmp->children().end(),
+                                                               [](const auto& child) { return is_scan_filter(child); });
+            }
+            if (!std::holds_alternative<ce::key_t>(cmp->left())) {
+                return false;
+            }
+            switch (cmp->type()) {
+                case ce::compare_type::is_null:
+                case ce::compare_type::is_not_null:
+                    return true;
+                case ce::compare_type::eq:
+                case ce::compare_type::ne:
+                case ce::compare_type::gt:
+                case ce::compare_type::lt:
+                case ce::compare_type::gte:
+                case ce::compare_type::lte:
+                case ce::compare_type::regex:
+                case ce::compare_type::any:
+                case ce::compare_type::all:
+                    return std::holds_alternative<core::parameter_id_t>(cmp->right());
+                default:
+                    return false;
+            }
+        }
+
+        struct leaf_t {
+            lp::node_ptr node;
+            size_t offset; // first column in the region's original layout
+            size_t width;
+            const table_stats_estimate_t* stats{nullptr};
+            double rows{0};
+        };
+
+        struct conjunct_t {
+            ce::expression_ptr expr; // keys: side left, path[0] in the original layout
+            relset_t leaves{0};
+            double selectivity{1};
+            bool pushed{false}; // became a scan filter of its only leaf
+            bool placed{false};
+        };
+
+        struct region_t {
+            std::vector<leaf_t> leaves;
+            std::vector<conjunct_t> conjuncts;
+            size_t width{0};
+
+            size_t leaf_of(size_t column) const {
+                auto it = std::upper_bound(leaves.begin(), leaves.end(), column, [](size_t c, const leaf_t& leaf) {
+                    return c < leaf.offset;
+                });
+                return static_cast<size_t>(it - leaves.begin()) - 1;
+            }
+        };
+
+        // Column references into the region's layout for the shared estimates.
+        class estimator_t {
+        public:
+            estimator_t(const region_t& region, const lp::parameter_node_t* parameters)
+                : region_(region)
+                , parameters_(parameters ? &parameters->parameters() : nullptr) {}
+
+            double selectivity(const ce::expression_ptr& expr) const {
+                return estimate_selectivity(
+                    expr,
+                    [this](const ce::key_t& key) { return column(key.path()[0]); },
+                    parameters_);
+            }
+
+            double table_rows(size_t leaf) const { return column_ref_t{region_.leaves[leaf].stats}.rows(); }
+
+        private:
+            column_ref_t column(size_t column) const {
+                const auto& leaf = region_.leaves[region_.leaf_of(column)];
+                return column_ref_t{leaf.stats, column - leaf.offset};
+            }
+
+            const region_t& region_;
+            const lp::storage_parameters* parameters_;
+        };
+
+        // One entry of the enumerator's arena: a leaf or the join of two entries.
+        struct plan_t {
+            relset_t set;
+            double rows;
+            double cost;
+            size_t left{no_plan}; // probe side
+            size_t right{no_plan}; // build side
+            size_t leaf{0};
+        };
+
+        class join_planner_t {
+        public:
+            explicit join_planner_t(const region_t& region)
+                : region_(region) {
+                for (const auto& conjunct : region_.conjuncts) {
+                    if (!conjunct.pushed && std::popcount(conjunct.leaves) > 1) {
+                        edges_.push_back(&conjunct);
+                    }
+                }
+                for (size_t i = 0; i < region_.leaves.size(); ++i) {
+                    plans_.push_back(plan_t{relset_t{1} << i, region_.leaves[i].rows, 0, no_plan, no_plan, i});
+                }
+            }
+
+            size_t plan() { return region_.leaves.size() <= dp_max_leaves ? plan_dp() : plan_greedy(); }
+
+            const plan_t& at(size_t index) const { return plans_[index]; }
+
+        private:
+            double cardinality(relset_t set) const {
+                double rows = 1;
+                for (relset_t rest = set; rest; rest &= rest - 1) {
+                    rows *= region_.leaves[std::countr_zero(rest)].rows;
+                }
+                for (const auto* edge : edges_) {
+                    if ((edge->leaves & ~set) == 0) {
+                        rows *= edge->selectivity;
+                    }
+                }
+                return std::max(rows, 1.0);
+            }
+
+            bool connected(relset_t a, relset_t b) const {
+                return std::any_of(edges_.begin(), edges_.end(), [a, b](const conjunct_t* edge) {
+                    return (edge->leaves & ~(a | b)) == 0 && (edge->leaves & a) && (edge->leaves & b);
+                });
+            }
+
+            double join_cost(const plan_t& a, const plan_t& b, double rows) const {
+                return a.cost + b.cost + rows + std::min(a.rows, b.rows);
+            }
+
+            size_t make_join(size_t a, size_t b, double rows) {
+                const auto& pa = plans_[a];
+                const auto& pb = plans_[b];
+                plan_t join{pa.set | pb.set, rows, join_cost(pa, pb, rows)};
+                // The smaller input is built into the hash table.
+                join.left = pa.rows >= pb.rows ? a : b;
+                join.right = pa.rows >= pb.rows ? b : a;
+                plans_.push_back(join);
+                return plans_.size() - 1;
+            }
+
+            // DPsub: every subset is split into every pair of complementary subsets,
+            // connected pairs first; a subset with no connected split (a disconnected
+            // join graph) falls back to cross products.
+            size_t plan_dp() {
+                const size_t n = region_.leaves.size();
+                const relset_t full = (relset_t{1} << n) - 1;
+                std::vector<size_t> best(full + 1, no_plan);
+                for (size_t i = 0; i < n; ++i) {
+                    best[relset_t{1} << i] = i;
+                }
+                for (relset_t set = 1; set <= full; ++set) {
+                    if (std::popcount(set) < 2) {
+                        continue;
+                    }
+                    const double rows = cardinality(set);
+                    size_t best_a = no_plan;
+                    size_t best_b = no_plan;
+                    double best_cost = std::numeric_limits<double>::infinity();
+                    for (bool cross : {false, true}) {
+                        for (relset_t sub = (set - 1) & set; sub; sub = (sub - 1) & set) {
+                            const relset_t other = set ^ sub;
+                            if (sub < other || best[sub] == no_plan || best[other] == no_plan) {
+                                continue;
+                            }
+                            if (!cross && !connected(sub, other)) {
+                                continue;
+                            }
+                            const double cost = join_cost(plans_[best[sub]], plans_[best[other]], rows);
+                            if (cost < best_cost) {
+                                best_cost = cost;
+                                best_a = best[sub];
+                                best_b = best[other];
+                            }
+                        }
+                        if (best_a != no_plan) {
+                            break;
+                        }
+                    }
+                    best[set] = make_join(best_a, best_b, rows);
+                }
+                return best[full];
+            }
+
+            // GOO: join the pair with the smallest result until one tree is left,
+            // preferring pairs an edge connects.
+            size_t plan_greedy() {
+                std::vector<size_t> forest(region_.leaves.size());
+                for (size_t i = 0; i < forest.size(); ++i) {
+                    forest[i] = i;
+                }
+                while (forest.size() > 1) {
+                    size_t best_i = 0;
+                    size_t best_j = 1;
+                    bool best_connected = false;
+                    double best_rows = std::numeric_limits<double>::infinity();
+                    for (size_t i = 0; i < forest.size(); ++i) {
+                        for (size_t j = i + 1; j < forest.size(); ++j) {
+                            const auto& a = plans_[forest[i]];
+                            const auto& b = plans_[forest[j]];
+                            const bool linked = connected(a.set, b.set);
+                            if (best_connected && !linked) {
+                                continue;
+                            }
+                            const double rows = cardinality(a.set | b.set);
+                            if ((linked && !best_connected) || rows < best_rows) {
+                                best_i = i;
+                                best_j = j;
+                                best_connected = linked;
+                                best_rows = rows;
+                            }
+                        }
+                    }
+                    forest[best_i] = make_join(forest[best_i], forest[best_j], best_rows);
+                    forest.erase(forest.begin() + static_cast<std::ptrdiff_t>(best_j));
+                }
+                return forest.front();
+            }
+
+            const region_t& region_;
+            std::vector<const conjunct_t*> edges_;
+            std::vector<plan_t> plans_;
+        };
+
+        class join_orderer_t {
+        public:
+            join_orderer_t(std::pmr::memory_resource* resource,
+                           const lp::parameter_node_t* parameters,
+                           const statistics_map_t& statistics,
+                           table_info_map_t tables)
+                : resource_(resource)
+                , parameters_(parameters)
+                , statistics_(statistics)
+                , tables_(std::move(tables)) {}
+
+            void walk(lp::node_ptr& node) {
+                if (!node) {
+                    return;
+                }
+                if (is_region_join(node)) {
+                    reorder(node, nullptr);
+                    return;
+                }
+                if (node->type() == lp::node_type::aggregate_t && !node->children().empty() &&
+                    is_region_join(node->children().front())) {
+                    // child[0] is the data source; a WHERE over it is the first match_t.
+                    auto& children = node->children();
+                    auto match = std::find_if(children.begin() + 1, children.end(), [](const lp::node_ptr& child) {
+                        return child->type() == lp::node_type::match_t && !child->expressions().empty();
+                    });
+                    const bool has_match = match != children.end();
+                    if (reorder(children.front(), has_match ? match->get() : nullptr) && has_match) {
+                        children.erase(match);
+                    }
+                    for (size_t i = 1; i < children.size(); ++i) {
+                        walk(children[i]);
+                    }
+                    return;
+                }
+                for (auto& child : node->children()) {
+                    walk(child);
+                }
+            }
+
+        private:
+            bool collect(const lp::node_ptr& node, region_t& region) {
+                if (is_region_join(node)) {
+                    const size_t left_begin = region.width;
+                    if (!collect(node->children()[0], region)) {
+                        return false;
+                    }
+                    const size_t right_begin = region.width;
+                    if (!collect(node->children()[1], region)) {
+                        return false;
+                    }
+                    const size_t end = region.width;
+                    if (node->expressions().empty()) {
+                        return true;
+                    }
+                    auto to_global = [&](const ce::key_t& key) -> key_target_t {
+                        const size_t column = key.path()[0];
+                        if (key.side() == ce::side_t::left && left_begin + column < right_begin) {
+                            return std::make_pair(ce::side_t::left, left_begin + column);
+                        }
+                        if (key.side() == ce::side_t::right && right_begin + column < end) {
+                            return std::make_pair(ce::side_t::left, right_begin + column);
+                        }
+                        return std::nullopt;
+                    };
+                    for (const auto& conjunct : split_conjuncts(node->expressions().front())) {
+                        auto global = remap_keys(resource_, conjunct, to_global);
+                        if (!global) {
+                            return false;
+                        }
+                        region.conjuncts.push_back(conjunct_t{std::move(global)});
+                    }
+                    return true;
+                }
+                size_t width = 0;
+                if (region.leaves.size() == max_region_leaves || !is_table_leaf(node, tables_, width)) {
+                    return false;
+                }
+                region.leaves.push_back(leaf_t{node, region.width, width});
+                region.width += width;
+                return true;
+            }
+
+            // Rewrites the region rooted at `slot`. `where` is the match_t of the
+            // aggregate the region feeds, if any; returns true when every WHERE
+            // conjunct moved into the region and the match_t must be dropped.
+            bool reorder(lp::node_ptr& slot, lp::node_t* where) {
+                region_t region;
+                if (!collect(slot, region)) {
+                    for (auto& child : slot->children()) {
+                        walk(child);
+                    }
+                    return false;
+                }
+
+                std::vector<ce::expression_ptr> kept;
+                if (where) {
+                    const size_t width = region.width;
+                    auto identity = [width](const ce::key_t& key) -> key_target_t {
+                        if (key.path()[0] >= width) {
+                            return std::nullopt;
+                        }
+                        return std::make_pair(ce::side_t::left, key.path()[0]);
+                    };
+                    for (const auto& conjunct : split_conjuncts(where->expressions().front())) {
+                        auto global = remap_keys(resource_, conjunct, identity);
+                        if (!global) {
+                            kept.push_back(conjunct);
+                            continue;
+                        }
+                        region.conjuncts.push_back(conjunct_t{std::move(global)});
+                    }
+                }
+
+                for (auto& conjunct : region.conjuncts) {
+                    for_each_key(conjunct.expr, [&](const ce::key_t& key) {
+                        conjunct.leaves |= relset_t{1} << region.leaf_of(key.path()[0]);
+                    });
+                }
+                // A conjunct without columns (a parameter-only comparison) has no
+                // join to land on; it stays in the WHERE or the region is left alone.
+                for (auto it = region.conjuncts.begin(); it != region.conjuncts.end();) {
+                    if (it->leaves != 0) {
+                        ++it;
+                    } else if (where) {
+                        kept.push_back(it->expr);
+                        it = region.conjuncts.erase(it);
+                    } else {
+                        return false;
+                    }
+                }
+
+                for (auto& leaf : region.leaves) {
+                    auto it = statistics_.find(leaf.node->table_oid());
+                    leaf.stats = it == statistics_.end() ? nullptr : &it->second;
+                }
+                estimator_t estimator(region, parameters_);
+                for (size_t i = 0; i < region.leaves.size(); ++i) {
+                    auto& leaf = region.leaves[i];
+                    leaf.rows = estimator.table_rows(i);
+                    for (const auto& child : leaf.node->children()) {
+                        const size_t offset = leaf.offset;
+                        auto filter = remap_keys(resource_,
+                                                 child->expressions().empty() ? nullptr : child->expressions().front(),
+                                                 [offset](const ce::key_t& key) -> key_target_t {
+                                                     return std::make_pair(ce::side_t::left, offset + key.path()[0]);
+                                                 });
+                        leaf.rows *= filter ? estimator.selectivity(filter) : default_selectivity;
+                    }
+                }
+                for (auto& conjunct : region.conjuncts) {
+                    conjunct.selectivity = estimator.selectivity(conjunct.expr);
+                    if (std::popcount(conjunct.leaves) == 1) {
+                        auto& leaf = region.leaves[std::countr_zero(conjunct.leaves)];
+                        leaf.rows *= conjunct.selectivity;
+                        conjunct.pushed = leaf.node->children().empty() && is_scan_filter(conjunct.expr);
+                    }
+                }
+                for (auto& leaf : region.leaves) {
+                    leaf.rows = std::max(leaf.rows, 1.0);
+                }
+
+                join_planner_t planner(region);
+                const size_t root = planner.plan();
+
+                push_scan_filters(region);
+                std::vector<size_t> order;
+                auto rebuilt = build(region, planner, root, order);
+                rebuilt->set_result_alias(slot->result_alias());
+
+                // Restore the original column layout for the nodes above.
+                std::vector<size_t> new_offset(region.leaves.size());
+                size_t position = 0;
+                for (size_t leaf : order) {
+                    new_offset[leaf] = position;
+                    position += region.leaves[leaf].width;
+                }
+                std::pmr::vector<size_t> output_order(resource_);
+                output_order.reserve(region.width);
+                bool identity = true;
+                for (size_t i = 0; i < region.leaves.size(); ++i) {
+                    for (size_t c = 0; c < region.leaves[i].width; ++c) {
+                        output_order.push_back(new_offset[i] + c);
+                        identity = identity && output_order.back() == output_order.size() - 1;
+                    }
+                }
+                if (!identity) {
+                    static_cast<lp::node_join_t*>(rebuilt.get())->set_output_order(std::move(output_order));
+                }
+                slot = std::move(rebuilt);
+
+                if (where && !kept.empty()) {
+                    where->expressions().front() = rebuild_conjunction(resource_, kept);
+                }
+                return where && kept.empty();
+            }
+
+            void push_scan_filters(region_t& region) {
+                for (size_t i = 0; i < region.leaves.size(); ++i) {
+                    auto& leaf = region.leaves[i];
+                    const size_t offset = leaf.offset;
+                    auto to_local = [offset](const ce::key_t& key) -> key_target_t {
+                        return std::make_pair(ce::side_t::left, key.path()[0] - offset);
+                    };
+                    std::vector<ce::expression_ptr> filters;
+                    for (auto& conjunct : region.conjuncts) {
+                        if (conjunct.pushed && conjunct.leaves == relset_t{1} << i) {
+                            filters.push_back(remap_keys(resource_, conjunct.expr, to_local));
+                            conjunct.placed = true;
+                        }
+                    }
+                    if (filters.empty()) {
+                        continue;
+                    }
+                    const auto* scan = static_cast<const lp::node_aggregate_t*>(leaf.node.get());
+                    auto match =
+                        lp::make_node_match(resource_, scan->dbname(), scan->relname(), rebuild_conjunction(resource_, filters));
+                    match->set_table_oid(leaf.node->table_oid());
+                    leaf.node->append_child(match);
+                }
+            }
+
+            // Emits the plan entry as a node_join_t tree; `order` receives its
+            // leaves left to right, i.e. the order of its output columns.
+            lp::node_ptr build(region_t& region, const join_planner_t& planner, size_t index, std::vector<size_t>& order) {
+                const auto& plan = planner.at(index);
+                if (plan.left == no_plan) {
+                    order.push_back(plan.leaf);
+                    return region.leaves[plan.leaf].node;
+                }
+                std::vector<size_t> left_order;
+                std::vector<size_t> right_order;
+                auto left = build(region, planner, plan.left, left_order);
+                auto right = build(region, planner, plan.right, right_order);
+
+                // Side and offset of every leaf's first column within this join's inputs.
+                std::vector<std::pair<ce::side_t, size_t>> position(region.leaves.size());
+                size_t offset = 0;
+                for (size_t leaf : left_order) {
+                    position[leaf] = {ce::side_t::left, offset};
+                    offset += region.leaves[leaf].width;
+                }
+                offset = 0;
+                for (size_t leaf : right_order) {
+                    position[leaf] = {ce::side_t::right, offset};
+                    offset += region.leaves[leaf].width;
+                }
+                auto to_inputs = [&](const ce::key_t& key) -> key_target_t {
+                    const size_t column = key.path()[0];
+                    const size_t leaf = region.leaf_of(column);
+                    return std::make_pair(position[leaf].first,
+                                          position[leaf].second + column - region.leaves[leaf].offset);
+                };
+
+                // Children were built first, so a conjunct not yet placed has no
+                // lower join covering all of its tables.
+                std::vector<ce::expression_ptr> conditions;
+                for (auto& conjunct : region.conjuncts) {
+                    if (!conjunct.placed && (conjunct.leaves & ~plan.set) == 0) {
+                        conditions.push_back(remap_keys(resource_, conjunct.expr, to_inputs));
+                        conjunct.placed = true;
+                    }
+                }
+
+                auto join = lp::make_node_join(resource_,
+                                               core::dbname_t{},
+                                               core::relname_t{},
+                                               conditions.empty() ? lp::join_type::cross : lp::join_type::inner);
+                join->append_child(std::move(left));
+                join->append_child(std::move(right));
+                if (conditions.empty()) {
+                    join->append_expression(ce::make_compare_expression(resource_, ce::compare_type::all_true));
+                } else {
+                    join->append_expression(rebuild_conjunction(resource_, conditions));
+                }
+                order.insert(order.end(), left_order.begin(), left_order.end());
+                order.insert(order.end(), right_order.begin(), right_order.end());
+                return join;
+            }
+
+            std::pmr::memory_resource* resource_;
+            const lp::parameter_node_t* parameters_;
+            const statistics_map_t& statistics_;
+            table_info_map_t tables_;
+        };
+
+    } // anonymous namespace
+
+    logical_plan::node_ptr reorder_joins(std::pmr::memory_resource* resource,
+                                         logical_plan::node_ptr root,
+                                         const logical_plan::parameter_node_t* parameters,
+                                         const statistics_map_t& statistics) {
+        if (!root) {
+            return root;
+        }
+        table_info_map_t tables;
+        collect_tables(root, tables);
+        if (tables.empty()) {
+            return root;
+        }
+        join_orderer_t orderer(resource, parameters, statistics, std::move(tables));
+        orderer.walk(root);
+        return root;
+    }
+
+    std::vector<catalog::oid_t> join_leaf_tables(const logical_plan::node_ptr& root) {
+        std::vector<catalog::oid_t> result;
+        std::unordered_set<catalog::oid_t> seen;
+        std::vector<const lp::node_t*> stack{root.get()};
+        while (!stack.empty()) {
+            const auto* node = stack.back();
+            stack.pop_back();
+            if (!node) {
+                continue;
+            }
+            if (node->type() == lp::node_type::join_t) {
+                const auto type = static_cast<const lp::node_join_t*>(node)->type();
+                for (const auto& child : node->children()) {
+                    if ((type == lp::join_type::inner || type == lp::join_type::cross) &&
+                        child->type() == lp::node_type::aggregate_t &&
+                        child->table_oid() != catalog::INVALID_OID && seen.insert(child->table_oid()).second) {
+                        result.push_back(child->table_oid());
+                    }
+                }
+            }
+            for (const auto& child : node->children()) {
+                stack.push_back(child.get());
+            }
+        }
+        return result;
+    }
+
+} // namespace components::planner::optimizer
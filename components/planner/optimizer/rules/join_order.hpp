@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../statistics.hpp"
+
+#include <components/logical_plan/node.hpp>
+#include <components/logical_plan/param_storage.hpp>
+
+namespace components::planner::optimizer {
+
+    // Cost-based join ordering.
+    //
+    // A maximal tree of inner/cross node_join_t whose leaves are base-table scans is
+    // a join region. Its join graph is built from the conjuncts of every ON condition
+    // plus, when the region feeds an aggregate whose WHERE match_t filters the join
+    // output directly (the comma-join shape `FROM a, b, c WHERE ...`), the WHERE
+    // conjuncts. The region is then rebuilt in the cheapest order found:
+    //   - up to 10 tables: dynamic programming over table subsets (bushy trees);
+    //   - more tables: greedy operator ordering (GOO), repeatedly joining the pair
+    //     with the smallest estimated result.
+    // Cost is the sum of intermediate result sizes plus the build sides. Within each
+    // join the smaller input becomes the right (build) side of the hash join.
+    //
+    // Conjuncts on a single table that compare a column to a parameter are pushed
+    // into that table's scan. Every other conjunct lands on the lowest join that
+    // covers its tables. WHERE conjuncts the rule cannot re-address (computed
+    // operands) stay in the WHERE. The rebuilt region root carries an output_order
+    // that restores the original column layout, so nodes above the region keep
+    // their key paths.
+    //
+    // Cardinalities come from `statistics`: row counts, NULL fractions from the NULL
+    // counts, equality selectivity from the distinct-value bound max - min + 1 of
+    // integer columns, and range selectivity interpolated between min and max.
+    //
+    // A region is left as written when a leaf is not a regular table, when an ON
+    // conjunct has computed operands, or when it has more than 64 tables.
+    //
+    // Must run AFTER validate_schema (reads key.side()/key.path()) and BEFORE
+    // rewrite_hash_joins, which turns the rebuilt conditions into hash keys.
+    logical_plan::node_ptr reorder_joins(std::pmr::memory_resource* resource,
+                                         logical_plan::node_ptr root,
+                                         const logical_plan::parameter_node_t* parameters,
+                                         const statistics_map_t& statistics);
+
+    // Oids of the base tables that are leaves of inner/cross joins in `root`: the
+    // tables reorder_joins wants statistics for. Empty when the plan has no join.
+    std::vector<catalog::oid_t> join_leaf_tables(const logical_plan::node_ptr& root);
+
+} // namespace components::planner::optimizer
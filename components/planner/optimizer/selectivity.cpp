@@ -0,0 +1,367 @@
+#include "selectivity.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string_view>
+#include <variant>
+
+namespace components::planner::optimizer {
+
+    namespace {
+
+        namespace ce = components::expressions;
+
+        ce::compare_type mirror(ce::compare_type type) {
+            switch (type) {
+                case ce::compare_type::gt:
+                    return ce::compare_type::lt;
+                case ce::compare_type::lt:
+                    return ce::compare_type::gt;
+                case ce::compare_type::gte:
+                    return ce::compare_type::lte;
+                case ce::compare_type::lte:
+                    return ce::compare_type::gte;
+                default:
+                    return type;
+            }
+        }
+
+        bool is_integral(types::logical_type type) {
+            return types::is_numeric(type) && type != types::logical_type::FLOAT &&
+                   type != types::logical_type::DOUBLE;
+        }
+
+        // Three-way comparison of a statistics value with a query value: numbers
+        // of any width, or two strings. nullopt when they are not comparable.
+        std::optional<int> compare(const types::logical_value_t& a, const types::logical_value_t& b) {
+            if (auto x = as_number(a)) {
+                auto y = as_number(b);
+                if (!y) {
+                    return std::nullopt;
+                }
+                return *x < *y ? -1 : (*x > *y ? 1 : 0);
+            }
+            if (a.is_null() || b.is_null() || a.type().type() != types::logical_type::STRING_LITERAL ||
+                b.type().type() != types::logical_type::STRING_LITERAL) {
+                return std::nullopt;
+            }
+            const auto c = a.value<std::string_view>().compare(b.value<std::string_view>());
+            return c < 0 ? -1 : (c > 0 ? 1 : 0);
+        }
+
+        bool satisfies(int cmp, ce::compare_type type) {
+            switch (type) {
+                case ce::compare_type::lt:
+                    return cmp < 0;
+                case ce::compare_type::lte:
+                    return cmp <= 0;
+                case ce::compare_type::gt:
+                    return cmp > 0;
+                case ce::compare_type::gte:
+                    return cmp >= 0;
+                default:
+                    return cmp == 0;
+            }
+        }
+
+        double mcv_total(const column_statistics_t& stats) {
+            return std::accumulate(stats.mcv_fractions.begin(), stats.mcv_fractions.end(), 0.0);
+        }
+
+        // Position of `value` in an equi-depth histogram as the fraction of its
+        // rows that lie below it; nullopt when the value is not comparable.
+        std::optional<double> histogram_fraction_below(const std::vector<types::logical_value_t>& bounds,
+                                                       const types::logical_value_t& value) {
+            const size_t buckets = bounds.size() - 1;
+            auto first = compare(bounds.front(), value);
+            if (!first) {
+                return std::nullopt;
+            }
+            if (*first > 0) {
+                return 0.0;
+            }
+            if (compare(bounds.back(), value).value_or(0) <= 0) {
+                return 1.0;
+            }
+            // First bound greater than the value; bounds[i - 1] <= value < bounds[i].
+            size_t lo = 0;
+            size_t hi = buckets;
+            while (lo < hi) {
+                const size_t mid = (lo + hi) / 2;
+                if (compare(bounds[mid], value).value_or(0) <= 0) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            const size_t i = lo;
+            double within = 0.5;
+            auto left = as_number(bounds[i - 1]);
+            auto right = as_number(bounds[i]);
+            auto v = as_number(value);
+            if (left && right && v && *right > *left) {
+                within = std::clamp((*v - *left) / (*right - *left), 0.0, 1.0);
+            }
+            return (static_cast<double>(i - 1) + within) / static_cast<double>(buckets);
+        }
+
+        const types::logical_value_t* parameter(const logical_plan::storage_parameters* parameters,
+                                                const ce::param_storage& operand) {
+            if (!parameters || !std::holds_alternative<core::parameter_id_t>(operand)) {
+                return nullptr;
+            }
+            auto it = parameters->parameters.find(std::get<core::parameter_id_t>(operand));
+            return it == parameters->parameters.end() ? nullptr : &it->second;
+        }
+
+    } // namespace
+
+    const column_statistics_t* column_ref_t::stats() const noexcept {
+        if (!table || column >= table->columns.size()) {
+            return nullptr;
+        }
+        return &table->columns[column];
+    }
+
+    double column_ref_t::rows() const noexcept {
+        return table ? std::max(1.0, static_cast<double>(table->row_count)) : default_row_count;
+    }
+
+    std::optional<double> as_number(const types::logical_value_t& value) {
+        using types::logical_type;
+        if (value.is_null()) {
+            return std::nullopt;
+        }
+        switch (value.type().type()) {
+            case logical_type::BOOLEAN:
+                return value.value<bool>() ? 1.0 : 0.0;
+            case logical_type::TINYINT:
+                return value.value<int8_t>();
+            case logical_type::SMALLINT:
+                return value.value<int16_t>();
+            case logical_type::INTEGER:
+                return value.value<int32_t>();
+            case logical_type::BIGINT:
+                return static_cast<double>(value.value<int64_t>());
+            case logical_type::UTINYINT:
+                return value.value<uint8_t>();
+            case logical_type::USMALLINT:
+                return value.value<uint16_t>();
+            case logical_type::UINTEGER:
+                return value.value<uint32_t>();
+            case logical_type::UBIGINT:
+                return static_cast<double>(value.value<uint64_t>());
+            case logical_type::FLOAT:
+                return value.value<float>();
+            case logical_type::DOUBLE:
+                return value.value<double>();
+            default:
+                return std::nullopt;
+        }
+    }
+
+    double null_fraction(const column_ref_t& column) {
+        const auto* stats = column.stats();
+        if (!stats) {
+            return 0;
+        }
+        return std::min(1.0, static_cast<double>(stats->null_count) / column.rows());
+    }
+
+    // Without ANALYZE: the domain max - min + 1 of an integer column (capped by
+    // the non-NULL rows), otherwise the non-NULL rows themselves.
+    double distinct_values(const column_ref_t& column, bool& bounded) {
+        const double non_null = std::max(1.0, column.rows() * (1 - null_fraction(column)));
+        bounded = false;
+        const auto* stats = column.stats();
+        if (!stats) {
+            return non_null;
+        }
+        if (stats->distinct_count > 0) {
+            bounded = true;
+            return static_cast<double>(stats->distinct_count);
+        }
+        if (!is_integral(stats->min.type().type())) {
+            return non_null;
+        }
+        auto min = as_number(stats->min);
+        auto max = as_number(stats->max);
+        if (!min || !max || *max < *min) {
+            return non_null;
+        }
+        bounded = true;
+        return std::clamp(*max - *min + 1, 1.0, non_null);
+    }
+
+    double eq_selectivity(const column_ref_t& column, const types::logical_value_t* value) {
+        const auto* stats = column.stats();
+        if (stats && value) {
+            auto v = as_number(*value);
+            auto min = as_number(stats->min);
+            auto max = as_number(stats->max);
+            if (v && min && max && (*v < *min || *v > *max)) {
+                return 1 / column.rows();
+            }
+            for (size_t i = 0; i < stats->mcv_values.size(); ++i) {
+                if (compare(stats->mcv_values[i], *value) == 0) {
+                    return stats->mcv_fractions[i];
+                }
+            }
+            if (!stats->mcv_values.empty()) {
+                // Not an MCV: an even share of what the MCVs leave over.
+                const double rest = std::max(0.0, 1 - null_fraction(column) - mcv_total(*stats));
+                const double others = static_cast<double>(stats->distinct_count) -
+                                      static_cast<double>(stats->mcv_values.size());
+                if (rest <= 0 || others < 1) {
+                    return 1 / column.rows();
+                }
+                return rest / others;
+            }
+        }
+        bool bounded = false;
+        const double ndv = distinct_values(column, bounded);
+        const double s = bounded ? 1 / ndv : std::max(1 / ndv, default_eq_selectivity);
+        return s * (1 - null_fraction(column));
+    }
+
+    double range_selectivity(const column_ref_t& column,
+                             expressions::compare_type type,
+                             const types::logical_value_t* value) {
+        const auto* stats = column.stats();
+        if (!stats || !value) {
+            return default_range_selectivity;
+        }
+        const bool less = type == ce::compare_type::lt || type == ce::compare_type::lte;
+        const double nulls = null_fraction(column);
+
+        // ANALYZE: the MCVs that satisfy the predicate count exactly, the
+        // histogram spreads the remaining rows.
+        if (stats->histogram.size() >= 2 || !stats->mcv_values.empty()) {
+            double mcv_part = 0;
+            bool comparable = true;
+            for (size_t i = 0; i < stats->mcv_values.size() && comparable; ++i) {
+                auto cmp = compare(stats->mcv_values[i], *value);
+                comparable = cmp.has_value();
+                if (cmp && satisfies(*cmp, type)) {
+                    mcv_part += stats->mcv_fractions[i];
+                }
+            }
+            const double rest = std::max(0.0, 1 - nulls - mcv_total(*stats));
+            std::optional<double> below;
+            if (stats->histogram.size() >= 2) {
+                below = histogram_fraction_below(stats->histogram, *value);
+            } else if (rest <= 0) {
+                below = 0.0; // the MCVs are the whole column
+            }
+            if (comparable && below) {
+                return std::clamp(mcv_part + (less ? *below : 1 - *below) * rest, 0.0, 1.0);
+            }
+        }
+
+        auto v = as_number(*value);
+        auto min = as_number(stats->min);
+        auto max = as_number(stats->max);
+        if (!v || !min || !max || *max < *min) {
+            return default_range_selectivity;
+        }
+        double below = 1;
+        if (*max > *min) {
+            below = std::clamp((*v - *min) / (*max - *min), 0.0, 1.0);
+        } else {
+            below = *v > *min ? 1.0 : 0.0;
+        }
+        return (less ? below : 1 - below) * (1 - nulls);
+    }
+
+    double join_selectivity(const column_ref_t& a, const column_ref_t& b) {
+        bool bounded = false;
+        const double ndv = std::max(distinct_values(a, bounded), distinct_values(b, bounded));
+        return (1 - null_fraction(a)) * (1 - null_fraction(b)) / ndv;
+    }
+
+    double estimate_selectivity(const expressions::expression_ptr& expr,
+                                const column_resolver_t& resolve,
+                                const logical_plan::storage_parameters* parameters) {
+        const auto* cmp = static_cast<const ce::compare_expression_t*>(expr.get());
+        switch (cmp->type()) {
+            case ce::compare_type::union_and: {
+                double s = 1;
+                for (const auto& child : cmp->children()) {
+                    s *= estimate_selectivity(child, resolve, parameters);
+                }
+                return s;
+            }
+            case ce::compare_type::union_or: {
+                double miss = 1;
+                for (const auto& child : cmp->children()) {
+                    miss *= 1 - estimate_selectivity(child, resolve, parameters);
+                }
+                return 1 - miss;
+            }
+            case ce::compare_type::union_not: {
+                double s = 1;
+                for (const auto& child : cmp->children()) {
+                    s *= estimate_selectivity(child, resolve, parameters);
+                }
+                return 1 - s;
+            }
+            case ce::compare_type::all_true:
+                return 1;
+            case ce::compare_type::all_false:
+                return 0;
+            default:
+                break;
+        }
+
+        auto type = cmp->type();
+        const auto* key = std::get_if<ce::key_t>(&cmp->left());
+        const ce::param_storage* other = &cmp->right();
+        if (!key) {
+            key = std::get_if<ce::key_t>(&cmp->right());
+            other = &cmp->left();
+            type = mirror(type);
+        }
+        if (!key) {
+            return default_selectivity;
+        }
+        const auto column = resolve(*key);
+
+        if (const auto* other_key = std::get_if<ce::key_t>(other)) {
+            switch (type) {
+                case ce::compare_type::eq:
+                    return join_selectivity(column, resolve(*other_key));
+                case ce::compare_type::ne:
+                    return 1 - join_selectivity(column, resolve(*other_key));
+                case ce::compare_type::gt:
+                case ce::compare_type::lt:
+                case ce::compare_type::gte:
+                case ce::compare_type::lte:
+                    return default_range_selectivity;
+                default:
+                    return default_selectivity;
+            }
+        }
+
+        const auto* value = parameter(parameters, *other);
+        switch (type) {
+            case ce::compare_type::eq:
+                return eq_selectivity(column, value);
+            case ce::compare_type::ne:
+                return std::max(0.0, 1 - null_fraction(column) - eq_selectivity(column, value));
+            case ce::compare_type::gt:
+            case ce::compare_type::lt:
+            case ce::compare_type::gte:
+            case ce::compare_type::lte:
+                return range_selectivity(column, type, value);
+            case ce::compare_type::is_null:
+                return null_fraction(column);
+            case ce::compare_type::is_not_null:
+                return 1 - null_fraction(column);
+            case ce::compare_type::regex:
+                return pattern_selectivity;
+            default:
+                return default_selectivity;
+        }
+    }
+
+} // namespace components::planner::optimizer
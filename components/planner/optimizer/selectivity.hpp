@@ -0,0 +1,51 @@
+#pragma once
+
+#include "statistics.hpp"
+
+#include <components/expressions/compare_expression.hpp>
+#include <components/logical_plan/param_storage.hpp>
+
+#include <functional>
+#include <optional>
+
+namespace components::planner::optimizer {
+
+    // Fallbacks when a table or a column has no statistics. A table the disk
+    // manager does not know is assumed mid-sized so it neither wins nor loses
+    // every comparison.
+    constexpr double default_row_count = 1000.0;
+    constexpr double default_eq_selectivity = 0.005;
+    constexpr double default_range_selectivity = 1.0 / 3.0;
+    constexpr double default_selectivity = 0.25;
+    constexpr double pattern_selectivity = 0.1;
+
+    // One column of one table as the estimates see it; `table` is null when
+    // the table has no statistics.
+    struct column_ref_t {
+        const table_stats_estimate_t* table{nullptr};
+        size_t column{0};
+
+        const column_statistics_t* stats() const noexcept;
+        double rows() const noexcept;
+    };
+
+    std::optional<double> as_number(const types::logical_value_t& value);
+
+    double null_fraction(const column_ref_t& column);
+    // Distinct non-NULL values. `bounded` is set when the count is known rather
+    // than assumed: from ANALYZE, or the max - min + 1 domain of an integer column.
+    double distinct_values(const column_ref_t& column, bool& bounded);
+    double eq_selectivity(const column_ref_t& column, const types::logical_value_t* value);
+    double range_selectivity(const column_ref_t& column,
+                             expressions::compare_type type,
+                             const types::logical_value_t* value);
+    double join_selectivity(const column_ref_t& a, const column_ref_t& b);
+
+    // Fraction of rows a compare-expression tree keeps. `resolve` maps a key to
+    // its column; parameter operands are read from `parameters` (may be null).
+    using column_resolver_t = std::function<column_ref_t(const expressions::key_t&)>;
+    double estimate_selectivity(const expressions::expression_ptr& expr,
+                                const column_resolver_t& resolve,
+                                const logical_plan::storage_parameters* parameters);
+
+} // namespace components::planner::optimizer
@@ -0,0 +1,106 @@
+#include "statistics.hpp"
+
+#include <components/catalog/system_table_schemas.hpp>
+#include <components/vector/data_chunk.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <string_view>
+
+namespace components::planner::optimizer {
+
+    namespace {
+
+        std::vector<uint64_t> parse_counts(std::string_view csv) {
+            std::vector<uint64_t> counts;
+            while (!csv.empty()) {
+                const auto comma = csv.find(',');
+                const auto item = csv.substr(0, comma);
+                uint64_t count = 0;
+                if (std::from_chars(item.data(), item.data() + item.size(), count).ec != std::errc{}) {
+                    return {};
+                }
+                counts.push_back(count);
+                csv = comma == std::string_view::npos ? std::string_view{} : csv.substr(comma + 1);
+            }
+            return counts;
+        }
+
+        int64_t int64_cell(const vector::data_chunk_t& rows, uint64_t column, uint64_t row) {
+            auto value = rows.value(column, row);
+            return value.is_null() ? 0 : value.value<int64_t>();
+        }
+
+        std::string_view string_cell(const vector::data_chunk_t& rows, uint64_t column, uint64_t row) {
+            auto value = rows.value(column, row);
+            return value.is_null() ? std::string_view{} : value.value<std::string_view>();
+        }
+
+    } // namespace
+
+    void merge_pg_statistic(std::pmr::memory_resource* resource,
+                            table_stats_estimate_t& stats,
+                            const vector::data_chunk_t& rows) {
+        if (rows.column_count() < 9) {
+            return;
+        }
+        for (uint64_t r = 0; r < rows.size(); ++r) {
+            auto attnum = rows.value(1, r);
+            if (attnum.is_null() || attnum.value<int32_t>() < 1) {
+                continue;
+            }
+            const auto position = static_cast<size_t>(attnum.value<int32_t>() - 1);
+            while (stats.columns.size() <= position) {
+                stats.columns.push_back(column_statistics_t{types::logical_value_t(resource, types::logical_type::NA),
+                                                            types::logical_value_t(resource, types::logical_type::NA)});
+            }
+            auto& column = stats.columns[position];
+            const auto analyzed_rows = static_cast<uint64_t>(std::max<int64_t>(0, int64_cell(rows, 2, r)));
+            if (stats.row_count == 0) {
+                // Storage has nothing to say (e.g. no disk manager): trust ANALYZE.
+                stats.row_count = analyzed_rows;
+                column.null_count = static_cast<uint64_t>(std::max<int64_t>(0, int64_cell(rows, 3, r)));
+            }
+            column.distinct_count = static_cast<uint64_t>(std::max<int64_t>(0, int64_cell(rows, 4, r)));
+            column.histogram = catalog::decode_value_list(resource, string_cell(rows, 6, r));
+            column.mcv_values = catalog::decode_value_list(resource, string_cell(rows, 7, r));
+            const auto counts = parse_counts(string_cell(rows, 8, r));
+            column.mcv_fractions.clear();
+            if (counts.size() != column.mcv_values.size() || analyzed_rows == 0) {
+                column.mcv_values.clear();
+            } else {
+                for (auto count : counts) {
+                    column.mcv_fractions.push_back(static_cast<double>(count) / static_cast<double>(analyzed_rows));
+                }
+            }
+            stats.analyzed = true;
+        }
+    }
+
+    void merge_analyzed(table_stats_estimate_t& stats, const table_stats_estimate_t& analyzed) {
+        if (!analyzed.analyzed) {
+            return;
+        }
+        // Storage has nothing to say: trust ANALYZE, as merge_pg_statistic does.
+        const bool trust_analyze = stats.row_count == 0;
+        if (trust_analyze) {
+            stats.row_count = analyzed.row_count;
+        }
+        for (size_t position = 0; position < analyzed.columns.size(); ++position) {
+            const auto& source = analyzed.columns[position];
+            if (stats.columns.size() <= position) {
+                stats.columns.push_back(column_statistics_t{source.min, source.max});
+            }
+            auto& column = stats.columns[position];
+            if (trust_analyze) {
+                column.null_count = source.null_count;
+            }
+            column.distinct_count = source.distinct_count;
+            column.histogram = source.histogram;
+            column.mcv_values = source.mcv_values;
+            column.mcv_fractions = source.mcv_fractions;
+        }
+        stats.analyzed = true;
+    }
+
+} // namespace components::planner::optimizer
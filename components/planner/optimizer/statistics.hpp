@@ -0,0 +1,58 @@
+#pragma once
+
+#include <components/catalog/catalog_oids.hpp>
+#include <components/types/logical_value.hpp>
+
+#include <cstdint>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+namespace components::vector {
+    class data_chunk_t;
+} // namespace components::vector
+
+namespace components::planner::optimizer {
+
+    // What the cardinality estimates know about one column: its min/max (NULL
+    // values when the table has no statistics for it yet) and its NULL count,
+    // plus what the last ANALYZE stored in pg_statistic (zero / empty when the
+    // table was never analyzed).
+    struct column_statistics_t {
+        types::logical_value_t min;
+        types::logical_value_t max;
+        uint64_t null_count{0};
+        // Distinct non-NULL values.
+        uint64_t distinct_count{0};
+        // Equi-depth bounds over the non-MCV values, ascending.
+        std::vector<types::logical_value_t> histogram;
+        // Most common values and the fraction of all rows each one holds.
+        std::vector<types::logical_value_t> mcv_values;
+        std::vector<double> mcv_fractions;
+    };
+
+    struct table_stats_estimate_t {
+        uint64_t row_count{0};
+        std::vector<column_statistics_t> columns;
+        // pg_statistic rows were merged into `columns`.
+        bool analyzed{false};
+    };
+
+    // Keyed by table oid. The executor fills it from the disk manager for the
+    // tables a plan joins (see join_leaf_tables) and merges in pg_statistic for
+    // analyzed tables; a table without an entry is estimated with defaults.
+    using statistics_map_t = std::unordered_map<catalog::oid_t, table_stats_estimate_t>;
+
+    // Folds pg_statistic rows of one table (starelid already matched) into
+    // `stats`: distinct counts, histograms and MCVs with their fractions of the
+    // analyzed rows. Marks the table analyzed when any row applied.
+    void merge_pg_statistic(std::pmr::memory_resource* resource,
+                            table_stats_estimate_t& stats,
+                            const vector::data_chunk_t& rows);
+
+    // Folds `analyzed` — pg_statistic rows merged into an otherwise empty
+    // estimate, as catalog_cache_t keeps them — into storage statistics `stats`,
+    // with the same result as merging the rows into `stats` directly.
+    void merge_analyzed(table_stats_estimate_t& stats, const table_stats_estimate_t& analyzed);
+
+} // namespace components::planner::optimizer
@@ -0,0 +1,149 @@
+#include <catch2/catch.hpp>
+
+#include <components/catalog/catalog_codes.hpp>
+#include <components/expressions/compare_expression.hpp>
+#include <components/logical_plan/node_aggregate.hpp>
+#include <components/logical_plan/node_catalog_resolve.hpp>
+#include <components/logical_plan/node_join.hpp>
+#include <components/logical_plan/node_sequence.hpp>
+#include <components/logical_plan/param_storage.hpp>
+#include <components/planner/optimizer.hpp>
+
+using namespace components::logical_plan;
+using namespace components::expressions;
+using components::catalog::oid_t;
+using components::planner::optimizer::statistics_map_t;
+using components::planner::optimizer::table_stats_estimate_t;
+using key = components::expressions::key_t;
+
+constexpr auto database_name = "database";
+
+// ================================================================
+// Helpers: a resolved two-column table, its scan, and an equi-join
+// condition between column `left_column` of the left input and
+// column `right_column` of the right input.
+// ================================================================
+static node_ptr make_resolved_table(std::pmr::memory_resource* r, oid_t oid) {
+    auto resolve = make_node_catalog_resolve_table(r, core::dbname_t{database_name}, core::relname_t{"t"});
+    resolved_table_metadata_t md;
+    md.table_oid = oid;
+    md.relkind = components::catalog::relkind::regular;
+    for (const char* name : {"a", "b"}) {
+        resolved_column_metadata_t column;
+        column.attname = name;
+        column.type = components::types::logical_type::BIGINT;
+        md.columns.push_back(std::move(column));
+    }
+    resolve->set_resolved_metadata(std::move(md));
+    return resolve;
+}
+
+static node_ptr make_scan(std::pmr::memory_resource* r, oid_t oid) {
+    auto scan = make_node_aggregate(r, core::dbname_t{database_name}, core::relname_t{"t"});
+    scan->set_table_oid(oid);
+    return scan;
+}
+
+static node_ptr make_equi_join(std::pmr::memory_resource* r,
+                               node_ptr left,
+                               node_ptr right,
+                               size_t left_column,
+                               size_t right_column) {
+    key left_key(r, "a", side_t::left);
+    left_key.set_path({left_column});
+    key right_key(r, "a", side_t::right);
+    right_key.set_path({right_column});
+    auto join = make_node_join(r, core::dbname_t{}, core::relname_t{}, join_type::inner);
+    join->append_child(left);
+    join->append_child(right);
+    join->append_expression(make_compare_expression(r, compare_type::eq, left_key, right_key));
+    return join;
+}
+
+static const node_join_t* as_hash_join(const node_ptr& node) {
+    REQUIRE(node->type() == node_type::join_t);
+    const auto* join = static_cast<const node_join_t*>(node.get());
+    REQUIRE(join->algo() == node_join_t::join_algo::hash);
+    return join;
+}
+
+// ================================================================
+// J1. Three tables (the DP path): the two small tables are joined
+// first and built; the big one is probed.
+// ================================================================
+TEST_CASE("optimizer::join_order_dp_builds_small_sides") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto params = make_parameter_node(&resource);
+    constexpr oid_t small = 101;
+    constexpr oid_t medium = 102;
+    constexpr oid_t big = 103;
+
+    statistics_map_t statistics;
+    statistics[small] = table_stats_estimate_t{10};
+    statistics[medium] = table_stats_estimate_t{1'000};
+    statistics[big] = table_stats_estimate_t{1'000'000};
+
+    // (small JOIN medium ON small.b = medium.b) JOIN big ON medium.a = big.a
+    node_ptr root{new node_sequence_t(&resource)};
+    for (oid_t oid : {small, medium, big}) {
+        root->append_child(make_resolved_table(&resource, oid));
+    }
+    auto inner = make_equi_join(&resource, make_scan(&resource, small), make_scan(&resource, medium), 1, 1);
+    root->append_child(make_equi_join(&resource, inner, make_scan(&resource, big), 2, 0));
+
+    root = components::planner::optimize(&resource, root, params.get(), &statistics);
+
+    // Costs: (medium JOIN small) = 10 rows, then probing big with it = 10 rows, total 40;
+    // starting from (medium JOIN big) = 1000 rows costs 2020.
+    const auto* top = as_hash_join(root->children().back());
+    REQUIRE(top->children()[0]->table_oid() == big);
+    const auto* build = as_hash_join(top->children()[1]);
+    REQUIRE(build->children()[0]->table_oid() == medium);
+    REQUIRE(build->children()[1]->table_oid() == small);
+    // Original column order: small, medium, big.
+    REQUIRE(top->output_order() == std::pmr::vector<size_t>({4, 5, 2, 3, 0, 1}));
+}
+
+// ================================================================
+// J2. Eleven tables in a chain (the greedy path): growing from the
+// smallest table, each step joins the cheapest neighbour and builds
+// the running intermediate, which stays the smaller input.
+// ================================================================
+TEST_CASE("optimizer::join_order_greedy_grows_from_smallest_pair") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto params = make_parameter_node(&resource);
+    constexpr size_t table_count = 11;
+    auto oid_of = [](size_t k) { return static_cast<oid_t>(200 + k); };
+
+    // t_k has 1000 * (k + 1) rows; t_k.b = t_{k+1}.a, so a run t_i..t_j
+    // is estimated at the rows of t_i.
+    statistics_map_t statistics;
+    for (size_t k = 0; k < table_count; ++k) {
+        statistics[oid_of(k)] = table_stats_estimate_t{1'000 * (k + 1)};
+    }
+
+    // Written from the largest table down: ((t10 JOIN t9) JOIN t8) ... JOIN t0.
+    node_ptr root{new node_sequence_t(&resource)};
+    for (size_t k = 0; k < table_count; ++k) {
+        root->append_child(make_resolved_table(&resource, oid_of(k)));
+    }
+    node_ptr chain = make_scan(&resource, oid_of(table_count - 1));
+    for (size_t k = table_count - 1; k-- > 0;) {
+        // t_{k+1}.a is the last table of the left input so far.
+        const size_t left_column = (table_count - 2 - k) * 2;
+        chain = make_equi_join(&resource, chain, make_scan(&resource, oid_of(k)), left_column, 1);
+    }
+    root->append_child(chain);
+
+    root = components::planner::optimize(&resource, root, params.get(), &statistics);
+
+    // t10 JOIN (t9 JOIN (... (t1 JOIN t0))): t0 and t1 first, each larger table probes.
+    node_ptr node = root->children().back();
+    for (size_t k = table_count - 1; k > 0; --k) {
+        INFO("table " << k);
+        const auto* join = as_hash_join(node);
+        REQUIRE(join->children()[0]->table_oid() == oid_of(k));
+        node = join->children()[1];
+    }
+    REQUIRE(node->table_oid() == oid_of(0));
+}
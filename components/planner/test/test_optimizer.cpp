@@ -46,7 +46,9 @@ TEST_CASE("optimizer::scalar_fold_add") {
                                         expression_ptr(scalar));
     auto node = make_match_with_expr(&resource, comp);
 
-    auto result = components::planner::optimize(&resource, node, params.get());
+    bool folded = false;
+    auto result = components::planner::optimize(&resource, node, params.get(), nullptr, &folded);
+    REQUIRE(folded);
 
     auto* s = static_cast<scalar_expression_t*>(scalar.get());
     REQUIRE(s->params().size() == 1);
@@ -1013,3 +1015,66 @@ TEST_CASE("create_plan_match::union_compare_uses_full_scan") {
     auto op = services::planner::impl::create_plan_match(ctx, node, components::logical_plan::limit_t::unlimit());
     REQUIRE(op->type() == components::operators::operator_type::full_scan);
 }
+
+TEST_CASE("create_plan_match::analyzed_common_value_skips_index") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto params = make_parameter_node(&resource);
+    auto common = params->add_parameter(int64_t(42));
+    auto rare = params->add_parameter(int64_t(7));
+    constexpr auto table_oid = components::catalog::oid_t{782};
+
+    auto ctx = make_context_with_oid(&resource, table_oid, params.get());
+    add_single_field_index(ctx, &resource, "age", components::logical_plan::index_type::hashed);
+
+    components::logical_plan::resolved_table_metadata_t md;
+    md.table_oid = table_oid;
+    components::logical_plan::resolved_column_metadata_t age_column;
+    age_column.attname = "age";
+    age_column.type = components::types::logical_type::BIGINT;
+    age_column.attnum = 1;
+    age_column.chunk_position = 0;
+    md.columns.push_back(std::move(age_column));
+    ctx.table_metadata[table_oid] = &md;
+
+    // ANALYZE found 42 in 90% of the rows.
+    components::planner::optimizer::column_statistics_t age{
+        components::types::logical_value_t(&resource, int64_t(0)),
+        components::types::logical_value_t(&resource, int64_t(100)),
+        0,
+        50,
+    };
+    age.mcv_values.emplace_back(&resource, int64_t(42));
+    age.mcv_fractions.push_back(0.9);
+    components::planner::optimizer::table_stats_estimate_t stats{1000, {}, true};
+    stats.columns.push_back(std::move(age));
+    ctx.statistics.emplace(table_oid, std::move(stats));
+
+    auto plan_for = [&](core::parameter_id_t pid) {
+        auto node = make_node_match(&resource,
+                                    core::dbname_t{database_name},
+                                    core::relname_t{collection_name},
+                                    make_compare_expression(&resource, compare_type::eq, key(&resource, "age"), pid));
+        node->set_table_oid(table_oid);
+        return services::planner::impl::create_plan_match(ctx, node, components::logical_plan::limit_t::unlimit());
+    };
+
+    REQUIRE(plan_for(common)->type() == components::operators::operator_type::full_scan);
+    REQUIRE(plan_for(rare)->type() == components::operators::operator_type::index_scan);
+}
+
+// ================================================================
+// A comparison against a single parameter is left for execution
+// ================================================================
+TEST_CASE("optimizer::no_fold_reports_reusable_plan") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto params = make_parameter_node(&resource);
+    auto id0 = params->add_parameter(int64_t(42));
+
+    auto comp = make_compare_expression(&resource, compare_type::eq, key(&resource, "field", side_t::left), id0);
+    auto node = make_match_with_expr(&resource, comp);
+
+    bool folded = true;
+    components::planner::optimize(&resource, node, params.get(), nullptr, &folded);
+    REQUIRE_FALSE(folded);
+    REQUIRE(comp->type() == compare_type::eq);
+}
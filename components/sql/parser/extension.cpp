@@ -12,10 +12,14 @@ namespace components::sql::parser {
                                      "parser extension '" + it->first + "' already registered",
                                  });
         }
+        ++generation_;
         return &it->second;
     }
 
-    void parser_extension_registry_t::clear() { extensions_.clear(); }
+    void parser_extension_registry_t::clear() {
+        extensions_.clear();
+        ++generation_;
+    }
 
     bool parser_extension_registry_t::empty() const noexcept { return extensions_.empty(); }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory_resource>
 #include <string>
 #include <string_view>
@@ -53,7 +54,12 @@ namespace components::sql::parser {
 
         [[nodiscard]] parse_extension_result_t dispatch(std::pmr::memory_resource* resource, const char* query) const;
 
+        // Bumped by every add() and clear(): statements parsed or planned under
+        // another generation may parse differently now.
+        [[nodiscard]] uint64_t generation() const noexcept { return generation_; }
+
     private:
         std::unordered_map<std::string, parser_extension_t> extensions_;
+        uint64_t generation_{0};
     };
 } // namespace components::sql::parser
@@ -1,4 +1,5 @@
 #include <catch2/catch.hpp>
+#include <components/logical_plan/node_analyze.hpp>
 #include <components/logical_plan/node_checkpoint.hpp>
 #include <components/logical_plan/node_vacuum.hpp>
 #include <components/sql/parser/parser.h>
@@ -57,3 +58,44 @@ TEST_CASE("components::sql::vacuum") {
         REQUIRE(node->to_string() == "$vacuum");
     }
 }
+
+TEST_CASE("components::sql::analyze") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    std::pmr::monotonic_buffer_resource arena_resource(&resource);
+    transform::transformer transformer(&resource);
+
+    SECTION("ANALYZE") {
+        auto stmt = raw_parser(&arena_resource, "ANALYZE")->lst.front().data;
+        auto result = transformer.transform(pg_cell_to_node_cast(stmt)).finalize();
+        REQUIRE(!result.has_error());
+        auto node = result.value().sub_queries.back();
+        REQUIRE(node->type() == node_type::analyze_t);
+        REQUIRE(node->to_string() == "$analyze");
+    }
+
+    SECTION("ANALYZE db.table") {
+        auto stmt = raw_parser(&arena_resource, "ANALYZE db.table;")->lst.front().data;
+        auto result = transformer.transform(pg_cell_to_node_cast(stmt)).finalize();
+        REQUIRE(!result.has_error());
+        auto node = result.value().sub_queries.back();
+        REQUIRE(node->type() == node_type::sequence_t);
+        REQUIRE(node->to_string() == "$sequence[3]");
+        REQUIRE(node->children().back()->type() == node_type::analyze_t);
+        REQUIRE(node->children().back()->to_string() == "$analyze");
+    }
+
+    SECTION("ANALYZE db.table (columns)") {
+        auto stmt = raw_parser(&arena_resource, "ANALYZE db.table (a, b);")->lst.front().data;
+        auto result = transformer.transform(pg_cell_to_node_cast(stmt)).finalize();
+        REQUIRE(!result.has_error());
+        auto node = result.value().sub_queries.back();
+        REQUIRE(node->children().back()->to_string() == "$analyze: {a, b}");
+    }
+
+    SECTION("VACUUM ANALYZE stays a vacuum") {
+        auto stmt = raw_parser(&arena_resource, "VACUUM ANALYZE")->lst.front().data;
+        auto result = transformer.transform(pg_cell_to_node_cast(stmt)).finalize();
+        REQUIRE(!result.has_error());
+        REQUIRE(result.value().sub_queries.back()->type() == node_type::vacuum_t);
+    }
+}
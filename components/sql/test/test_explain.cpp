@@ -0,0 +1,77 @@
+#include <catch2/catch.hpp>
+#include <components/sql/parser/parser.h>
+#include <components/sql/parser/pg_functions.h>
+#include <components/sql/transformer/transformer.hpp>
+#include <components/sql/transformer/utils.hpp>
+
+using namespace components::sql;
+using namespace components::logical_plan;
+using namespace components::sql::transform;
+
+TEST_CASE("components::sql::explain") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    std::pmr::monotonic_buffer_resource arena_resource(&resource);
+    transform::transformer transformer(&resource);
+
+    auto transform_query = [&](const char* query) {
+        auto stmt = raw_parser(&arena_resource, query)->lst.front().data;
+        return transformer.transform(pg_cell_to_node_cast(stmt)).finalize();
+    };
+
+    SECTION("SELECT is not explained") {
+        auto result = transform_query("SELECT * FROM db.t;");
+        REQUIRE(!result.has_error());
+        REQUIRE(result.value().explain == explain_mode::none);
+        REQUIRE_FALSE(result.value().explain_json);
+    }
+
+    SECTION("EXPLAIN SELECT") {
+        auto result = transform_query("EXPLAIN SELECT * FROM db.t;");
+        REQUIRE(!result.has_error());
+        REQUIRE(result.value().explain == explain_mode::plan);
+        REQUIRE_FALSE(result.value().explain_json);
+        auto node = result.value().sub_queries.back();
+        REQUIRE(node->type() == node_type::sequence_t);
+        REQUIRE(node->children().back()->type() == node_type::aggregate_t);
+    }
+
+    SECTION("EXPLAIN ANALYZE SELECT") {
+        auto result = transform_query("EXPLAIN ANALYZE SELECT * FROM db.t WHERE a > 1;");
+        REQUIRE(!result.has_error());
+        REQUIRE(result.value().explain == explain_mode::analyze);
+        REQUIRE(result.value().sub_queries.back()->children().back()->type() == node_type::aggregate_t);
+    }
+
+    SECTION("EXPLAIN (ANALYZE, FORMAT JSON)") {
+        auto result = transform_query("EXPLAIN (ANALYZE, FORMAT JSON) SELECT * FROM db.t;");
+        REQUIRE(!result.has_error());
+        REQUIRE(result.value().explain == explain_mode::analyze);
+        REQUIRE(result.value().explain_json);
+    }
+
+    SECTION("EXPLAIN (ANALYZE false, FORMAT TEXT)") {
+        auto result = transform_query("EXPLAIN (ANALYZE false, FORMAT TEXT) SELECT * FROM db.t;");
+        REQUIRE(!result.has_error());
+        REQUIRE(result.value().explain == explain_mode::plan);
+        REQUIRE_FALSE(result.value().explain_json);
+    }
+
+    SECTION("EXPLAIN INSERT") {
+        auto result = transform_query("EXPLAIN INSERT INTO db.t (a) VALUES (1);");
+        REQUIRE(!result.has_error());
+        REQUIRE(result.value().explain == explain_mode::plan);
+        REQUIRE(result.value().sub_queries.back()->children().back()->type() == node_type::insert_t);
+    }
+
+    SECTION("EXPLAIN (FORMAT XML) is rejected") {
+        auto result = transform_query("EXPLAIN (FORMAT XML) SELECT * FROM db.t;");
+        REQUIRE(result.has_error());
+        REQUIRE(result.error().type == core::error_code_t::sql_parse_error);
+    }
+
+    SECTION("EXPLAIN of a utility statement is rejected") {
+        auto result = transform_query("EXPLAIN CREATE MATERIALIZED VIEW db.v AS SELECT * FROM db.t;");
+        REQUIRE(result.has_error());
+        REQUIRE(result.error().type == core::error_code_t::sql_parse_error);
+    }
+}
@@ -0,0 +1,73 @@
+#include <components/sql/transformer/transformer.hpp>
+#include <components/sql/transformer/utils.hpp>
+
+#include <algorithm>
+#include <cctype>
+
+namespace components::sql::transform {
+
+    namespace {
+
+        std::string lowercase(std::string text) {
+            std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::tolower(c); });
+            return text;
+        }
+
+        // A boolean option: bare (`ANALYZE`), a word (`ANALYZE false`, `on`) or
+        // a number (`ANALYZE 0`).
+        bool option_enabled(const DefElem& def) {
+            if (!def.arg) {
+                return true;
+            }
+            if (nodeTag(def.arg) == T_Integer) {
+                return intVal(def.arg) != 0;
+            }
+            const auto value = lowercase(strVal(def.arg));
+            return value != "false" && value != "off" && value != "no" && value != "0";
+        }
+
+    } // namespace
+
+    logical_plan::node_ptr transformer::transform_explain(ExplainStmt& node, logical_plan::execution_plan_t* plan) {
+        bool analyze = false;
+        if (node.options) {
+            for (auto data : node.options->lst) {
+                auto def = pg_ptr_cast<DefElem>(data.data);
+                if (!def->defname) {
+                    continue;
+                }
+                const std::string opt_name(def->defname);
+                if (opt_name == "analyze") {
+                    analyze = option_enabled(*def);
+                } else if (opt_name == "format") {
+                    const auto format = def->arg ? lowercase(strVal(def->arg)) : std::string{};
+                    if (format == "json") {
+                        plan->explain_json = true;
+                    } else if (format != "text") {
+                        error_ = core::error_t(core::error_code_t::sql_parse_error,
+                                               std::pmr::string{"EXPLAIN format must be TEXT or JSON", resource_});
+                        return nullptr;
+                    }
+                }
+                // VERBOSE, COSTS, ...: accepted and ignored.
+            }
+        }
+
+        switch (nodeTag(node.query)) {
+            case T_SelectStmt:
+            case T_InsertStmt:
+            case T_UpdateStmt:
+            case T_DeleteStmt:
+                break;
+            default:
+                error_ = core::error_t(core::error_code_t::sql_parse_error,
+                                       std::pmr::string{"EXPLAIN supports SELECT, INSERT, UPDATE and DELETE only",
+                                                        resource_});
+                return nullptr;
+        }
+
+        plan->explain = analyze ? logical_plan::explain_mode::analyze : logical_plan::explain_mode::plan;
+        return transform(*node.query, plan);
+    }
+
+} // namespace components::sql::transform
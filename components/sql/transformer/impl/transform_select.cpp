@@ -362,14 +362,18 @@ namespace components::sql::transform {
             // the same chunk in as both left and right), so column refs resolve
             // through the join's merged schema regardless of side_t.
             //
-            // The synthesized tree mutates `node.fromClause->lst.front()` so the
-            // existing T_JoinExpr branch below picks it up unchanged.
+            // The synthesized tree only replaces the local `from_first`, so the
+            // existing T_JoinExpr branch below picks it up unchanged. The parse
+            // tree itself is left alone: a prepared statement transforms the same
+            // tree on every execution, possibly from several threads at once.
+            //
+            // Synth parser-AST nodes — consumed within this function by join_dfs,
+            // which builds independent logical_plan nodes. Live in a transient
+            // arena (upstream=resource_) so they don't outlive this function on
+            // the session resource.
+            std::pmr::monotonic_buffer_resource transient(resource_);
+            auto from_first = node.fromClause->lst.front().data;
             if (node.fromClause->lst.size() > 1) {
-                // Synth parser-AST nodes — consumed within this function by
-                // join_dfs which builds independent logical_plan nodes. Live in
-                // a transient arena (upstream=resource_) so they don't outlive
-                // their scope on the session resource.
-                std::pmr::monotonic_buffer_resource transient(resource_);
                 auto* resource = &transient; // makeNode macro reads `resource_` / `resource`
                 auto it = node.fromClause->lst.begin();
                 Node* acc = pg_ptr_cast<Node>(it->data);
@@ -387,14 +391,10 @@ namespace components::sql::transform {
                     synth->rtindex = 0;
                     acc = reinterpret_cast<Node*>(synth);
                 }
-                // Replace the original multi-entry fromClause with a single
-                // top-level JoinExpr so the dispatch below sees T_JoinExpr.
-                node.fromClause->lst.clear();
-                node.fromClause->lst.push_back({acc});
+                from_first = acc;
             }
 
             // has from
-            auto from_first = node.fromClause->lst.front().data;
             if (nodeTag(from_first) == T_RangeVar) {
                 // from table_name
                 auto table = pg_ptr_cast<RangeVar>(from_first);
@@ -1,10 +1,28 @@
+#include <components/logical_plan/node_analyze.hpp>
 #include <components/logical_plan/node_vacuum.hpp>
+#include <components/sql/parser/pg_functions.h>
 #include <components/sql/transformer/transformer.hpp>
+#include <components/sql/transformer/utils.hpp>
 
 namespace components::sql::transform {
 
-    logical_plan::node_ptr transformer::transform_vacuum(VacuumStmt& /*node*/) {
-        return logical_plan::make_node_vacuum(resource_);
+    logical_plan::node_ptr transformer::transform_vacuum(VacuumStmt& node) {
+        // The grammar sets VACOPT_ANALYZE for ANALYZE and for VACUUM ANALYZE;
+        // only the former has no VACOPT_VACUUM. VACUUM keeps its own path.
+        if (!(node.options & VACOPT_ANALYZE) || (node.options & VACOPT_VACUUM)) {
+            return logical_plan::make_node_vacuum(resource_);
+        }
+        auto analyze = logical_plan::make_node_analyze(resource_);
+        if (!node.relation) {
+            return analyze;
+        }
+        if (node.va_cols) {
+            for (auto cell : node.va_cols->lst) {
+                analyze->append_column(strVal(cell.data));
+            }
+        }
+        auto qn = rangevar_to_qualified_name(node.relation);
+        return maybe_wrap_with_catalog_resolve_table(resource_, qn.dbname, qn.relname, std::move(analyze));
     }
 
 } // namespace components::sql::transform
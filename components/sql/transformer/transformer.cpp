@@ -110,6 +110,9 @@ namespace components::sql::transform {
             case T_VacuumStmt:
                 log_node = transform_vacuum(pg_cast<VacuumStmt>(node));
                 break;
+            case T_ExplainStmt:
+                log_node = transform_explain(pg_cast<ExplainStmt>(node), plan);
+                break;
             case T_CreateSeqStmt:
                 log_node = transform_create_sequence(pg_cast<CreateSeqStmt>(node));
                 break;
@@ -52,6 +52,9 @@ namespace components::sql::transform {
         logical_plan::node_ptr transform_drop_database(DropdbStmt& node);
         logical_plan::node_ptr transform_checkpoint(CheckPointStmt& node);
         logical_plan::node_ptr transform_vacuum(VacuumStmt& node);
+        // EXPLAIN [ANALYZE] / EXPLAIN (ANALYZE, FORMAT JSON) <query>: stamps the
+        // options on `plan` and transforms the query itself.
+        logical_plan::node_ptr transform_explain(ExplainStmt& node, logical_plan::execution_plan_t* plan);
         logical_plan::node_ptr transform_create_table(CreateStmt& node);
         logical_plan::node_ptr transform_drop(DropStmt& node);
         logical_plan::node_ptr transform_select(SelectStmt& node, logical_plan::execution_plan_t* plan);
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <memory_resource>
 #include <vector>
 
+#include <components/table/base_statistics.hpp>
 #include <components/table/column_definition.hpp>
 #include <components/table/column_state.hpp>
 #include <components/table/row_version_manager.hpp>
@@ -43,6 +45,8 @@ namespace components::storage {
 
         virtual uint64_t total_rows() const = 0;
         virtual uint64_t calculate_size() = 0;
+        // Per-column min/max/null count over the whole table. Default: no statistics.
+        virtual std::vector<table::base_statistics_t> column_statistics() { return {}; }
 
         virtual void scan(vector::data_chunk_t& output, const table::table_filter_t* filter, int64_t limit) = 0;
         virtual void scan(vector::data_chunk_t& output,
@@ -121,6 +125,62 @@ namespace components::storage {
             return true;
         }
 
+        // Read-ahead fetch-next. Appends up to ~`max_batches` batches from `pos.next_row` to `batches`
+        // (at least one unless the scan drains), advancing `pos` exactly as repeated fetch_next_batch
+        // calls would, but through one scan state per call (see data_table_t::fetch_next_batches).
+        // Default fallback: fetch_next_batch in a loop.
+        [[nodiscard]] virtual core::result_wrapper_t<bool>
+        fetch_next_batches(std::pmr::vector<vector::data_chunk_t>& batches,
+                           scan_position_t& pos,
+                           const table::table_filter_t* filter,
+                           const std::vector<size_t>* projected_cols,
+                           table::transaction_data txn,
+                           uint64_t max_batches) {
+            auto t = types();
+            for (uint64_t i = 0; i < std::max<uint64_t>(max_batches, 1) && !pos.drained; i++) {
+                vector::data_chunk_t one =
+                    projected_cols
+                        ? vector::data_chunk_t(resource(), t, *projected_cols, vector::DEFAULT_VECTOR_CAPACITY)
+                        : vector::data_chunk_t(resource(), t, vector::DEFAULT_VECTOR_CAPACITY);
+                auto fetched = fetch_next_batch(one, pos, filter, projected_cols, txn);
+                if (fetched.has_error()) {
+                    return fetched;
+                }
+                if (one.size() == 0) {
+                    break;
+                }
+                batches.push_back(std::move(one));
+            }
+            return true;
+        }
+
+        // Morsel-parallel fetch-next. Scans up to `max_morsels` morsels from `pos.next_row` on
+        // `thread_count` workers (see data_table_t::scan_parallel), appends their batches to `batches`
+        // in row order, advances `pos` past them and sets `pos.drained` at `pos.max_row`. Unlike
+        // fetch_next_batch this hands back several batches per call; the pins still die before it
+        // returns. Default fallback: one fetch_next_batch.
+        [[nodiscard]] virtual core::result_wrapper_t<bool>
+        fetch_next_morsels(std::pmr::vector<vector::data_chunk_t>& batches,
+                           scan_position_t& pos,
+                           const table::table_filter_t* filter,
+                           const std::vector<size_t>* projected_cols,
+                           table::transaction_data txn,
+                           uint64_t /*max_morsels*/,
+                           uint64_t /*thread_count*/) {
+            auto t = types();
+            vector::data_chunk_t one =
+                projected_cols ? vector::data_chunk_t(resource(), t, *projected_cols, vector::DEFAULT_VECTOR_CAPACITY)
+                               : vector::data_chunk_t(resource(), t, vector::DEFAULT_VECTOR_CAPACITY);
+            auto fetched = fetch_next_batch(one, pos, filter, projected_cols, txn);
+            if (fetched.has_error()) {
+                return fetched;
+            }
+            if (one.size() > 0) {
+                batches.push_back(std::move(one));
+            }
+            return true;
+        }
+
         virtual void fetch(vector::data_chunk_t& output, const vector::vector_t& row_ids, uint64_t count) = 0;
 
         virtual void scan_segment(int64_t start,
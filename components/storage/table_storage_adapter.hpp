@@ -28,6 +28,10 @@ namespace components::storage {
 
         uint64_t calculate_size() override { return table_.calculate_size(); }
 
+        std::vector<table::base_statistics_t> column_statistics() override {
+            return table_.row_group()->column_statistics();
+        }
+
         void scan(vector::data_chunk_t& output, const table::table_filter_t* filter, int64_t limit) override {
             std::vector<table::storage_index_t> column_indices;
             column_indices.reserve(table_.column_count());
@@ -199,6 +203,86 @@ namespace components::storage {
             return table_.fetch_next_batch(output, column_indices, filter, txn, pos.next_row, pos.max_row, pos.drained);
         }
 
+        [[nodiscard]] core::result_wrapper_t<bool> fetch_next_morsels(std::pmr::vector<vector::data_chunk_t>& batches,
+                                                                      scan_position_t& pos,
+                                                                      const table::table_filter_t* filter,
+                                                                      const std::vector<size_t>* projected_cols,
+                                                                      table::transaction_data txn,
+                                                                      uint64_t max_morsels,
+                                                                      uint64_t thread_count) override {
+            if (pos.drained || pos.next_row >= pos.max_row) {
+                pos.drained = true;
+                return true;
+            }
+            std::vector<table::storage_index_t> column_indices;
+            if (projected_cols) {
+                column_indices.reserve(projected_cols->size());
+                for (size_t idx : *projected_cols) {
+                    if (idx < table_.column_count()) {
+                        column_indices.emplace_back(static_cast<int64_t>(idx));
+                    }
+                }
+            } else {
+                column_indices.reserve(table_.column_count());
+                for (size_t i = 0; i < table_.column_count(); i++) {
+                    column_indices.emplace_back(static_cast<int64_t>(i));
+                }
+            }
+            auto scanned = table_.scan_parallel(table_.copy_types(),
+                                                column_indices,
+                                                projected_cols,
+                                                filter,
+                                                txn,
+                                                pos.next_row,
+                                                pos.max_row,
+                                                max_morsels,
+                                                thread_count,
+                                                batches);
+            if (scanned.has_error()) {
+                return scanned;
+            }
+            if (pos.next_row >= pos.max_row) {
+                pos.drained = true;
+            }
+            return true;
+        }
+
+        [[nodiscard]] core::result_wrapper_t<bool> fetch_next_batches(std::pmr::vector<vector::data_chunk_t>& batches,
+                                                                      scan_position_t& pos,
+                                                                      const table::table_filter_t* filter,
+                                                                      const std::vector<size_t>* projected_cols,
+                                                                      table::transaction_data txn,
+                                                                      uint64_t max_batches) override {
+            if (pos.drained || pos.next_row >= pos.max_row) {
+                pos.drained = true;
+                return true;
+            }
+            std::vector<table::storage_index_t> column_indices;
+            if (projected_cols) {
+                column_indices.reserve(projected_cols->size());
+                for (size_t idx : *projected_cols) {
+                    if (idx < table_.column_count()) {
+                        column_indices.emplace_back(static_cast<int64_t>(idx));
+                    }
+                }
+            } else {
+                column_indices.reserve(table_.column_count());
+                for (size_t i = 0; i < table_.column_count(); i++) {
+                    column_indices.emplace_back(static_cast<int64_t>(i));
+                }
+            }
+            return table_.fetch_next_batches(table_.copy_types(),
+                                             column_indices,
+                                             projected_cols,
+                                             filter,
+                                             txn,
+                                             pos.next_row,
+                                             pos.max_row,
+                                             max_batches,
+                                             batches,
+                                             pos.drained);
+        }
+
         void fetch(vector::data_chunk_t& output, const vector::vector_t& row_ids, uint64_t count) override {
             table::column_fetch_state state;
             std::vector<table::storage_index_t> column_indices;
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory_resource>
+#include <vector>
 
 #include <components/types/logical_value.hpp>
 
@@ -58,4 +59,11 @@ namespace components::table {
         bool has_stats_{false};
     };
 
+    // Whole-table statistics: the row count and, per column, the min/max/null count
+    // merged over all row groups. Read by the optimizer's cardinality estimates.
+    struct table_statistics_t {
+        uint64_t row_count{0};
+        std::vector<base_statistics_t> columns;
+    };
+
 } // namespace components::table
@@ -397,6 +397,18 @@ namespace components::table {
         return result;
     }
 
+    std::vector<base_statistics_t> collection_t::column_statistics() {
+        std::vector<base_statistics_t> result;
+        result.reserve(types_.size());
+        for (const auto& type : types_) {
+            result.emplace_back(resource_, type.type());
+        }
+        for (auto& row_group : row_groups_->segments()) {
+            row_group.merge_column_statistics(result);
+        }
+        return result;
+    }
+
     void collection_t::collect_disk_block_ids(std::pmr::vector<uint64_t>& out) {
         for (auto& row_group : row_groups_->segments()) {
             row_group.collect_disk_block_ids(out);
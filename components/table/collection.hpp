@@ -91,9 +91,12 @@ namespace components::table {
                                                                  vector::data_chunk_t& updates);
 
         std::vector<column_segment_info> get_column_segment_info();
+        // Per-column statistics merged over every row group.
+        std::vector<base_statistics_t> column_statistics();
 
         // Append the ids of disk blocks exclusively owned by this collection's columns to `out`,
-        // so data_table_t::compact can free them after swapping the collection out for a compacted one.
+        // so data_table_t::compact can free them after swapping the collection out for a compacted one,
+        // and a checkpoint can tell which superseded checkpoint blocks live segments still read.
         void collect_disk_block_ids(std::pmr::vector<uint64_t>& out);
 
         const std::pmr::vector<types::complex_logical_type>& types() const;
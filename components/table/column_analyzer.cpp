@@ -0,0 +1,238 @@
+#include "column_analyzer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <string_view>
+
+#include <components/vector/vector.hpp>
+
+namespace components::table {
+
+    namespace {
+
+        constexpr uint64_t random_seed = 0x9e3779b97f4a7c15ULL;
+
+        template<typename T>
+        uint64_t raw_hash(T value) noexcept {
+            if constexpr (std::is_floating_point_v<T>) {
+                if (value == T{0}) {
+                    value = T{0}; // -0.0 == 0.0
+                }
+            }
+            uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(T));
+            return hyperloglog_t::mix_hash(bits);
+        }
+
+        uint64_t raw_hash(std::string_view value) noexcept {
+            return hyperloglog_t::mix_hash(std::hash<std::string_view>{}(value));
+        }
+
+        bool is_sampled_type(types::logical_type type) {
+            return types::is_numeric(type) || type == types::logical_type::BOOLEAN ||
+                   type == types::logical_type::STRING_LITERAL;
+        }
+
+    } // namespace
+
+    column_analyzer_t::column_analyzer_t(std::pmr::memory_resource* resource, size_t sample_size)
+        : resource_(resource)
+        , sample_size_(std::max<size_t>(sample_size, 1))
+        , random_state_(random_seed) {}
+
+    size_t column_analyzer_t::next_slot() noexcept {
+        const uint64_t seen = non_null_count_++;
+        if (seen < sample_size_) {
+            return static_cast<size_t>(seen);
+        }
+        // splitmix64 step; the modulo bias is negligible for table sizes.
+        random_state_ += 0x9e3779b97f4a7c15ULL;
+        const uint64_t j = hyperloglog_t::mix_hash(random_state_) % (seen + 1);
+        return j < sample_size_ ? static_cast<size_t>(j) : sample_size_;
+    }
+
+    void column_analyzer_t::store(size_t slot, types::logical_value_t value) {
+        if (slot == sample_.size()) {
+            sample_.push_back(std::move(value));
+        } else {
+            sample_[slot] = std::move(value);
+        }
+    }
+
+    template<typename T>
+    void column_analyzer_t::update_typed(vector::vector_t& vec, uint64_t count) {
+        vector::unified_vector_format uvf(vec.resource(), count);
+        vec.to_unified_format(count, uvf);
+        const auto* data = uvf.get_data<T>();
+        for (uint64_t i = 0; i < count; ++i) {
+            const uint64_t idx = uvf.referenced_indexing->get_index(i);
+            if (!uvf.validity.row_is_valid(idx)) {
+                ++null_count_;
+                continue;
+            }
+            sketch_.add_hash(raw_hash(data[idx]));
+            if (const size_t slot = next_slot(); slot < sample_size_) {
+                if constexpr (std::is_same_v<T, std::string_view>) {
+                    store(slot, types::logical_value_t(resource_, std::string(data[idx])));
+                } else {
+                    store(slot, types::logical_value_t(resource_, data[idx]));
+                }
+            }
+        }
+    }
+
+    void column_analyzer_t::update_generic(vector::vector_t& vec, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            add(vec.value(i));
+        }
+    }
+
+    void column_analyzer_t::update(vector::vector_t& vec, uint64_t count) {
+        using types::logical_type;
+        row_count_ += count;
+        switch (vec.type().type()) {
+            case logical_type::BOOLEAN:
+                update_typed<bool>(vec, count);
+                break;
+            case logical_type::TINYINT:
+                update_typed<int8_t>(vec, count);
+                break;
+            case logical_type::SMALLINT:
+                update_typed<int16_t>(vec, count);
+                break;
+            case logical_type::INTEGER:
+                update_typed<int32_t>(vec, count);
+                break;
+            case logical_type::BIGINT:
+                update_typed<int64_t>(vec, count);
+                break;
+            case logical_type::UTINYINT:
+                update_typed<uint8_t>(vec, count);
+                break;
+            case logical_type::USMALLINT:
+                update_typed<uint16_t>(vec, count);
+                break;
+            case logical_type::UINTEGER:
+                update_typed<uint32_t>(vec, count);
+                break;
+            case logical_type::UBIGINT:
+                update_typed<uint64_t>(vec, count);
+                break;
+            case logical_type::FLOAT:
+                update_typed<float>(vec, count);
+                break;
+            case logical_type::DOUBLE:
+                update_typed<double>(vec, count);
+                break;
+            case logical_type::STRING_LITERAL:
+                update_typed<std::string_view>(vec, count);
+                break;
+            default:
+                // add() counts the rows again.
+                row_count_ -= count;
+                update_generic(vec, count);
+                break;
+        }
+    }
+
+    void column_analyzer_t::add(const types::logical_value_t& value) {
+        ++row_count_;
+        if (value.is_null()) {
+            ++null_count_;
+            return;
+        }
+        sketch_.add_hash(hyperloglog_t::mix_hash(value.hash()));
+        if (!is_sampled_type(value.type().type())) {
+            ++non_null_count_;
+            unsampled_ = true;
+            return;
+        }
+        if (const size_t slot = next_slot(); slot < sample_size_) {
+            store(slot, types::logical_value_t(resource_, value));
+        }
+    }
+
+    column_analysis_t column_analyzer_t::finish(size_t histogram_buckets, size_t mcv_size) {
+        column_analysis_t result{row_count_, null_count_, 0, sketch_, {}, {}, {}};
+        if (non_null_count_ == 0) {
+            return result;
+        }
+        result.distinct_count = std::clamp<uint64_t>(sketch_.estimate(), 1, non_null_count_);
+        if (unsampled_ || sample_.empty()) {
+            return result;
+        }
+
+        std::sort(sample_.begin(), sample_.end());
+        struct run_t {
+            size_t begin;
+            size_t length;
+        };
+        std::vector<run_t> runs;
+        for (size_t i = 0; i < sample_.size();) {
+            size_t j = i + 1;
+            while (j < sample_.size() && sample_[j] == sample_[i]) {
+                ++j;
+            }
+            runs.push_back({i, j - i});
+            i = j;
+        }
+
+        const bool complete = sample_.size() == non_null_count_;
+        if (complete) {
+            result.distinct_count = runs.size();
+        }
+        const double scale = static_cast<double>(non_null_count_) / static_cast<double>(sample_.size());
+
+        // MCVs: every value when the whole column fits the list, otherwise the
+        // values sampled more than once and clearly above the average frequency.
+        std::vector<size_t> mcv_runs;
+        if (complete && runs.size() <= mcv_size) {
+            mcv_runs.resize(runs.size());
+            std::iota(mcv_runs.begin(), mcv_runs.end(), 0);
+        } else {
+            const double average = static_cast<double>(sample_.size()) / static_cast<double>(runs.size());
+            for (size_t r = 0; r < runs.size(); ++r) {
+                if (runs[r].length >= 2 && static_cast<double>(runs[r].length) > 1.25 * average) {
+                    mcv_runs.push_back(r);
+                }
+            }
+        }
+        std::stable_sort(mcv_runs.begin(), mcv_runs.end(), [&runs](size_t a, size_t b) {
+            return runs[a].length > runs[b].length;
+        });
+        if (mcv_runs.size() > mcv_size) {
+            mcv_runs.resize(mcv_size);
+        }
+        std::vector<bool> is_mcv(runs.size(), false);
+        for (auto r : mcv_runs) {
+            is_mcv[r] = true;
+            result.mcv_values.push_back(sample_[runs[r].begin]);
+            result.mcv_counts.push_back(
+                static_cast<uint64_t>(std::llround(static_cast<double>(runs[r].length) * scale)));
+        }
+
+        // Histogram over the remaining sampled values, in sorted order.
+        std::vector<size_t> rest;
+        for (size_t r = 0; r < runs.size(); ++r) {
+            if (is_mcv[r]) {
+                continue;
+            }
+            for (size_t k = 0; k < runs[r].length; ++k) {
+                rest.push_back(runs[r].begin + k);
+            }
+        }
+        if (rest.size() >= 2 && histogram_buckets > 0) {
+            const size_t buckets = std::min(histogram_buckets, rest.size() - 1);
+            result.histogram.reserve(buckets + 1);
+            for (size_t b = 0; b <= buckets; ++b) {
+                result.histogram.push_back(sample_[rest[b * (rest.size() - 1) / buckets]]);
+            }
+        }
+        return result;
+    }
+
+} // namespace components::table
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "hyperloglog.hpp"
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include <components/types/logical_value.hpp>
+
+namespace components::vector {
+    class vector_t;
+} // namespace components::vector
+
+namespace components::table {
+
+    // What ANALYZE learns about one column.
+    struct column_analysis_t {
+        uint64_t row_count{0};
+        uint64_t null_count{0};
+        // Distinct non-NULL values: exact when the sample held every non-NULL
+        // row, the sketch's estimate otherwise.
+        uint64_t distinct_count{0};
+        hyperloglog_t sketch;
+        // Equi-depth histogram over the values that are not MCVs: the first bound
+        // is the smallest such value, the last the largest, and about the same
+        // number of rows fall between each pair of neighbours. Empty when fewer
+        // than two such values were sampled or the type is not sampled.
+        std::vector<types::logical_value_t> histogram;
+        // Most common values, most frequent first, with their estimated row counts.
+        std::vector<types::logical_value_t> mcv_values;
+        std::vector<uint64_t> mcv_counts;
+    };
+
+    // Streams one column: every non-NULL value feeds the HyperLogLog sketch and a
+    // fixed-size reservoir sample (Vitter's algorithm R, deterministic seed), from
+    // which finish() derives the MCV list and the equi-depth histogram. Only
+    // scalar numeric, boolean and string values are sampled; other types get row,
+    // NULL and distinct counts only.
+    class column_analyzer_t {
+    public:
+        static constexpr size_t default_sample_size = 30000;
+        static constexpr size_t default_histogram_buckets = 100;
+        static constexpr size_t default_mcv_size = 100;
+
+        explicit column_analyzer_t(std::pmr::memory_resource* resource, size_t sample_size = default_sample_size);
+
+        void update(vector::vector_t& vec, uint64_t count);
+        void add(const types::logical_value_t& value);
+
+        column_analysis_t finish(size_t histogram_buckets = default_histogram_buckets,
+                                 size_t mcv_size = default_mcv_size);
+
+    private:
+        template<typename T>
+        void update_typed(vector::vector_t& vec, uint64_t count);
+        void update_generic(vector::vector_t& vec, uint64_t count);
+
+        // Index of the reservoir slot the next non-NULL value goes to, or
+        // sample_size_ when it is not sampled. Counts the value.
+        size_t next_slot() noexcept;
+        void store(size_t slot, types::logical_value_t value);
+
+        std::pmr::memory_resource* resource_;
+        size_t sample_size_;
+        uint64_t row_count_{0};
+        uint64_t null_count_{0};
+        uint64_t non_null_count_{0};
+        // Some non-NULL value was of a type that is not sampled.
+        bool unsampled_{false};
+        uint64_t random_state_;
+        hyperloglog_t sketch_;
+        std::vector<types::logical_value_t> sample_;
+    };
+
+} // namespace components::table
@@ -6,6 +6,10 @@
 
 #include <components/table/column_data.hpp>
 #include <components/table/column_segment.hpp>
+#include <components/table/compression/alp.hpp>
+#include <components/table/compression/bitpacking.hpp>
+#include <components/table/compression/fsst.hpp>
+#include <components/table/compression/string_dictionary.hpp>
 #include <components/table/storage/block_manager.hpp>
 #include <components/table/storage/buffer_handle.hpp>
 #include <components/table/storage/buffer_manager.hpp>
@@ -171,6 +175,29 @@ namespace components::table {
             return analysis.compressed_size;
         }
 
+        // Reads the values of an uncompressed STRING segment: [uint32_t dict_size][uint32_t dict_end]..., the
+        // cumulative int32_t offsets after the header and the bytes growing down from dict_end. NULL rows
+        // repeat the previous offset and read back empty; validity lives in its own column. Returns false
+        // when a value sits in an overflow block (negative offset): such segments stay uncompressed.
+        bool read_inline_strings(const std::byte* segment_data, uint64_t count, std::vector<std::string_view>& out) {
+            static constexpr uint64_t STRING_HEADER_SIZE = 5 * sizeof(uint32_t);
+            uint32_t dict_end;
+            std::memcpy(&dict_end, segment_data + sizeof(uint32_t), sizeof(uint32_t));
+            out.resize(count);
+            int32_t previous = 0;
+            for (uint64_t i = 0; i < count; i++) {
+                int32_t offset;
+                std::memcpy(&offset, segment_data + STRING_HEADER_SIZE + i * sizeof(int32_t), sizeof(int32_t));
+                if (offset < 0) {
+                    return false;
+                }
+                out[i] = std::string_view(reinterpret_cast<const char*>(segment_data + dict_end - offset),
+                                          static_cast<uint64_t>(offset - previous));
+                previous = offset;
+            }
+            return true;
+        }
+
     } // anonymous namespace
 
     column_checkpoint_state_t::column_checkpoint_state_t(column_data_t& column_data,
@@ -194,8 +221,8 @@ namespace components::table {
         bool is_fixed_size = (phys != types::physical_type::STRING && phys != types::physical_type::BIT &&
                               phys != types::physical_type::INVALID);
 
-        // A DISK-LOADED segment that is already compressed (CONSTANT/RLE/DICTIONARY) holds its COMPRESSED
-        // byte stream in the pinned buffer, NOT raw values. Re-running the compression analysis below would
+        // A DISK-LOADED segment that is already compressed (CONSTANT/RLE/DICTIONARY/BITPACKING/FSST/ALP) holds its
+        // COMPRESSED byte stream in the pinned buffer, NOT raw values. Re-running the compression analysis below would
         // read those compressed bytes as raw fixed-width values and re-compress garbage (reopen corruption:
         // a packed RLE column read back as 0x140003). Such a segment is already in its final on-disk form,
         // so copy its bytes through VERBATIM to a fresh allocation, preserving the compression type and the
@@ -243,50 +270,115 @@ namespace components::table {
                 return true;
             }
 
-            // Try RLE compression
+            // RLE, DICTIONARY, BITPACKING and ALP compete on size: the smallest encoding below the raw
+            // size wins, and only the winner's buffer is built.
+            uint64_t uncompressed_size = segment.type_size * tuple_count;
+            auto best = compression::compression_type::UNCOMPRESSED;
+            uint64_t best_size = uncompressed_size;
+
             uint32_t num_runs = count_runs(segment_data, segment.type_size, tuple_count);
             uint64_t entry_size = segment.type_size + sizeof(uint32_t);
             uint64_t rle_size = sizeof(uint32_t) + num_runs * entry_size;
-            uint64_t uncompressed_size = segment.type_size * tuple_count;
+            if (rle_size < best_size) {
+                best = compression::compression_type::RLE;
+                best_size = rle_size;
+            }
 
-            if (rle_size < uncompressed_size) {
-                std::vector<std::byte> rle_buf;
-                build_rle_buffer(segment_data, segment.type_size, tuple_count, rle_buf);
+            // BITPACKING (frame-of-reference / delta, high-cardinality integers and timestamps)
+            std::vector<std::byte> bitpacked;
+            uint64_t bitpacked_size = compression::bitpacking::encode(phys, segment_data, tuple_count, bitpacked);
+            if (bitpacked_size > 0 && bitpacked_size < best_size) {
+                best = compression::compression_type::BITPACKING;
+                best_size = bitpacked_size;
+            }
+
+            // ALP (decimal-origin FLOAT / DOUBLE, with a Chimp fallback per group)
+            std::vector<std::byte> alp_encoded;
+            uint64_t alp_size = compression::alp::encode(phys, segment_data, tuple_count, alp_encoded);
+            if (alp_size > 0 && alp_size < best_size) {
+                best = compression::compression_type::ALP;
+                best_size = alp_size;
+            }
+
+            // DICTIONARY (low-cardinality columns). Its one-byte-per-row floor often loses to bit-packing
+            // already, and then the costly distinct-value analysis is skipped.
+            dict_analysis_t dict_info;
+            if (sizeof(uint16_t) + 2 * segment.type_size + tuple_count < best_size) {
+                dict_info = analyze_dictionary(segment_data, segment.type_size, tuple_count);
+            }
+            if (dict_info.num_unique > 1 && dict_info.compressed_size < best_size) {
+                best = compression::compression_type::DICTIONARY;
+                best_size = dict_info.compressed_size;
+            }
 
-                auto allocation = partial_block_manager_.get_block_allocation(rle_size);
+            if (best != compression::compression_type::UNCOMPRESSED) {
+                std::vector<std::byte> buffer;
+                switch (best) {
+                    case compression::compression_type::RLE:
+                        build_rle_buffer(segment_data, segment.type_size, tuple_count, buffer);
+                        break;
+                    case compression::compression_type::DICTIONARY:
+                        build_dict_buffer(segment_data, segment.type_size, tuple_count, dict_info, buffer);
+                        break;
+                    case compression::compression_type::ALP:
+                        buffer = std::move(alp_encoded);
+                        break;
+                    default:
+                        buffer = std::move(bitpacked);
+                        break;
+                }
+
+                auto allocation = partial_block_manager_.get_block_allocation(best_size);
                 partial_block_manager_.write_to_block(allocation.block_id,
                                                       allocation.offset_in_block,
-                                                      rle_buf.data(),
-                                                      rle_size);
+                                                      buffer.data(),
+                                                      best_size);
 
                 storage::data_pointer_t dp;
                 dp.row_start = row_start;
                 dp.tuple_count = tuple_count;
                 dp.block_pointer = storage::block_pointer_t(allocation.block_id, allocation.offset_in_block);
-                dp.compression = compression::compression_type::RLE;
-                dp.segment_size = rle_size;
+                dp.compression = best;
+                dp.segment_size = best_size;
                 data_pointers_.push_back(dp);
                 return true;
             }
+        }
 
-            // Try DICTIONARY compression (low-cardinality columns)
-            auto dict_info = analyze_dictionary(segment_data, segment.type_size, tuple_count);
-            if (dict_info.num_unique > 1 && dict_info.compressed_size < uncompressed_size) {
-                std::vector<std::byte> dict_buf;
-                build_dict_buffer(segment_data, segment.type_size, tuple_count, dict_info, dict_buf);
+        // STRING: DICTIONARY for few distinct values, FSST for text that only repeats in fragments. Both compete
+        // on size against the uncompressed segment.
+        std::vector<std::string_view> strings;
+        if (phys == types::physical_type::STRING && tuple_count > 1 && data &&
+            read_inline_strings(data + segment.block_offset(), tuple_count, strings)) {
+            auto best = compression::compression_type::UNCOMPRESSED;
+            uint64_t best_size = segment.segment_size();
+            std::vector<std::byte> buffer;
+            uint64_t dict_size = compression::string_dictionary::encode(strings, best_size, buffer);
+            if (dict_size > 0) {
+                best = compression::compression_type::DICTIONARY;
+                best_size = dict_size;
+            }
+            std::vector<std::byte> fsst_buffer;
+            uint64_t fsst_size = compression::fsst::encode(strings, best_size, fsst_buffer);
+            if (fsst_size > 0) {
+                best = compression::compression_type::FSST;
+                best_size = fsst_size;
+                buffer = std::move(fsst_buffer);
+            }
 
-                auto allocation = partial_block_manager_.get_block_allocation(dict_info.compressed_size);
+            if (best != compression::compression_type::UNCOMPRESSED) {
+                auto allocation = partial_block_manager_.get_block_allocation(best_size);
                 partial_block_manager_.write_to_block(allocation.block_id,
                                                       allocation.offset_in_block,
-                                                      dict_buf.data(),
-                                                      dict_info.compressed_size);
+                                                      buffer.data(),
+                                                      best_size);
 
                 storage::data_pointer_t dp;
                 dp.row_start = row_start;
                 dp.tuple_count = tuple_count;
                 dp.block_pointer = storage::block_pointer_t(allocation.block_id, allocation.offset_in_block);
-                dp.compression = compression::compression_type::DICTIONARY;
-                dp.segment_size = dict_info.compressed_size;
+                dp.compression = best;
+                dp.segment_size = best_size;
                 data_pointers_.push_back(dp);
                 return true;
             }
@@ -54,6 +54,18 @@ namespace components::table {
         if (dynamic_cast<const set_membership_filter_t*>(&filter)) {
             return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
         }
+        // A runtime join filter prunes on its key range; the Bloom bits are checked per row.
+        if (auto* bloom = dynamic_cast<const bloom_filter_t*>(&filter)) {
+            return bloom->excludes_range(statistics_.min_value(), statistics_.max_value())
+                       ? filter_propagate_result_t::ALWAYS_FALSE
+                       : filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        }
+        // A top-N filter prunes everything past the sort's current k-th key.
+        if (auto* top_n = dynamic_cast<const top_n_filter_t*>(&filter)) {
+            return top_n->excludes_range(statistics_.min_value(), statistics_.max_value(), statistics_.null_count())
+                       ? filter_propagate_result_t::ALWAYS_FALSE
+                       : filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        }
 
         if (filter.filter_type == expressions::compare_type::eq ||
             filter.filter_type == expressions::compare_type::gt ||
@@ -64,6 +76,11 @@ namespace components::table {
             const auto& constant = constant_filter.constant;
             const auto& min = statistics_.min_value();
             const auto& max = statistics_.max_value();
+            // A constant of another type (e.g. a µs constant against a DATE column) is widened per
+            // row by the filter; the raw statistics cannot be compared with it.
+            if (constant.type().type() != min.type().type()) {
+                return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+            }
             switch (filter.filter_type) {
                 case expressions::compare_type::eq:
                     // eq is impossible if constant < min or constant > max
@@ -128,6 +145,16 @@ namespace components::table {
         if (dynamic_cast<const set_membership_filter_t*>(&filter)) {
             return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
         }
+        if (auto* bloom = dynamic_cast<const bloom_filter_t*>(&filter)) {
+            return bloom->excludes_range(seg_stats.min_value(), seg_stats.max_value())
+                       ? filter_propagate_result_t::ALWAYS_FALSE
+                       : filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        }
+        if (auto* top_n = dynamic_cast<const top_n_filter_t*>(&filter)) {
+            return top_n->excludes_range(seg_stats.min_value(), seg_stats.max_value(), seg_stats.null_count())
+                       ? filter_propagate_result_t::ALWAYS_FALSE
+                       : filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        }
 
         if (filter.filter_type == expressions::compare_type::eq ||
             filter.filter_type == expressions::compare_type::gt ||
@@ -138,6 +165,11 @@ namespace components::table {
             const auto& constant = constant_filter.constant;
             const auto& min = seg_stats.min_value();
             const auto& max = seg_stats.max_value();
+            // A constant of another type (e.g. a µs constant against a DATE column) is widened per
+            // row by the filter; the raw statistics cannot be compared with it.
+            if (constant.type().type() != min.type().type()) {
+                return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+            }
             switch (filter.filter_type) {
                 case expressions::compare_type::eq:
                     if (constant < min || constant > max) {
@@ -343,7 +375,16 @@ namespace components::table {
 
         vector::unified_vector_format uvf(result.resource(), scan_count);
         result.to_unified_format(scan_count, uvf);
-        column_segment_t::filter_indexing(indexing, result, uvf, filter, scan_count, count);
+        column_segment_t::filter_indexing(indexing, result, uvf, filter, count);
+    }
+
+    bool column_data_t::filter_compressed(int64_t,
+                                          uint64_t,
+                                          vector::indexing_vector_t&,
+                                          const table_filter_t&,
+                                          uint64_t&,
+                                          core::error_t&) {
+        return false;
     }
 
     void column_data_t::filter_scan(uint64_t vector_index,
@@ -530,12 +571,20 @@ namespace components::table {
             if (auto* set = dynamic_cast<const set_membership_filter_t*>(filter)) {
                 return set->contains(result.value(0));
             }
+            if (auto* bloom = dynamic_cast<const bloom_filter_t*>(filter)) {
+                return bloom->contains(result.value(0));
+            }
+            if (auto* top_n = dynamic_cast<const top_n_filter_t*>(filter)) {
+                return top_n->contains(result.value(0));
+            }
             return filter->cast<constant_filter_t>().compare(result.value(0));
         }
         auto segment = data_.get_segment(row_id);
         // For compressed segments, fetch the actual decompressed value
         auto comp = segment->compression();
-        if (comp == compression::compression_type::RLE || comp == compression::compression_type::DICTIONARY) {
+        if (comp == compression::compression_type::RLE || comp == compression::compression_type::DICTIONARY ||
+            comp == compression::compression_type::BITPACKING || comp == compression::compression_type::FSST ||
+            comp == compression::compression_type::ALP) {
             column_fetch_state fetch_state;
             vector::vector_t result(resource_, type_, 1);
             fetch_row(fetch_state, row_id, result, 0);
@@ -546,10 +595,16 @@ namespace components::table {
             if (!result.validity().row_is_valid(0)) {
                 return false;
             }
-            // Dispatch handles both constant_filter_t and set_membership_filter_t.
+            // Dispatch handles constant, set membership, Bloom and top-N filters.
             if (auto* set = dynamic_cast<const set_membership_filter_t*>(filter)) {
                 return set->contains(result.value(0));
             }
+            if (auto* bloom = dynamic_cast<const bloom_filter_t*>(filter)) {
+                return bloom->contains(result.value(0));
+            }
+            if (auto* top_n = dynamic_cast<const top_n_filter_t*>(filter)) {
+                return top_n->contains(result.value(0));
+            }
             const auto& const_filter = filter->cast<constant_filter_t>();
             return const_filter.compare(result.value(0));
         }
@@ -632,6 +687,7 @@ namespace components::table {
             column_info.segment_idx = segment_idx;
             column_info.segment_start = segment->start;
             column_info.segment_count = segment->count;
+            column_info.compression = segment->compression();
             column_info.has_updates = has_updates();
             auto segment_state = segment->segment_state();
             if (segment_state) {
@@ -834,9 +890,9 @@ namespace components::table {
     }
 
     void column_data_t::collect_disk_block_ids(std::pmr::vector<uint64_t>& out) const {
-        // Collect the ids of disk blocks owned by this column's segments so the SOLE caller
-        // (data_table_t::compact's free-list reclaim) can return them to the block manager once the WHOLE
-        // collection these segments belong to is being torn down (replaced by the compacted one). Because
+        // Collect the ids of disk blocks owned by this column's segments so data_table_t::compact's free-list
+        // reclaim can return them to the block manager once the WHOLE collection these segments belong to is
+        // being torn down (replaced by the compacted one). Because
         // the entire owning collection is discarded, EVERY reloadable disk block it references is freeable,
         // INCLUDING packed/shared partial blocks: a block packed with several of this collection's segments
         // at distinct offsets is referenced ONLY by this (about-to-drop) collection, so freeing its id once
@@ -847,6 +903,7 @@ namespace components::table {
         // dedicated-block-only discriminator (block_offset()==0 && segment_size() > 0.8*block) leaked nearly
         // every block on each compaction -> unbounded file growth. We now emit one entry per reloadable
         // segment; the caller DEDUPES before freeing (multiple packed segments report the SAME block id).
+        // The checkpoint's superseded-block release reads the same list as the set it must NOT free.
         for (auto& segment : const_cast<segment_tree_t<column_segment_t>&>(data_).segments()) {
             if (segment.block && segment.block->is_reloadable()) {
                 out.push_back(segment.block->block_id());
@@ -93,6 +93,16 @@ namespace components::table {
                             vector::indexing_vector_t& indexing,
                             uint64_t& count,
                             const table_filter_t& filter);
+        // Evaluates a leaf filter over rows [row_idx, row_idx + count) straight from a compressed
+        // segment (see column_segment_t::filter_compressed). Returns false when the range is not held by
+        // a single compressed segment, so the caller scans and decompresses instead; `error` carries a
+        // pin out_of_memory.
+        virtual bool filter_compressed(int64_t row_idx,
+                                       uint64_t count,
+                                       vector::indexing_vector_t& indexing,
+                                       const table_filter_t& filter,
+                                       uint64_t& approved_tuple_count,
+                                       core::error_t& error);
         virtual void filter_scan(uint64_t vector_index,
                                  column_scan_state& state,
                                  vector::vector_t& result,
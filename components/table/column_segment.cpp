@@ -1,8 +1,13 @@
 #include "column_segment.hpp"
 
+#include <algorithm>
 #include <cstring>
 
 #include "column_state.hpp"
+#include "compression/alp.hpp"
+#include "compression/bitpacking.hpp"
+#include "compression/fsst.hpp"
+#include "compression/string_dictionary.hpp"
 #include "storage/block_manager.hpp"
 #include "storage/buffer_handle.hpp"
 #include "storage/buffer_manager.hpp"
@@ -172,6 +177,25 @@ namespace components::table {
             return std::string_view(reinterpret_cast<char*>(aux.insert(borrowed)), borrowed.size());
         }
 
+        // The string heap of `result` that scanned values are interned into. A freshly-built STRING vector
+        // already carries one (see vector_t::initialize), but guard against a missing/typed-wrong auxiliary so
+        // the interned views are always backed by result-owned memory rather than the transient pinned block.
+        vector::string_vector_buffer_t& result_string_heap(vector::vector_t& result) {
+            auto aux_buffer = result.auxiliary();
+            if (!aux_buffer || aux_buffer->type() != vector::vector_buffer_type::STRING) {
+                aux_buffer = std::make_shared<vector::string_vector_buffer_t>(result.resource());
+                result.set_auxiliary(aux_buffer);
+            }
+            return *static_cast<vector::string_vector_buffer_t*>(aux_buffer.get());
+        }
+
+        std::string_view own_string(vector::string_vector_buffer_t& heap, std::string_view value) {
+            if (value.empty()) {
+                return std::string_view(nullptr, 0);
+            }
+            return std::string_view(reinterpret_cast<char*>(heap.insert(value)), value.size());
+        }
+
         core::result_wrapper_t<bool> write_string_memory(column_segment_t& segment,
                                                          std::string_view string,
                                                          uint64_t& result_block,
@@ -730,6 +754,80 @@ namespace components::table {
             }
         }
 
+        // --- BITPACKING compression scan helpers ---
+        // Format: see compression/bitpacking.hpp. Only the groups the range touches are decoded.
+
+        void bitpacking_scan(column_segment_t& segment,
+                             column_scan_state& state,
+                             uint64_t scan_count,
+                             vector::vector_t& result,
+                             uint64_t result_offset) {
+            auto* base = state.scan_state->ptr() + segment.block_offset();
+            auto row_offset = static_cast<uint64_t>(segment.relative_index(state.row_index));
+            result.set_vector_type(vector::vector_type::FLAT);
+            compression::bitpacking::decode(segment.type.to_physical_type(),
+                                            base,
+                                            row_offset,
+                                            scan_count,
+                                            result.data() + result_offset * segment.type_size);
+        }
+
+        void bitpacking_fetch_row(column_segment_t& segment,
+                                  column_fetch_state& state,
+                                  int64_t row_id,
+                                  vector::vector_t& result,
+                                  uint64_t result_idx) {
+            auto& buffer_manager = segment.block->block_manager.buffer_manager;
+            auto pinned = buffer_manager.pin(segment.block);
+            if (pinned.has_error()) {
+                state.fetch_error = pinned.error();
+                return;
+            }
+            auto* base = pinned.value().ptr() + segment.block_offset();
+            compression::bitpacking::decode(segment.type.to_physical_type(),
+                                            base,
+                                            static_cast<uint64_t>(row_id),
+                                            1,
+                                            result.data() + result_idx * segment.type_size);
+        }
+
+        // --- ALP compression scan helpers ---
+        // Format: see compression/alp.hpp. Only the groups the range touches are decoded.
+
+        void alp_scan(column_segment_t& segment,
+                      column_scan_state& state,
+                      uint64_t scan_count,
+                      vector::vector_t& result,
+                      uint64_t result_offset) {
+            auto* base = state.scan_state->ptr() + segment.block_offset();
+            auto row_offset = static_cast<uint64_t>(segment.relative_index(state.row_index));
+            result.set_vector_type(vector::vector_type::FLAT);
+            compression::alp::decode(segment.type.to_physical_type(),
+                                     base,
+                                     row_offset,
+                                     scan_count,
+                                     result.data() + result_offset * segment.type_size);
+        }
+
+        void alp_fetch_row(column_segment_t& segment,
+                           column_fetch_state& state,
+                           int64_t row_id,
+                           vector::vector_t& result,
+                           uint64_t result_idx) {
+            auto& buffer_manager = segment.block->block_manager.buffer_manager;
+            auto pinned = buffer_manager.pin(segment.block);
+            if (pinned.has_error()) {
+                state.fetch_error = pinned.error();
+                return;
+            }
+            auto* base = pinned.value().ptr() + segment.block_offset();
+            compression::alp::decode(segment.type.to_physical_type(),
+                                     base,
+                                     static_cast<uint64_t>(row_id),
+                                     1,
+                                     result.data() + result_idx * segment.type_size);
+        }
+
         // --- DICTIONARY compression scan helpers ---
         // Format: [uint16_t num_unique][values(num_unique * ts)][indices(count * idx_size)]
         // idx_size = 1 if num_unique <= 256, else 2
@@ -830,6 +928,98 @@ namespace components::table {
             std::memcpy(result.data() + result_idx * ts, dict_values + dict_idx * ts, ts);
         }
 
+        // --- STRING DICTIONARY / FSST scan helpers ---
+        // Formats: see compression/string_dictionary.hpp and compression/fsst.hpp. Values are copied into
+        // the result's string heap, the pinned block is released between batches.
+
+        void string_dictionary_scan(column_segment_t& segment,
+                                    column_scan_state& state,
+                                    uint64_t scan_count,
+                                    vector::vector_t& result,
+                                    uint64_t result_offset) {
+            const auto* base = state.scan_state->ptr() + segment.block_offset();
+            const auto header = compression::string_dictionary::header(base);
+            auto row_offset = static_cast<uint64_t>(segment.relative_index(state.row_index));
+
+            result.set_vector_type(vector::vector_type::FLAT);
+            auto& heap = result_string_heap(result);
+            auto* dest = result.data<std::string_view>() + result_offset;
+            if (header.entry_count > scan_count) {
+                for (uint64_t i = 0; i < scan_count; i++) {
+                    auto entry = compression::string_dictionary::index(base, header, row_offset + i);
+                    dest[i] = own_string(heap, compression::string_dictionary::entry(base, header, entry));
+                }
+                return;
+            }
+            // Few entries: each is copied once and its rows share the copy.
+            std::vector<std::string_view> owned(header.entry_count);
+            std::vector<uint8_t> is_owned(header.entry_count, 0);
+            for (uint64_t i = 0; i < scan_count; i++) {
+                auto entry = compression::string_dictionary::index(base, header, row_offset + i);
+                if (!is_owned[entry]) {
+                    owned[entry] = own_string(heap, compression::string_dictionary::entry(base, header, entry));
+                    is_owned[entry] = 1;
+                }
+                dest[i] = owned[entry];
+            }
+        }
+
+        void string_dictionary_fetch_row(column_segment_t& segment,
+                                         column_fetch_state& state,
+                                         int64_t row_id,
+                                         vector::vector_t& result,
+                                         uint64_t result_idx) {
+            auto* handle_ptr = state.get_or_insert_handle(segment);
+            if (!handle_ptr) {
+                return; // state.fetch_error already set by get_or_insert_handle
+            }
+            const auto* base = handle_ptr->ptr() + segment.block_offset();
+            const auto header = compression::string_dictionary::header(base);
+            auto entry = compression::string_dictionary::index(base, header, static_cast<uint64_t>(row_id));
+            result.data<std::string_view>()[result_idx] =
+                own_string(result_string_heap(result), compression::string_dictionary::entry(base, header, entry));
+        }
+
+        void fsst_scan(column_segment_t& segment,
+                       column_scan_state& state,
+                       uint64_t scan_count,
+                       vector::vector_t& result,
+                       uint64_t result_offset) {
+            const auto* base = state.scan_state->ptr() + segment.block_offset();
+            const auto header = compression::fsst::header(base);
+            auto row_offset = static_cast<uint64_t>(segment.relative_index(state.row_index));
+
+            result.set_vector_type(vector::vector_type::FLAT);
+            auto& heap = result_string_heap(result);
+            auto* dest = result.data<std::string_view>() + result_offset;
+            std::string decoded;
+            for (uint64_t i = 0; i < scan_count; i++) {
+                decoded.clear();
+                const auto codes = compression::fsst::codes(base, header, row_offset + i);
+                compression::fsst::decode(base, header, codes, decoded);
+                dest[i] = own_string(heap, decoded);
+            }
+        }
+
+        void fsst_fetch_row(column_segment_t& segment,
+                            column_fetch_state& state,
+                            int64_t row_id,
+                            vector::vector_t& result,
+                            uint64_t result_idx) {
+            auto* handle_ptr = state.get_or_insert_handle(segment);
+            if (!handle_ptr) {
+                return; // state.fetch_error already set by get_or_insert_handle
+            }
+            const auto* base = handle_ptr->ptr() + segment.block_offset();
+            const auto header = compression::fsst::header(base);
+            std::string decoded;
+            compression::fsst::decode(base,
+                                      header,
+                                      compression::fsst::codes(base, header, static_cast<uint64_t>(row_id)),
+                                      decoded);
+            result.data<std::string_view>()[result_idx] = own_string(result_string_heap(result), decoded);
+        }
+
         void validity_scan_partial(column_segment_t& segment,
                                    column_scan_state& state,
                                    uint64_t scan_count,
@@ -941,17 +1131,7 @@ namespace components::table {
             auto dict = dictionary(segment, *state.scan_state);
             auto base_data = reinterpret_cast<int32_t*>(baseptr + DICTIONARY_HEADER_SIZE);
             auto result_data = result.data<std::string_view>();
-
-            // Ensure the result vector owns a string heap to intern scanned bytes into.
-            // A freshly-built STRING vector already carries one (see vector_t::initialize),
-            // but guard against a missing/typed-wrong auxiliary so the interned views are
-            // always backed by result-owned memory rather than the transient pinned block.
-            auto aux_buffer = result.auxiliary();
-            if (!aux_buffer || aux_buffer->type() != vector::vector_buffer_type::STRING) {
-                aux_buffer = std::make_shared<vector::string_vector_buffer_t>(result.resource());
-                result.set_auxiliary(aux_buffer);
-            }
-            auto* aux = static_cast<vector::string_vector_buffer_t*>(aux_buffer.get());
+            auto* aux = &result_string_heap(result);
 
             int32_t previous_offset = start > 0 ? base_data[start - 1] : 0;
 
@@ -1098,7 +1278,10 @@ namespace components::table {
             row_id = start;
         }
         if (compression_ == compression::compression_type::RLE ||
-            compression_ == compression::compression_type::DICTIONARY) {
+            compression_ == compression::compression_type::DICTIONARY ||
+            compression_ == compression::compression_type::BITPACKING ||
+            compression_ == compression::compression_type::FSST ||
+            compression_ == compression::compression_type::ALP) {
             // For compressed segments, per-row predicate check on raw block data doesn't work.
             // Return true (accept the row) — correctness is maintained by the filter
             // evaluating on the fully scanned/decompressed data.
@@ -1161,7 +1344,27 @@ namespace components::table {
             return;
         }
         if (compression_ == compression::compression_type::DICTIONARY) {
-            impl::dict_fetch_row(*this, state, static_cast<int64_t>(row_id - start), result, result_idx);
+            if (type.to_physical_type() == types::physical_type::STRING) {
+                impl::string_dictionary_fetch_row(*this,
+                                                  state,
+                                                  static_cast<int64_t>(row_id - start),
+                                                  result,
+                                                  result_idx);
+            } else {
+                impl::dict_fetch_row(*this, state, static_cast<int64_t>(row_id - start), result, result_idx);
+            }
+            return;
+        }
+        if (compression_ == compression::compression_type::FSST) {
+            impl::fsst_fetch_row(*this, state, static_cast<int64_t>(row_id - start), result, result_idx);
+            return;
+        }
+        if (compression_ == compression::compression_type::BITPACKING) {
+            impl::bitpacking_fetch_row(*this, state, static_cast<int64_t>(row_id - start), result, result_idx);
+            return;
+        }
+        if (compression_ == compression::compression_type::ALP) {
+            impl::alp_fetch_row(*this, state, static_cast<int64_t>(row_id - start), result, result_idx);
             return;
         }
         switch (type.to_physical_type()) {
@@ -1256,240 +1459,822 @@ namespace components::table {
         }
     }
 
-    template<class T, class COMP, bool HAS_NULL>
-    static uint64_t filter_selection(vector::unified_vector_format& uvf,
-                                     T predicate,
-                                     vector::indexing_vector_t& sel,
-                                     uint64_t approved_tuple_count,
-                                     vector::indexing_vector_t& result_sel) {
-        auto& mask = uvf.validity;
-        auto vec = uvf.get_data<T>();
-        uint64_t result_count = 0;
-        for (uint64_t i = 0; i < approved_tuple_count; i++) {
-            auto idx = sel.get_index(i);
-            auto vector_idx = uvf.referenced_indexing->get_index(idx);
-            COMP comparator{};
-            bool comparison_result =
-                (!HAS_NULL || mask.row_is_valid(vector_idx)) && comparator(vec[vector_idx], predicate);
-            result_sel.set_index(result_count, idx);
-            result_count += comparison_result;
+    namespace impl {
+
+        // Comparators of the vectorized filter kernels. They mirror constant_filter_t::compare<T>
+        // (epsilon equality for floating point), so the vector and row paths accept the same rows.
+        struct filter_equal_t {
+            template<class T>
+            bool operator()(const T& left, const T& right) const {
+                return core::is_equals(left, right);
+            }
+        };
+        struct filter_not_equal_t {
+            template<class T>
+            bool operator()(const T& left, const T& right) const {
+                return !core::is_equals(left, right);
+            }
+        };
+        struct filter_less_t {
+            template<class T>
+            bool operator()(const T& left, const T& right) const {
+                return !core::is_equals(left, right) && left < right;
+            }
+        };
+        struct filter_greater_t {
+            template<class T>
+            bool operator()(const T& left, const T& right) const {
+                return !core::is_equals(left, right) && !(left < right);
+            }
+        };
+        struct filter_less_equal_t {
+            template<class T>
+            bool operator()(const T& left, const T& right) const {
+                return core::is_equals(left, right) || left < right;
+            }
+        };
+        struct filter_greater_equal_t {
+            template<class T>
+            bool operator()(const T& left, const T& right) const {
+                return core::is_equals(left, right) || !(left < right);
+            }
+        };
+
+        inline bool validity_bit(const uint64_t* validity, uint64_t idx) {
+            return (validity[idx / vector::validity_mask_t::BITS_PER_VALUE] >>
+                    (idx % vector::validity_mask_t::BITS_PER_VALUE)) &
+                   1;
+        }
+
+        // Selection kernel shared by every leaf filter: writes the positions (taken from `sel`) that
+        // pass `matches` into `result_sel` and returns their count. `matches` receives the physical
+        // position inside `uvf`. Writes are unconditional and the count is bumped by the predicate
+        // result, so the loop body has no data-dependent branch; when neither the candidates nor the
+        // vector carry a selection the loop walks plain arrays and is left to the auto-vectorizer.
+        template<bool HAS_NULL, class MATCH>
+        uint64_t select_rows(vector::unified_vector_format& uvf,
+                             const vector::indexing_vector_t& sel,
+                             uint64_t approved_tuple_count,
+                             vector::indexing_vector_t& result_sel,
+                             MATCH&& matches) {
+            const uint64_t* validity = uvf.validity.data();
+            const uint64_t* candidates = sel.data();
+            const uint64_t* physical = uvf.referenced_indexing->data();
+            uint64_t* result = result_sel.data();
+            uint64_t result_count = 0;
+            if (!candidates && !physical) {
+                for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                    bool passed = (!HAS_NULL || validity_bit(validity, i)) && matches(i);
+                    result[result_count] = i;
+                    result_count += passed;
+                }
+                return result_count;
+            }
+            for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                auto idx = candidates ? candidates[i] : i;
+                auto vector_idx = physical ? physical[idx] : idx;
+                bool passed = (!HAS_NULL || validity_bit(validity, vector_idx)) && matches(vector_idx);
+                result[result_count] = idx;
+                result_count += passed;
+            }
+            return result_count;
         }
-        return result_count;
-    }
-    template<class T>
-    static void filter_selection_switch(vector::unified_vector_format& uvf,
-                                        T predicate,
-                                        vector::indexing_vector_t& indexing,
-                                        uint64_t& approved_tuple_count,
-                                        expressions::compare_type comparison_type) {
-        vector::indexing_vector_t new_indexing(indexing.resource(), approved_tuple_count);
-        auto& mask = uvf.validity;
-        // the inplace loops take the result as the last parameter
-        switch (comparison_type) {
-            case expressions::compare_type::eq: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::equal_to<T>, false>(uvf,
+
+        template<class T, class COMP>
+        uint64_t compare_selection(vector::unified_vector_format& uvf,
+                                   T predicate,
+                                   const vector::indexing_vector_t& sel,
+                                   uint64_t approved_tuple_count,
+                                   vector::indexing_vector_t& result_sel) {
+            const T* data = uvf.get_data<T>();
+            COMP comparator{};
+            auto matches = [&](uint64_t idx) { return comparator(data[idx], predicate); };
+            if (uvf.validity.all_valid()) {
+                return select_rows<false>(uvf, sel, approved_tuple_count, result_sel, matches);
+            }
+            return select_rows<true>(uvf, sel, approved_tuple_count, result_sel, matches);
+        }
+
+        template<class T>
+        bool constant_selection(const constant_filter_t& filter,
+                                vector::unified_vector_format& uvf,
+                                vector::indexing_vector_t& indexing,
+                                uint64_t& approved_tuple_count) {
+            if constexpr (std::is_same_v<T, std::string_view>) {
+                // regex / LIKE: the pattern was compiled with the filter, match the views in place
+                if (filter.filter_type == expressions::compare_type::regex) {
+                    const auto* pattern = filter.pattern();
+                    if (!pattern) {
+                        return false;
+                    }
+                    const auto* data = uvf.get_data<std::string_view>();
+                    vector::indexing_vector_t new_indexing(indexing.resource(), approved_tuple_count);
+                    auto matches = [&](uint64_t idx) { return pattern->matches(data[idx]); };
+                    if (uvf.validity.all_valid()) {
+                        approved_tuple_count =
+                            select_rows<false>(uvf, indexing, approved_tuple_count, new_indexing, matches);
+                    } else {
+                        approved_tuple_count =
+                            select_rows<true>(uvf, indexing, approved_tuple_count, new_indexing, matches);
+                    }
+                    indexing = new_indexing;
+                    return true;
+                }
+            }
+            T predicate{};
+            if (!filter.typed_constant(predicate)) {
+                return false;
+            }
+            vector::indexing_vector_t new_indexing(indexing.resource(), approved_tuple_count);
+            switch (filter.filter_type) {
+                case expressions::compare_type::eq:
+                    approved_tuple_count = compare_selection<T, filter_equal_t>(uvf,
+                                                                                predicate,
+                                                                                indexing,
+                                                                                approved_tuple_count,
+                                                                                new_indexing);
+                    break;
+                case expressions::compare_type::ne:
+                    approved_tuple_count = compare_selection<T, filter_not_equal_t>(uvf,
+                                                                                    predicate,
+                                                                                    indexing,
+                                                                                    approved_tuple_count,
+                                                                                    new_indexing);
+                    break;
+                case expressions::compare_type::lt:
+                    approved_tuple_count = compare_selection<T, filter_less_t>(uvf,
+                                                                               predicate,
+                                                                               indexing,
+                                                                               approved_tuple_count,
+                                                                               new_indexing);
+                    break;
+                case expressions::compare_type::gt:
+                    approved_tuple_count = compare_selection<T, filter_greater_t>(uvf,
+                                                                                  predicate,
+                                                                                  indexing,
+                                                                                  approved_tuple_count,
+                                                                                  new_indexing);
+                    break;
+                case expressions::compare_type::lte:
+                    approved_tuple_count = compare_selection<T, filter_less_equal_t>(uvf,
+                                                                                     predicate,
+                                                                                     indexing,
+                                                                                     approved_tuple_count,
+                                                                                     new_indexing);
+                    break;
+                case expressions::compare_type::gte:
+                    approved_tuple_count = compare_selection<T, filter_greater_equal_t>(uvf,
                                                                                         predicate,
                                                                                         indexing,
                                                                                         approved_tuple_count,
                                                                                         new_indexing);
+                    break;
+                case expressions::compare_type::all_true:
+                    return true;
+                default:
+                    // regex and friends have no typed kernel
+                    return false;
+            }
+            indexing = new_indexing;
+            return true;
+        }
+
+        template<class T>
+        bool set_membership_selection(const set_membership_filter_t& filter,
+                                      types::physical_type column_type,
+                                      vector::unified_vector_format& uvf,
+                                      vector::indexing_vector_t& indexing,
+                                      uint64_t& approved_tuple_count) {
+            // Decode the IN-list once. A value of another physical type would need a cast the
+            // row path performs through logical_value_t, so such lists stay on the row path.
+            // std::vector<bool> hands out proxies; keep booleans as bytes.
+            using stored_t = std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>;
+            std::vector<stored_t> values;
+            values.reserve(filter.values.size());
+            for (const auto& value : filter.values) {
+                if (value.is_null()) {
+                    continue;
+                }
+                if (value.type().to_physical_type() != column_type) {
+                    return false;
+                }
+                values.push_back(value.value<T>());
+            }
+            const T* data = uvf.get_data<T>();
+            vector::indexing_vector_t new_indexing(indexing.resource(), approved_tuple_count);
+            auto run = [&](auto&& matches) {
+                if (uvf.validity.all_valid()) {
+                    approved_tuple_count =
+                        select_rows<false>(uvf, indexing, approved_tuple_count, new_indexing, matches);
                 } else {
-                    approved_tuple_count = filter_selection<T, std::equal_to<T>, true>(uvf,
-                                                                                       predicate,
-                                                                                       indexing,
-                                                                                       approved_tuple_count,
-                                                                                       new_indexing);
+                    approved_tuple_count =
+                        select_rows<true>(uvf, indexing, approved_tuple_count, new_indexing, matches);
+                }
+            };
+            constexpr uint64_t LINEAR_PROBE_LIMIT = 8;
+            if constexpr (!std::is_floating_point_v<T>) {
+                if (values.size() > LINEAR_PROBE_LIMIT) {
+                    std::sort(values.begin(), values.end());
+                    run([&](uint64_t idx) {
+                        return std::binary_search(values.begin(), values.end(), static_cast<stored_t>(data[idx]));
+                    });
+                    indexing = new_indexing;
+                    return true;
                 }
-                break;
             }
-            case expressions::compare_type::ne: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::not_equal_to<T>, false>(uvf,
-                                                                                            predicate,
-                                                                                            indexing,
-                                                                                            approved_tuple_count,
-                                                                                            new_indexing);
+            run([&](uint64_t idx) {
+                for (const auto& value : values) {
+                    if (core::is_equals(data[idx], static_cast<T>(value))) {
+                        return true;
+                    }
+                }
+                return false;
+            });
+            indexing = new_indexing;
+            return true;
+        }
+
+        // Runtime join filter: a range check and one Bloom word per candidate. Only integer columns
+        // have a kernel; the filter is never pushed onto anything else.
+        template<class T>
+        bool bloom_selection(const bloom_filter_t& filter,
+                             vector::unified_vector_format& uvf,
+                             vector::indexing_vector_t& indexing,
+                             uint64_t& approved_tuple_count) {
+            if constexpr (!std::is_integral_v<T> || std::is_same_v<T, bool>) {
+                return false;
+            } else {
+                const T* data = uvf.get_data<T>();
+                vector::indexing_vector_t new_indexing(indexing.resource(), approved_tuple_count);
+                auto matches = [&](uint64_t idx) { return filter.test(data[idx]); };
+                if (uvf.validity.all_valid()) {
+                    approved_tuple_count =
+                        select_rows<false>(uvf, indexing, approved_tuple_count, new_indexing, matches);
                 } else {
-                    approved_tuple_count = filter_selection<T, std::not_equal_to<T>, true>(uvf,
-                                                                                           predicate,
-                                                                                           indexing,
-                                                                                           approved_tuple_count,
-                                                                                           new_indexing);
+                    approved_tuple_count =
+                        select_rows<true>(uvf, indexing, approved_tuple_count, new_indexing, matches);
                 }
-                break;
+                indexing = new_indexing;
+                return true;
             }
-            case expressions::compare_type::lt: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::less<T>, false>(uvf,
-                                                                                    predicate,
-                                                                                    indexing,
-                                                                                    approved_tuple_count,
-                                                                                    new_indexing);
+        }
+
+        // Top-N filter: one compare against the sort's current bound per candidate. NULLs stay when the
+        // sort puts them first (keeps_nulls).
+        template<class T>
+        bool top_n_selection(const top_n_filter_t& filter,
+                             vector::unified_vector_format& uvf,
+                             vector::indexing_vector_t& indexing,
+                             uint64_t& approved_tuple_count) {
+            if constexpr (!std::is_integral_v<T> || std::is_same_v<T, bool>) {
+                return false;
+            } else {
+                const T* data = uvf.get_data<T>();
+                vector::indexing_vector_t new_indexing(indexing.resource(), approved_tuple_count);
+                if (uvf.validity.all_valid()) {
+                    auto matches = [&](uint64_t idx) { return filter.test(data[idx]); };
+                    approved_tuple_count =
+                        select_rows<false>(uvf, indexing, approved_tuple_count, new_indexing, matches);
+                } else if (filter.keeps_nulls()) {
+                    const uint64_t* validity = uvf.validity.data();
+                    auto matches = [&](uint64_t idx) {
+                        return !validity_bit(validity, idx) || filter.test(data[idx]);
+                    };
+                    approved_tuple_count =
+                        select_rows<false>(uvf, indexing, approved_tuple_count, new_indexing, matches);
                 } else {
-                    approved_tuple_count = filter_selection<T, std::less<T>, true>(uvf,
-                                                                                   predicate,
-                                                                                   indexing,
-                                                                                   approved_tuple_count,
-                                                                                   new_indexing);
+                    auto matches = [&](uint64_t idx) { return filter.test(data[idx]); };
+                    approved_tuple_count =
+                        select_rows<true>(uvf, indexing, approved_tuple_count, new_indexing, matches);
                 }
-                break;
+                indexing = new_indexing;
+                return true;
             }
-            case expressions::compare_type::gt: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::greater<T>, false>(uvf,
-                                                                                       predicate,
-                                                                                       indexing,
-                                                                                       approved_tuple_count,
-                                                                                       new_indexing);
-                } else {
-                    approved_tuple_count = filter_selection<T, std::greater<T>, true>(uvf,
-                                                                                      predicate,
-                                                                                      indexing,
-                                                                                      approved_tuple_count,
-                                                                                      new_indexing);
+        }
+
+        template<bool IS_NULL>
+        void null_selection(vector::unified_vector_format& uvf,
+                            vector::indexing_vector_t& indexing,
+                            uint64_t& approved_tuple_count) {
+            if (uvf.validity.all_valid()) {
+                if (IS_NULL) {
+                    approved_tuple_count = 0;
                 }
-                break;
+                return;
             }
-            case expressions::compare_type::lte: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::less_equal<T>, false>(uvf,
-                                                                                          predicate,
-                                                                                          indexing,
-                                                                                          approved_tuple_count,
-                                                                                          new_indexing);
-                } else {
-                    approved_tuple_count = filter_selection<T, std::less_equal<T>, true>(uvf,
-                                                                                         predicate,
-                                                                                         indexing,
-                                                                                         approved_tuple_count,
-                                                                                         new_indexing);
+            const uint64_t* validity = uvf.validity.data();
+            vector::indexing_vector_t new_indexing(indexing.resource(), approved_tuple_count);
+            auto matches = [&](uint64_t idx) { return validity_bit(validity, idx) != IS_NULL; };
+            approved_tuple_count = select_rows<false>(uvf, indexing, approved_tuple_count, new_indexing, matches);
+            indexing = new_indexing;
+        }
+
+        // Calls `op` with a value-initialized tag of the C++ type backing `type`; false for types
+        // without a filter kernel (nested and BIT).
+        template<class OP>
+        bool dispatch_filter_type(types::physical_type type, OP&& op) {
+            switch (type) {
+                case types::physical_type::BOOL:
+                    return op(bool{});
+                case types::physical_type::UINT8:
+                    return op(uint8_t{});
+                case types::physical_type::UINT16:
+                    return op(uint16_t{});
+                case types::physical_type::UINT32:
+                    return op(uint32_t{});
+                case types::physical_type::UINT64:
+                    return op(uint64_t{});
+                case types::physical_type::UINT128:
+                    return op(types::uint128_t{});
+                case types::physical_type::INT8:
+                    return op(int8_t{});
+                case types::physical_type::INT16:
+                    return op(int16_t{});
+                case types::physical_type::INT32:
+                    return op(int32_t{});
+                case types::physical_type::INT64:
+                    return op(int64_t{});
+                case types::physical_type::INT128:
+                    return op(types::int128_t{});
+                case types::physical_type::FLOAT:
+                    return op(float{});
+                case types::physical_type::DOUBLE:
+                    return op(double{});
+                case types::physical_type::STRING:
+                    return op(std::string_view{});
+                default:
+                    return false;
+            }
+        }
+
+        // Keeps the candidates whose compressed entry passed and that are not NULL. `matches` receives
+        // the row relative to the evaluated range; same branch-free shape as select_rows.
+        template<class MATCH>
+        void select_compressed_rows(const vector::validity_mask_t& validity,
+                                    vector::indexing_vector_t& indexing,
+                                    uint64_t& approved_tuple_count,
+                                    MATCH&& matches) {
+            const uint64_t* validity_data = validity.data();
+            vector::indexing_vector_t new_indexing(indexing.resource(), approved_tuple_count);
+            uint64_t* result = new_indexing.data();
+            uint64_t result_count = 0;
+            for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                auto idx = indexing.get_index(i);
+                bool passed = (!validity_data || validity_bit(validity_data, idx)) && matches(idx);
+                result[result_count] = idx;
+                result_count += passed;
+            }
+            indexing = new_indexing;
+            approved_tuple_count = result_count;
+        }
+
+        enum class group_verdict : uint8_t
+        {
+            SOME,
+            ALL,
+            NONE
+        };
+
+        // What a group's min and max tell about a comparison with a constant or a top-N bound; the
+        // same reasoning as the segment zone maps, one level finer.
+        group_verdict group_bounds_verdict(const table_filter_t& filter,
+                                           const types::logical_value_t& min,
+                                           const types::logical_value_t& max) {
+            if (auto* top_n = dynamic_cast<const top_n_filter_t*>(&filter)) {
+                return top_n->excludes_range(min, max, 0) ? group_verdict::NONE : group_verdict::SOME;
+            }
+            auto* constant_filter = dynamic_cast<const constant_filter_t*>(&filter);
+            if (!constant_filter || constant_filter->constant.type().type() != min.type().type()) {
+                return group_verdict::SOME;
+            }
+            const auto& constant = constant_filter->constant;
+            switch (filter.filter_type) {
+                case expressions::compare_type::eq:
+                    if (constant < min || constant > max) {
+                        return group_verdict::NONE;
+                    }
+                    return min == max ? group_verdict::ALL : group_verdict::SOME;
+                case expressions::compare_type::gt:
+                    return max <= constant ? group_verdict::NONE
+                           : min > constant ? group_verdict::ALL
+                                            : group_verdict::SOME;
+                case expressions::compare_type::gte:
+                    return max < constant ? group_verdict::NONE
+                           : min >= constant ? group_verdict::ALL
+                                             : group_verdict::SOME;
+                case expressions::compare_type::lt:
+                    return min >= constant ? group_verdict::NONE
+                           : max < constant ? group_verdict::ALL
+                                            : group_verdict::SOME;
+                case expressions::compare_type::lte:
+                    return min > constant ? group_verdict::NONE
+                           : max <= constant ? group_verdict::ALL
+                                             : group_verdict::SOME;
+                default:
+                    return group_verdict::SOME;
+            }
+        }
+
+        // Evaluates a filter on rows [offset, offset + count) of a segment stored in groups of `group_size`
+        // rows (BITPACKING, ALP) group by group: groups the bounds decide are taken or skipped without
+        // decoding, the rest are decoded and run through the regular kernel. `bounds(group, min, max)`
+        // writes a group's bounds and returns false when they decide nothing; `decode(row, count, dest)`
+        // decodes rows.
+        template<typename BOUNDS, typename DECODE>
+        bool group_filter(column_segment_t& segment,
+                          uint64_t group_size,
+                          uint64_t offset,
+                          uint64_t count,
+                          const vector::validity_mask_t& validity,
+                          vector::indexing_vector_t& indexing,
+                          const table_filter_t& filter,
+                          uint64_t& approved_tuple_count,
+                          BOUNDS&& bounds_of,
+                          DECODE&& decode) {
+            auto* resource = indexing.resource();
+            const auto ts = segment.type_size;
+
+            std::pmr::vector<uint8_t> row_matches(count, 0, resource);
+            vector::vector_t bounds(resource, segment.type, 2);
+            vector::vector_t values(resource, segment.type, group_size);
+            uint64_t row = offset;
+            while (row < offset + count) {
+                const uint64_t group = row / group_size;
+                const uint64_t group_end = std::min((group + 1) * group_size, offset + count);
+                const uint64_t rows = group_end - row;
+                const auto verdict = bounds_of(group, bounds.data(), bounds.data() + ts)
+                                         ? group_bounds_verdict(filter, bounds.value(0), bounds.value(1))
+                                         : group_verdict::SOME;
+                auto matches = row_matches.begin() + static_cast<int64_t>(row - offset);
+                if (verdict == group_verdict::ALL) {
+                    std::fill(matches, matches + static_cast<int64_t>(rows), uint8_t{1});
+                } else if (verdict == group_verdict::SOME) {
+                    decode(row, rows, values.data());
+                    vector::unified_vector_format values_uvf(resource, rows);
+                    values.to_unified_format(rows, values_uvf);
+                    vector::indexing_vector_t values_indexing(resource);
+                    uint64_t matched = rows;
+                    if (!column_segment_t::filter_indexing(values_indexing, values, values_uvf, filter, matched)) {
+                        return false;
+                    }
+                    for (uint64_t i = 0; i < matched; i++) {
+                        matches[static_cast<int64_t>(values_indexing.get_index(i))] = 1;
+                    }
                 }
-                break;
+                row = group_end;
             }
-            case expressions::compare_type::gte: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::greater_equal<T>, false>(uvf,
-                                                                                             predicate,
-                                                                                             indexing,
-                                                                                             approved_tuple_count,
-                                                                                             new_indexing);
-                } else {
-                    approved_tuple_count = filter_selection<T, std::greater_equal<T>, true>(uvf,
-                                                                                            predicate,
-                                                                                            indexing,
-                                                                                            approved_tuple_count,
-                                                                                            new_indexing);
+            select_compressed_rows(validity, indexing, approved_tuple_count, [&](uint64_t idx) {
+                return row_matches[idx] != 0;
+            });
+            return true;
+        }
+
+        // Runs the filter once per dictionary entry, viewed in place in the pinned block; the rows then
+        // only look up their entry's verdict.
+        bool string_dictionary_filter(column_segment_t& segment,
+                                      const std::byte* base,
+                                      uint64_t offset,
+                                      uint64_t count,
+                                      const vector::validity_mask_t& validity,
+                                      vector::indexing_vector_t& indexing,
+                                      const table_filter_t& filter,
+                                      uint64_t& approved_tuple_count) {
+            namespace dictionary = compression::string_dictionary;
+            auto* resource = indexing.resource();
+            const auto header = dictionary::header(base);
+            // A dictionary larger than the range costs more to evaluate than the decompressed rows.
+            if (header.entry_count > count) {
+                return false;
+            }
+            vector::vector_t entries(resource, segment.type, std::max<uint64_t>(header.entry_count, 1));
+            auto* entry_data = entries.data<std::string_view>();
+            for (uint32_t entry = 0; entry < header.entry_count; entry++) {
+                entry_data[entry] = dictionary::entry(base, header, entry);
+            }
+            vector::unified_vector_format entries_uvf(resource, header.entry_count);
+            entries.to_unified_format(header.entry_count, entries_uvf);
+            vector::indexing_vector_t entry_indexing(resource);
+            uint64_t matched_entries = header.entry_count;
+            if (!column_segment_t::filter_indexing(entry_indexing, entries, entries_uvf, filter, matched_entries)) {
+                return false;
+            }
+            std::pmr::vector<uint8_t> entry_matches(header.entry_count, 0, resource);
+            for (uint64_t i = 0; i < matched_entries; i++) {
+                entry_matches[entry_indexing.get_index(i)] = 1;
+            }
+            select_compressed_rows(validity, indexing, approved_tuple_count, [&](uint64_t idx) {
+                return entry_matches[dictionary::index(base, header, offset + idx)] != 0;
+            });
+            return true;
+        }
+
+        // Equality and LIKE / prefix filters on an FSST segment. Equal values have equal codes, so (in)equality
+        // compares the codes of the encoded constant; a pattern first checks its required prefix, decoding only
+        // the codes the prefix spans, and decodes the whole value only when the prefix alone does not decide.
+        // Other filters return false and run on the scanned values.
+        bool fsst_filter(const std::byte* base,
+                         uint64_t offset,
+                         const vector::validity_mask_t& validity,
+                         vector::indexing_vector_t& indexing,
+                         const table_filter_t& filter,
+                         uint64_t& approved_tuple_count) {
+            namespace fsst = compression::fsst;
+            const auto* constant = dynamic_cast<const constant_filter_t*>(&filter);
+            if (!constant || constant->constant.type().to_physical_type() != types::physical_type::STRING) {
+                return false;
+            }
+            const auto header = fsst::header(base);
+            auto select_equal = [&](std::string_view value, bool keep_equal) {
+                std::string encoded;
+                fsst::symbol_table_t::load(base).encode(value, encoded);
+                select_compressed_rows(validity, indexing, approved_tuple_count, [&](uint64_t idx) {
+                    return (fsst::codes(base, header, offset + idx) == encoded) == keep_equal;
+                });
+                return true;
+            };
+            switch (filter.filter_type) {
+                case expressions::compare_type::eq:
+                    return select_equal(constant->constant.value<std::string_view>(), true);
+                case expressions::compare_type::ne:
+                    return select_equal(constant->constant.value<std::string_view>(), false);
+                case expressions::compare_type::regex: {
+                    const auto* pattern = constant->pattern();
+                    if (!pattern) {
+                        return false;
+                    }
+                    const auto prefix = pattern->required_prefix();
+                    if (pattern->kind() == types::string_pattern_t::kind_t::exact) {
+                        return select_equal(prefix, true);
+                    }
+                    if (prefix.empty()) {
+                        return false;
+                    }
+                    const bool prefix_decides = pattern->kind() == types::string_pattern_t::kind_t::prefix;
+                    std::string decoded;
+                    select_compressed_rows(validity, indexing, approved_tuple_count, [&](uint64_t idx) {
+                        const auto codes = fsst::codes(base, header, offset + idx);
+                        if (!fsst::starts_with(base, header, codes, prefix)) {
+                            return false;
+                        }
+                        if (prefix_decides) {
+                            return true;
+                        }
+                        decoded.clear();
+                        fsst::decode(base, header, codes, decoded);
+                        return pattern->matches(decoded);
+                    });
+                    return true;
                 }
-                break;
+                default:
+                    return false;
             }
-            default:
-                throw std::logic_error("Unknown comparison type for filter");
         }
-        indexing = new_indexing;
-    }
-    uint64_t column_segment_t::filter_indexing(vector::indexing_vector_t& indexing,
-                                               vector::vector_t& vector,
-                                               vector::unified_vector_format& uvf,
-                                               const table_filter_t& filter,
-                                               uint64_t,
-                                               uint64_t& approved_tuple_count) {
+
+    } // namespace impl
+
+    bool column_segment_t::filter_indexing(vector::indexing_vector_t& indexing,
+                                           vector::vector_t& vector,
+                                           vector::unified_vector_format& uvf,
+                                           const table_filter_t& filter,
+                                           uint64_t& approved_tuple_count) {
         assert(filter.filter_type != expressions::compare_type::invalid);
         assert(!is_union_compare_condition(filter.filter_type));
-        // set_membership_filter_t doesn't fit the single-predicate vectorized path —
-        // it has multiple values, requiring per-row contains() rather than a SIMD compare.
-        // Until M4 wires a vectorized IN-list path here, fall through to the row-based
-        // check_row dispatch (which IS set_membership_filter_t-aware via table_filter_dispatch).
-        if (dynamic_cast<const set_membership_filter_t*>(&filter)) {
-            return approved_tuple_count;
-        }
-        auto& constant_filter = filter.cast<constant_filter_t>();
-        switch (vector.type().to_physical_type()) {
-            case types::physical_type::UINT8: {
-                auto predicate = constant_filter.constant.value<uint8_t>();
-                filter_selection_switch<uint8_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
-                break;
-            }
-            case types::physical_type::UINT16: {
-                auto predicate = constant_filter.constant.value<uint16_t>();
-                filter_selection_switch<uint16_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
-                break;
-            }
-            case types::physical_type::UINT32: {
-                auto predicate = constant_filter.constant.value<uint32_t>();
-                filter_selection_switch<uint32_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
-                break;
-            }
-            case types::physical_type::UINT64: {
-                auto predicate = constant_filter.constant.value<uint64_t>();
-                filter_selection_switch<uint64_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
-                break;
-            }
-            case types::physical_type::UINT128: {
-                auto predicate = constant_filter.constant.value<types::uint128_t>();
-                filter_selection_switch<types::uint128_t>(uvf,
-                                                          predicate,
-                                                          indexing,
-                                                          approved_tuple_count,
-                                                          filter.filter_type);
-                break;
-            }
-            case types::physical_type::INT8: {
-                auto predicate = constant_filter.constant.value<int8_t>();
-                filter_selection_switch<int8_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
-                break;
-            }
-            case types::physical_type::INT16: {
-                auto predicate = constant_filter.constant.value<int16_t>();
-                filter_selection_switch<int16_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
-                break;
-            }
-            case types::physical_type::INT32: {
-                auto predicate = constant_filter.constant.value<int32_t>();
-                filter_selection_switch<int32_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
-                break;
-            }
-            case types::physical_type::INT64: {
-                auto predicate = constant_filter.constant.value<int64_t>();
-                filter_selection_switch<int64_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
-                break;
-            }
-            case types::physical_type::INT128: {
-                auto predicate = constant_filter.constant.value<types::int128_t>();
-                filter_selection_switch<types::int128_t>(uvf,
-                                                         predicate,
-                                                         indexing,
-                                                         approved_tuple_count,
-                                                         filter.filter_type);
+        switch (filter.filter_type) {
+            case expressions::compare_type::is_null:
+                impl::null_selection<true>(uvf, indexing, approved_tuple_count);
+                return true;
+            case expressions::compare_type::is_not_null:
+                impl::null_selection<false>(uvf, indexing, approved_tuple_count);
+                return true;
+            default:
                 break;
-            }
-            case types::physical_type::FLOAT: {
-                auto predicate = constant_filter.constant.value<float>();
-                filter_selection_switch<float>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+        }
+        auto column_type = vector.type().to_physical_type();
+        if (auto* set = dynamic_cast<const set_membership_filter_t*>(&filter)) {
+            return impl::dispatch_filter_type(column_type, [&](auto tag) {
+                using T = decltype(tag);
+                return impl::set_membership_selection<T>(*set, column_type, uvf, indexing, approved_tuple_count);
+            });
+        }
+        if (auto* bloom = dynamic_cast<const bloom_filter_t*>(&filter)) {
+            return impl::dispatch_filter_type(column_type, [&](auto tag) {
+                using T = decltype(tag);
+                return impl::bloom_selection<T>(*bloom, uvf, indexing, approved_tuple_count);
+            });
+        }
+        if (auto* top_n = dynamic_cast<const top_n_filter_t*>(&filter)) {
+            return impl::dispatch_filter_type(column_type, [&](auto tag) {
+                using T = decltype(tag);
+                return impl::top_n_selection<T>(*top_n, uvf, indexing, approved_tuple_count);
+            });
+        }
+        const auto& constant_filter = filter.cast<constant_filter_t>();
+        return impl::dispatch_filter_type(column_type, [&](auto tag) {
+            using T = decltype(tag);
+            return impl::constant_selection<T>(constant_filter, uvf, indexing, approved_tuple_count);
+        });
+    }
+
+    core::result_wrapper_t<bool> column_segment_t::filter_compressed(uint64_t offset,
+                                                                     uint64_t count,
+                                                                     const vector::validity_mask_t& validity,
+                                                                     vector::indexing_vector_t& indexing,
+                                                                     const table_filter_t& filter,
+                                                                     uint64_t& approved_tuple_count) {
+        if (compression_ == compression::compression_type::UNCOMPRESSED) {
+            return false;
+        }
+        // IS [NOT] NULL only looks at the validity child; the value kernels below never see NULLs.
+        if (filter.filter_type == expressions::compare_type::is_null ||
+            filter.filter_type == expressions::compare_type::is_not_null) {
+            return false;
+        }
+        // Neither may a top-N filter that keeps NULLs: the compressed path drops them.
+        if (auto* top_n = dynamic_cast<const top_n_filter_t*>(&filter); top_n && top_n->keeps_nulls()) {
+            return false;
+        }
+        assert(offset + count <= this->count);
+        auto pinned = block->block_manager.buffer_manager.pin(block);
+        if (pinned.has_error()) {
+            return pinned.convert_error<bool>(); // out_of_memory
+        }
+        auto* base = pinned.value().ptr() + offset_;
+        if (compression_ == compression::compression_type::BITPACKING) {
+            const auto physical = type.to_physical_type();
+            return impl::group_filter(
+                *this,
+                compression::bitpacking::GROUP_SIZE,
+                offset,
+                count,
+                validity,
+                indexing,
+                filter,
+                approved_tuple_count,
+                [&](uint64_t group, std::byte* min, std::byte* max) {
+                    compression::bitpacking::group_bounds(physical, base, group, min, max);
+                    return true;
+                },
+                [&](uint64_t row, uint64_t rows, std::byte* dest) {
+                    compression::bitpacking::decode(physical, base, row, rows, dest);
+                });
+        }
+        if (compression_ == compression::compression_type::ALP) {
+            const auto physical = type.to_physical_type();
+            return impl::group_filter(
+                *this,
+                compression::alp::GROUP_SIZE,
+                offset,
+                count,
+                validity,
+                indexing,
+                filter,
+                approved_tuple_count,
+                [&](uint64_t group, std::byte* min, std::byte* max) {
+                    return compression::alp::group_bounds(physical, base, group, min, max);
+                },
+                [&](uint64_t row, uint64_t rows, std::byte* dest) {
+                    compression::alp::decode(physical, base, row, rows, dest);
+                });
+        }
+        if (type.to_physical_type() == types::physical_type::STRING) {
+            if (compression_ == compression::compression_type::DICTIONARY) {
+                return impl::string_dictionary_filter(*this,
+                                                      base,
+                                                      offset,
+                                                      count,
+                                                      validity,
+                                                      indexing,
+                                                      filter,
+                                                      approved_tuple_count);
+            }
+            if (compression_ == compression::compression_type::FSST) {
+                return impl::fsst_filter(base, offset, validity, indexing, filter, approved_tuple_count);
+            }
+            return false;
+        }
+        auto* resource = indexing.resource();
+        const auto ts = type_size;
+
+        // The distinct values touched by the range: the constant, the overlapping runs or the whole
+        // dictionary. The filter runs once over them and the rows then only look up their entry.
+        uint64_t entry_count = 0;
+        const std::byte* entry_values = nullptr;
+        uint64_t first_run = 0;
+        uint64_t first_run_start = 0;
+        uint32_t num_runs = 0;
+        uint16_t num_unique = 0;
+        const std::byte* dict_indices = nullptr;
+        switch (compression_) {
+            case compression::compression_type::CONSTANT:
+                entry_count = 1;
+                entry_values = base;
                 break;
-            }
-            case types::physical_type::DOUBLE: {
-                auto predicate = constant_filter.constant.value<double>();
-                filter_selection_switch<double>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case compression::compression_type::RLE: {
+                std::memcpy(&num_runs, base, sizeof(uint32_t));
+                auto* runs = base + sizeof(uint32_t);
+                const auto entry_size = ts + sizeof(uint32_t);
+                uint64_t run_start = 0;
+                uint64_t run = 0;
+                for (; run < num_runs; run++) {
+                    uint32_t run_len;
+                    std::memcpy(&run_len, runs + run * entry_size + ts, sizeof(uint32_t));
+                    if (run_start + run_len > offset) {
+                        break;
+                    }
+                    run_start += run_len;
+                }
+                first_run = run;
+                first_run_start = run_start;
+                for (; run < num_runs && run_start < offset + count; run++) {
+                    uint32_t run_len;
+                    std::memcpy(&run_len, runs + run * entry_size + ts, sizeof(uint32_t));
+                    run_start += run_len;
+                    entry_count++;
+                }
                 break;
             }
-            case types::physical_type::STRING: {
-                auto predicate = constant_filter.constant.value<std::string_view>();
-                filter_selection_switch<std::string_view>(uvf,
-                                                          predicate,
-                                                          indexing,
-                                                          approved_tuple_count,
-                                                          filter.filter_type);
+            case compression::compression_type::DICTIONARY:
+                std::memcpy(&num_unique, base, sizeof(uint16_t));
+                // A dictionary larger than the range costs more to evaluate than the decompressed rows.
+                if (num_unique > count) {
+                    return false;
+                }
+                entry_count = num_unique;
+                entry_values = base + sizeof(uint16_t);
+                dict_indices = entry_values + num_unique * ts;
                 break;
+            default:
+                return false;
+        }
+
+        vector::vector_t entries(resource, type, std::max<uint64_t>(entry_count, 1));
+        if (compression_ == compression::compression_type::RLE) {
+            auto* runs = base + sizeof(uint32_t);
+            for (uint64_t i = 0; i < entry_count; i++) {
+                std::memcpy(entries.data() + i * ts, runs + (first_run + i) * (ts + sizeof(uint32_t)), ts);
             }
-            case types::physical_type::BOOL: {
-                auto predicate = constant_filter.constant.value<bool>();
-                filter_selection_switch<bool>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
-                break;
+        } else {
+            std::memcpy(entries.data(), entry_values, entry_count * ts);
+        }
+        vector::unified_vector_format entries_uvf(resource, entry_count);
+        entries.to_unified_format(entry_count, entries_uvf);
+        vector::indexing_vector_t entry_indexing(resource);
+        uint64_t matched_entries = entry_count;
+        if (!filter_indexing(entry_indexing, entries, entries_uvf, filter, matched_entries)) {
+            return false;
+        }
+        std::pmr::vector<uint8_t> entry_matches(entry_count, 0, resource);
+        for (uint64_t i = 0; i < matched_entries; i++) {
+            entry_matches[entry_indexing.get_index(i)] = 1;
+        }
+
+        switch (compression_) {
+            case compression::compression_type::CONSTANT:
+                if (!entry_matches[0]) {
+                    approved_tuple_count = 0;
+                    return true;
+                }
+                impl::select_compressed_rows(validity, indexing, approved_tuple_count, [](uint64_t) { return true; });
+                return true;
+            case compression::compression_type::RLE: {
+                // Spread the per-run verdicts over the range, one fill per run.
+                std::pmr::vector<uint8_t> row_matches(count, 0, resource);
+                auto* runs = base + sizeof(uint32_t);
+                uint64_t run_start = first_run_start;
+                for (uint64_t i = 0; i < entry_count; i++) {
+                    uint32_t run_len;
+                    std::memcpy(&run_len, runs + (first_run + i) * (ts + sizeof(uint32_t)) + ts, sizeof(uint32_t));
+                    const uint64_t from = std::max(run_start, offset) - offset;
+                    const uint64_t to = std::min<uint64_t>(run_start + run_len, offset + count) - offset;
+                    std::fill(row_matches.begin() + static_cast<int64_t>(from),
+                              row_matches.begin() + static_cast<int64_t>(to),
+                              entry_matches[i]);
+                    run_start += run_len;
+                }
+                impl::select_compressed_rows(validity, indexing, approved_tuple_count, [&](uint64_t idx) {
+                    return row_matches[idx] != 0;
+                });
+                return true;
+            }
+            case compression::compression_type::DICTIONARY: {
+                const auto* codes = dict_indices;
+                if (num_unique <= 256) {
+                    const auto* narrow = reinterpret_cast<const uint8_t*>(codes) + offset;
+                    impl::select_compressed_rows(validity, indexing, approved_tuple_count, [&](uint64_t idx) {
+                        return entry_matches[narrow[idx]] != 0;
+                    });
+                } else {
+                    impl::select_compressed_rows(validity, indexing, approved_tuple_count, [&](uint64_t idx) {
+                        uint16_t code;
+                        std::memcpy(&code, codes + (offset + idx) * sizeof(uint16_t), sizeof(uint16_t));
+                        return entry_matches[code] != 0;
+                    });
+                }
+                return true;
             }
             default:
-                throw std::logic_error("Invalid type for filter value");
+                return false;
         }
-        return approved_tuple_count;
     }
 
     void column_segment_t::skip(column_scan_state& state) { state.internal_index = state.row_index; }
@@ -1674,7 +2459,23 @@ namespace components::table {
             return;
         }
         if (compression_ == compression::compression_type::DICTIONARY) {
-            impl::dict_scan_entire(*this, state, scan_count, result);
+            if (type.to_physical_type() == types::physical_type::STRING) {
+                impl::string_dictionary_scan(*this, state, scan_count, result, 0);
+            } else {
+                impl::dict_scan_entire(*this, state, scan_count, result);
+            }
+            return;
+        }
+        if (compression_ == compression::compression_type::FSST) {
+            impl::fsst_scan(*this, state, scan_count, result, 0);
+            return;
+        }
+        if (compression_ == compression::compression_type::BITPACKING) {
+            impl::bitpacking_scan(*this, state, scan_count, result, 0);
+            return;
+        }
+        if (compression_ == compression::compression_type::ALP) {
+            impl::alp_scan(*this, state, scan_count, result, 0);
             return;
         }
         switch (type.to_physical_type()) {
@@ -1745,7 +2546,23 @@ namespace components::table {
             return;
         }
         if (compression_ == compression::compression_type::DICTIONARY) {
-            impl::dict_scan_partial(*this, state, scan_count, result, result_offset);
+            if (type.to_physical_type() == types::physical_type::STRING) {
+                impl::string_dictionary_scan(*this, state, scan_count, result, result_offset);
+            } else {
+                impl::dict_scan_partial(*this, state, scan_count, result, result_offset);
+            }
+            return;
+        }
+        if (compression_ == compression::compression_type::FSST) {
+            impl::fsst_scan(*this, state, scan_count, result, result_offset);
+            return;
+        }
+        if (compression_ == compression::compression_type::BITPACKING) {
+            impl::bitpacking_scan(*this, state, scan_count, result, result_offset);
+            return;
+        }
+        if (compression_ == compression::compression_type::ALP) {
+            impl::alp_scan(*this, state, scan_count, result, result_offset);
             return;
         }
         switch (type.to_physical_type()) {
@@ -67,12 +67,30 @@ namespace components::table {
         [[nodiscard]] core::result_wrapper_t<bool> check_predicate(int64_t row_id, const table_filter_t* filter);
         void fetch_row(column_fetch_state& state, int64_t row_id, vector::vector_t& result, uint64_t result_idx);
 
-        static uint64_t filter_indexing(vector::indexing_vector_t& indexing,
-                                        vector::vector_t& vector,
-                                        vector::unified_vector_format& uvf,
-                                        const table_filter_t& filter,
-                                        uint64_t scan_count,
-                                        uint64_t& approved_tuple_count);
+        // Vectorized evaluation of a leaf filter (constant comparison, IS [NOT] NULL or IN-list) over
+        // the scanned `vector`: narrows the `approved_tuple_count` rows of `indexing` to those that
+        // pass. Returns false, leaving `indexing` untouched, when the filter has no typed kernel for
+        // this vector and has to be checked row by row.
+        static bool filter_indexing(vector::indexing_vector_t& indexing,
+                                    vector::vector_t& vector,
+                                    vector::unified_vector_format& uvf,
+                                    const table_filter_t& filter,
+                                    uint64_t& approved_tuple_count);
+
+        // Evaluates a leaf filter on rows [offset, offset + count) of a CONSTANT, RLE or DICTIONARY
+        // segment without decompressing them: the filter runs once on the constant, once per run or
+        // once per dictionary entry, and the candidate rows (relative to `offset`) then only look up
+        // their entry's verdict. BITPACKING and ALP segments are evaluated per group: comparisons a
+        // group's min/max decide skip the decoding. STRING segments run the filter per DICTIONARY entry;
+        // FSST answers equality from the codes and prefixes from the first codes. Rows cleared in
+        // `validity` never pass. Returns false, leaving `indexing` untouched, for uncompressed segments
+        // and filters without a typed kernel; out_of_memory when the segment cannot be pinned.
+        [[nodiscard]] core::result_wrapper_t<bool> filter_compressed(uint64_t offset,
+                                                                     uint64_t count,
+                                                                     const vector::validity_mask_t& validity,
+                                                                     vector::indexing_vector_t& indexing,
+                                                                     const table_filter_t& filter,
+                                                                     uint64_t& approved_tuple_count);
 
         void skip(column_scan_state& state);
 
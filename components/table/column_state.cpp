@@ -5,15 +5,25 @@
 #include "storage/block_handle.hpp"
 #include "storage/block_manager.hpp"
 #include "storage/buffer_manager.hpp"
-#include <regex>
+
+#include <algorithm>
 
 namespace components::table {
 
+    void constant_filter_t::compile_pattern() {
+        if (filter_type != expressions::compare_type::regex ||
+            constant.type().to_physical_type() != types::physical_type::STRING) {
+            return;
+        }
+        auto compiled = types::string_pattern_t::compile(constant.resource(), constant.value<std::string_view>());
+        if (!compiled.has_error()) {
+            pattern_ = std::make_shared<const types::string_pattern_t>(std::move(compiled.value()));
+        }
+    }
+
     bool constant_filter_t::compare(const types::logical_value_t& value) const {
         if (filter_type == expressions::compare_type::regex) {
-            auto str = std::string(value.value<std::string_view>());
-            auto pattern = std::string(constant.value<std::string_view>());
-            return std::regex_search(str, std::regex(pattern));
+            return pattern_ && pattern_->matches(value.value<std::string_view>());
         }
         auto comp = value.compare(constant);
         if (comp == types::compare_t::equals) {
@@ -57,6 +67,143 @@ namespace components::table {
         return std::make_unique<constant_filter_t>(filter_type, constant, table_indices);
     }
 
+    bloom_filter_t::bloom_filter_t(uint64_t expected_keys, std::pmr::vector<uint64_t> table_indices)
+        : table_filter_t(expressions::compare_type::eq)
+        , table_indices(std::move(table_indices)) {
+        if (expected_keys == 0 || expected_keys > max_bloom_keys) {
+            return;
+        }
+        // ~16 bits per key keeps three-bits-per-word blocking at a few percent false positives.
+        uint64_t words = 1;
+        while (words * 64 < expected_keys * 16) {
+            words <<= 1;
+        }
+        bits.assign(words, 0);
+    }
+
+    void bloom_filter_t::insert(int64_t key) noexcept {
+        min_key = std::min(min_key, key);
+        max_key = std::max(max_key, key);
+        if (!bits.empty()) {
+            const uint64_t h = hash(key);
+            bits[h & (bits.size() - 1)] |= word_mask(h);
+        }
+    }
+
+    bool bloom_filter_t::contains(const types::logical_value_t& value) const {
+        int64_t key;
+        if (!integral_key(value, key)) {
+            return !value.is_null();
+        }
+        return may_contain(key);
+    }
+
+    bool bloom_filter_t::excludes_range(const types::logical_value_t& min, const types::logical_value_t& max) const {
+        if (empty()) {
+            return true;
+        }
+        int64_t lo;
+        int64_t hi;
+        if (!integral_key(min, lo) || !integral_key(max, hi)) {
+            return false;
+        }
+        return hi < min_key || lo > max_key;
+    }
+
+    std::unique_ptr<table_filter_t> bloom_filter_t::copy() const {
+        auto result = std::make_unique<bloom_filter_t>(0, table_indices);
+        result->min_key = min_key;
+        result->max_key = max_key;
+        result->bits = bits;
+        return result;
+    }
+
+    bool bloom_filter_t::equals(const table_filter_t& other) const {
+        auto* bloom = dynamic_cast<const bloom_filter_t*>(&other);
+        return bloom && min_key == bloom->min_key && max_key == bloom->max_key && bits == bloom->bits &&
+               table_indices == bloom->table_indices;
+    }
+
+    bool bloom_filter_t::is_integral_key(types::logical_type type) noexcept {
+        switch (type) {
+            case types::logical_type::TINYINT:
+            case types::logical_type::SMALLINT:
+            case types::logical_type::INTEGER:
+            case types::logical_type::BIGINT:
+            case types::logical_type::UTINYINT:
+            case types::logical_type::USMALLINT:
+            case types::logical_type::UINTEGER:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool bloom_filter_t::integral_key(const types::logical_value_t& value, int64_t& key) {
+        if (value.is_null()) {
+            return false;
+        }
+        switch (value.type().type()) {
+            case types::logical_type::TINYINT:
+                key = value.value<int8_t>();
+                return true;
+            case types::logical_type::SMALLINT:
+                key = value.value<int16_t>();
+                return true;
+            case types::logical_type::INTEGER:
+                key = value.value<int32_t>();
+                return true;
+            case types::logical_type::BIGINT:
+                key = value.value<int64_t>();
+                return true;
+            case types::logical_type::UTINYINT:
+                key = value.value<uint8_t>();
+                return true;
+            case types::logical_type::USMALLINT:
+                key = value.value<uint16_t>();
+                return true;
+            case types::logical_type::UINTEGER:
+                key = value.value<uint32_t>();
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool top_n_filter_t::contains(const types::logical_value_t& value) const {
+        if (value.is_null()) {
+            return keeps_nulls() || !active();
+        }
+        int64_t key;
+        if (!bloom_filter_t::integral_key(value, key)) {
+            return true;
+        }
+        return may_enter(key);
+    }
+
+    bool top_n_filter_t::excludes_range(const types::logical_value_t& min,
+                                        const types::logical_value_t& max,
+                                        uint64_t null_count) const {
+        if (!active() || (keeps_nulls() && null_count > 0)) {
+            return false;
+        }
+        int64_t lo;
+        int64_t hi;
+        if (!bloom_filter_t::integral_key(min, lo) || !bloom_filter_t::integral_key(max, hi)) {
+            return false;
+        }
+        return descending() ? !may_enter(hi) : !may_enter(lo);
+    }
+
+    std::unique_ptr<table_filter_t> top_n_filter_t::copy() const {
+        return std::make_unique<top_n_filter_t>(descending(), bound, table_indices);
+    }
+
+    bool top_n_filter_t::equals(const table_filter_t& other) const {
+        auto* top_n = dynamic_cast<const top_n_filter_t*>(&other);
+        return top_n && table_filter_t::equals(other) && bound == top_n->bound && table_indices == top_n->table_indices;
+    }
+
     bool conjunction_filter_t::equals(const table_filter_t& other) const {
         return table_filter_t::equals(other) && child_filters == other.cast<conjunction_filter_t>().child_filters;
     }
@@ -1,16 +1,21 @@
 #pragma once
 #include <components/types/types.hpp>
+#include <core/hash_mix.hpp>
 #include <core/operations_helper.hpp>
 #include <core/result_wrapper.hpp>
+#include <atomic>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
 
+#include <components/table/compression/compression_type.hpp>
 #include <components/table/storage/buffer_handle.hpp>
 
 #include <components/expressions/forward.hpp>
 #include <components/types/logical_value.hpp>
+#include <components/types/string_pattern.hpp>
 
 namespace components::table {
     class row_group_t;
@@ -95,21 +100,35 @@ namespace components::table {
                           std::pmr::vector<uint64_t> table_indices)
             : table_filter_t(comparison_type)
             , constant(std::move(constant))
-            , table_indices(std::move(table_indices)) {}
+            , table_indices(std::move(table_indices)) {
+            compile_pattern();
+        }
 
         bool compare(const types::logical_value_t& value) const;
         template<typename T>
         bool compare(T value) const;
+        // Converts the constant to the column's physical type once, so vectorized kernels compare
+        // raw values without re-deriving the constant's type per row. Returns false when the
+        // comparison needs the column value widened first (see compare<T>).
+        template<typename T>
+        bool typed_constant(T& predicate) const;
         bool equals(const table_filter_t& other) const override;
         std::unique_ptr<table_filter_t> copy() const override;
+        // compiled constant of a regex filter; nullptr for other filters and invalid patterns
+        const types::string_pattern_t* pattern() const noexcept { return pattern_.get(); }
 
         types::logical_value_t constant;
         std::pmr::vector<uint64_t> table_indices;
+
+    private:
+        // regex filters compile their constant once; null when it is not a valid pattern
+        void compile_pattern();
+
+        std::shared_ptr<const types::string_pattern_t> pattern_;
     };
 
     template<typename T>
-    bool constant_filter_t::compare(T value) const {
-        T predicate;
+    bool constant_filter_t::typed_constant(T& predicate) const {
         if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
             auto const_type = constant.type().type();
             if (const_type == types::logical_type::DOUBLE) {
@@ -117,10 +136,10 @@ namespace components::table {
             } else if (const_type == types::logical_type::FLOAT) {
                 predicate = static_cast<T>(constant.value<float>());
             } else if constexpr (sizeof(T) == 4) {
-                // INT32 column (DATE = days since epoch). Widen to µs when constant is a µs-based duration.
+                // INT32 column (DATE = days since epoch) against a µs-based constant: the column
+                // value has to be widened, which a T-typed predicate cannot express.
                 if (const_type == types::logical_type::TIMESTAMP || const_type == types::logical_type::TIMESTAMP_TZ) {
-                    const int64_t as_us = static_cast<int64_t>(value) * int64_t{86400} * int64_t{1000000};
-                    return compare(as_us);
+                    return false;
                 }
                 predicate = constant.value<T>();
             } else if constexpr (sizeof(T) == 8) {
@@ -143,6 +162,19 @@ namespace components::table {
         } else {
             predicate = constant.value<T>();
         }
+        return true;
+    }
+
+    template<typename T>
+    bool constant_filter_t::compare(T value) const {
+        T predicate{};
+        if (!typed_constant(predicate)) {
+            // Only an INT32 (DATE) column against a µs constant lands here: widen the value to µs.
+            if constexpr (std::is_integral_v<T>) {
+                const int64_t as_us = static_cast<int64_t>(value) * int64_t{86400} * int64_t{1000000};
+                return compare(as_us);
+            }
+        }
         if (core::is_equals(value, predicate)) {
             switch (filter_type) {
                 case expressions::compare_type::eq:
@@ -233,16 +265,160 @@ namespace components::table {
         std::pmr::vector<uint64_t> table_indices;
     };
 
+    // Runtime join filter, handed to the probe-side scan of a hash join once the build side is
+    // materialized: the [min, max] of the build keys plus a register-blocked Bloom filter over them
+    // (one 64-bit word per key, three bits set in it), so a probe value is rejected by a range check
+    // or a single word load. Integer keys only; values are widened to int64 before hashing, so the
+    // build and probe columns may differ in width. False positives are possible, false negatives
+    // are not — the join still verifies every row that survives.
+    class bloom_filter_t : public table_filter_t {
+    public:
+        // Past this many keys the Bloom bits would be mostly ones; only the range is kept.
+        static constexpr uint64_t max_bloom_keys = uint64_t{1} << 20;
+
+        bloom_filter_t(uint64_t expected_keys, std::pmr::vector<uint64_t> table_indices);
+
+        void insert(int64_t key) noexcept;
+        bool may_contain(int64_t key) const noexcept {
+            if (key < min_key || key > max_key) {
+                return false;
+            }
+            if (bits.empty()) {
+                return true;
+            }
+            const uint64_t h = hash(key);
+            const uint64_t mask = word_mask(h);
+            return (bits[h & (bits.size() - 1)] & mask) == mask;
+        }
+        // Typed probe for the storage kernels; a non-integer value is never rejected.
+        template<typename T>
+        bool test(T value) const noexcept;
+        bool contains(const types::logical_value_t& value) const;
+        // Zone-map verdict for a column or segment whose values lie in [min, max].
+        bool excludes_range(const types::logical_value_t& min, const types::logical_value_t& max) const;
+        // No key was inserted: the build side is empty, nothing can match.
+        bool empty() const noexcept { return max_key < min_key; }
+
+        std::unique_ptr<table_filter_t> copy() const override;
+        bool equals(const table_filter_t& other) const override;
+
+        // Widens an integer logical value to the int64 the filter hashes; false for other types.
+        static bool integral_key(const types::logical_value_t& value, int64_t& key);
+        static bool is_integral_key(types::logical_type type) noexcept;
+
+        int64_t min_key{std::numeric_limits<int64_t>::max()};
+        int64_t max_key{std::numeric_limits<int64_t>::min()};
+        // Power-of-two word count; empty keeps the range check only.
+        std::vector<uint64_t> bits;
+        std::pmr::vector<uint64_t> table_indices;
+
+    private:
+        static uint64_t hash(int64_t key) noexcept { return core::fmix64(static_cast<uint64_t>(key)); }
+        // Three bit positions from the top 18 hash bits; the low bits pick the word.
+        static uint64_t word_mask(uint64_t h) noexcept {
+            return (uint64_t{1} << (h >> 58)) | (uint64_t{1} << ((h >> 52) & 63)) |
+                   (uint64_t{1} << ((h >> 46) & 63));
+        }
+    };
+
+    template<typename T>
+    bool bloom_filter_t::test(T value) const noexcept {
+        if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+            if constexpr (std::is_unsigned_v<T> && sizeof(T) == sizeof(int64_t)) {
+                if (value > static_cast<T>(std::numeric_limits<int64_t>::max())) {
+                    return false;
+                }
+            }
+            return may_contain(static_cast<int64_t>(value));
+        } else {
+            return true;
+        }
+    }
+
+    // Bound of a dynamic top-N filter, shared between an ORDER BY ... LIMIT k sort and the scan
+    // feeding it. The sort publishes the leading key of its current k-th row whenever its buffer
+    // is full; the bound only ever tightens, so a reader that sees a stale one prunes less, never
+    // wrongly.
+    struct top_n_bound_t {
+        void publish(int64_t value) noexcept {
+            key.store(value, std::memory_order_relaxed);
+            active.store(true, std::memory_order_release);
+        }
+
+        std::atomic<int64_t> key{0};
+        std::atomic<bool> active{false};
+    };
+
+    // Dynamic filter pushed from a top-N sort onto its scan: a row whose leading sort key lies past
+    // the bound cannot enter the top k. Passes every row until the sort first fills its buffer.
+    // Integer keys only, like bloom_filter_t. Ascending sorts put NULLs last, so once the bound is
+    // set a NULL is dropped; descending sorts put them first, so NULLs always pass (keeps_nulls).
+    class top_n_filter_t : public table_filter_t {
+    public:
+        top_n_filter_t(bool descending,
+                       std::shared_ptr<const top_n_bound_t> bound,
+                       std::pmr::vector<uint64_t> table_indices)
+            : table_filter_t(descending ? expressions::compare_type::gte : expressions::compare_type::lte)
+            , bound(std::move(bound))
+            , table_indices(std::move(table_indices)) {}
+
+        bool active() const noexcept { return bound->active.load(std::memory_order_acquire); }
+        bool descending() const noexcept { return filter_type == expressions::compare_type::gte; }
+        bool keeps_nulls() const noexcept { return descending(); }
+        bool may_enter(int64_t key) const noexcept {
+            if (!active()) {
+                return true;
+            }
+            const int64_t limit = bound->key.load(std::memory_order_relaxed);
+            return descending() ? key >= limit : key <= limit;
+        }
+        // Typed probe for the storage kernels; a non-integer value is never rejected.
+        template<typename T>
+        bool test(T value) const noexcept;
+        bool contains(const types::logical_value_t& value) const;
+        // Zone-map verdict for a column or segment whose non-NULL values lie in [min, max].
+        bool excludes_range(const types::logical_value_t& min,
+                            const types::logical_value_t& max,
+                            uint64_t null_count) const;
+
+        std::unique_ptr<table_filter_t> copy() const override;
+        bool equals(const table_filter_t& other) const override;
+
+        std::shared_ptr<const top_n_bound_t> bound;
+        std::pmr::vector<uint64_t> table_indices;
+    };
+
+    template<typename T>
+    bool top_n_filter_t::test(T value) const noexcept {
+        if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+            if constexpr (std::is_unsigned_v<T> && sizeof(T) == sizeof(int64_t)) {
+                if (value > static_cast<T>(std::numeric_limits<int64_t>::max())) {
+                    return descending() || !active();
+                }
+            }
+            return may_enter(static_cast<int64_t>(value));
+        } else {
+            return true;
+        }
+    }
+
     // Dispatch helper used by all storage filter sites. Replaces the
     //     `filter->cast<constant_filter_t>().compare(value)` pattern with one that handles
-    // set_membership_filter_t too. Constructs a temporary logical_value_t on the default
-    // pmr resource for the membership probe — fine for a 1-shot bool, no escape.
+    // set_membership_filter_t, bloom_filter_t and top_n_filter_t too. Constructs a temporary
+    // logical_value_t on the default pmr resource for the membership probe — fine for a 1-shot
+    // bool, no escape.
     // Templated on the value type (fixed-width T, bool for validity, string_view).
     template<typename T>
     inline bool table_filter_dispatch(const table_filter_t* filter, T value) {
         if (auto* set = dynamic_cast<const set_membership_filter_t*>(filter)) {
             return set->contains(types::logical_value_t{std::pmr::get_default_resource(), value});
         }
+        if (auto* bloom = dynamic_cast<const bloom_filter_t*>(filter)) {
+            return bloom->test(value);
+        }
+        if (auto* top_n = dynamic_cast<const top_n_filter_t*>(filter)) {
+            return top_n->test(value);
+        }
         return filter->cast<constant_filter_t>().compare(value);
     }
 
@@ -256,6 +432,12 @@ namespace components::table {
         if (auto* nul = dynamic_cast<const is_null_filter_t*>(filter)) {
             return nul->table_indices;
         }
+        if (auto* bloom = dynamic_cast<const bloom_filter_t*>(filter)) {
+            return bloom->table_indices;
+        }
+        if (auto* top_n = dynamic_cast<const top_n_filter_t*>(filter)) {
+            return top_n->table_indices;
+        }
         return filter->cast<constant_filter_t>().table_indices;
     }
 
@@ -405,6 +587,7 @@ namespace components::table {
         std::string column_path;
         uint64_t segment_idx;
         std::string segment_type;
+        compression::compression_type compression{compression::compression_type::INVALID};
         int64_t segment_start;
         uint64_t segment_count;
         bool has_updates;
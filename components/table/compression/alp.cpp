@@ -0,0 +1,487 @@
+#include "alp.hpp"
+#include "bitpacking.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace components::table::compression::alp {
+
+    namespace {
+
+        static constexpr uint64_t SEGMENT_HEADER_SIZE = 2 * sizeof(uint32_t);
+        static constexpr uint64_t SAMPLE_SIZE = 32;
+
+        template<typename T>
+        struct float_traits;
+
+        template<>
+        struct float_traits<double> {
+            using bits_t = uint64_t;
+            static constexpr unsigned MAX_EXPONENT = 18;
+            static constexpr unsigned CENTER_BITS = 6;
+        };
+
+        template<>
+        struct float_traits<float> {
+            using bits_t = uint32_t;
+            static constexpr unsigned MAX_EXPONENT = 10;
+            static constexpr unsigned CENTER_BITS = 5;
+        };
+
+        template<typename T>
+        static constexpr std::array<T, 19> EXP10 = {T(1e0),  T(1e1),  T(1e2),  T(1e3),  T(1e4),  T(1e5),  T(1e6),
+                                                    T(1e7),  T(1e8),  T(1e9),  T(1e10), T(1e11), T(1e12), T(1e13),
+                                                    T(1e14), T(1e15), T(1e16), T(1e17), T(1e18)};
+
+        template<typename T>
+        static constexpr std::array<T, 19> FRAC10 = {T(1e0),   T(1e-1),  T(1e-2),  T(1e-3),  T(1e-4),
+                                                     T(1e-5),  T(1e-6),  T(1e-7),  T(1e-8),  T(1e-9),
+                                                     T(1e-10), T(1e-11), T(1e-12), T(1e-13), T(1e-14),
+                                                     T(1e-15), T(1e-16), T(1e-17), T(1e-18)};
+
+        template<typename T>
+        T from_digits(int64_t digits, unsigned exponent, unsigned factor) {
+            return static_cast<T>(digits) * EXP10<T>[factor] * FRAC10<T>[exponent];
+        }
+
+        // The digits of `value` at (exponent, factor), when decoding them gives the same bits back.
+        template<typename T>
+        bool to_digits(T value, unsigned exponent, unsigned factor, int64_t& digits) {
+            const T scaled = value * EXP10<T>[exponent] * FRAC10<T>[factor];
+            // also rejects NaN and the infinities
+            if (!(std::abs(scaled) < static_cast<T>(uint64_t{1} << 62))) {
+                return false;
+            }
+            digits = static_cast<int64_t>(std::nearbyint(scaled));
+            const T decoded = from_digits<T>(digits, exponent, factor);
+            return std::memcmp(&decoded, &value, sizeof(T)) == 0;
+        }
+
+        struct alp_choice_t {
+            unsigned exponent = 0;
+            unsigned factor = 0;
+        };
+
+        // (exponent, factor) with the fewest packed bits plus exception bits over a sample of the group.
+        template<typename T>
+        alp_choice_t choose_exponent(const T* values, uint64_t count) {
+            static constexpr uint64_t EXCEPTION_BITS = 8 * (sizeof(uint16_t) + sizeof(T));
+            const uint64_t step = std::max<uint64_t>(count / SAMPLE_SIZE, 1);
+            alp_choice_t best;
+            uint64_t best_cost = std::numeric_limits<uint64_t>::max();
+            for (unsigned exponent = 0; exponent <= float_traits<T>::MAX_EXPONENT; exponent++) {
+                for (unsigned factor = 0; factor <= exponent; factor++) {
+                    uint64_t sampled = 0;
+                    uint64_t exceptions = 0;
+                    int64_t min = std::numeric_limits<int64_t>::max();
+                    int64_t max = std::numeric_limits<int64_t>::min();
+                    for (uint64_t i = 0; i < count; i += step) {
+                        int64_t digits;
+                        sampled++;
+                        if (!to_digits(values[i], exponent, factor, digits)) {
+                            exceptions++;
+                            continue;
+                        }
+                        min = std::min(min, digits);
+                        max = std::max(max, digits);
+                    }
+                    const uint64_t range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+                    const uint64_t width = exceptions < sampled ? std::bit_width(range) : 0;
+                    const uint64_t cost = width * sampled + exceptions * EXCEPTION_BITS;
+                    if (cost < best_cost) {
+                        best_cost = cost;
+                        best.exponent = exponent;
+                        best.factor = factor;
+                    }
+                }
+            }
+            return best;
+        }
+
+        // Digits bit-packed as a one-group BITPACKING segment, followed by the exceptions.
+        template<typename T>
+        void encode_alp(const T* values, uint64_t count, group_header_t& header, std::vector<std::byte>& payload) {
+            const auto choice = choose_exponent(values, count);
+            header.mode = group_mode::ALP;
+            header.exponent = static_cast<uint8_t>(choice.exponent);
+            header.factor = static_cast<uint8_t>(choice.factor);
+
+            std::array<int64_t, GROUP_SIZE> digits;
+            std::vector<uint16_t> rows;
+            std::vector<T> exceptions;
+            bool has_fill = false;
+            int64_t fill = 0;
+            for (uint64_t i = 0; i < count; i++) {
+                if (to_digits(values[i], choice.exponent, choice.factor, digits[i])) {
+                    if (!has_fill) {
+                        has_fill = true;
+                        fill = digits[i];
+                    }
+                } else {
+                    rows.push_back(static_cast<uint16_t>(i));
+                    exceptions.push_back(values[i]);
+                }
+            }
+            // Exception slots take a regular value's digits so they do not widen the packing.
+            for (auto row : rows) {
+                digits[row] = fill;
+            }
+            header.exception_count = static_cast<uint16_t>(rows.size());
+
+            std::vector<std::byte> packed;
+            bitpacking::encode(types::physical_type::INT64,
+                               reinterpret_cast<const std::byte*>(digits.data()),
+                               count,
+                               packed);
+            header.payload_size = static_cast<uint32_t>(packed.size());
+            payload = std::move(packed);
+            const uint64_t start = payload.size();
+            payload.resize(start + rows.size() * (sizeof(uint16_t) + sizeof(T)));
+            std::memcpy(payload.data() + start, rows.data(), rows.size() * sizeof(uint16_t));
+            std::memcpy(payload.data() + start + rows.size() * sizeof(uint16_t),
+                        exceptions.data(),
+                        exceptions.size() * sizeof(T));
+        }
+
+        class bit_writer_t {
+        public:
+            void write(uint64_t value, unsigned bits) {
+                if (bits == 0) {
+                    return;
+                }
+                if (bits < 64) {
+                    value &= (uint64_t{1} << bits) - 1;
+                }
+                const unsigned shift = position_ % 64;
+                if (shift == 0) {
+                    words_.push_back(0);
+                }
+                words_.back() |= value << shift;
+                if (shift + bits > 64) {
+                    words_.push_back(value >> (64 - shift));
+                }
+                position_ += bits;
+            }
+
+            const std::vector<uint64_t>& words() const { return words_; }
+
+        private:
+            std::vector<uint64_t> words_;
+            uint64_t position_ = 0;
+        };
+
+        class bit_reader_t {
+        public:
+            explicit bit_reader_t(const std::byte* data)
+                : data_(data) {}
+
+            uint64_t read(unsigned bits) {
+                if (bits == 0) {
+                    return 0;
+                }
+                const uint64_t word = position_ / 64;
+                const unsigned shift = position_ % 64;
+                uint64_t value = load(word) >> shift;
+                if (shift + bits > 64) {
+                    value |= load(word + 1) << (64 - shift);
+                }
+                position_ += bits;
+                return bits == 64 ? value : value & ((uint64_t{1} << bits) - 1);
+            }
+
+        private:
+            uint64_t load(uint64_t word) const {
+                uint64_t value;
+                std::memcpy(&value, data_ + word * sizeof(uint64_t), sizeof(uint64_t));
+                return value;
+            }
+
+            const std::byte* data_;
+            uint64_t position_ = 0;
+        };
+
+        // Chimp's leading-zero counts, rounded down to one of eight stored in three bits.
+        static constexpr std::array<unsigned, 8> LEADING = {0, 8, 12, 16, 18, 20, 22, 24};
+        static constexpr unsigned TRAILING_THRESHOLD = 6;
+
+        unsigned leading_code(unsigned leading_zeros) {
+            unsigned code = 0;
+            while (code + 1 < LEADING.size() && LEADING[code + 1] <= leading_zeros) {
+                code++;
+            }
+            return code;
+        }
+
+        // Per value a two-bit flag: 00 same as the previous value; 01 the XOR's centre bits when it has
+        // many trailing zeros; 10 the XOR below the previous leading zeros; 11 new leading zeros first.
+        template<typename T>
+        void encode_chimp(const T* values, uint64_t count, std::vector<std::byte>& payload) {
+            using bits_t = typename float_traits<T>::bits_t;
+            static constexpr unsigned BITS = 8 * sizeof(bits_t);
+            bit_writer_t writer;
+            bits_t previous;
+            std::memcpy(&previous, &values[0], sizeof(T));
+            writer.write(previous, BITS);
+            unsigned stored_leading = BITS + 1;
+            for (uint64_t i = 1; i < count; i++) {
+                bits_t value;
+                std::memcpy(&value, &values[i], sizeof(T));
+                const bits_t xored = value ^ previous;
+                previous = value;
+                if (xored == 0) {
+                    writer.write(0, 2);
+                    stored_leading = BITS + 1;
+                    continue;
+                }
+                const unsigned code = leading_code(static_cast<unsigned>(std::countl_zero(xored)));
+                const unsigned leading = LEADING[code];
+                const auto trailing = static_cast<unsigned>(std::countr_zero(xored));
+                if (trailing > TRAILING_THRESHOLD) {
+                    const unsigned center = BITS - leading - trailing;
+                    writer.write(1, 2);
+                    writer.write(code, 3);
+                    writer.write(center, float_traits<T>::CENTER_BITS);
+                    writer.write(xored >> trailing, center);
+                    stored_leading = BITS + 1;
+                } else if (leading == stored_leading) {
+                    writer.write(2, 2);
+                    writer.write(xored, BITS - leading);
+                } else {
+                    stored_leading = leading;
+                    writer.write(3, 2);
+                    writer.write(code, 3);
+                    writer.write(xored, BITS - leading);
+                }
+            }
+            const auto& words = writer.words();
+            payload.resize(words.size() * sizeof(uint64_t));
+            std::memcpy(payload.data(), words.data(), payload.size());
+        }
+
+        // The stream is sequential: the first `count` values of the group.
+        template<typename T>
+        void decode_chimp(const std::byte* payload, uint64_t count, T* dest) {
+            using bits_t = typename float_traits<T>::bits_t;
+            static constexpr unsigned BITS = 8 * sizeof(bits_t);
+            bit_reader_t reader(payload);
+            auto previous = static_cast<bits_t>(reader.read(BITS));
+            std::memcpy(&dest[0], &previous, sizeof(T));
+            unsigned stored_leading = 0;
+            for (uint64_t i = 1; i < count; i++) {
+                bits_t xored = 0;
+                switch (reader.read(2)) {
+                    case 0:
+                        break;
+                    case 1: {
+                        const unsigned leading = LEADING[reader.read(3)];
+                        const auto center = static_cast<unsigned>(reader.read(float_traits<T>::CENTER_BITS));
+                        const unsigned trailing = BITS - leading - center;
+                        xored = static_cast<bits_t>(reader.read(center) << trailing);
+                        break;
+                    }
+                    case 2:
+                        xored = static_cast<bits_t>(reader.read(BITS - stored_leading));
+                        break;
+                    default:
+                        stored_leading = LEADING[reader.read(3)];
+                        xored = static_cast<bits_t>(reader.read(BITS - stored_leading));
+                        break;
+                }
+                previous ^= xored;
+                std::memcpy(&dest[i], &previous, sizeof(T));
+            }
+        }
+
+        template<typename T>
+        void encode_group(const std::byte* data, uint64_t count, std::vector<std::byte>& out) {
+            std::array<T, GROUP_SIZE> values;
+            std::memcpy(values.data(), data, count * sizeof(T));
+
+            group_header_t header{};
+            bool has_bounds = false;
+            for (uint64_t i = 0; i < count; i++) {
+                if (std::isnan(values[i])) {
+                    header.has_nan = 1;
+                } else if (!has_bounds) {
+                    has_bounds = true;
+                    header.min = values[i];
+                    header.max = values[i];
+                } else {
+                    header.min = std::min<double>(header.min, values[i]);
+                    header.max = std::max<double>(header.max, values[i]);
+                }
+            }
+
+            group_header_t alp_header = header;
+            std::vector<std::byte> alp_payload;
+            encode_alp(values.data(), count, alp_header, alp_payload);
+
+            std::vector<std::byte> chimp_payload;
+            encode_chimp(values.data(), count, chimp_payload);
+
+            const std::byte* payload = data;
+            uint64_t payload_size = count * sizeof(T);
+            header.mode = group_mode::RAW;
+            if (alp_payload.size() < payload_size && alp_payload.size() <= chimp_payload.size()) {
+                header = alp_header;
+                payload = alp_payload.data();
+                payload_size = alp_payload.size();
+            } else if (chimp_payload.size() < payload_size) {
+                header.mode = group_mode::CHIMP;
+                header.payload_size = static_cast<uint32_t>(chimp_payload.size());
+                payload = chimp_payload.data();
+                payload_size = chimp_payload.size();
+            }
+
+            const uint64_t start = out.size();
+            out.resize(start + sizeof(group_header_t) + payload_size);
+            std::memcpy(out.data() + start, &header, sizeof(group_header_t));
+            std::memcpy(out.data() + start + sizeof(group_header_t), payload, payload_size);
+        }
+
+        template<typename T>
+        uint64_t encode_typed(const std::byte* data, uint64_t count, std::vector<std::byte>& out) {
+            const auto groups = static_cast<uint32_t>((count + GROUP_SIZE - 1) / GROUP_SIZE);
+            out.clear();
+            out.resize(SEGMENT_HEADER_SIZE + groups * sizeof(uint32_t));
+            const auto total = static_cast<uint32_t>(count);
+            std::memcpy(out.data(), &total, sizeof(uint32_t));
+            std::memcpy(out.data() + sizeof(uint32_t), &groups, sizeof(uint32_t));
+            for (uint32_t group = 0; group < groups; group++) {
+                const auto offset = static_cast<uint32_t>(out.size());
+                std::memcpy(out.data() + SEGMENT_HEADER_SIZE + group * sizeof(uint32_t), &offset, sizeof(uint32_t));
+                const uint64_t first = group * GROUP_SIZE;
+                encode_group<T>(data + first * sizeof(T), std::min(GROUP_SIZE, count - first), out);
+            }
+            return out.size();
+        }
+
+        const std::byte* group_start(const std::byte* segment, uint64_t group) {
+            uint32_t offset;
+            std::memcpy(&offset, segment + SEGMENT_HEADER_SIZE + group * sizeof(uint32_t), sizeof(uint32_t));
+            return segment + offset;
+        }
+
+        uint64_t segment_count(const std::byte* segment) {
+            uint32_t count;
+            std::memcpy(&count, segment, sizeof(uint32_t));
+            return count;
+        }
+
+        // Decodes rows [from, from + count) of one group. ALP unpacks only the digits the range covers
+        // and scales them in one pass; CHIMP has to replay the stream from the group's first row.
+        template<typename T>
+        void decode_group(const std::byte* group, uint64_t from, uint64_t count, T* dest) {
+            group_header_t header;
+            std::memcpy(&header, group, sizeof(group_header_t));
+            const auto* payload = group + sizeof(group_header_t);
+            switch (header.mode) {
+                case group_mode::RAW:
+                    std::memcpy(dest, payload + from * sizeof(T), count * sizeof(T));
+                    return;
+                case group_mode::CHIMP: {
+                    T values[GROUP_SIZE];
+                    decode_chimp(payload, from + count, values);
+                    std::memcpy(dest, values + from, count * sizeof(T));
+                    return;
+                }
+                case group_mode::ALP:
+                    break;
+            }
+            int64_t digits[GROUP_SIZE];
+            bitpacking::decode(types::physical_type::INT64,
+                               payload,
+                               from,
+                               count,
+                               reinterpret_cast<std::byte*>(digits));
+            const T exponent = FRAC10<T>[header.exponent];
+            const T factor = EXP10<T>[header.factor];
+            for (uint64_t i = 0; i < count; i++) {
+                dest[i] = static_cast<T>(digits[i]) * factor * exponent;
+            }
+            const auto* rows = payload + header.payload_size;
+            const auto* exceptions = rows + header.exception_count * sizeof(uint16_t);
+            for (uint16_t i = 0; i < header.exception_count; i++) {
+                uint16_t row;
+                std::memcpy(&row, rows + i * sizeof(uint16_t), sizeof(uint16_t));
+                if (row >= from && row < from + count) {
+                    std::memcpy(&dest[row - from], exceptions + i * sizeof(T), sizeof(T));
+                }
+            }
+        }
+
+        template<typename T>
+        void decode_typed(const std::byte* segment, uint64_t offset, uint64_t count, std::byte* dest) {
+            const uint64_t total = segment_count(segment);
+            uint64_t done = 0;
+            while (done < count) {
+                const uint64_t row = offset + done;
+                const uint64_t group = row / GROUP_SIZE;
+                const uint64_t from = row % GROUP_SIZE;
+                const uint64_t group_rows = std::min(GROUP_SIZE, total - group * GROUP_SIZE);
+                const uint64_t take = std::min(group_rows - from, count - done);
+                T values[GROUP_SIZE];
+                decode_group<T>(group_start(segment, group), from, take, values);
+                std::memcpy(dest + done * sizeof(T), values, take * sizeof(T));
+                done += take;
+            }
+        }
+
+        template<typename FN>
+        auto dispatch(types::physical_type type, FN&& fn) {
+            if (type == types::physical_type::FLOAT) {
+                return fn(float{});
+            }
+            return fn(double{});
+        }
+
+    } // namespace
+
+    bool supports(types::physical_type type) {
+        return type == types::physical_type::FLOAT || type == types::physical_type::DOUBLE;
+    }
+
+    uint64_t encode(types::physical_type type, const std::byte* data, uint64_t count, std::vector<std::byte>& out) {
+        if (!supports(type) || count == 0) {
+            return 0;
+        }
+        return dispatch(type, [&](auto tag) { return encode_typed<decltype(tag)>(data, count, out); });
+    }
+
+    void decode(types::physical_type type, const std::byte* segment, uint64_t offset, uint64_t count, std::byte* dest) {
+        dispatch(type, [&](auto tag) { decode_typed<decltype(tag)>(segment, offset, count, dest); });
+    }
+
+    uint64_t group_count(const std::byte* segment) {
+        uint32_t groups;
+        std::memcpy(&groups, segment + sizeof(uint32_t), sizeof(uint32_t));
+        return groups;
+    }
+
+    group_header_t group_header(const std::byte* segment, uint64_t group) {
+        group_header_t header;
+        std::memcpy(&header, group_start(segment, group), sizeof(group_header_t));
+        return header;
+    }
+
+    bool group_bounds(types::physical_type type,
+                      const std::byte* segment,
+                      uint64_t group,
+                      std::byte* min_dest,
+                      std::byte* max_dest) {
+        const auto header = group_header(segment, group);
+        dispatch(type, [&](auto tag) {
+            using T = decltype(tag);
+            const auto min = static_cast<T>(header.min);
+            const auto max = static_cast<T>(header.max);
+            std::memcpy(min_dest, &min, sizeof(T));
+            std::memcpy(max_dest, &max, sizeof(T));
+        });
+        return header.has_nan == 0;
+    }
+
+} // namespace components::table::compression::alp
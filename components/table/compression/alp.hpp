@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <components/types/types.hpp>
+
+namespace components::table::compression::alp {
+
+    // ALP segments hold FLOAT and DOUBLE values in groups of GROUP_SIZE rows, each encoded on its own so
+    // a scan or a fetch only decodes the groups it touches. Every group picks the smallest of:
+    //   ALP    value = digits * 10^factor / 10^exponent, with (exponent, factor) chosen per group. Values
+    //          that came from decimals (prices, sensor readings, metrics with a few significant digits)
+    //          become small integers, bit-packed as a BITPACKING segment. Values that do not round-trip
+    //          exactly (NaN, infinities, -0.0, full-precision doubles) are patched exceptions.
+    //   CHIMP  every value XORed with the previous one, keeping only the bits between the leading and
+    //          trailing zeros: real-valued series that change slowly.
+    //   RAW    the values as they are, when neither helps.
+    // Decoding is lossless: every value comes back bit for bit.
+    //
+    // Layout, all offsets relative to the segment start:
+    //   [uint32_t count][uint32_t group_count][uint32_t group_offset]...
+    //   ALP group:   [group_header_t][packed digits][uint16_t exception_row]...[T exception_value]...
+    //   CHIMP group: [group_header_t][bit stream]
+    //   RAW group:   [group_header_t][T value]...
+    // The header also keeps the group's min and max, so filters can accept or reject a whole group
+    // without decoding it.
+    static constexpr uint64_t GROUP_SIZE = 1024;
+
+    enum class group_mode : uint8_t
+    {
+        RAW = 0,
+        ALP = 1,
+        CHIMP = 2
+    };
+
+    struct group_header_t {
+        group_mode mode;
+        uint8_t exponent;
+        uint8_t factor;
+        uint8_t has_nan;
+        uint16_t exception_count;
+        uint16_t reserved;
+        uint32_t payload_size; // ALP: bytes of the packed digits; CHIMP: bytes of the bit stream
+        uint32_t reserved2;
+        double min; // smallest value other than NaN, widened to double for FLOAT
+        double max;
+    };
+
+    // FLOAT and DOUBLE; everything else stays with the other encodings.
+    bool supports(types::physical_type type);
+
+    // Encodes `count` raw values into `out` and returns the encoded size, 0 for unsupported types.
+    uint64_t encode(types::physical_type type, const std::byte* data, uint64_t count, std::vector<std::byte>& out);
+
+    // Decodes rows [offset, offset + count) of an encoded segment into `dest` as raw values.
+    void decode(types::physical_type type, const std::byte* segment, uint64_t offset, uint64_t count, std::byte* dest);
+
+    uint64_t group_count(const std::byte* segment);
+    group_header_t group_header(const std::byte* segment, uint64_t group);
+
+    // Writes the group's min and max into `min_dest` / `max_dest` as raw values of the segment type.
+    // Returns false when the group holds a NaN: no comparison is then decided by the bounds alone.
+    bool group_bounds(types::physical_type type,
+                      const std::byte* segment,
+                      uint64_t group,
+                      std::byte* min_dest,
+                      std::byte* max_dest);
+
+} // namespace components::table::compression::alp
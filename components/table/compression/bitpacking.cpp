@@ -0,0 +1,376 @@
+#include "bitpacking.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace components::table::compression::bitpacking {
+
+    namespace {
+
+        static constexpr uint64_t BLOCK_SIZE = 64;
+        static constexpr uint64_t SEGMENT_HEADER_SIZE = 2 * sizeof(uint32_t);
+        static constexpr uint64_t EXCEPTION_SIZE = sizeof(uint16_t) + sizeof(uint64_t);
+
+        uint64_t block_count(uint64_t count) { return (count + BLOCK_SIZE - 1) / BLOCK_SIZE; }
+
+        uint64_t packed_size(uint64_t count, unsigned width) { return block_count(count) * width * sizeof(uint64_t); }
+
+        // Unpacks one block of 64 residuals. With the width a template constant every shift and word
+        // index folds, leaving straight-line code the compiler vectorises.
+        template<unsigned WIDTH>
+        void unpack_block(const std::byte* in, uint64_t* out) {
+            if constexpr (WIDTH == 0) {
+                std::fill_n(out, BLOCK_SIZE, uint64_t{0});
+            } else if constexpr (WIDTH == 64) {
+                std::memcpy(out, in, BLOCK_SIZE * sizeof(uint64_t));
+            } else {
+                uint64_t words[WIDTH];
+                std::memcpy(words, in, sizeof(words));
+                constexpr uint64_t mask = (uint64_t{1} << WIDTH) - 1;
+                for (unsigned i = 0; i < BLOCK_SIZE; i++) {
+                    const unsigned bit = i * WIDTH;
+                    const unsigned word = bit / 64;
+                    const unsigned shift = bit % 64;
+                    uint64_t value = words[word] >> shift;
+                    if (shift + WIDTH > 64) {
+                        value |= words[word + 1] << (64 - shift);
+                    }
+                    out[i] = value & mask;
+                }
+            }
+        }
+
+        using unpack_fn = void (*)(const std::byte*, uint64_t*);
+
+        template<unsigned... WIDTH>
+        constexpr std::array<unpack_fn, sizeof...(WIDTH)> make_unpackers(std::integer_sequence<unsigned, WIDTH...>) {
+            return {&unpack_block<WIDTH>...};
+        }
+
+        static constexpr auto UNPACKERS = make_unpackers(std::make_integer_sequence<unsigned, 65>{});
+
+        void pack(const uint64_t* residuals, uint64_t count, unsigned width, std::byte* out) {
+            if (width == 0) {
+                return;
+            }
+            std::vector<uint64_t> words(block_count(count) * width, 0);
+            const uint64_t mask = width == 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1;
+            for (uint64_t i = 0; i < count; i++) {
+                const uint64_t value = residuals[i] & mask;
+                const uint64_t bit = i * width;
+                const uint64_t word = bit / 64;
+                const unsigned shift = bit % 64;
+                words[word] |= value << shift;
+                if (shift + width > 64) {
+                    words[word + 1] |= value >> (64 - shift);
+                }
+            }
+            std::memcpy(out, words.data(), words.size() * sizeof(uint64_t));
+        }
+
+        // Width minimising packed bits plus exception entries over the group's residuals.
+        unsigned choose_width(const uint64_t* residuals, uint64_t count, uint64_t& exceptions, uint64_t& size) {
+            std::array<uint64_t, 65> widths{};
+            for (uint64_t i = 0; i < count; i++) {
+                widths[static_cast<size_t>(std::bit_width(residuals[i]))]++;
+            }
+            unsigned best = 64;
+            uint64_t best_exceptions = 0;
+            uint64_t best_size = packed_size(count, 64);
+            uint64_t wider = 0;
+            for (int width = 63; width >= 0; width--) {
+                wider += widths[static_cast<size_t>(width) + 1];
+                const uint64_t candidate = packed_size(count, static_cast<unsigned>(width)) + wider * EXCEPTION_SIZE;
+                if (candidate <= best_size) {
+                    best = static_cast<unsigned>(width);
+                    best_exceptions = wider;
+                    best_size = candidate;
+                }
+            }
+            exceptions = best_exceptions;
+            size = best_size;
+            return best;
+        }
+
+        template<typename T>
+        using wide_t = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+
+        template<typename T>
+        void encode_group(const std::byte* data, uint64_t count, std::vector<std::byte>& out) {
+            std::array<uint64_t, GROUP_SIZE> values{};
+            for (uint64_t i = 0; i < count; i++) {
+                T value;
+                std::memcpy(&value, data + i * sizeof(T), sizeof(T));
+                values[i] = static_cast<uint64_t>(static_cast<wide_t<T>>(value));
+            }
+            auto less = [](uint64_t a, uint64_t b) {
+                return static_cast<wide_t<T>>(a) < static_cast<wide_t<T>>(b);
+            };
+            const auto [min, max] = std::minmax_element(values.begin(), values.begin() + count, less);
+
+            group_header_t header{};
+            header.min = *min;
+            header.max = *max;
+
+            // The frame is the minimum, unless a few low outliers would widen every residual: then a
+            // frame just above them turns those outliers into exceptions instead.
+            std::array<uint64_t, GROUP_SIZE> for_residuals{};
+            auto frame_of = [&](uint64_t frame, uint64_t& exceptions, uint64_t& size) {
+                for (uint64_t i = 0; i < count; i++) {
+                    for_residuals[i] = values[i] - frame;
+                }
+                return choose_width(for_residuals.data(), count, exceptions, size);
+            };
+            uint64_t frame = header.min;
+            uint64_t for_exceptions;
+            uint64_t for_size;
+            unsigned for_width = frame_of(frame, for_exceptions, for_size);
+            if (const uint64_t outliers = count / 32; outliers > 0) {
+                std::array<uint64_t, GROUP_SIZE> sorted = values;
+                std::nth_element(sorted.begin(), sorted.begin() + outliers, sorted.begin() + count, less);
+                uint64_t robust_exceptions;
+                uint64_t robust_size;
+                const unsigned robust_width = frame_of(sorted[outliers], robust_exceptions, robust_size);
+                if (robust_size < for_size) {
+                    frame = sorted[outliers];
+                    for_width = robust_width;
+                    for_exceptions = robust_exceptions;
+                    for_size = robust_size;
+                } else {
+                    frame_of(frame, for_exceptions, for_size);
+                }
+            }
+
+            // Deltas wrap modulo 2^64 like the values do, so any sequence round-trips.
+            std::array<uint64_t, GROUP_SIZE> delta_residuals{};
+            delta_residuals[0] = 0;
+            uint64_t min_delta = count > 1 ? values[1] - values[0] : 0;
+            for (uint64_t i = 2; i < count; i++) {
+                const uint64_t delta = values[i] - values[i - 1];
+                if (static_cast<int64_t>(delta) < static_cast<int64_t>(min_delta)) {
+                    min_delta = delta;
+                }
+            }
+            for (uint64_t i = 1; i < count; i++) {
+                delta_residuals[i] = values[i] - values[i - 1] - min_delta;
+            }
+            uint64_t delta_exceptions = 0;
+            uint64_t delta_size = for_size;
+            unsigned delta_width = for_width;
+            if (count > 1) {
+                delta_width = choose_width(delta_residuals.data(), count, delta_exceptions, delta_size);
+            }
+
+            const uint64_t* residuals = for_residuals.data();
+            uint64_t exceptions = for_exceptions;
+            header.mode = group_mode::FOR;
+            header.width = static_cast<uint8_t>(for_width);
+            header.base = frame;
+            if (count > 1 && delta_size < for_size) {
+                residuals = delta_residuals.data();
+                exceptions = delta_exceptions;
+                header.mode = group_mode::DELTA_FOR;
+                header.width = static_cast<uint8_t>(delta_width);
+                header.base = min_delta;
+                header.first = values[0];
+            }
+            header.exception_count = static_cast<uint16_t>(exceptions);
+
+            const uint64_t words = packed_size(count, header.width);
+            const uint64_t start = out.size();
+            out.resize(start + sizeof(group_header_t) + words + exceptions * EXCEPTION_SIZE);
+            auto* ptr = out.data() + start;
+            std::memcpy(ptr, &header, sizeof(group_header_t));
+            ptr += sizeof(group_header_t);
+            pack(residuals, count, header.width, ptr);
+            ptr += words;
+
+            auto* rows = ptr;
+            auto* patches = ptr + exceptions * sizeof(uint16_t);
+            const uint64_t limit = header.width == 64 ? ~uint64_t{0} : (uint64_t{1} << header.width) - 1;
+            for (uint64_t i = 0; i < count; i++) {
+                if (residuals[i] > limit) {
+                    const auto row = static_cast<uint16_t>(i);
+                    std::memcpy(rows, &row, sizeof(uint16_t));
+                    std::memcpy(patches, &residuals[i], sizeof(uint64_t));
+                    rows += sizeof(uint16_t);
+                    patches += sizeof(uint64_t);
+                }
+            }
+        }
+
+        template<typename T>
+        uint64_t encode_typed(const std::byte* data, uint64_t count, std::vector<std::byte>& out) {
+            const auto groups = static_cast<uint32_t>((count + GROUP_SIZE - 1) / GROUP_SIZE);
+            out.clear();
+            out.resize(SEGMENT_HEADER_SIZE + groups * sizeof(uint32_t));
+            const auto total = static_cast<uint32_t>(count);
+            std::memcpy(out.data(), &total, sizeof(uint32_t));
+            std::memcpy(out.data() + sizeof(uint32_t), &groups, sizeof(uint32_t));
+            for (uint32_t group = 0; group < groups; group++) {
+                const auto offset = static_cast<uint32_t>(out.size());
+                std::memcpy(out.data() + SEGMENT_HEADER_SIZE + group * sizeof(uint32_t), &offset, sizeof(uint32_t));
+                const uint64_t first = group * GROUP_SIZE;
+                encode_group<T>(data + first * sizeof(T), std::min(GROUP_SIZE, count - first), out);
+            }
+            return out.size();
+        }
+
+        const std::byte* group_start(const std::byte* segment, uint64_t group) {
+            uint32_t offset;
+            std::memcpy(&offset, segment + SEGMENT_HEADER_SIZE + group * sizeof(uint32_t), sizeof(uint32_t));
+            return segment + offset;
+        }
+
+        uint64_t segment_count(const std::byte* segment) {
+            uint32_t count;
+            std::memcpy(&count, segment, sizeof(uint32_t));
+            return count;
+        }
+
+        // Decodes rows [from, from + count) of one group. FOR unpacks only the blocks the range covers;
+        // DELTA_FOR has to start at the group's first row to rebuild the running sum.
+        template<typename T>
+        void decode_group(const std::byte* group, uint64_t group_rows, uint64_t from, uint64_t count, T* dest) {
+            group_header_t header;
+            std::memcpy(&header, group, sizeof(group_header_t));
+            const auto* words = group + sizeof(group_header_t);
+            const uint64_t block_words = uint64_t{header.width} * sizeof(uint64_t);
+
+            const uint64_t first_block = header.mode == group_mode::FOR ? from / BLOCK_SIZE : 0;
+            const uint64_t end_block = block_count(from + count);
+            std::array<uint64_t, GROUP_SIZE> residuals;
+            const auto unpack = UNPACKERS[header.width];
+            for (uint64_t block = first_block; block < end_block; block++) {
+                unpack(words + block * block_words, residuals.data() + block * BLOCK_SIZE);
+            }
+
+            const auto* rows = words + packed_size(group_rows, header.width);
+            const auto* patches = rows + header.exception_count * sizeof(uint16_t);
+            const uint64_t patch_from = first_block * BLOCK_SIZE;
+            const uint64_t patch_to = from + count;
+            for (uint16_t i = 0; i < header.exception_count; i++) {
+                uint16_t row;
+                std::memcpy(&row, rows + i * sizeof(uint16_t), sizeof(uint16_t));
+                if (row >= patch_from && row < patch_to) {
+                    std::memcpy(&residuals[row], patches + i * sizeof(uint64_t), sizeof(uint64_t));
+                }
+            }
+
+            if (header.mode == group_mode::FOR) {
+                for (uint64_t i = 0; i < count; i++) {
+                    dest[i] = static_cast<T>(header.base + residuals[from + i]);
+                }
+                return;
+            }
+            uint64_t value = header.first;
+            for (uint64_t i = 1; i <= from; i++) {
+                value += header.base + residuals[i];
+            }
+            dest[0] = static_cast<T>(value);
+            for (uint64_t i = 1; i < count; i++) {
+                value += header.base + residuals[from + i];
+                dest[i] = static_cast<T>(value);
+            }
+        }
+
+        template<typename T>
+        void decode_typed(const std::byte* segment, uint64_t offset, uint64_t count, std::byte* dest) {
+            const uint64_t total = segment_count(segment);
+            uint64_t done = 0;
+            while (done < count) {
+                const uint64_t row = offset + done;
+                const uint64_t group = row / GROUP_SIZE;
+                const uint64_t from = row % GROUP_SIZE;
+                const uint64_t group_rows = std::min(GROUP_SIZE, total - group * GROUP_SIZE);
+                const uint64_t take = std::min(group_rows - from, count - done);
+                T values[GROUP_SIZE];
+                decode_group<T>(group_start(segment, group), group_rows, from, take, values);
+                std::memcpy(dest + done * sizeof(T), values, take * sizeof(T));
+                done += take;
+            }
+        }
+
+        template<typename FN>
+        auto dispatch(types::physical_type type, FN&& fn) {
+            switch (type) {
+                case types::physical_type::INT8:
+                    return fn(int8_t{});
+                case types::physical_type::INT16:
+                    return fn(int16_t{});
+                case types::physical_type::INT32:
+                    return fn(int32_t{});
+                case types::physical_type::INT64:
+                    return fn(int64_t{});
+                case types::physical_type::UINT8:
+                    return fn(uint8_t{});
+                case types::physical_type::UINT16:
+                    return fn(uint16_t{});
+                case types::physical_type::UINT32:
+                    return fn(uint32_t{});
+                default:
+                    return fn(uint64_t{});
+            }
+        }
+
+    } // namespace
+
+    bool supports(types::physical_type type) {
+        switch (type) {
+            case types::physical_type::INT8:
+            case types::physical_type::INT16:
+            case types::physical_type::INT32:
+            case types::physical_type::INT64:
+            case types::physical_type::UINT8:
+            case types::physical_type::UINT16:
+            case types::physical_type::UINT32:
+            case types::physical_type::UINT64:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    uint64_t encode(types::physical_type type, const std::byte* data, uint64_t count, std::vector<std::byte>& out) {
+        if (!supports(type) || count == 0) {
+            return 0;
+        }
+        return dispatch(type, [&](auto tag) { return encode_typed<decltype(tag)>(data, count, out); });
+    }
+
+    void decode(types::physical_type type, const std::byte* segment, uint64_t offset, uint64_t count, std::byte* dest) {
+        dispatch(type, [&](auto tag) { decode_typed<decltype(tag)>(segment, offset, count, dest); });
+    }
+
+    uint64_t group_count(const std::byte* segment) {
+        uint32_t groups;
+        std::memcpy(&groups, segment + sizeof(uint32_t), sizeof(uint32_t));
+        return groups;
+    }
+
+    group_header_t group_header(const std::byte* segment, uint64_t group) {
+        group_header_t header;
+        std::memcpy(&header, group_start(segment, group), sizeof(group_header_t));
+        return header;
+    }
+
+    void group_bounds(types::physical_type type,
+                      const std::byte* segment,
+                      uint64_t group,
+                      std::byte* min_dest,
+                      std::byte* max_dest) {
+        const auto header = group_header(segment, group);
+        dispatch(type, [&](auto tag) {
+            using T = decltype(tag);
+            const auto min = static_cast<T>(header.min);
+            const auto max = static_cast<T>(header.max);
+            std::memcpy(min_dest, &min, sizeof(T));
+            std::memcpy(max_dest, &max, sizeof(T));
+        });
+    }
+
+} // namespace components::table::compression::bitpacking
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <components/types/types.hpp>
+
+namespace components::table::compression::bitpacking {
+
+    // BITPACKING segments hold integer (and temporal: DATE, TIME, TIMESTAMP) values in groups of
+    // GROUP_SIZE rows, each encoded on its own so a scan or a fetch only decodes the groups it touches:
+    //   FOR        value = frame + residual                  (ids and other narrow-range columns)
+    //   DELTA_FOR  value = previous + min_delta + residual   (monotonic ids, timestamps)
+    // Residuals are bit-packed at one width per group, 64 rows per block of `width` words. Residuals
+    // wider than the chosen width are patched exceptions (PFOR): the width is the one that minimises
+    // packed bits plus exception entries, so a few outliers do not widen the whole group.
+    //
+    // Layout, all offsets relative to the segment start:
+    //   [uint32_t count][uint32_t group_count][uint32_t group_offset]...
+    //   group: [group_header_t][packed words][uint16_t exception_row]...[uint64_t exception_residual]...
+    // The header also keeps the group's min and max, so filters can accept or reject a whole group
+    // without unpacking it.
+    static constexpr uint64_t GROUP_SIZE = 1024;
+
+    enum class group_mode : uint8_t
+    {
+        FOR = 0,
+        DELTA_FOR = 1
+    };
+
+    struct group_header_t {
+        group_mode mode;
+        uint8_t width;
+        uint16_t exception_count;
+        uint32_t reserved;
+        uint64_t base;  // FOR: the frame; DELTA_FOR: the smallest delta
+        uint64_t first; // DELTA_FOR: value of the group's first row
+        uint64_t min;   // smallest value, widened to 64 bits (sign-extended for signed types)
+        uint64_t max;
+    };
+
+    // Integer physical types of up to 64 bits; everything else stays with the other encodings.
+    bool supports(types::physical_type type);
+
+    // Encodes `count` raw values into `out` and returns the encoded size, 0 for unsupported types.
+    uint64_t encode(types::physical_type type, const std::byte* data, uint64_t count, std::vector<std::byte>& out);
+
+    // Decodes rows [offset, offset + count) of an encoded segment into `dest` as raw values.
+    void decode(types::physical_type type, const std::byte* segment, uint64_t offset, uint64_t count, std::byte* dest);
+
+    uint64_t group_count(const std::byte* segment);
+    group_header_t group_header(const std::byte* segment, uint64_t group);
+
+    // Writes the group's min and max into `min_dest` / `max_dest` as raw values of the segment type.
+    void group_bounds(types::physical_type type,
+                      const std::byte* segment,
+                      uint64_t group,
+                      std::byte* min_dest,
+                      std::byte* max_dest);
+
+} // namespace components::table::compression::bitpacking
@@ -12,7 +12,9 @@ namespace components::table::compression {
         RLE = 3,
         BITPACKING = 4,
         DICTIONARY = 5,
-        VALIDITY_UNCOMPRESSED = 6
+        VALIDITY_UNCOMPRESSED = 6,
+        FSST = 7,
+        ALP = 8
     };
 
 } // namespace components::table::compression
@@ -0,0 +1,267 @@
+#include "fsst.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <unordered_map>
+
+namespace components::table::compression::fsst {
+
+    namespace {
+
+        static constexpr int GENERATIONS = 5;
+        static constexpr uint64_t SAMPLE_BYTES = 16 * 1024;
+
+        const std::byte* symbols_of(const std::byte* segment) { return segment + sizeof(header_t); }
+
+        const uint8_t* lengths_of(const std::byte* segment, const header_t& header) {
+            return reinterpret_cast<const uint8_t*>(symbols_of(segment) + header.symbol_count * sizeof(uint64_t));
+        }
+
+        // Every row while the column is small, otherwise rows drawn at random (with a fixed seed, so a
+        // segment always trains the same table) until the sample holds SAMPLE_BYTES. A fixed stride would
+        // alias with periodic data and miss whole classes of values.
+        std::vector<std::string_view> sample_of(const std::vector<std::string_view>& values, uint64_t total_bytes) {
+            if (total_bytes <= SAMPLE_BYTES) {
+                return values;
+            }
+            std::vector<std::string_view> sample;
+            std::minstd_rand random(SAMPLE_BYTES);
+            uint64_t sampled = 0;
+            while (sampled < SAMPLE_BYTES) {
+                const auto& value = values[random() % values.size()];
+                sample.push_back(value);
+                sampled += std::max<uint64_t>(value.size(), 1);
+            }
+            return sample;
+        }
+
+    } // namespace
+
+    symbol_table_t symbol_table_t::train(const std::vector<std::string_view>& sample) {
+        symbol_table_t table;
+        table.index();
+        for (int generation = 0; generation < GENERATIONS; generation++) {
+            // Compress the sample with the current table, counting the codes and the pairs of adjacent
+            // codes. Codes [0, n) are the symbols, n + b the escaped byte b.
+            const uint64_t n = table.symbols_.size();
+            const uint64_t code_count = n + 256;
+            std::vector<uint64_t> single(code_count, 0);
+            std::unordered_map<uint64_t, uint64_t> pairs;
+            for (auto value : sample) {
+                uint64_t previous = code_count;
+                uint64_t pos = 0;
+                while (pos < value.size()) {
+                    auto [symbol, length] = table.match(value.data() + pos, value.size() - pos);
+                    const uint64_t code = symbol >= 0 ? static_cast<uint64_t>(symbol)
+                                                      : n + static_cast<uint8_t>(value[pos]);
+                    single[code]++;
+                    if (length > 1) {
+                        // keep the byte itself a candidate, in case the symbol loses its place
+                        single[n + static_cast<uint8_t>(value[pos])]++;
+                    }
+                    if (previous != code_count) {
+                        pairs[previous * code_count + code]++;
+                    }
+                    previous = code;
+                    pos += length;
+                }
+            }
+
+            // Candidates are the current codes and their concatenations (cut to MAX_SYMBOL_LENGTH), each
+            // worth the bytes it would cover.
+            std::unordered_map<std::string, uint64_t> gains;
+            for (uint64_t code = 0; code < code_count; code++) {
+                if (single[code] > 0) {
+                    auto symbol = table.text(code);
+                    gains[symbol] += single[code] * symbol.size();
+                }
+            }
+            for (const auto& [pair, frequency] : pairs) {
+                auto symbol = table.text(pair / code_count) + table.text(pair % code_count);
+                if (symbol.size() > MAX_SYMBOL_LENGTH) {
+                    symbol.resize(MAX_SYMBOL_LENGTH);
+                }
+                gains[symbol] += frequency * symbol.size();
+            }
+
+            std::vector<std::pair<std::string, uint64_t>> candidates(gains.begin(), gains.end());
+            std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+                if (a.second != b.second) {
+                    return a.second > b.second;
+                }
+                if (a.first.size() != b.first.size()) {
+                    return a.first.size() > b.first.size();
+                }
+                return a.first < b.first;
+            });
+            candidates.resize(std::min<uint64_t>(candidates.size(), MAX_SYMBOLS));
+
+            table.symbols_.clear();
+            table.lengths_.clear();
+            for (const auto& [symbol, gain] : candidates) {
+                uint64_t packed = 0;
+                std::memcpy(&packed, symbol.data(), symbol.size());
+                table.symbols_.push_back(packed);
+                table.lengths_.push_back(static_cast<uint8_t>(symbol.size()));
+            }
+            table.index();
+        }
+        return table;
+    }
+
+    symbol_table_t symbol_table_t::load(const std::byte* segment) {
+        const auto head = header(segment);
+        symbol_table_t table;
+        table.symbols_.resize(head.symbol_count);
+        std::memcpy(table.symbols_.data(), symbols_of(segment), head.symbol_count * sizeof(uint64_t));
+        const auto* lengths = lengths_of(segment, head);
+        table.lengths_.assign(lengths, lengths + head.symbol_count);
+        table.index();
+        return table;
+    }
+
+    void symbol_table_t::encode(std::string_view value, std::string& out) const {
+        uint64_t pos = 0;
+        while (pos < value.size()) {
+            auto [symbol, length] = match(value.data() + pos, value.size() - pos);
+            if (symbol >= 0) {
+                out.push_back(static_cast<char>(symbol));
+            } else {
+                out.push_back(static_cast<char>(ESCAPE));
+                out.push_back(value[pos]);
+            }
+            pos += length;
+        }
+    }
+
+    void symbol_table_t::index() {
+        for (auto& codes : by_first_) {
+            codes.clear();
+        }
+        for (uint64_t code = 0; code < symbols_.size(); code++) {
+            by_first_[symbols_[code] & 0xFF].push_back(static_cast<uint8_t>(code));
+        }
+        for (auto& codes : by_first_) {
+            std::stable_sort(codes.begin(), codes.end(), [this](uint8_t a, uint8_t b) {
+                return lengths_[a] > lengths_[b];
+            });
+        }
+    }
+
+    std::pair<int, uint32_t> symbol_table_t::match(const char* text, uint64_t size) const {
+        for (auto code : by_first_[static_cast<uint8_t>(text[0])]) {
+            const uint32_t length = lengths_[code];
+            if (length <= size && std::memcmp(&symbols_[code], text, length) == 0) {
+                return {code, length};
+            }
+        }
+        return {-1, 1};
+    }
+
+    std::string symbol_table_t::text(uint64_t code) const {
+        if (code < symbols_.size()) {
+            return std::string(reinterpret_cast<const char*>(&symbols_[code]), lengths_[code]);
+        }
+        return std::string(1, static_cast<char>(code - symbols_.size()));
+    }
+
+    uint64_t encode(const std::vector<std::string_view>& values, uint64_t limit, std::vector<std::byte>& out) {
+        uint64_t total_bytes = 0;
+        for (auto value : values) {
+            total_bytes += value.size();
+        }
+        const auto table = symbol_table_t::train(sample_of(values, total_bytes));
+
+        std::string codes;
+        std::vector<uint32_t> ends(values.size());
+        for (uint64_t i = 0; i < values.size(); i++) {
+            table.encode(values[i], codes);
+            ends[i] = static_cast<uint32_t>(codes.size());
+        }
+
+        header_t head;
+        head.count = static_cast<uint32_t>(values.size());
+        head.symbol_count = static_cast<uint32_t>(table.symbol_count());
+        head.ends_offset =
+            static_cast<uint32_t>(sizeof(header_t) + table.symbol_count() * (sizeof(uint64_t) + sizeof(uint8_t)));
+        head.codes_offset = static_cast<uint32_t>(head.ends_offset + values.size() * sizeof(uint32_t));
+        const uint64_t size = head.codes_offset + codes.size();
+        if (size >= limit) {
+            return 0;
+        }
+
+        out.assign(size, std::byte{0});
+        auto* ptr = out.data();
+        std::memcpy(ptr, &head, sizeof(head));
+        for (uint64_t code = 0; code < table.symbol_count(); code++) {
+            const uint64_t symbol = table.symbol(code);
+            std::memcpy(ptr + sizeof(header_t) + code * sizeof(uint64_t), &symbol, sizeof(uint64_t));
+            ptr[sizeof(header_t) + table.symbol_count() * sizeof(uint64_t) + code] =
+                static_cast<std::byte>(table.symbol_length(code));
+        }
+        std::memcpy(ptr + head.ends_offset, ends.data(), ends.size() * sizeof(uint32_t));
+        std::memcpy(ptr + head.codes_offset, codes.data(), codes.size());
+        return size;
+    }
+
+    header_t header(const std::byte* segment) {
+        header_t result;
+        std::memcpy(&result, segment, sizeof(result));
+        return result;
+    }
+
+    std::string_view codes(const std::byte* segment, const header_t& header, uint64_t row) {
+        const auto* ends = segment + header.ends_offset;
+        uint32_t begin = 0;
+        uint32_t end;
+        if (row > 0) {
+            std::memcpy(&begin, ends + (row - 1) * sizeof(uint32_t), sizeof(uint32_t));
+        }
+        std::memcpy(&end, ends + row * sizeof(uint32_t), sizeof(uint32_t));
+        return std::string_view(reinterpret_cast<const char*>(segment + header.codes_offset + begin), end - begin);
+    }
+
+    void decode(const std::byte* segment, const header_t& header, std::string_view codes, std::string& out) {
+        const auto* symbols = symbols_of(segment);
+        const auto* lengths = lengths_of(segment, header);
+        const auto start = out.size();
+        // Every code yields at most MAX_SYMBOL_LENGTH bytes, so whole symbols are copied unchecked.
+        out.resize(start + codes.size() * MAX_SYMBOL_LENGTH);
+        auto* dest = out.data() + start;
+        for (uint64_t i = 0; i < codes.size(); i++) {
+            const auto code = static_cast<uint8_t>(codes[i]);
+            if (code == ESCAPE) {
+                *dest++ = codes[++i];
+            } else {
+                std::memcpy(dest, symbols + code * sizeof(uint64_t), sizeof(uint64_t));
+                dest += lengths[code];
+            }
+        }
+        out.resize(static_cast<uint64_t>(dest - out.data()));
+    }
+
+    bool
+    starts_with(const std::byte* segment, const header_t& header, std::string_view codes, std::string_view prefix) {
+        const auto* symbols = symbols_of(segment);
+        const auto* lengths = lengths_of(segment, header);
+        uint64_t matched = 0;
+        for (uint64_t i = 0; i < codes.size() && matched < prefix.size(); i++) {
+            const auto code = static_cast<uint8_t>(codes[i]);
+            if (code == ESCAPE) {
+                if (codes[++i] != prefix[matched]) {
+                    return false;
+                }
+                matched++;
+            } else {
+                const uint64_t length = std::min<uint64_t>(lengths[code], prefix.size() - matched);
+                if (std::memcmp(symbols + code * sizeof(uint64_t), prefix.data() + matched, length) != 0) {
+                    return false;
+                }
+                matched += lengths[code];
+            }
+        }
+        return matched >= prefix.size();
+    }
+
+} // namespace components::table::compression::fsst
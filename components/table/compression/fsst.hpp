@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace components::table::compression::fsst {
+
+    // FSST segments compress high-cardinality text (URLs, user agents, log lines) with a table of up to
+    // 255 symbols of one to eight bytes, trained on a sample of the segment's own values. A value becomes
+    // a string of one-byte codes: a symbol's code, or ESCAPE followed by a byte no symbol covers. Every
+    // value is encoded on its own, so a fetch decodes one row and a scan only the rows it returns.
+    //
+    // The encoder is deterministic (greedy longest match), so two values are equal exactly when their
+    // codes are: equality filters compare codes, and prefix filters decode only the codes the prefix
+    // spans.
+    //
+    // Layout, all offsets relative to the segment start:
+    //   [header_t][uint64_t symbol]...(symbol_count)[uint8_t symbol_length]...(symbol_count)
+    //   [uint32_t code_end]...(count)[codes]
+    // Row i's codes span [code_end[i - 1], code_end[i]) of the codes (code_end[-1] = 0).
+    static constexpr uint8_t ESCAPE = 255;
+    static constexpr uint64_t MAX_SYMBOLS = 255;
+    static constexpr uint64_t MAX_SYMBOL_LENGTH = 8;
+
+    struct header_t {
+        uint32_t count;
+        uint32_t symbol_count;
+        uint32_t ends_offset;
+        uint32_t codes_offset;
+    };
+
+    class symbol_table_t {
+    public:
+        // Picks the symbols with the largest gain over a few compress-and-count rounds on `sample`.
+        static symbol_table_t train(const std::vector<std::string_view>& sample);
+        // The table an encoded segment was built with.
+        static symbol_table_t load(const std::byte* segment);
+
+        // Appends the codes of `value` to `out`.
+        void encode(std::string_view value, std::string& out) const;
+
+        uint64_t symbol_count() const { return symbols_.size(); }
+        uint64_t symbol(uint64_t code) const { return symbols_[code]; }
+        uint8_t symbol_length(uint64_t code) const { return lengths_[code]; }
+
+    private:
+        void index();
+        // Code and length of the longest symbol `text` starts with; code -1 when none does.
+        std::pair<int, uint32_t> match(const char* text, uint64_t size) const;
+        std::string text(uint64_t code) const;
+
+        std::vector<uint64_t> symbols_;
+        std::vector<uint8_t> lengths_;
+        // Codes by the symbol's first byte, longest symbol first.
+        std::array<std::vector<uint8_t>, 256> by_first_;
+    };
+
+    // Encodes the row values into `out` and returns the encoded size; 0 when the result would not be
+    // smaller than `limit` bytes.
+    uint64_t encode(const std::vector<std::string_view>& values, uint64_t limit, std::vector<std::byte>& out);
+
+    header_t header(const std::byte* segment);
+
+    std::string_view codes(const std::byte* segment, const header_t& header, uint64_t row);
+
+    // Appends the decoded `codes` to `out`.
+    void decode(const std::byte* segment, const header_t& header, std::string_view codes, std::string& out);
+
+    // Whether the value of `codes` starts with `prefix`; decodes only the codes the prefix spans.
+    bool starts_with(const std::byte* segment, const header_t& header, std::string_view codes, std::string_view prefix);
+
+} // namespace components::table::compression::fsst
@@ -0,0 +1,103 @@
+#include "string_dictionary.hpp"
+
+#include <cstring>
+#include <unordered_map>
+
+namespace components::table::compression::string_dictionary {
+
+    namespace {
+
+        uint32_t index_width(uint64_t entry_count) {
+            if (entry_count <= 0x100) {
+                return 1;
+            }
+            return entry_count <= 0x10000 ? 2 : 4;
+        }
+
+        uint64_t encoded_size(uint64_t count, uint64_t entry_count, uint64_t entry_bytes) {
+            return sizeof(header_t) + entry_count * sizeof(uint32_t) + count * index_width(entry_count) + entry_bytes;
+        }
+
+    } // namespace
+
+    uint64_t encode(const std::vector<std::string_view>& values, uint64_t limit, std::vector<std::byte>& out) {
+        const uint64_t count = values.size();
+        std::unordered_map<std::string_view, uint32_t> mapping;
+        std::vector<std::string_view> entries;
+        std::vector<uint32_t> indices(count);
+        uint64_t entry_bytes = 0;
+        for (uint64_t i = 0; i < count; i++) {
+            auto [it, inserted] = mapping.try_emplace(values[i], static_cast<uint32_t>(entries.size()));
+            if (inserted) {
+                entries.push_back(values[i]);
+                entry_bytes += values[i].size();
+                // Give up as soon as the distinct values alone outgrow the limit.
+                if (encoded_size(count, entries.size(), entry_bytes) >= limit) {
+                    return 0;
+                }
+            }
+            indices[i] = it->second;
+        }
+
+        const uint64_t size = encoded_size(count, entries.size(), entry_bytes);
+        header_t header;
+        header.count = static_cast<uint32_t>(count);
+        header.entry_count = static_cast<uint32_t>(entries.size());
+        header.index_width = index_width(entries.size());
+        header.entries_offset = static_cast<uint32_t>(size - entry_bytes);
+
+        out.assign(size, std::byte{0});
+        auto* ptr = out.data();
+        std::memcpy(ptr, &header, sizeof(header));
+        auto* ends = ptr + sizeof(header_t);
+        auto* rows = ends + entries.size() * sizeof(uint32_t);
+        auto* bytes = ptr + header.entries_offset;
+        uint32_t end = 0;
+        for (uint64_t i = 0; i < entries.size(); i++) {
+            std::memcpy(bytes + end, entries[i].data(), entries[i].size());
+            end += static_cast<uint32_t>(entries[i].size());
+            std::memcpy(ends + i * sizeof(uint32_t), &end, sizeof(uint32_t));
+        }
+        for (uint64_t i = 0; i < count; i++) {
+            // Little-endian: the low `index_width` bytes hold the index.
+            std::memcpy(rows + i * header.index_width, &indices[i], header.index_width);
+        }
+        return size;
+    }
+
+    header_t header(const std::byte* segment) {
+        header_t result;
+        std::memcpy(&result, segment, sizeof(result));
+        return result;
+    }
+
+    uint32_t index(const std::byte* segment, const header_t& header, uint64_t row) {
+        const auto* rows = segment + sizeof(header_t) + uint64_t{header.entry_count} * sizeof(uint32_t);
+        switch (header.index_width) {
+            case 1:
+                return static_cast<uint32_t>(rows[row]);
+            case 2: {
+                uint16_t value;
+                std::memcpy(&value, rows + row * sizeof(uint16_t), sizeof(uint16_t));
+                return value;
+            }
+            default: {
+                uint32_t value;
+                std::memcpy(&value, rows + row * sizeof(uint32_t), sizeof(uint32_t));
+                return value;
+            }
+        }
+    }
+
+    std::string_view entry(const std::byte* segment, const header_t& header, uint32_t entry) {
+        const auto* ends = segment + sizeof(header_t);
+        uint32_t begin = 0;
+        uint32_t end;
+        if (entry > 0) {
+            std::memcpy(&begin, ends + (entry - 1) * sizeof(uint32_t), sizeof(uint32_t));
+        }
+        std::memcpy(&end, ends + entry * sizeof(uint32_t), sizeof(uint32_t));
+        return std::string_view(reinterpret_cast<const char*>(segment + header.entries_offset + begin), end - begin);
+    }
+
+} // namespace components::table::compression::string_dictionary
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace components::table::compression::string_dictionary {
+
+    // DICTIONARY segments of a STRING column keep every distinct value once and one index per row, so a
+    // low-cardinality column (status codes, country names, enum-like tags) costs its distinct values plus
+    // one or two bytes a row. Filters run once per entry and the rows only look up their entry's verdict.
+    //
+    // Layout, all offsets relative to the segment start:
+    //   [header_t][uint32_t entry_end]...(entry_count)[index]...(count, index_width bytes)[entry bytes]
+    // Entry i spans [entry_end[i - 1], entry_end[i]) of the entry bytes (entry_end[-1] = 0).
+    struct header_t {
+        uint32_t count;
+        uint32_t entry_count;
+        uint32_t index_width;
+        uint32_t entries_offset;
+    };
+
+    // Encodes the row values into `out` and returns the encoded size; 0 when the dictionary would not
+    // be smaller than `limit` bytes.
+    uint64_t encode(const std::vector<std::string_view>& values, uint64_t limit, std::vector<std::byte>& out);
+
+    header_t header(const std::byte* segment);
+
+    uint32_t index(const std::byte* segment, const header_t& header, uint64_t row);
+
+    std::string_view entry(const std::byte* segment, const header_t& header, uint32_t entry);
+
+} // namespace components::table::compression::string_dictionary
@@ -3,8 +3,10 @@
 #include <components/table/storage/partial_block_manager.hpp>
 #include <components/vector/data_chunk.hpp>
 #include <components/vector/vector_operations.hpp>
+#include <core/worker_pool/worker_pool.hpp>
 #include <algorithm>
 #include <cstdlib>
+#include <mutex>
 #include <unordered_set>
 
 #include "row_group.hpp"
@@ -156,6 +158,11 @@ namespace components::table {
         if (row_groups_->has_version_above(compact_watermark)) {
             return false;
         }
+        // Nothing to drop: every stamp is visible to all and no row is deleted, so the rebuild would only
+        // rewrite identical data and dirty every row group for the next checkpoint.
+        if (row_groups_->committed_row_count() == total) {
+            return true;
+        }
 
         auto types = row_groups_->types();
         auto new_collection = std::make_shared<collection_t>(
@@ -333,6 +340,132 @@ namespace components::table {
 
     void data_table_t::set_table_name(std::string new_name) { name_ = std::move(new_name); }
 
+    std::vector<std::pair<int64_t, int64_t>>
+    data_table_t::cut_row_group_ranges(int64_t next_row, int64_t max_row, uint64_t min_rows, uint64_t max_ranges) {
+        // Cut against the LIVE tree, like fetch_next_batch never assuming a fixed row_group_size.
+        std::vector<std::pair<int64_t, int64_t>> ranges;
+        auto* tree = row_groups_->row_group_tree();
+        auto l = tree->lock();
+        if (tree->is_empty(l)) {
+            return ranges;
+        }
+        int64_t range_start = next_row;
+        int64_t scanned_to = next_row;
+        for (auto* group = tree->get_segment(l, next_row); group && group->start < max_row;
+             group = tree->next_segment(l, group)) {
+            scanned_to = std::min(group->start + static_cast<int64_t>(group->count.load()), max_row);
+            if (static_cast<uint64_t>(scanned_to - range_start) >= min_rows) {
+                ranges.emplace_back(range_start, scanned_to);
+                range_start = scanned_to;
+                if (max_ranges != 0 && ranges.size() == max_ranges) {
+                    break;
+                }
+            }
+        }
+        if (scanned_to > range_start && (max_ranges == 0 || ranges.size() < max_ranges)) {
+            ranges.emplace_back(range_start, scanned_to);
+        }
+        return ranges;
+    }
+
+    core::result_wrapper_t<bool>
+    data_table_t::fetch_next_batches(const std::pmr::vector<types::complex_logical_type>& types,
+                                     const std::vector<storage_index_t>& column_ids,
+                                     const std::vector<size_t>* projected_cols,
+                                     const table_filter_t* filter,
+                                     transaction_data txn,
+                                     int64_t& next_row,
+                                     int64_t max_row,
+                                     uint64_t max_batches,
+                                     std::pmr::vector<vector::data_chunk_t>& batches,
+                                     bool& drained) {
+        const uint64_t min_rows = std::max<uint64_t>(max_batches, 1) * vector::DEFAULT_VECTOR_CAPACITY;
+        const size_t produced_before = batches.size();
+        // A fully filtered / all-deleted range produces nothing but still advances the position; keep
+        // walking so an empty reply keeps meaning end-of-scan (see fetch_next_batch).
+        while (!drained && batches.size() == produced_before) {
+            auto ranges = next_row < max_row ? cut_row_group_ranges(next_row, max_row, min_rows, 1)
+                                             : std::vector<std::pair<int64_t, int64_t>>{};
+            if (ranges.empty() || ranges.front().second <= next_row) {
+                next_row = max_row;
+                drained = true;
+                break;
+            }
+            table_scan_state state(resource_);
+            initialize_scan_with_offset(state, column_ids, ranges.front().first, ranges.front().second);
+            state.filter = filter;
+            state.table_state.txn = txn;
+            state.local_state.txn = txn;
+            state.table_state.scan_batched(types, projected_cols, batches, resource_);
+            if (state.table_state.has_error()) {
+                return state.table_state.scan_error;
+            }
+            next_row = ranges.front().second;
+            drained = next_row >= max_row;
+        }
+        return true;
+    }
+
+    core::result_wrapper_t<bool> data_table_t::scan_parallel(const std::pmr::vector<types::complex_logical_type>& types,
+                                                             const std::vector<storage_index_t>& column_ids,
+                                                             const std::vector<size_t>* projected_cols,
+                                                             const table_filter_t* filter,
+                                                             transaction_data txn,
+                                                             int64_t& next_row,
+                                                             int64_t max_row,
+                                                             uint64_t max_morsels,
+                                                             uint64_t thread_count,
+                                                             std::pmr::vector<vector::data_chunk_t>& batches) {
+        if (next_row >= max_row) {
+            return true;
+        }
+        auto morsels = cut_row_group_ranges(next_row, max_row, MORSEL_ROW_COUNT, max_morsels);
+        if (morsels.empty()) {
+            next_row = max_row;
+            return true;
+        }
+
+        // One slot per morsel: workers fill distinct slots, so nothing but the counters is shared.
+        std::pmr::vector<std::pmr::vector<vector::data_chunk_t>> slots(morsels.size(), resource_);
+        std::atomic<uint64_t> next_morsel{0};
+        std::atomic<bool> failed{false};
+        std::mutex error_mutex;
+        core::error_t first_error = core::error_t::no_error();
+        auto worker = [&] {
+            for (uint64_t m = next_morsel.fetch_add(1); m < morsels.size(); m = next_morsel.fetch_add(1)) {
+                if (failed.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                // Transient per-morsel state: its pins are released before the worker claims the next one.
+                table_scan_state state(resource_);
+                initialize_scan_with_offset(state, column_ids, morsels[m].first, morsels[m].second);
+                state.filter = filter;
+                state.table_state.txn = txn;
+                state.local_state.txn = txn;
+                state.table_state.scan_batched(types, projected_cols, slots[m], resource_);
+                if (state.table_state.has_error()) {
+                    std::lock_guard guard(error_mutex);
+                    if (!failed.exchange(true)) {
+                        first_error = state.table_state.scan_error;
+                    }
+                    return;
+                }
+            }
+        };
+        const uint64_t workers = std::clamp<uint64_t>(thread_count, 1, morsels.size());
+        core::worker_pool_t::shared().run(workers, [&](uint64_t) { worker(); });
+        if (failed.load()) {
+            return first_error;
+        }
+        for (auto& slot : slots) {
+            for (auto& batch : slot) {
+                batches.push_back(std::move(batch));
+            }
+        }
+        next_row = morsels.back().second;
+        return true;
+    }
+
     void data_table_t::fetch(vector::data_chunk_t& result,
                              const std::vector<storage_index_t>& column_ids,
                              const vector::vector_t& row_identifiers,
@@ -604,9 +737,47 @@ namespace components::table {
         }
 
         writer.flush();
+        release_superseded_blocks(row_group_pointers, writer.manager().block_ids());
         return true;
     }
 
+    void data_table_t::release_superseded_blocks(const std::vector<storage::row_group_pointer_t>& pointers,
+                                                 std::vector<uint64_t> metadata_blocks) {
+        std::vector<uint64_t> current = std::move(metadata_blocks);
+        for (const auto& rgp : pointers) {
+            for (const auto& column : rgp.data_pointers) {
+                for (const auto& dp : column) {
+                    if (dp.block_pointer.block_id < storage::MAXIMUM_BLOCK) {
+                        current.push_back(dp.block_pointer.block_id);
+                    }
+                }
+            }
+        }
+        std::sort(current.begin(), current.end());
+        current.erase(std::unique(current.begin(), current.end()), current.end());
+
+        // Clean row groups carry their blocks over; only the rewritten ones and the previous metadata chain
+        // leave blocks behind. Loaded segments read straight from checkpoint blocks, so those stay until the
+        // segments go away (compact frees them then). mark_as_free keeps every id the durable header may
+        // reference out of the free list until the header of this checkpoint is written, so the previous
+        // checkpoint stays readable until then.
+        auto& block_manager = row_groups_->block_manager();
+        if (!block_manager.in_memory() && !checkpoint_block_ids_.empty()) {
+            std::pmr::vector<uint64_t> live{resource_};
+            row_groups_->collect_disk_block_ids(live);
+            std::sort(live.begin(), live.end());
+            for (uint64_t block_id : checkpoint_block_ids_) {
+                if (std::binary_search(current.begin(), current.end(), block_id) ||
+                    std::binary_search(live.begin(), live.end(), block_id)) {
+                    continue;
+                }
+                block_manager.mark_as_free(block_id);
+                block_manager.unregister_block(block_id);
+            }
+        }
+        checkpoint_block_ids_ = std::move(current);
+    }
+
     core::result_wrapper_t<std::unique_ptr<data_table_t>>
     data_table_t::load_from_disk(std::pmr::memory_resource* resource,
                                  storage::block_manager_t& block_manager,
@@ -629,8 +800,10 @@ namespace components::table {
 
         uint64_t total_loaded_rows = 0;
         auto rg_count = reader.read<uint32_t>();
+        std::vector<storage::row_group_pointer_t> pointers;
+        pointers.reserve(rg_count);
         for (uint32_t i = 0; i < rg_count; i++) {
-            auto pointer = storage::row_group_pointer_t::deserialize(reader);
+            auto& pointer = pointers.emplace_back(storage::row_group_pointer_t::deserialize(reader));
 
             // create a new row group and populate from disk pointer
             auto* rg = table->row_groups_->append_row_group(static_cast<int64_t>(pointer.row_start));
@@ -640,6 +813,7 @@ namespace components::table {
             }
         }
         table->row_groups_->set_total_rows(total_loaded_rows);
+        table->release_superseded_blocks(pointers, reader.manager().block_ids());
 
         // Corrupt-stream check at the load boundary: if any read above ran past the end of the metadata
         // chain, the reader recorded a sticky data_corruption error (reads became no-ops, so `table` may
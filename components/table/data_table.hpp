@@ -8,6 +8,10 @@
 
 namespace components::table {
 
+    // Rows per morsel of a parallel scan. Morsels are cut at row-group boundaries, so a morsel holds
+    // whole row groups adding up to at least this many rows (the tail of the range may be shorter).
+    constexpr uint64_t MORSEL_ROW_COUNT = vector::DEFAULT_VECTOR_CAPACITY * 64;
+
     class data_table_t {
     public:
         data_table_t(std::pmr::memory_resource* resource,
@@ -58,6 +62,41 @@ namespace components::table {
                                                                     int64_t max_row,
                                                                     bool& drained);
 
+        // Read-ahead fetch-next: like fetch_next_batch, but scans a range of whole row groups spanning at
+        // least `max_batches` vectors with ONE continuous scan state, so the seek and the segment pins
+        // are paid once per range instead of once per batch. Appends the range's non-empty batches to
+        // `batches` (keeps walking ranges until one produces rows or the scan drains), then advances
+        // `next_row` past the range. The state still dies before return — no pin survives the call.
+        [[nodiscard]] core::result_wrapper_t<bool>
+        fetch_next_batches(const std::pmr::vector<types::complex_logical_type>& types,
+                           const std::vector<storage_index_t>& column_ids,
+                           const std::vector<size_t>* projected_cols,
+                           const table_filter_t* filter,
+                           transaction_data txn,
+                           int64_t& next_row,
+                           int64_t max_row,
+                           uint64_t max_batches,
+                           std::pmr::vector<vector::data_chunk_t>& batches,
+                           bool& drained);
+
+        // Morsel-driven parallel scan. [next_row, max_row) is cut into morsels (at most `max_morsels`,
+        // 0 = no cap) that `thread_count` workers — the calling thread plus threads of the shared
+        // core::worker_pool_t — claim from a shared counter and scan, filter and project with their
+        // own transient scan state, exactly as scan_batched would. The morsels' batches are appended
+        // to `batches` in row order. On return `next_row` is the row just past the last morsel. The
+        // first buffer-pool OOM / data_corruption stops the remaining morsels and is returned.
+        [[nodiscard]] core::result_wrapper_t<bool>
+        scan_parallel(const std::pmr::vector<types::complex_logical_type>& types,
+                      const std::vector<storage_index_t>& column_ids,
+                      const std::vector<size_t>* projected_cols,
+                      const table_filter_t* filter,
+                      transaction_data txn,
+                      int64_t& next_row,
+                      int64_t max_row,
+                      uint64_t max_morsels,
+                      uint64_t thread_count,
+                      std::pmr::vector<vector::data_chunk_t>& batches);
+
         void fetch(vector::data_chunk_t& result,
                    const std::vector<storage_index_t>& column_ids,
                    const vector::vector_t& row_ids,
@@ -126,6 +165,8 @@ namespace components::table {
         // — otherwise it is a no-op returning false (MVCC: older snapshots and
         // in-flight commits still need the history). True = table is fully
         // compacted (or empty) and safe to checkpoint without version metadata.
+        // A table without committed deletes is already compact and is left as
+        // is, so its clean row groups stay clean for an incremental checkpoint.
         bool compact(uint64_t compact_watermark);
 
         // The checkpoint chain returns out_of_memory when a column flush pin fails;
@@ -144,6 +185,14 @@ namespace components::table {
                                          const std::vector<storage_index_t>& column_ids,
                                          int64_t start_row,
                                          int64_t end_row);
+        // Cuts [next_row, max_row) into ranges of whole row groups of at least `min_rows` rows each
+        // (the last one may be shorter), at most `max_ranges` of them (0 = no cap), against the live tree.
+        std::vector<std::pair<int64_t, int64_t>>
+        cut_row_group_ranges(int64_t next_row, int64_t max_row, uint64_t min_rows, uint64_t max_ranges);
+        // Frees the blocks the previous checkpoint referenced that neither the new one (`pointers` plus its
+        // `metadata_blocks`) nor a live segment still use, then remembers the new checkpoint's blocks.
+        void release_superseded_blocks(const std::vector<storage::row_group_pointer_t>& pointers,
+                                       std::vector<uint64_t> metadata_blocks);
 
         std::pmr::memory_resource* resource_;
         std::vector<column_definition_t> column_definitions_;
@@ -151,6 +200,8 @@ namespace components::table {
         std::shared_ptr<collection_t> row_groups_;
         std::atomic<bool> is_root_;
         std::string name_;
+        // Sorted ids of the data and metadata blocks of the last checkpoint (or the load).
+        std::vector<uint64_t> checkpoint_block_ids_;
     };
 
 } // namespace components::table
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "hyperloglog.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+
+namespace components::table {
+
+    hyperloglog_t::hyperloglog_t(uint8_t precision)
+        : precision_(std::clamp(precision, min_precision, max_precision))
+        , registers_(size_t{1} << precision_, 0) {}
+
+    void hyperloglog_t::add_hash(uint64_t hash) noexcept {
+        const auto index = static_cast<size_t>(hash >> (64 - precision_));
+        const uint64_t rest = hash << precision_;
+        const auto rank =
+            static_cast<uint8_t>(rest == 0 ? 64 - precision_ + 1 : std::countl_zero(rest) + 1);
+        registers_[index] = std::max(registers_[index], rank);
+    }
+
+    void hyperloglog_t::merge(const hyperloglog_t& other) noexcept {
+        if (other.precision_ != precision_) {
+            return;
+        }
+        for (size_t i = 0; i < registers_.size(); ++i) {
+            registers_[i] = std::max(registers_[i], other.registers_[i]);
+        }
+    }
+
+    uint64_t hyperloglog_t::estimate() const noexcept {
+        const auto m = static_cast<double>(registers_.size());
+        double sum = 0;
+        size_t zeros = 0;
+        for (auto r : registers_) {
+            sum += std::ldexp(1.0, -static_cast<int>(r));
+            zeros += r == 0;
+        }
+        const double alpha = 0.7213 / (1 + 1.079 / m);
+        double estimate = alpha * m * m / sum;
+        if (estimate <= 2.5 * m && zeros > 0) {
+            estimate = m * std::log(m / static_cast<double>(zeros));
+        }
+        return static_cast<uint64_t>(std::llround(estimate));
+    }
+
+    std::string hyperloglog_t::serialize() const {
+        std::string out = std::to_string(precision_);
+        out += ':';
+        out.reserve(out.size() + registers_.size());
+        for (auto r : registers_) {
+            out += static_cast<char>('0' + r);
+        }
+        return out;
+    }
+
+    std::optional<hyperloglog_t> hyperloglog_t::deserialize(std::string_view text) {
+        const auto colon = text.find(':');
+        if (colon == std::string_view::npos) {
+            return std::nullopt;
+        }
+        unsigned precision = 0;
+        auto [p, ec] = std::from_chars(text.data(), text.data() + colon, precision);
+        if (ec != std::errc{} || p != text.data() + colon || precision < min_precision ||
+            precision > max_precision) {
+            return std::nullopt;
+        }
+        hyperloglog_t sketch(static_cast<uint8_t>(precision));
+        const auto registers = text.substr(colon + 1);
+        if (registers.size() != sketch.registers_.size()) {
+            return std::nullopt;
+        }
+        for (size_t i = 0; i < registers.size(); ++i) {
+            const int value = registers[i] - '0';
+            if (value < 0 || value > 64 - static_cast<int>(precision) + 1) {
+                return std::nullopt;
+            }
+            sketch.registers_[i] = static_cast<uint8_t>(value);
+        }
+        return sketch;
+    }
+
+    uint64_t hyperloglog_t::mix_hash(uint64_t hash) noexcept {
+        hash ^= hash >> 30;
+        hash *= 0xbf58476d1ce4e5b9ULL;
+        hash ^= hash >> 27;
+        hash *= 0x94d049bb133111ebULL;
+        hash ^= hash >> 31;
+        return hash;
+    }
+
+} // namespace components::table
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace components::table {
+
+    // HyperLogLog distinct-count sketch (Flajolet et al. 2007) over 64-bit hashes,
+    // with linear counting for the small range. 2^precision one-byte registers;
+    // the default precision 11 has a standard error of about 2.3% in 2 KiB.
+    // Sketches of the same precision merge losslessly (register-wise max).
+    class hyperloglog_t {
+    public:
+        static constexpr uint8_t min_precision = 4;
+        static constexpr uint8_t max_precision = 16;
+        static constexpr uint8_t default_precision = 11;
+
+        explicit hyperloglog_t(uint8_t precision = default_precision);
+
+        // `hash` must be well mixed; see mix_hash.
+        void add_hash(uint64_t hash) noexcept;
+        // No-op when the precisions differ.
+        void merge(const hyperloglog_t& other) noexcept;
+        uint64_t estimate() const noexcept;
+
+        uint8_t precision() const noexcept { return precision_; }
+
+        // "<precision>:<one char per register>", registers as '0' + value (values
+        // are <= 64 - precision + 1, so every char is printable ASCII).
+        std::string serialize() const;
+        static std::optional<hyperloglog_t> deserialize(std::string_view text);
+
+        // Finalizer of splitmix64: spreads weak hashes (std::hash of integers is the
+        // identity) over all 64 bits.
+        static uint64_t mix_hash(uint64_t hash) noexcept;
+
+    private:
+        uint8_t precision_;
+        std::vector<uint8_t> registers_;
+    };
+
+} // namespace components::table
@@ -22,6 +22,7 @@ namespace components::table {
     void row_group_t::move_to_collection(collection_t* collection, int64_t new_start) {
         collection_ = collection;
         start = new_start;
+        mark_dirty();
         for (auto& column : columns()) {
             column->set_start(new_start);
         }
@@ -232,6 +233,9 @@ namespace components::table {
         if (auto* set = dynamic_cast<const set_membership_filter_t*>(filter)) {
             return set->contains(element_value);
         }
+        if (auto* bloom = dynamic_cast<const bloom_filter_t*>(filter)) {
+            return bloom->contains(element_value);
+        }
         return filter->cast<constant_filter_t>().compare(element_value);
     }
 
@@ -289,6 +293,14 @@ namespace components::table {
                 return filter->filter_type == expressions::compare_type::is_null ? !is_valid : is_valid;
             }
             default: {
+                // A top-N filter passes everything until the sort fills its top k, and keeps the
+                // NULLs a descending sort puts first.
+                if (auto* top_n = dynamic_cast<const top_n_filter_t*>(filter)) {
+                    if (!top_n->active() ||
+                        (top_n->keeps_nulls() && !get_column(top_n->table_indices.front()).check_validity(row_id))) {
+                        return true;
+                    }
+                }
                 // Works for both constant_filter_t and set_membership_filter_t.
                 const auto& indices = table_filter_table_indices(filter);
                 column_data_t* column = &get_column(indices.front());
@@ -309,35 +321,72 @@ namespace components::table {
         if (!f) {
             return true;
         }
-        // For constant comparison filters, check if any column's zonemap prunes this segment
-        if (f->filter_type == expressions::compare_type::eq || f->filter_type == expressions::compare_type::gt ||
-            f->filter_type == expressions::compare_type::gte || f->filter_type == expressions::compare_type::lt ||
-            f->filter_type == expressions::compare_type::lte) {
-            // Support both constant_filter_t and set_membership_filter_t for zonemap pruning.
-            const auto& cf_indices = table_filter_table_indices(f);
-            if (!cf_indices.empty()) {
-                auto col_idx = cf_indices.front();
-                if (col_idx < get_column_count()) {
-                    auto& col = get_column(col_idx);
-                    column_scan_state dummy;
-                    auto result = col.check_zonemap(dummy, const_cast<table_filter_t&>(*f));
-                    if (result == filter_propagate_result_t::ALWAYS_FALSE) {
-                        next_vector(state);
-                        return false;
-                    }
+        if (zonemap_excludes(f)) {
+            next_vector(state);
+            return false;
+        }
+        return true;
+    }
+
+    bool row_group_t::zonemap_excludes(const table_filter_t* filter) {
+        // An AND fails as soon as one child does — this is how a runtime join filter, ANDed onto
+        // the scan predicate, prunes by its key range.
+        if (filter->filter_type == expressions::compare_type::union_and) {
+            for (const auto& child : filter->cast<conjunction_and_filter_t>().child_filters) {
+                if (zonemap_excludes(child.get())) {
+                    return true;
                 }
             }
+            return false;
         }
-        return true;
+        // For constant comparison filters, check if any column's zonemap prunes this segment
+        if (filter->filter_type != expressions::compare_type::eq &&
+            filter->filter_type != expressions::compare_type::gt &&
+            filter->filter_type != expressions::compare_type::gte &&
+            filter->filter_type != expressions::compare_type::lt &&
+            filter->filter_type != expressions::compare_type::lte) {
+            return false;
+        }
+        // constant_filter_t, set_membership_filter_t and bloom_filter_t all carry a column path.
+        const auto& cf_indices = table_filter_table_indices(filter);
+        if (cf_indices.empty() || cf_indices.front() >= get_column_count()) {
+            return false;
+        }
+        auto& col = get_column(cf_indices.front());
+        column_scan_state dummy;
+        return col.check_zonemap(dummy, const_cast<table_filter_t&>(*filter)) ==
+               filter_propagate_result_t::ALWAYS_FALSE;
     }
 
-    void row_group_t::filter_indexing(std::pmr::memory_resource* resource,
-                                      uint64_t vector_index,
-                                      vector::indexing_vector_t& indexing,
-                                      const table_filter_t* filter,
-                                      uint64_t& approved_tuple_count,
-                                      core::error_t& error) {
-        vector::indexing_vector_t new_indexing(resource, approved_tuple_count);
+    column_data_t* row_group_t::vectorized_filter_column(const table_filter_t* filter) {
+        const auto& indices = table_filter_table_indices(filter);
+        // Sub-column paths (STRUCT fields, LIST/ARRAY elements) are resolved per row.
+        if (indices.size() != 1 || indices.front() >= get_column_count()) {
+            return nullptr;
+        }
+        auto& column = get_column(indices.front());
+        switch (column.type().to_physical_type()) {
+            case types::physical_type::STRUCT:
+            case types::physical_type::LIST:
+            case types::physical_type::ARRAY:
+            case types::physical_type::BIT:
+                return nullptr;
+            default:
+                break;
+        }
+        // The row path overlays in-flight updates per row; keep those columns on it.
+        if (column.has_updates()) {
+            return nullptr;
+        }
+        return &column;
+    }
+
+    void row_group_t::filter_rows(uint64_t vector_index,
+                                  vector::indexing_vector_t& indexing,
+                                  const table_filter_t* filter,
+                                  uint64_t& approved_tuple_count,
+                                  core::error_t& error) {
+        vector::indexing_vector_t new_indexing(indexing.resource(), approved_tuple_count);
         uint64_t result_count = 0;
         for (uint64_t i = 0; i < approved_tuple_count; i++) {
             auto idx = indexing.get_index(i);
@@ -354,6 +403,125 @@ namespace components::table {
         approved_tuple_count = result_count;
     }
 
+    void row_group_t::filter_indexing(std::pmr::memory_resource* resource,
+                                      uint64_t vector_index,
+                                      uint64_t vector_count,
+                                      vector::indexing_vector_t& indexing,
+                                      const table_filter_t* filter,
+                                      uint64_t& approved_tuple_count,
+                                      core::error_t& error) {
+        switch (filter->filter_type) {
+            case expressions::compare_type::union_and: {
+                // Each child only sees the rows its predecessors approved.
+                auto& conjunction_and = filter->cast<conjunction_and_filter_t>();
+                for (auto& child_filter : conjunction_and.child_filters) {
+                    filter_indexing(resource,
+                                    vector_index,
+                                    vector_count,
+                                    indexing,
+                                    child_filter.get(),
+                                    approved_tuple_count,
+                                    error);
+                    if (error.contains_error() || approved_tuple_count == 0) {
+                        return;
+                    }
+                }
+                return;
+            }
+            case expressions::compare_type::union_or:
+            case expressions::compare_type::union_not: {
+                // Each child is evaluated over the rows no earlier child matched; union_or keeps the
+                // matched rows, union_not the rest. Both keep the original row order.
+                auto& conjunction = filter->cast<conjunction_filter_t>();
+                std::pmr::vector<uint8_t> matched(vector_count, 0, resource);
+                vector::indexing_vector_t remaining = indexing;
+                uint64_t remaining_count = approved_tuple_count;
+                for (auto& child_filter : conjunction.child_filters) {
+                    if (remaining_count == 0) {
+                        break;
+                    }
+                    vector::indexing_vector_t child_indexing = remaining;
+                    uint64_t child_count = remaining_count;
+                    filter_indexing(resource,
+                                    vector_index,
+                                    vector_count,
+                                    child_indexing,
+                                    child_filter.get(),
+                                    child_count,
+                                    error);
+                    if (error.contains_error()) {
+                        return;
+                    }
+                    if (child_count == 0) {
+                        continue;
+                    }
+                    for (uint64_t i = 0; i < child_count; i++) {
+                        matched[child_indexing.get_index(i)] = 1;
+                    }
+                    vector::indexing_vector_t next_remaining(resource, remaining_count - child_count);
+                    uint64_t next_count = 0;
+                    for (uint64_t i = 0; i < remaining_count; i++) {
+                        auto idx = remaining.get_index(i);
+                        if (!matched[idx]) {
+                            next_remaining.set_index(next_count++, idx);
+                        }
+                    }
+                    remaining = next_remaining;
+                    remaining_count = next_count;
+                }
+                const uint8_t keep = filter->filter_type == expressions::compare_type::union_or ? 1 : 0;
+                vector::indexing_vector_t new_indexing(resource, approved_tuple_count);
+                uint64_t result_count = 0;
+                for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                    auto idx = indexing.get_index(i);
+                    new_indexing.set_index(result_count, idx);
+                    result_count += matched[idx] == keep;
+                }
+                indexing = new_indexing;
+                approved_tuple_count = result_count;
+                return;
+            }
+            case expressions::compare_type::invalid: {
+                assert(false && "invalid type for filter selection");
+                std::abort();
+            }
+            default:
+                break;
+        }
+        if (auto* top_n = dynamic_cast<const top_n_filter_t*>(filter); top_n && !top_n->active()) {
+            return;
+        }
+        if (auto* column = vectorized_filter_column(filter)) {
+            // Compressed segments answer the filter from their runs / dictionary without decompressing.
+            if (column->filter_compressed(static_cast<int64_t>(vector_index * vector::DEFAULT_VECTOR_CAPACITY),
+                                          vector_count,
+                                          indexing,
+                                          *filter,
+                                          approved_tuple_count,
+                                          error) ||
+                error.contains_error()) {
+                return;
+            }
+            // Otherwise scan the filter column's vector once and run the typed kernel over the candidates.
+            vector::vector_t values(resource, column->type(), vector_count);
+            column_scan_state scan_state;
+            scan_state.initialize(column->type());
+            column->initialize_scan_with_offset(scan_state,
+                                                static_cast<int64_t>(vector_index * vector::DEFAULT_VECTOR_CAPACITY));
+            column->scan_count(scan_state, values, vector_count);
+            if (scan_state.has_error()) {
+                error = scan_state.scan_error;
+                return;
+            }
+            vector::unified_vector_format uvf(resource, vector_count);
+            values.to_unified_format(vector_count, uvf);
+            if (column_segment_t::filter_indexing(indexing, values, uvf, *filter, approved_tuple_count)) {
+                return;
+            }
+        }
+        filter_rows(vector_index, indexing, filter, approved_tuple_count, error);
+    }
+
     template<table_scan_type TYPE>
     void row_group_t::templated_scan(collection_scan_state& state, vector::data_chunk_t& result) {
         constexpr bool ALLOW_UPDATES = TYPE != table_scan_type::COMMITTED_ROWS_DISALLOW_UPDATES;
@@ -430,6 +598,7 @@ namespace components::table {
                     assert(ALLOW_UPDATES);
                     filter_indexing(collection_->resource(),
                                     state.vector_index,
+                                    max_count,
                                     indexing,
                                     filter,
                                     approved_tuple_count,
@@ -560,6 +729,9 @@ namespace components::table {
     }
 
     void row_group_t::append_version_info(transaction_data txn, uint64_t count) {
+        if (count > 0) {
+            mark_dirty();
+        }
         uint64_t row_group_start = this->count.load();
         uint64_t row_group_end = row_group_start + count;
         if (row_group_end > row_group_size()) {
@@ -581,6 +753,7 @@ namespace components::table {
     }
 
     void row_group_t::revert_append(uint64_t row_group_start) {
+        mark_dirty();
         auto vinfo = version_info();
         if (vinfo) {
             vinfo->revert_append(row_group_start);
@@ -607,6 +780,7 @@ namespace components::table {
     core::result_wrapper_t<bool>
     row_group_t::append(row_group_append_state& state, vector::data_chunk_t& chunk, uint64_t append_count) {
         assert(chunk.column_count() == get_column_count());
+        mark_dirty();
         for (uint64_t i = 0; i < get_column_count(); i++) {
             auto& col_data = get_column(i);
             auto prev_allocation_size = col_data.allocation_size();
@@ -625,6 +799,7 @@ namespace components::table {
                                                      uint64_t offset,
                                                      uint64_t count,
                                                      const std::vector<uint64_t>& column_ids) {
+        mark_dirty();
         for (uint64_t i = 0; i < column_ids.size(); i++) {
             auto column = column_ids[i];
             assert(column != std::numeric_limits<uint64_t>::max());
@@ -649,6 +824,7 @@ namespace components::table {
                                                             vector::vector_t& row_ids,
                                                             const std::vector<uint64_t>& column_path) {
         assert(updates.column_count() == 1);
+        mark_dirty();
         auto ids = row_ids.data<int64_t>();
 
         auto primary_column_idx = column_path[0];
@@ -689,6 +865,13 @@ namespace components::table {
         }
     }
 
+    void row_group_t::merge_column_statistics(std::vector<base_statistics_t>& result) {
+        const uint64_t count = std::min<uint64_t>(get_column_count(), result.size());
+        for (uint64_t col_idx = 0; col_idx < count; col_idx++) {
+            result[col_idx].merge(get_column(col_idx).statistics());
+        }
+    }
+
     void row_group_t::collect_disk_block_ids(std::pmr::vector<uint64_t>& out) {
         // Only walk columns already materialized in memory; an unloaded/disk-loaded column is iterated
         // via columns_ lazily by get_column, which is what we want (its segments carry disk block ids).
@@ -731,6 +914,7 @@ namespace components::table {
     };
 
     uint64_t row_group_t::delete_rows(uint64_t vector_idx, int64_t rows[], uint64_t count) {
+        mark_dirty();
         const auto delete_id = ++current_version_;
         auto deleted = get_or_create_version_info().delete_rows(vector_idx, delete_id, rows, count);
         ++current_version_;
@@ -738,6 +922,7 @@ namespace components::table {
     }
 
     uint64_t row_group_t::delete_rows(data_table_t& table, int64_t* ids, uint64_t count, uint64_t transaction_id) {
+        mark_dirty();
         const bool is_txn = transaction_id != 0;
         version_delete_state del_state(*this, transaction_id, table, start, is_txn);
 
@@ -871,6 +1056,12 @@ namespace components::table {
     }
     core::result_wrapper_t<storage::row_group_pointer_t>
     row_group_t::write_to_disk(storage::partial_block_manager_t& partial_block_manager) {
+        if (checkpoint_pointer_ && checkpoint_pointer_->row_start == static_cast<uint64_t>(start) &&
+            checkpoint_pointer_->tuple_count == count &&
+            checkpoint_pointer_->data_pointers.size() == get_column_count()) {
+            return *checkpoint_pointer_;
+        }
+
         storage::row_group_pointer_t pointer;
         pointer.row_start = static_cast<uint64_t>(start);
         pointer.tuple_count = count;
@@ -886,6 +1077,7 @@ namespace components::table {
             pointer.data_pointers[i] = std::move(persistent.value().data_pointers);
         }
 
+        checkpoint_pointer_ = pointer;
         return pointer;
     }
 
@@ -925,6 +1117,7 @@ namespace components::table {
             pcd.data_pointers = pointer.data_pointers[i];
             columns_[i]->initialize_column(pcd);
         }
+        checkpoint_pointer_ = pointer;
     }
 
 } // namespace components::table
\ No newline at end of file
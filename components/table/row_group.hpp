@@ -99,13 +99,16 @@ namespace components::table {
                                                                  const std::vector<uint64_t>& column_path);
 
         void get_column_segment_info(uint64_t row_group_index, std::vector<column_segment_info>& result);
+        // Merge each column's statistics into result[column] (columns past result.size() are skipped).
+        void merge_column_statistics(std::vector<base_statistics_t>& result);
 
         // Append the ids of disk blocks exclusively owned by this row group's columns (and their
         // sub-columns) to `out`, so a compacting caller can free them after swapping the collection.
         void collect_disk_block_ids(std::pmr::vector<uint64_t>& out);
 
         // The checkpoint chain returns out_of_memory when a column flush pin fails;
-        // the row group pointer on success.
+        // the row group pointer on success. A row group unchanged since the previous checkpoint (or since it
+        // was loaded) returns that checkpoint's pointer without rewriting any block.
         [[nodiscard]] core::result_wrapper_t<storage::row_group_pointer_t>
         write_to_disk(storage::partial_block_manager_t& partial_block_manager);
         void create_from_pointer(const storage::row_group_pointer_t& pointer);
@@ -143,17 +146,34 @@ namespace components::table {
         uint64_t get_column_count() const;
         std::vector<std::shared_ptr<column_data_t>>& columns();
 
+        // Narrows `indexing` to the candidate rows of vector `vector_index` that pass `filter`:
+        // conjunctions combine child selections, leaf filters on a plain column run a typed kernel
+        // over that column's vector and anything else falls back to filter_rows.
         void filter_indexing(std::pmr::memory_resource* resource,
                              uint64_t vector_index,
+                             uint64_t vector_count,
                              vector::indexing_vector_t& indexing,
                              const table_filter_t* filter,
                              uint64_t& approved_tuple_count,
                              core::error_t& error);
+        // Row-at-a-time check_predicate over the candidates.
+        void filter_rows(uint64_t vector_index,
+                         vector::indexing_vector_t& indexing,
+                         const table_filter_t* filter,
+                         uint64_t& approved_tuple_count,
+                         core::error_t& error);
+        // The column a leaf filter can be evaluated on vector-wise, or nullptr.
+        column_data_t* vectorized_filter_column(const table_filter_t* filter);
+        // True when the column statistics prove no row of this group passes `filter`.
+        bool zonemap_excludes(const table_filter_t* filter);
 
         template<table_scan_type TYPE>
         void templated_scan(collection_scan_state& state, vector::data_chunk_t& result);
 
         bool has_unloaded_deletes() const;
+        // Any change to the rows or their position drops the persisted pointer, so the next checkpoint
+        // rewrites this row group.
+        void mark_dirty() { checkpoint_pointer_.reset(); }
 
         std::mutex row_group_lock_;
         std::vector<storage::meta_block_pointer_t> column_pointers_;
@@ -161,5 +181,8 @@ namespace components::table {
         std::vector<storage::meta_block_pointer_t> deletes_pointers_;
         std::atomic<bool> deletes_is_loaded_;
         uint64_t allocation_size_;
+        // Where the last checkpoint (or the load) left this row group on disk; empty while it is dirty.
+        // Written by appends, updates and checkpoints, which all run on the owning disk agent's thread.
+        std::optional<storage::row_group_pointer_t> checkpoint_pointer_;
     };
 } // namespace components::table
\ No newline at end of file
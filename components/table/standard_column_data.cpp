@@ -72,6 +72,39 @@ namespace components::table {
         return scan_count;
     }
 
+    bool standard_column_data_t::filter_compressed(int64_t row_idx,
+                                                   uint64_t count,
+                                                   vector::indexing_vector_t& indexing,
+                                                   const table_filter_t& filter,
+                                                   uint64_t& approved_tuple_count,
+                                                   core::error_t& error) {
+        auto* segment = data_.get_segment(row_idx);
+        if (segment->compression() == compression::compression_type::UNCOMPRESSED ||
+            row_idx + static_cast<int64_t>(count) > segment->start + static_cast<int64_t>(segment->count)) {
+            return false;
+        }
+        // NULL rows keep whatever value was appended in their slot; only the validity child marks them.
+        vector::vector_t nulls(resource_, type_, count);
+        column_scan_state validity_state;
+        validity.initialize_scan_with_offset(validity_state, row_idx);
+        validity.scan_count(validity_state, nulls, count);
+        if (validity_state.has_error()) {
+            error = validity_state.scan_error;
+            return false;
+        }
+        auto filtered = segment->filter_compressed(static_cast<uint64_t>(segment->relative_index(row_idx)),
+                                                   count,
+                                                   nulls.validity(),
+                                                   indexing,
+                                                   filter,
+                                                   approved_tuple_count);
+        if (filtered.has_error()) {
+            error = filtered.error();
+            return false;
+        }
+        return filtered.value();
+    }
+
     core::result_wrapper_t<bool> standard_column_data_t::initialize_append(column_append_state& state) {
         auto base = column_data_t::initialize_append(state);
         if (base.has_error()) {
@@ -30,6 +30,12 @@ namespace components::table {
                                 bool allow_updates,
                                 uint64_t target_count) override;
         uint64_t scan_count(column_scan_state& state, vector::vector_t& result, uint64_t count) override;
+        bool filter_compressed(int64_t row_idx,
+                               uint64_t count,
+                               vector::indexing_vector_t& indexing,
+                               const table_filter_t& filter,
+                               uint64_t& approved_tuple_count,
+                               core::error_t& error) override;
 
         [[nodiscard]] core::result_wrapper_t<bool> initialize_append(column_append_state& state) override;
         [[nodiscard]] core::result_wrapper_t<bool>
@@ -90,4 +90,14 @@ namespace components::table::storage {
         }
     }
 
+    std::vector<uint64_t> metadata_manager_t::block_ids() {
+        std::lock_guard lock(lock_);
+        std::vector<uint64_t> result;
+        result.reserve(blocks_.size());
+        for (const auto& mb : blocks_) {
+            result.push_back(mb.block_id);
+        }
+        return result;
+    }
+
 } // namespace components::table::storage
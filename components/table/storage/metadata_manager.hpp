@@ -41,6 +41,10 @@ namespace components::table::storage {
 
         block_manager_t& block_manager() { return block_manager_; }
 
+        // Ids of every block written or pinned through this manager, i.e. the blocks one metadata chain
+        // occupies once it is flushed or fully read.
+        std::vector<uint64_t> block_ids();
+
     private:
         struct metadata_block_t {
             uint64_t block_id;
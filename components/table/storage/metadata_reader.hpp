@@ -40,6 +40,7 @@ namespace components::table::storage {
         }
 
         bool finished() const { return finished_; }
+        metadata_manager_t& manager() { return manager_; }
 
         // Sticky corrupt-stream flag: true once a read ran past the end of the chain.
         bool has_error() const { return error_.contains_error(); }
@@ -28,6 +28,7 @@ namespace components::table::storage {
         }
 
         meta_block_pointer_t get_block_pointer() const { return start_pointer_; }
+        metadata_manager_t& manager() { return manager_; }
 
         void flush();
 
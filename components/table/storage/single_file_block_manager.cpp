@@ -1,5 +1,6 @@
 #include "single_file_block_manager.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <stdexcept>
@@ -13,6 +14,19 @@
 
 namespace components::table::storage {
 
+    namespace {
+        uint64_t header_checksum(database_header_t header) {
+            header.checksum = 0;
+            return static_cast<uint64_t>(static_cast<uint32_t>(
+                absl::ComputeCrc32c({reinterpret_cast<const char*>(&header), sizeof(header)})));
+        }
+
+        // Headers written before checksums were introduced carry 0 and are trusted as they are.
+        bool header_is_intact(const database_header_t& header) {
+            return header.checksum == 0 || header.checksum == header_checksum(header);
+        }
+    } // namespace
+
     single_file_block_manager_t::single_file_block_manager_t(buffer_manager_t& buffer_manager,
                                                              core::filesystem::local_file_system_t& fs,
                                                              const std::string& path,
@@ -49,6 +63,7 @@ namespace components::table::storage {
         database_header_t db_header;
         db_header.initialize();
         db_header.block_alloc_size = block_allocation_size();
+        db_header.checksum = header_checksum(db_header);
         handle_->write(&db_header, sizeof(db_header), SECTOR_SIZE);
         handle_->write(&db_header, sizeof(db_header), 2 * SECTOR_SIZE);
 
@@ -93,7 +108,15 @@ namespace components::table::storage {
                                  std::pmr::string{"Failed to read database header 2", buffer_manager.resource()});
         }
 
-        const database_header_t& active = (header1.iteration >= header2.iteration) ? header1 : header2;
+        // A crash while writing one slot leaves the other one holding the previous checkpoint.
+        const bool intact1 = header_is_intact(header1);
+        const bool intact2 = header_is_intact(header2);
+        if (!intact1 && !intact2) {
+            return core::error_t(core::error_code_t::data_corruption,
+                                 std::pmr::string{"Both database headers are corrupt", buffer_manager.resource()});
+        }
+        const database_header_t& active =
+            (intact1 && (!intact2 || header1.iteration >= header2.iteration)) ? header1 : header2;
 
         iteration_ = active.iteration;
         meta_block_ = active.meta_block;
@@ -145,6 +168,7 @@ namespace components::table::storage {
             block_id = max_block_++;
         }
         used_blocks_.insert(block_id);
+        fresh_blocks_.insert(block_id);
         return block_id;
     }
 
@@ -164,7 +188,11 @@ namespace components::table::storage {
         std::lock_guard lock(allocation_lock_);
         used_blocks_.erase(block_id);
         modified_blocks_.erase(block_id);
-        free_list_.insert(block_id);
+        if (fresh_blocks_.erase(block_id) > 0) {
+            free_list_.insert(block_id);
+        } else {
+            pending_free_.insert(block_id);
+        }
     }
 
     void single_file_block_manager_t::mark_as_used(uint64_t block_id) {
@@ -250,16 +278,17 @@ namespace components::table::storage {
         write_header.block_count = max_block_;
         write_header.block_alloc_size = block_allocation_size();
         write_header.meta_block = meta_block_;
+        write_header.checksum = header_checksum(write_header);
 
-        // double-header protocol: alternate between slot 1 and slot 2
+        // double-header protocol: alternate between slot 1 and slot 2, leaving the previous header untouched
         uint64_t slot = (iteration_ % 2 == 1) ? SECTOR_SIZE : (2 * SECTOR_SIZE);
         handle_->write(&write_header, sizeof(write_header), slot);
         handle_->sync();
 
-        // write to the other slot as well for redundancy
-        uint64_t other_slot = (slot == SECTOR_SIZE) ? (2 * SECTOR_SIZE) : SECTOR_SIZE;
-        handle_->write(&write_header, sizeof(write_header), other_slot);
-        handle_->sync();
+        std::lock_guard lock(allocation_lock_);
+        free_list_.insert(pending_free_.begin(), pending_free_.end());
+        pending_free_.clear();
+        fresh_blocks_.clear();
     }
 
     void single_file_block_manager_t::file_sync() {
@@ -278,16 +307,45 @@ namespace components::table::storage {
     // --- Free List Persistence ---
 
     meta_block_pointer_t single_file_block_manager_t::serialize_free_list() {
-        if (free_list_.empty()) {
+        for (auto block_id : free_list_blocks_) {
+            mark_as_free(block_id);
+        }
+        free_list_blocks_.clear();
+
+        // Persist what is free once the header lands: the free list plus the blocks pending release. The
+        // chain's first block is taken from the free list (no durable header references it) and left out of
+        // the entries; free_list_ is otherwise empty while writing, so any further chain block is appended at
+        // the end of the file and never overlaps a block it lists.
+        std::set<uint64_t> reusable;
+        std::vector<uint64_t> entries;
+        {
+            std::lock_guard lock(allocation_lock_);
+            reusable.swap(free_list_);
+            if (!reusable.empty()) {
+                free_list_.insert(reusable.extract(reusable.begin()));
+            }
+            entries.assign(reusable.begin(), reusable.end());
+            entries.insert(entries.end(), pending_free_.begin(), pending_free_.end());
+        }
+        if (entries.empty()) {
+            std::lock_guard lock(allocation_lock_);
+            free_list_.merge(reusable);
             return meta_block_pointer_t{}; // INVALID_INDEX
         }
+        std::sort(entries.begin(), entries.end());
+
         metadata_manager_t meta_mgr(*this);
         metadata_writer_t writer(meta_mgr);
-        writer.write<uint64_t>(free_list_.size());
-        for (auto block_id : free_list_) {
+        writer.write<uint64_t>(entries.size());
+        for (auto block_id : entries) {
             writer.write<uint64_t>(block_id);
         }
         writer.flush();
+        {
+            std::lock_guard lock(allocation_lock_);
+            free_list_.merge(reusable);
+        }
+        free_list_blocks_ = meta_mgr.block_ids();
         return writer.get_block_pointer();
     }
 
@@ -301,6 +359,7 @@ namespace components::table::storage {
         for (uint64_t i = 0; i < count && !reader.finished(); ++i) {
             free_list_.insert(reader.read<uint64_t>());
         }
+        free_list_blocks_ = meta_mgr.block_ids();
         // Corrupt free-list chain (read past end) -> data_corruption, surfaced at the load boundary
         // instead of throwing.
         if (reader.has_error()) {
@@ -5,6 +5,7 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <vector>
 
 #include "block_manager.hpp"
 #include "buffer_manager.hpp"
@@ -95,8 +96,13 @@ namespace components::table::storage {
         void file_sync() override;
         void truncate() override;
 
+        // Shadow paging: writes the next iteration into the header slot the previous one did NOT use, so a
+        // torn write leaves the other slot (the previous checkpoint) intact; load picks the newest slot whose
+        // checksum verifies. Blocks released since the previous header become reusable once it is on disk.
         void write_header(const database_header_t& header);
 
+        // The chain holding the list never overlaps the blocks it lists, and the previous list's chain is
+        // released with the next header.
         meta_block_pointer_t serialize_free_list();
         [[nodiscard]] core::result_wrapper_t<bool> deserialize_free_list(meta_block_pointer_t pointer);
 
@@ -115,6 +121,14 @@ namespace components::table::storage {
         std::set<uint64_t> free_list_;
         std::set<uint64_t> used_blocks_;
         std::set<uint64_t> modified_blocks_;
+        // Blocks allocated since the last header: no durable checkpoint references them, so freeing one
+        // returns it to free_list_ at once.
+        std::set<uint64_t> fresh_blocks_;
+        // Blocks the durable checkpoint may still reference, freed since the last header. They join
+        // free_list_ only after the next header is written, so a checkpoint never overwrites its predecessor.
+        std::set<uint64_t> pending_free_;
+        // Metadata blocks holding the serialized free list of the latest header.
+        std::vector<uint64_t> free_list_blocks_;
         uint64_t max_block_{0};
         uint64_t iteration_{0};
         uint64_t meta_block_{INVALID_INDEX};
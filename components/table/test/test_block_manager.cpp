@@ -270,6 +270,80 @@ TEST_CASE("single_file_block_manager: empty free list persistence") {
     cleanup_test_file();
 }
 
+TEST_CASE("single_file_block_manager: blocks of the durable checkpoint are reused only after the next header") {
+    using namespace components::table::storage;
+    cleanup_test_file();
+
+    test_env_t env;
+    single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+    REQUIRE(!bm.create_new_database().has_error());
+
+    uint64_t durable = bm.free_block_id();
+    uint64_t fresh = bm.free_block_id();
+    database_header_t header;
+    header.initialize();
+    bm.write_header(header);
+
+    // Allocated after the header: nothing durable references it, so it is reusable at once.
+    uint64_t scratch = bm.free_block_id();
+    bm.mark_as_free(scratch);
+    REQUIRE(bm.free_blocks() == 1);
+    REQUIRE(bm.free_block_id() == scratch);
+
+    // Referenced by the durable header: held back until the next one is written.
+    bm.mark_as_free(durable);
+    REQUIRE(bm.free_blocks() == 0);
+    REQUIRE(bm.free_block_id() != durable);
+    bm.write_header(header);
+    REQUIRE(bm.free_blocks() == 1);
+    REQUIRE(bm.free_block_id() == durable);
+    REQUIRE(fresh != durable);
+
+    cleanup_test_file();
+}
+
+TEST_CASE("single_file_block_manager: torn newest header falls back to the previous one") {
+    using namespace components::table::storage;
+    cleanup_test_file();
+
+    test_env_t env;
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        REQUIRE(!bm.create_new_database().has_error());
+        database_header_t header;
+        header.initialize();
+        bm.set_meta_block(7);
+        bm.write_header(header); // iteration 1 -> slot 1
+        bm.set_meta_block(9);
+        bm.write_header(header); // iteration 2 -> slot 2
+    }
+
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        REQUIRE(!bm.load_existing_database().has_error());
+        REQUIRE(bm.meta_block() == 9);
+    }
+
+    // Damage the meta_block field of slot 2 as a torn write would.
+    {
+        std::fstream f(test_db_path(), std::ios::in | std::ios::out | std::ios::binary);
+        REQUIRE(f.is_open());
+        uint64_t garbage = 0xABABABABABABABABull;
+        f.seekp(2 * SECTOR_SIZE + sizeof(uint64_t));
+        f.write(reinterpret_cast<const char*>(&garbage), sizeof(garbage));
+        f.flush();
+        REQUIRE(f.good());
+    }
+
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        REQUIRE(!bm.load_existing_database().has_error());
+        REQUIRE(bm.meta_block() == 7);
+    }
+
+    cleanup_test_file();
+}
+
 // ---------------------------------------------------------------------------
 // Error-VALUE regression tests: the converted paths return a
 // core::result_wrapper_t carrying core::error_code_t::{data_corruption,io_error}
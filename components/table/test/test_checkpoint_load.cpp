@@ -8,7 +8,10 @@
 #include <components/table/storage/standard_buffer_manager.hpp>
 #include <core/file/local_file_system.hpp>
 
+#include <cmath>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <unistd.h>
 
 namespace {
@@ -104,6 +107,126 @@ namespace {
             offset += batch;
         }
     }
+
+    // Whether the checkpoint stored every data segment of `column` (validity
+    // segments left out) with `type`.
+    bool all_segments_use(components::table::data_table_t& table,
+                          uint64_t column,
+                          components::table::compression::compression_type type) {
+        const auto path = "[" + std::to_string(column) + "]";
+        uint64_t segments = 0;
+        for (const auto& info : table.get_column_segment_info()) {
+            if (info.column_path != path) {
+                continue;
+            }
+            if (info.compression != type) {
+                return false;
+            }
+            ++segments;
+        }
+        return segments > 0;
+    }
+
+    // Fills slot `i` of `chunk` with the values of table row `row`.
+    using row_setter_t = std::function<void(components::vector::data_chunk_t& chunk, uint64_t i, uint64_t row)>;
+    // Checks slot `i` of a scanned `chunk` against table row `row`.
+    using row_checker_t = std::function<void(components::vector::data_chunk_t& chunk, uint64_t i, uint64_t row)>;
+
+    // Appends `num_rows` rows made by `set_row` to a table of `columns`, checkpoints it into a fresh
+    // database file, loads it back and hands the loaded table to `check`.
+    void checkpoint_and_reload(test_env_t& env,
+                               std::vector<components::table::column_definition_t> columns,
+                               const std::string& name,
+                               uint64_t num_rows,
+                               const row_setter_t& set_row,
+                               const std::function<void(components::table::data_table_t&)>& check) {
+        using namespace components::table;
+        using namespace components::table::storage;
+        using namespace components::vector;
+        cleanup_test_file();
+
+        meta_block_pointer_t table_pointer;
+        {
+            single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+            REQUIRE(!bm.create_new_database().has_error());
+            auto table = std::make_unique<data_table_t>(&env.resource, bm, std::move(columns), name);
+
+            for (uint64_t offset = 0; offset < num_rows; offset += DEFAULT_VECTOR_CAPACITY) {
+                uint64_t batch = std::min(num_rows - offset, uint64_t(DEFAULT_VECTOR_CAPACITY));
+                data_chunk_t chunk(&env.resource, table->copy_types(), batch);
+                chunk.set_cardinality(batch);
+                for (uint64_t i = 0; i < batch; i++) {
+                    set_row(chunk, i, offset + i);
+                }
+                table_append_state state(&env.resource);
+                REQUIRE_FALSE(table->append_lock(state).has_error());
+                REQUIRE_FALSE(table->initialize_append(state).has_error());
+                REQUIRE_FALSE(table->append(chunk, state).has_error());
+                table->finalize_append(state, transaction_data{0, 0});
+            }
+
+            metadata_manager_t meta_mgr(bm);
+            metadata_writer_t writer(meta_mgr);
+            REQUIRE_FALSE(table->checkpoint(writer).has_error());
+            table_pointer = writer.get_block_pointer();
+
+            database_header_t header;
+            header.initialize();
+            bm.write_header(header);
+        }
+        {
+            single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+            REQUIRE(!bm.load_existing_database().has_error());
+
+            metadata_manager_t meta_mgr(bm);
+            metadata_reader_t reader(meta_mgr, table_pointer);
+            auto loaded_result = data_table_t::load_from_disk(&env.resource, bm, reader);
+            REQUIRE(!loaded_result.has_error());
+            check(*loaded_result.value());
+        }
+
+        cleanup_test_file();
+    }
+
+    // Scans every column of `table` (`num_rows` rows) with `filter` pushed down and requires
+    // exactly the rows `expected` accepts, in row order, each verified by `check_row`.
+    void check_scan(components::table::data_table_t& table,
+                    std::pmr::memory_resource* resource,
+                    uint64_t num_rows,
+                    const components::table::table_filter_t* filter,
+                    const std::function<bool(uint64_t)>& expected,
+                    const row_checker_t& check_row) {
+        using namespace components::table;
+        using namespace components::vector;
+
+        std::vector<storage_index_t> column_indices;
+        for (uint64_t column = 0; column < table.column_count(); column++) {
+            column_indices.emplace_back(column);
+        }
+        table_scan_state state(resource);
+        table.initialize_scan(state, column_indices, filter);
+        std::pmr::vector<data_chunk_t> batches(resource);
+        table.scan_batched(table.copy_types(), nullptr, batches, state, resource);
+
+        uint64_t row = 0;
+        uint64_t matched = 0;
+        for (auto& batch : batches) {
+            for (uint64_t i = 0; i < batch.size(); i++, matched++) {
+                while (!expected(row)) {
+                    row++;
+                    // A row the filter should have dropped came back.
+                    REQUIRE(row < num_rows);
+                }
+                check_row(batch, i, row);
+                row++;
+            }
+        }
+        uint64_t expected_count = 0;
+        for (uint64_t i = 0; i < num_rows; i++) {
+            expected_count += expected(i);
+        }
+        REQUIRE(matched == expected_count);
+    }
 } // namespace
 
 TEST_CASE("checkpoint_load: single INT64 column, 1000 rows") {
@@ -420,6 +543,8 @@ TEST_CASE("checkpoint_load: CONSTANT compression — all identical values") {
         REQUIRE(!loaded_result.has_error());
         auto& loaded = loaded_result.value();
 
+        REQUIRE(all_segments_use(*loaded, 0, compression::compression_type::CONSTANT));
+
         REQUIRE(loaded->table_name() == "const_table");
         uint64_t scanned = 0;
         loaded->scan_table_segment(0, NUM_ROWS, [&](data_chunk_t& chunk) {
@@ -480,6 +605,8 @@ TEST_CASE("checkpoint_load: RLE compression — sorted runs") {
         REQUIRE(!loaded_result.has_error());
         auto& loaded = loaded_result.value();
 
+        REQUIRE(all_segments_use(*loaded, 0, compression::compression_type::RLE));
+
         uint64_t scanned = 0;
         loaded->scan_table_segment(0, NUM_ROWS, [&](data_chunk_t& chunk) {
             for (uint64_t i = 0; i < chunk.size(); i++) {
@@ -515,9 +642,9 @@ TEST_CASE("checkpoint_load: DICTIONARY compression — low cardinality cycling")
         columns.emplace_back("value", logical_type::BIGINT);
         auto table = std::make_unique<data_table_t>(&env.resource, bm, std::move(columns), "dict_table");
 
-        // cycle through 5 values: 1,2,3,4,5,1,2,3,...
+        // cycle through 5 values far apart (bit-packing them would take ~33 bits per row)
         append_int64_data_with_fn(*table, &env.resource, NUM_ROWS, [](uint64_t idx) {
-            return static_cast<int64_t>(idx % 5 + 1);
+            return static_cast<int64_t>(idx % 5 + 1) * 1'000'000'007;
         });
         REQUIRE(table->calculate_size() == NUM_ROWS);
 
@@ -541,11 +668,13 @@ TEST_CASE("checkpoint_load: DICTIONARY compression — low cardinality cycling")
         REQUIRE(!loaded_result.has_error());
         auto& loaded = loaded_result.value();
 
+        REQUIRE(all_segments_use(*loaded, 0, compression::compression_type::DICTIONARY));
+
         uint64_t scanned = 0;
         loaded->scan_table_segment(0, NUM_ROWS, [&](data_chunk_t& chunk) {
             for (uint64_t i = 0; i < chunk.size(); i++) {
                 uint64_t global_idx = scanned + i;
-                int64_t expected = static_cast<int64_t>(global_idx % 5 + 1);
+                int64_t expected = static_cast<int64_t>(global_idx % 5 + 1) * 1'000'000'007;
                 REQUIRE(chunk.data[0].value(i).value<int64_t>() == expected);
             }
             scanned += chunk.size();
@@ -556,6 +685,357 @@ TEST_CASE("checkpoint_load: DICTIONARY compression — low cardinality cycling")
     cleanup_test_file();
 }
 
+TEST_CASE("checkpoint_load: filters evaluated on CONSTANT / RLE / DICTIONARY segments") {
+    using namespace components::table;
+    using namespace components::types;
+    using namespace components::vector;
+    using components::expressions::compare_type;
+
+    test_env_t env;
+    constexpr uint64_t NUM_ROWS = DEFAULT_VECTOR_CAPACITY * 2 + 500;
+    auto constant_of = [](uint64_t) { return int64_t{7}; };
+    auto rle_of = [](uint64_t idx) { return static_cast<int64_t>(idx / 300); };
+    auto dict_of = [](uint64_t idx) { return static_cast<int64_t>(idx % 5) * 1'000'000'007; };
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("constant", logical_type::BIGINT);
+    columns.emplace_back("rle", logical_type::BIGINT);
+    columns.emplace_back("dict", logical_type::BIGINT);
+    auto set_row = [&](data_chunk_t& chunk, uint64_t i, uint64_t row) {
+        chunk.set_value(0, i, logical_value_t{&env.resource, constant_of(row)});
+        chunk.set_value(1, i, logical_value_t{&env.resource, rle_of(row)});
+        chunk.set_value(2, i, logical_value_t{&env.resource, dict_of(row)});
+    };
+
+    checkpoint_and_reload(env, std::move(columns), "filter_table", NUM_ROWS, set_row, [&](data_table_t& loaded) {
+        // The sections below exercise each segment kind's own filter path.
+        REQUIRE(all_segments_use(loaded, 0, compression::compression_type::CONSTANT));
+        REQUIRE(all_segments_use(loaded, 1, compression::compression_type::RLE));
+        REQUIRE(all_segments_use(loaded, 2, compression::compression_type::DICTIONARY));
+
+        auto column_path = [&](uint64_t column) { return std::pmr::vector<uint64_t>(1, column, &env.resource); };
+        auto check_row = [&](data_chunk_t& batch, uint64_t i, uint64_t row) {
+            INFO("row=" << row);
+            REQUIRE(batch.data[1].value(i).value<int64_t>() == rle_of(row));
+            REQUIRE(batch.data[2].value(i).value<int64_t>() == dict_of(row));
+        };
+        auto scan = [&](const table_filter_t* filter, const std::function<bool(uint64_t)>& expected) {
+            check_scan(loaded, &env.resource, NUM_ROWS, filter, expected, check_row);
+        };
+
+        SECTION("CONSTANT segment accepted or rejected whole") {
+            constant_filter_t accept(compare_type::eq, logical_value_t{&env.resource, int64_t{7}}, column_path(0));
+            scan(&accept, [](uint64_t) { return true; });
+            constant_filter_t reject(compare_type::gt, logical_value_t{&env.resource, int64_t{7}}, column_path(0));
+            scan(&reject, [](uint64_t) { return false; });
+        }
+
+        SECTION("RLE segment evaluated per run") {
+            constant_filter_t filter(compare_type::lte, logical_value_t{&env.resource, int64_t{4}}, column_path(1));
+            scan(&filter, [&](uint64_t i) { return rle_of(i) <= 4; });
+        }
+
+        SECTION("DICTIONARY segment evaluated per entry") {
+            constant_filter_t filter(compare_type::ne, logical_value_t{&env.resource, dict_of(2)}, column_path(2));
+            scan(&filter, [&](uint64_t i) { return dict_of(i) != dict_of(2); });
+
+            std::pmr::vector<logical_value_t> values(&env.resource);
+            values.emplace_back(&env.resource, dict_of(0));
+            values.emplace_back(&env.resource, dict_of(3));
+            set_membership_filter_t in_list(std::move(values), column_path(2));
+            scan(&in_list, [&](uint64_t i) { return i % 5 == 0 || i % 5 == 3; });
+        }
+    });
+}
+
+TEST_CASE("checkpoint_load: BITPACKING compression — ids, timestamps and outliers") {
+    using namespace components::table;
+    using namespace components::types;
+    using namespace components::vector;
+    using components::expressions::compare_type;
+
+    test_env_t env;
+    constexpr uint64_t NUM_ROWS = DEFAULT_VECTOR_CAPACITY * 30 + 77;
+    // Monotonic ids (delta), timestamps one second apart with jitter (delta), and small codes with a
+    // rare huge outlier (frame of reference with patched exceptions).
+    auto id_of = [](uint64_t idx) { return static_cast<int64_t>(1'000'000 + idx); };
+    auto ts_of = [](uint64_t idx) { return static_cast<int64_t>(800'000'000'000'000 + idx * 1'000'000 + idx % 7); };
+    auto code_of = [](uint64_t idx) {
+        return idx % 500 == 13 ? int32_t{2'000'000'000} : static_cast<int32_t>((idx * 2654435761u) % 97);
+    };
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("id", logical_type::BIGINT);
+    columns.emplace_back("ts", logical_type::TIMESTAMP);
+    columns.emplace_back("code", logical_type::INTEGER);
+    auto set_row = [&](data_chunk_t& chunk, uint64_t i, uint64_t row) {
+        chunk.set_value(0, i, logical_value_t{&env.resource, id_of(row)});
+        chunk.set_value(1,
+                        i,
+                        logical_value_t{&env.resource, core::date::timestamp_t{core::date::microseconds{ts_of(row)}}});
+        chunk.set_value(2, i, logical_value_t{&env.resource, code_of(row)});
+    };
+
+    checkpoint_and_reload(env, std::move(columns), "events", NUM_ROWS, set_row, [&](data_table_t& loaded) {
+        REQUIRE(all_segments_use(loaded, 0, compression::compression_type::BITPACKING));
+        REQUIRE(all_segments_use(loaded, 1, compression::compression_type::BITPACKING));
+        REQUIRE(all_segments_use(loaded, 2, compression::compression_type::BITPACKING));
+
+        uint64_t scanned = 0;
+        loaded.scan_table_segment(0, NUM_ROWS, [&](data_chunk_t& chunk) {
+            for (uint64_t i = 0; i < chunk.size(); i++) {
+                const uint64_t row = scanned + i;
+                INFO("row=" << row);
+                REQUIRE(chunk.data[0].value(i).value<int64_t>() == id_of(row));
+                REQUIRE(chunk.data[1].value(i).value<core::date::timestamp_t>().value.count() == ts_of(row));
+                REQUIRE(chunk.data[2].value(i).value<int32_t>() == code_of(row));
+            }
+            scanned += chunk.size();
+        });
+        REQUIRE(scanned == NUM_ROWS);
+
+        auto column_path = [&](uint64_t column) { return std::pmr::vector<uint64_t>(1, column, &env.resource); };
+        auto check_row = [&](data_chunk_t& batch, uint64_t i, uint64_t row) {
+            INFO("row=" << row);
+            REQUIRE(batch.data[0].value(i).value<int64_t>() == id_of(row));
+            REQUIRE(batch.data[2].value(i).value<int32_t>() == code_of(row));
+        };
+        auto scan = [&](const table_filter_t* filter, const std::function<bool(uint64_t)>& expected) {
+            check_scan(loaded, &env.resource, NUM_ROWS, filter, expected, check_row);
+        };
+
+        SECTION("range on ids: whole groups taken or skipped from their bounds") {
+            constant_filter_t from(compare_type::gte, logical_value_t{&env.resource, id_of(5000)}, column_path(0));
+            scan(&from, [](uint64_t i) { return i >= 5000; });
+            constant_filter_t below(compare_type::lt, logical_value_t{&env.resource, id_of(1500)}, column_path(0));
+            scan(&below, [](uint64_t i) { return i < 1500; });
+        }
+
+        SECTION("point lookup on ids") {
+            constant_filter_t eq(compare_type::eq, logical_value_t{&env.resource, id_of(40'000)}, column_path(0));
+            scan(&eq, [](uint64_t i) { return i == 40'000; });
+        }
+
+        SECTION("codes with patched outliers") {
+            constant_filter_t gt(compare_type::gt, logical_value_t{&env.resource, int32_t{90}}, column_path(2));
+            scan(&gt, [&](uint64_t i) { return code_of(i) > 90; });
+
+            std::pmr::vector<logical_value_t> values(&env.resource);
+            values.emplace_back(&env.resource, int32_t{2'000'000'000});
+            values.emplace_back(&env.resource, int32_t{5});
+            set_membership_filter_t in_list(std::move(values), column_path(2));
+            scan(&in_list, [&](uint64_t i) { return code_of(i) == 2'000'000'000 || code_of(i) == 5; });
+        }
+    });
+}
+
+TEST_CASE("checkpoint_load: STRING compression — DICTIONARY statuses and FSST urls") {
+    using namespace components::table;
+    using namespace components::types;
+    using namespace components::vector;
+    using components::expressions::compare_type;
+
+    test_env_t env;
+    // The last row group is partial but still holds enough distinct urls for FSST to pay off.
+    constexpr uint64_t NUM_ROWS = DEFAULT_VECTOR_CAPACITY * 12 + 500;
+    // A handful of statuses (DICTIONARY), and distinct urls that share hosts and path shapes (FSST) with a
+    // few empty values.
+    auto status_of = [](uint64_t idx) {
+        static const char* statuses[] = {"ok", "error: timeout", "error: refused", "redirect"};
+        return std::string(statuses[(idx * 7) % 4]);
+    };
+    auto url_of = [](uint64_t idx) {
+        if (idx % 101 == 0) {
+            return std::string();
+        }
+        static const char* hosts[] = {"a.example.com", "b.example.org", "c.example.net"};
+        return std::string("https://") + hosts[idx % 3] + "/users/" + std::to_string(idx * 7919 % 100003) +
+               "/posts/" + std::to_string(idx) + "?ref=" + (idx % 5 == 0 ? "newsletter" : "search");
+    };
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("id", logical_type::BIGINT);
+    columns.emplace_back("status", logical_type::STRING_LITERAL);
+    columns.emplace_back("url", logical_type::STRING_LITERAL);
+    auto set_row = [&](data_chunk_t& chunk, uint64_t i, uint64_t row) {
+        chunk.set_value(0, i, logical_value_t{&env.resource, static_cast<int64_t>(row)});
+        chunk.set_value(1, i, logical_value_t{&env.resource, status_of(row)});
+        chunk.set_value(2, i, logical_value_t{&env.resource, url_of(row)});
+    };
+
+    checkpoint_and_reload(env, std::move(columns), "requests", NUM_ROWS, set_row, [&](data_table_t& loaded) {
+        REQUIRE(all_segments_use(loaded, 1, compression::compression_type::DICTIONARY));
+        REQUIRE(all_segments_use(loaded, 2, compression::compression_type::FSST));
+
+        auto check_row = [&](data_chunk_t& chunk, uint64_t i, uint64_t row) {
+            INFO("row=" << row);
+            REQUIRE(chunk.data[0].value(i).value<int64_t>() == static_cast<int64_t>(row));
+            REQUIRE(*chunk.data[1].value(i).value<std::string*>() == status_of(row));
+            REQUIRE(*chunk.data[2].value(i).value<std::string*>() == url_of(row));
+        };
+
+        uint64_t scanned = 0;
+        loaded.scan_table_segment(0, NUM_ROWS, [&](data_chunk_t& chunk) {
+            for (uint64_t i = 0; i < chunk.size(); i++) {
+                check_row(chunk, i, scanned + i);
+            }
+            scanned += chunk.size();
+        });
+        REQUIRE(scanned == NUM_ROWS);
+
+        auto column_path = [&](uint64_t column) { return std::pmr::vector<uint64_t>(1, column, &env.resource); };
+        auto text = [&](const std::string& value) { return logical_value_t{&env.resource, value}; };
+        auto scan = [&](const table_filter_t* filter, const std::function<bool(uint64_t)>& expected) {
+            check_scan(loaded, &env.resource, NUM_ROWS, filter, expected, check_row);
+        };
+
+        SECTION("statuses: filters run once per dictionary entry") {
+            constant_filter_t eq(compare_type::eq, text("error: timeout"), column_path(1));
+            scan(&eq, [&](uint64_t i) { return status_of(i) == "error: timeout"; });
+            constant_filter_t ne(compare_type::ne, text("ok"), column_path(1));
+            scan(&ne, [&](uint64_t i) { return status_of(i) != "ok"; });
+            constant_filter_t like(compare_type::regex, text("^error.*$"), column_path(1));
+            scan(&like, [&](uint64_t i) { return status_of(i).starts_with("error"); });
+        }
+
+        SECTION("urls: equality compares the codes") {
+            constant_filter_t eq(compare_type::eq, text(url_of(4321)), column_path(2));
+            scan(&eq, [&](uint64_t i) { return i == 4321; });
+            constant_filter_t missing(compare_type::eq, text("https://a.example.com/users/"), column_path(2));
+            scan(&missing, [](uint64_t) { return false; });
+            constant_filter_t empty(compare_type::eq, text(""), column_path(2));
+            scan(&empty, [](uint64_t i) { return i % 101 == 0; });
+            constant_filter_t ne(compare_type::ne, text(url_of(17)), column_path(2));
+            scan(&ne, [](uint64_t i) { return i != 17; });
+        }
+
+        SECTION("urls: prefixes decode only the codes they span") {
+            const std::string host_b = "https://b.example.org/users/1";
+            constant_filter_t like(compare_type::regex, text("^https://b\\.example\\.org/users/1.*$"), column_path(2));
+            scan(&like, [&](uint64_t i) { return url_of(i).starts_with(host_b); });
+            constant_filter_t prefix(compare_type::regex, text("^https://c"), column_path(2));
+            scan(&prefix, [&](uint64_t i) { return url_of(i).starts_with("https://c"); });
+            constant_filter_t glob(compare_type::regex,
+                                   text("^https://a\\.example\\.com/users/5.*newsletter$"),
+                                   column_path(2));
+            scan(&glob, [&](uint64_t i) {
+                return url_of(i).starts_with("https://a.example.com/users/5") && url_of(i).ends_with("newsletter");
+            });
+        }
+
+        SECTION("urls: other filters run on the decoded values") {
+            constant_filter_t suffix(compare_type::regex, text("newsletter$"), column_path(2));
+            scan(&suffix, [&](uint64_t i) { return url_of(i).ends_with("newsletter"); });
+
+            std::pmr::vector<logical_value_t> values(&env.resource);
+            values.push_back(text(url_of(10)));
+            values.push_back(text(url_of(9000)));
+            set_membership_filter_t in_list(std::move(values), column_path(2));
+            scan(&in_list, [](uint64_t i) { return i == 10 || i == 9000; });
+        }
+    });
+}
+
+TEST_CASE("checkpoint_load: ALP compression — sensor doubles, floats and a Chimp fallback") {
+    using namespace components::table;
+    using namespace components::types;
+    using namespace components::vector;
+    using components::expressions::compare_type;
+
+    test_env_t env;
+    constexpr uint64_t NUM_ROWS = DEFAULT_VECTOR_CAPACITY * 20 + 33;
+    // Readings with two and one decimal digits (ALP), and a full-precision series with NaN, infinities
+    // and negative zeros sprinkled in (Chimp, values that ALP cannot scale are exceptions).
+    auto temperature_of = [](uint64_t idx) {
+        return std::round((20.0 + 5.0 * std::sin(static_cast<double>(idx) / 300.0) + (idx * 37 % 11) * 0.1) * 100) /
+               100;
+    };
+    auto humidity_of = [](uint64_t idx) { return static_cast<float>((idx * 13 % 700) / 10 + 30) + (idx % 10) / 10.0f; };
+    auto ratio_of = [](uint64_t idx) {
+        if (idx % 997 == 0) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (idx % 991 == 0) {
+            return -0.0;
+        }
+        if (idx % 983 == 0) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return std::sin(static_cast<double>(idx) * 0.001);
+    };
+    auto same_bits = [](auto a, auto b) { return std::memcmp(&a, &b, sizeof(a)) == 0; };
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("temperature", logical_type::DOUBLE);
+    columns.emplace_back("humidity", logical_type::FLOAT);
+    columns.emplace_back("ratio", logical_type::DOUBLE);
+    auto set_row = [&](data_chunk_t& chunk, uint64_t i, uint64_t row) {
+        chunk.set_value(0, i, logical_value_t{&env.resource, temperature_of(row)});
+        chunk.set_value(1, i, logical_value_t{&env.resource, humidity_of(row)});
+        chunk.set_value(2, i, logical_value_t{&env.resource, ratio_of(row)});
+    };
+
+    checkpoint_and_reload(env, std::move(columns), "sensors", NUM_ROWS, set_row, [&](data_table_t& loaded) {
+        // Chimp groups live inside ALP segments: the fallback is per group, not per segment.
+        REQUIRE(all_segments_use(loaded, 0, compression::compression_type::ALP));
+        REQUIRE(all_segments_use(loaded, 1, compression::compression_type::ALP));
+        REQUIRE(all_segments_use(loaded, 2, compression::compression_type::ALP));
+
+        uint64_t scanned = 0;
+        loaded.scan_table_segment(0, NUM_ROWS, [&](data_chunk_t& chunk) {
+            for (uint64_t i = 0; i < chunk.size(); i++) {
+                const uint64_t row = scanned + i;
+                INFO("row=" << row);
+                REQUIRE(same_bits(chunk.data[0].value(i).value<double>(), temperature_of(row)));
+                REQUIRE(same_bits(chunk.data[1].value(i).value<float>(), humidity_of(row)));
+                REQUIRE(same_bits(chunk.data[2].value(i).value<double>(), ratio_of(row)));
+            }
+            scanned += chunk.size();
+        });
+        REQUIRE(scanned == NUM_ROWS);
+
+        auto column_path = [&](uint64_t column) { return std::pmr::vector<uint64_t>(1, column, &env.resource); };
+        auto check_row = [&](data_chunk_t& batch, uint64_t i, uint64_t row) {
+            INFO("row=" << row);
+            REQUIRE(same_bits(batch.data[0].value(i).value<double>(), temperature_of(row)));
+            REQUIRE(same_bits(batch.data[2].value(i).value<double>(), ratio_of(row)));
+        };
+        auto scan = [&](const table_filter_t* filter, const std::function<bool(uint64_t)>& expected) {
+            check_scan(loaded, &env.resource, NUM_ROWS, filter, expected, check_row);
+        };
+
+        SECTION("ranges and points on decimal doubles") {
+            constant_filter_t warm(compare_type::gte, logical_value_t{&env.resource, 24.5}, column_path(0));
+            scan(&warm, [&](uint64_t i) { return temperature_of(i) >= 24.5; });
+            constant_filter_t cold(compare_type::lt, logical_value_t{&env.resource, 15.25}, column_path(0));
+            scan(&cold, [&](uint64_t i) { return temperature_of(i) < 15.25; });
+            const double point = temperature_of(4321);
+            constant_filter_t eq(compare_type::eq, logical_value_t{&env.resource, point}, column_path(0));
+            scan(&eq, [&](uint64_t i) { return temperature_of(i) == point; });
+        }
+
+        SECTION("floats") {
+            constant_filter_t gt(compare_type::gt, logical_value_t{&env.resource, 95.5f}, column_path(1));
+            scan(&gt, [&](uint64_t i) { return humidity_of(i) > 95.5f; });
+        }
+
+        SECTION("groups holding NaN are never decided by their bounds") {
+            constant_filter_t lte(compare_type::lte, logical_value_t{&env.resource, 2.0}, column_path(2));
+            scan(&lte, [&](uint64_t i) { return ratio_of(i) <= 2.0; });
+        }
+
+        SECTION("IN-list") {
+            std::pmr::vector<logical_value_t> values(&env.resource);
+            values.emplace_back(&env.resource, temperature_of(10));
+            values.emplace_back(&env.resource, temperature_of(9000));
+            set_membership_filter_t in_list(std::move(values), column_path(0));
+            scan(&in_list, [&](uint64_t i) {
+                return temperature_of(i) == temperature_of(10) || temperature_of(i) == temperature_of(9000);
+            });
+        }
+    });
+}
+
 TEST_CASE("checkpoint_load: UNCOMPRESSED fallback — high cardinality") {
     using namespace components::table;
     using namespace components::table::storage;
@@ -565,6 +1045,13 @@ TEST_CASE("checkpoint_load: UNCOMPRESSED fallback — high cardinality") {
 
     test_env_t env;
     constexpr uint64_t NUM_ROWS = 500;
+    // all unique, full-width values with no runs or steady deltas: no encoding beats the raw bytes
+    auto value_of = [](uint64_t idx) {
+        uint64_t x = (idx + 1) * 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<int64_t>(x ^ (x >> 31));
+    };
 
     meta_block_pointer_t table_pointer;
 
@@ -576,8 +1063,7 @@ TEST_CASE("checkpoint_load: UNCOMPRESSED fallback — high cardinality") {
         columns.emplace_back("value", logical_type::BIGINT);
         auto table = std::make_unique<data_table_t>(&env.resource, bm, std::move(columns), "unique_table");
 
-        // all unique values: 0..499
-        append_int64_data(*table, &env.resource, NUM_ROWS);
+        append_int64_data_with_fn(*table, &env.resource, NUM_ROWS, value_of);
         REQUIRE(table->calculate_size() == NUM_ROWS);
 
         metadata_manager_t meta_mgr(bm);
@@ -600,10 +1086,12 @@ TEST_CASE("checkpoint_load: UNCOMPRESSED fallback — high cardinality") {
         REQUIRE(!loaded_result.has_error());
         auto& loaded = loaded_result.value();
 
+        REQUIRE(all_segments_use(*loaded, 0, compression::compression_type::UNCOMPRESSED));
+
         uint64_t scanned = 0;
         loaded->scan_table_segment(0, NUM_ROWS, [&](data_chunk_t& chunk) {
             for (uint64_t i = 0; i < chunk.size(); i++) {
-                REQUIRE(chunk.data[0].value(i).value<int64_t>() == static_cast<int64_t>(scanned + i));
+                REQUIRE(chunk.data[0].value(i).value<int64_t>() == value_of(scanned + i));
             }
             scanned += chunk.size();
         });
@@ -1007,3 +1495,88 @@ TEST_CASE("checkpoint_load: shared partial block survives reopen after table gro
 
     cleanup_test_file();
 }
+
+TEST_CASE("checkpoint_load: incremental checkpoint rewrites only dirty row groups") {
+    using namespace components::table;
+    using namespace components::table::storage;
+    using namespace components::types;
+    using namespace components::vector;
+    cleanup_test_file();
+
+    test_env_t env;
+    // distinct BIGINTs stay UNCOMPRESSED: 2 MiB of checkpoint data, several blocks
+    constexpr uint64_t NUM_ROWS = DEFAULT_VECTOR_CAPACITY * 256;
+    constexpr uint64_t GROW_ROWS = 100;
+    constexpr uint64_t TOTAL_ROWS = NUM_ROWS + GROW_ROWS;
+    // a checkpoint of an unchanged table only rotates its metadata and free-list chains
+    constexpr uint64_t CHAIN_BLOCKS = 3;
+    // a dirty row group adds its checkpoint copy and the re-pointed live tail
+    constexpr uint64_t DIRTY_GROUP_BLOCKS = 2;
+
+    auto verify = [&](data_table_t& table, uint64_t expected) {
+        uint64_t scanned = 0;
+        table.scan_table_segment(0, expected, [&](data_chunk_t& chunk) {
+            for (uint64_t i = 0; i < chunk.size(); i++) {
+                REQUIRE(chunk.data[0].value(i).value<int64_t>() == static_cast<int64_t>(scanned + i));
+            }
+            scanned += chunk.size();
+        });
+        REQUIRE(scanned == expected);
+    };
+
+    meta_block_pointer_t table_pointer;
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        REQUIRE(!bm.create_new_database().has_error());
+        std::vector<column_definition_t> columns;
+        columns.emplace_back("value", logical_type::BIGINT);
+        auto table = std::make_unique<data_table_t>(&env.resource, bm, std::move(columns), "incremental");
+        append_int64_data(*table, &env.resource, NUM_ROWS);
+
+        table_pointer = full_checkpoint(*table, bm);
+        const uint64_t blocks_after_first = bm.total_blocks();
+        for (int i = 0; i < 5; i++) {
+            table_pointer = full_checkpoint(*table, bm);
+        }
+        REQUIRE(bm.total_blocks() <= blocks_after_first + CHAIN_BLOCKS);
+
+        // one new row group: only it is written, the others keep their blocks
+        const uint64_t steady_blocks = bm.total_blocks();
+        append_int64_data_with_fn(*table, &env.resource, GROW_ROWS, [](uint64_t i) {
+            return static_cast<int64_t>(NUM_ROWS + i);
+        });
+        table_pointer = full_checkpoint(*table, bm);
+        REQUIRE(bm.total_blocks() <= steady_blocks + CHAIN_BLOCKS + DIRTY_GROUP_BLOCKS);
+    }
+
+    // A reloaded table is clean: checkpointing it again reuses the loaded pointers.
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        REQUIRE(!bm.load_existing_database().has_error());
+        metadata_manager_t meta_mgr(bm);
+        metadata_reader_t reader(meta_mgr, table_pointer);
+        auto loaded_result = data_table_t::load_from_disk(&env.resource, bm, reader);
+        REQUIRE(!loaded_result.has_error());
+        auto& loaded = loaded_result.value();
+        verify(*loaded, TOTAL_ROWS);
+
+        // the reload writes its all-valid validity segments through, which is not checkpoint data
+        const uint64_t blocks_after_load = bm.total_blocks();
+        for (int i = 0; i < 3; i++) {
+            table_pointer = full_checkpoint(*loaded, bm);
+        }
+        REQUIRE(bm.total_blocks() <= blocks_after_load + CHAIN_BLOCKS);
+    }
+
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        REQUIRE(!bm.load_existing_database().has_error());
+        metadata_manager_t meta_mgr(bm);
+        metadata_reader_t reader(meta_mgr, table_pointer);
+        auto loaded_result = data_table_t::load_from_disk(&env.resource, bm, reader);
+        REQUIRE(!loaded_result.has_error());
+        verify(*loaded_result.value(), TOTAL_ROWS);
+    }
+
+    cleanup_test_file();
+}
@@ -0,0 +1,208 @@
+#include <catch2/catch.hpp>
+#include <components/table/data_table.hpp>
+#include <components/table/storage/buffer_pool.hpp>
+#include <components/table/storage/in_memory_block_manager.hpp>
+#include <components/table/storage/standard_buffer_manager.hpp>
+#include <core/file/local_file_system.hpp>
+
+#include <functional>
+
+// Pushed-down filters are evaluated vector-wise over a selection; every case compares the scanned
+// ids against the same predicate evaluated row by row on the generated data.
+TEST_CASE("components::table::filter_scan") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+    using components::expressions::compare_type;
+
+    auto resource = std::pmr::synchronized_pool_resource();
+    core::filesystem::local_file_system_t fs;
+    auto buffer_pool = storage::buffer_pool_t(&resource, uint64_t(1) << 32, false, uint64_t(1) << 24);
+    auto buffer_manager = storage::standard_buffer_manager_t(&resource, fs, buffer_pool);
+    auto block_manager = storage::in_memory_block_manager_t(buffer_manager, storage::DEFAULT_BLOCK_ALLOC_SIZE);
+
+    // spans several vectors, the last one partial
+    constexpr uint64_t test_size = DEFAULT_VECTOR_CAPACITY * 3 + DEFAULT_VECTOR_CAPACITY / 2;
+    auto name_of = [](uint64_t i) { return "name_" + std::to_string(i % 10); };
+    auto score_is_null = [](uint64_t i) { return i % 7 == 0; };
+    auto score_of = [](uint64_t i) { return static_cast<int32_t>(i % 100); };
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("id", logical_type::BIGINT);
+    columns.emplace_back("name", logical_type::STRING_LITERAL);
+    columns.emplace_back("score", logical_type::INTEGER);
+    auto table = std::make_unique<data_table_t>(&resource, block_manager, std::move(columns));
+
+    {
+        table_append_state state(&resource);
+        REQUIRE_FALSE(table->append_lock(state).has_error());
+        REQUIRE_FALSE(table->initialize_append(state).has_error());
+        for (uint64_t base = 0; base < test_size; base += DEFAULT_VECTOR_CAPACITY) {
+            const uint64_t count = std::min<uint64_t>(DEFAULT_VECTOR_CAPACITY, test_size - base);
+            data_chunk_t chunk(&resource, table->copy_types(), count);
+            chunk.set_cardinality(count);
+            for (uint64_t local = 0; local < count; local++) {
+                const uint64_t i = base + local;
+                chunk.set_value(0, local, logical_value_t{&resource, static_cast<int64_t>(i)});
+                chunk.set_value(1, local, logical_value_t{&resource, name_of(i)});
+                chunk.set_value(2, local, logical_value_t{&resource, score_of(i)});
+                if (score_is_null(i)) {
+                    chunk.data[2].validity().set_invalid(local);
+                }
+            }
+            REQUIRE_FALSE(table->append(chunk, state).has_error());
+        }
+        table->finalize_append(state, transaction_data{0, 0});
+    }
+
+    auto column_path = [&](uint64_t column) { return std::pmr::vector<uint64_t>(1, column, &resource); };
+    auto constant = [&](compare_type type, uint64_t column, logical_value_t value) {
+        return std::make_unique<constant_filter_t>(type, std::move(value), column_path(column));
+    };
+
+    auto check_scan = [&](const table_filter_t* filter, const std::function<bool(uint64_t)>& expected) {
+        std::vector<storage_index_t> column_indices{storage_index_t(0), storage_index_t(1), storage_index_t(2)};
+        table_scan_state state(&resource);
+        table->initialize_scan(state, column_indices, filter);
+        std::pmr::vector<data_chunk_t> batches(&resource);
+        table->scan_batched(table->copy_types(), nullptr, batches, state, &resource);
+
+        std::vector<uint64_t> scanned;
+        for (auto& batch : batches) {
+            for (uint64_t i = 0; i < batch.size(); i++) {
+                scanned.push_back(static_cast<uint64_t>(batch.data[0].value(i).value<int64_t>()));
+            }
+        }
+        std::vector<uint64_t> reference;
+        for (uint64_t i = 0; i < test_size; i++) {
+            if (expected(i)) {
+                reference.push_back(i);
+            }
+        }
+        REQUIRE(scanned == reference);
+    };
+
+    SECTION("constant comparison") {
+        auto filter = constant(compare_type::gte, 0, logical_value_t{&resource, int64_t{1500}});
+        check_scan(filter.get(), [](uint64_t i) { return i >= 1500; });
+    }
+
+    SECTION("string equality skips other values") {
+        auto filter = constant(compare_type::eq, 1, logical_value_t{&resource, std::string{"name_3"}});
+        check_scan(filter.get(), [&](uint64_t i) { return name_of(i) == "name_3"; });
+    }
+
+    SECTION("comparison excludes NULL rows") {
+        auto filter = constant(compare_type::lt, 2, logical_value_t{&resource, int32_t{10}});
+        check_scan(filter.get(), [&](uint64_t i) { return !score_is_null(i) && score_of(i) < 10; });
+    }
+
+    SECTION("IS NULL / IS NOT NULL") {
+        is_null_filter_t is_null(compare_type::is_null, column_path(2));
+        check_scan(&is_null, [&](uint64_t i) { return score_is_null(i); });
+        is_null_filter_t is_not_null(compare_type::is_not_null, column_path(2));
+        check_scan(&is_not_null, [&](uint64_t i) { return !score_is_null(i); });
+    }
+
+    SECTION("AND narrows the selection child by child") {
+        conjunction_and_filter_t conj_and;
+        conj_and.child_filters.emplace_back(
+            constant(compare_type::eq, 1, logical_value_t{&resource, std::string{"name_4"}}));
+        conj_and.child_filters.emplace_back(constant(compare_type::gt, 2, logical_value_t{&resource, int32_t{50}}));
+        check_scan(&conj_and,
+                   [&](uint64_t i) { return name_of(i) == "name_4" && !score_is_null(i) && score_of(i) > 50; });
+    }
+
+    SECTION("OR keeps row order across children") {
+        conjunction_or_filter_t conj_or;
+        conj_or.child_filters.emplace_back(constant(compare_type::gte, 0, logical_value_t{&resource, int64_t{3000}}));
+        conj_or.child_filters.emplace_back(constant(compare_type::lt, 0, logical_value_t{&resource, int64_t{100}}));
+        conj_or.child_filters.emplace_back(constant(compare_type::eq, 2, logical_value_t{&resource, int32_t{42}}));
+        check_scan(&conj_or, [&](uint64_t i) {
+            return i >= 3000 || i < 100 || (!score_is_null(i) && score_of(i) == 42);
+        });
+    }
+
+    SECTION("NOT rejects rows matched by any child") {
+        conjunction_not_filter_t conj_not;
+        conj_not.child_filters.emplace_back(constant(compare_type::gte, 0, logical_value_t{&resource, int64_t{64}}));
+        check_scan(&conj_not, [](uint64_t i) { return i < 64; });
+    }
+
+    SECTION("IN-list, short and long") {
+        std::pmr::vector<logical_value_t> names(&resource);
+        names.emplace_back(&resource, std::string{"name_1"});
+        names.emplace_back(&resource, std::string{"name_8"});
+        set_membership_filter_t short_list(std::move(names), column_path(1));
+        check_scan(&short_list, [&](uint64_t i) { return name_of(i) == "name_1" || name_of(i) == "name_8"; });
+
+        std::pmr::vector<logical_value_t> ids(&resource);
+        for (int64_t id = 0; id < static_cast<int64_t>(test_size); id += 97) {
+            ids.emplace_back(&resource, id);
+        }
+        set_membership_filter_t long_list(std::move(ids), column_path(0));
+        check_scan(&long_list, [](uint64_t i) { return i % 97 == 0; });
+    }
+
+    SECTION("runtime join filter") {
+        bloom_filter_t ids(100, column_path(0));
+        for (int64_t id = 1000; id < 2300; id += 13) {
+            ids.insert(id);
+        }
+        check_scan(&ids, [&](uint64_t i) { return ids.may_contain(static_cast<int64_t>(i)); });
+        for (int64_t id = 1000; id < 2300; id += 13) {
+            REQUIRE(ids.may_contain(id));
+        }
+        REQUIRE_FALSE(ids.may_contain(999));
+        REQUIRE_FALSE(ids.may_contain(2300));
+
+        // narrower probe column, NULL rows never pass
+        bloom_filter_t scores(3, column_path(2));
+        scores.insert(5);
+        scores.insert(50);
+        scores.insert(95);
+        check_scan(&scores, [&](uint64_t i) { return !score_is_null(i) && scores.may_contain(score_of(i)); });
+
+        // ANDed onto a predicate, the way a probe scan receives it
+        conjunction_and_filter_t conj_and;
+        conj_and.child_filters.emplace_back(
+            constant(compare_type::eq, 1, logical_value_t{&resource, std::string{"name_5"}}));
+        conj_and.child_filters.emplace_back(ids.copy());
+        check_scan(&conj_and,
+                   [&](uint64_t i) { return name_of(i) == "name_5" && ids.may_contain(static_cast<int64_t>(i)); });
+
+        // empty build side
+        bloom_filter_t nothing(0, column_path(0));
+        check_scan(&nothing, [](uint64_t) { return false; });
+    }
+
+    SECTION("top-N filter") {
+        auto bound = std::make_shared<top_n_bound_t>();
+        top_n_filter_t ascending(false, bound, column_path(0));
+        // no bound published yet: nothing is pruned
+        check_scan(&ascending, [](uint64_t) { return true; });
+
+        bound->publish(1500);
+        check_scan(&ascending, [](uint64_t i) { return i <= 1500; });
+        bound->publish(20);
+        check_scan(&ascending, [](uint64_t i) { return i <= 20; });
+        REQUIRE(ascending.excludes_range(logical_value_t{&resource, int64_t{21}},
+                                         logical_value_t{&resource, int64_t{900}},
+                                         0));
+
+        // ascending puts NULLs last, descending first: only the latter keeps them
+        auto score_bound = std::make_shared<top_n_bound_t>();
+        top_n_filter_t low_scores(false, score_bound, column_path(2));
+        top_n_filter_t high_scores(true, score_bound, column_path(2));
+        check_scan(&high_scores, [](uint64_t) { return true; });
+        score_bound->publish(90);
+        check_scan(&low_scores, [&](uint64_t i) { return !score_is_null(i) && score_of(i) <= 90; });
+        check_scan(&high_scores, [&](uint64_t i) { return score_is_null(i) || score_of(i) >= 90; });
+        REQUIRE_FALSE(high_scores.excludes_range(logical_value_t{&resource, int32_t{0}},
+                                                 logical_value_t{&resource, int32_t{50}},
+                                                 1));
+        REQUIRE(high_scores.excludes_range(logical_value_t{&resource, int32_t{0}},
+                                           logical_value_t{&resource, int32_t{50}},
+                                           0));
+    }
+}
@@ -0,0 +1,158 @@
+#include <catch2/catch.hpp>
+#include <components/table/data_table.hpp>
+#include <components/table/storage/buffer_pool.hpp>
+#include <components/table/storage/in_memory_block_manager.hpp>
+#include <components/table/storage/standard_buffer_manager.hpp>
+#include <core/file/local_file_system.hpp>
+
+// The morsel-parallel scan must hand back exactly what the single-threaded scan_batched produces,
+// in the same row order, whatever the worker count.
+TEST_CASE("components::table::parallel_scan") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+    using components::expressions::compare_type;
+
+    auto resource = std::pmr::synchronized_pool_resource();
+    core::filesystem::local_file_system_t fs;
+    auto buffer_pool = storage::buffer_pool_t(&resource, uint64_t(1) << 32, false, uint64_t(1) << 24);
+    auto buffer_manager = storage::standard_buffer_manager_t(&resource, fs, buffer_pool);
+    auto block_manager = storage::in_memory_block_manager_t(buffer_manager, storage::DEFAULT_BLOCK_ALLOC_SIZE);
+
+    // three full morsels and a partial tail
+    constexpr uint64_t test_size = MORSEL_ROW_COUNT * 3 + DEFAULT_VECTOR_CAPACITY * 5 + 17;
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("id", logical_type::BIGINT);
+    columns.emplace_back("bucket", logical_type::INTEGER);
+    auto table = std::make_unique<data_table_t>(&resource, block_manager, std::move(columns));
+    {
+        table_append_state state(&resource);
+        REQUIRE_FALSE(table->append_lock(state).has_error());
+        REQUIRE_FALSE(table->initialize_append(state).has_error());
+        for (uint64_t base = 0; base < test_size; base += DEFAULT_VECTOR_CAPACITY) {
+            const uint64_t count = std::min<uint64_t>(DEFAULT_VECTOR_CAPACITY, test_size - base);
+            data_chunk_t chunk(&resource, table->copy_types(), count);
+            chunk.set_cardinality(count);
+            for (uint64_t local = 0; local < count; local++) {
+                const uint64_t i = base + local;
+                chunk.set_value(0, local, logical_value_t{&resource, static_cast<int64_t>(i)});
+                chunk.set_value(1, local, logical_value_t{&resource, static_cast<int32_t>(i % 13)});
+            }
+            REQUIRE_FALSE(table->append(chunk, state).has_error());
+        }
+        table->finalize_append(state, transaction_data{0, 0});
+    }
+
+    const std::vector<storage_index_t> column_ids{storage_index_t(0), storage_index_t(1)};
+    const auto types = table->copy_types();
+    auto ids_of = [](std::pmr::vector<data_chunk_t>& batches) {
+        std::vector<int64_t> ids;
+        for (auto& batch : batches) {
+            for (uint64_t i = 0; i < batch.size(); i++) {
+                ids.push_back(batch.data[0].value(i).value<int64_t>());
+            }
+        }
+        return ids;
+    };
+    constant_filter_t filter(compare_type::lt,
+                             logical_value_t{&resource, int32_t{4}},
+                             std::pmr::vector<uint64_t>(1, 1, &resource));
+
+    std::pmr::vector<data_chunk_t> serial(&resource);
+    {
+        table_scan_state state(&resource);
+        table->initialize_scan(state, column_ids, &filter);
+        table->scan_batched(types, nullptr, serial, state, &resource);
+    }
+    const auto expected = ids_of(serial);
+    REQUIRE(expected.size() == (test_size / 13) * 4 + std::min<uint64_t>(test_size % 13, 4));
+
+    SECTION("ordered merge matches the serial scan") {
+        for (uint64_t threads : {uint64_t{1}, uint64_t{3}, uint64_t{8}}) {
+            std::pmr::vector<data_chunk_t> batches(&resource);
+            int64_t next_row = 0;
+            REQUIRE_FALSE(table
+                              ->scan_parallel(types,
+                                              column_ids,
+                                              nullptr,
+                                              &filter,
+                                              transaction_data{0, 0},
+                                              next_row,
+                                              static_cast<int64_t>(test_size),
+                                              0,
+                                              threads,
+                                              batches)
+                              .has_error());
+            REQUIRE(next_row == static_cast<int64_t>(test_size));
+            REQUIRE(ids_of(batches) == expected);
+        }
+    }
+
+    SECTION("bounded windows resume where the previous one stopped") {
+        std::pmr::vector<data_chunk_t> batches(&resource);
+        int64_t next_row = 0;
+        uint64_t windows = 0;
+        while (next_row < static_cast<int64_t>(test_size)) {
+            const int64_t window_start = next_row;
+            REQUIRE_FALSE(table
+                              ->scan_parallel(types,
+                                              column_ids,
+                                              nullptr,
+                                              &filter,
+                                              transaction_data{0, 0},
+                                              next_row,
+                                              static_cast<int64_t>(test_size),
+                                              2,
+                                              2,
+                                              batches)
+                              .has_error());
+            REQUIRE(next_row > window_start);
+            windows++;
+        }
+        REQUIRE(windows == 2);
+        REQUIRE(ids_of(batches) == expected);
+    }
+
+    SECTION("read-ahead fetch resumes range by range") {
+        auto fetch_all = [&](const table_filter_t* range_filter, uint64_t read_ahead, uint64_t& fetches) {
+            std::pmr::vector<data_chunk_t> batches(&resource);
+            int64_t next_row = 0;
+            bool drained = false;
+            while (!drained) {
+                const size_t before = batches.size();
+                REQUIRE_FALSE(table
+                                  ->fetch_next_batches(types,
+                                                       column_ids,
+                                                       nullptr,
+                                                       range_filter,
+                                                       transaction_data{0, 0},
+                                                       next_row,
+                                                       static_cast<int64_t>(test_size),
+                                                       read_ahead,
+                                                       batches,
+                                                       drained)
+                                  .has_error());
+                REQUIRE((batches.size() > before || drained));
+                REQUIRE(batches.size() - before <= read_ahead);
+                fetches++;
+            }
+            REQUIRE(next_row == static_cast<int64_t>(test_size));
+            return batches;
+        };
+
+        uint64_t fetches = 0;
+        auto batches = fetch_all(&filter, 8, fetches);
+        REQUIRE(ids_of(batches) == expected);
+        REQUIRE(fetches == (test_size + 8 * DEFAULT_VECTOR_CAPACITY - 1) / (8 * DEFAULT_VECTOR_CAPACITY));
+
+        // ranges the filter empties are walked past inside one call, not returned empty
+        constant_filter_t tail(compare_type::gte,
+                               logical_value_t{&resource, static_cast<int64_t>(test_size - 100)},
+                               std::pmr::vector<uint64_t>(1, 0, &resource));
+        fetches = 0;
+        auto tail_batches = fetch_all(&tail, 4, fetches);
+        REQUIRE(fetches == 1);
+        REQUIRE(ids_of(tail_batches).size() == 100);
+    }
+}
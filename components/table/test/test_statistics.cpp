@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 #include <components/table/base_statistics.hpp>
+#include <components/table/column_analyzer.hpp>
 #include <components/table/column_data.hpp>
 #include <components/table/column_segment.hpp>
 #include <components/table/column_state.hpp>
@@ -295,3 +296,113 @@ TEST_CASE("per-segment statistics: populated during append") {
     CHECK(seg_stats.min_value().value<int64_t>() == 1);
     CHECK(seg_stats.max_value().value<int64_t>() == 100);
 }
+
+TEST_CASE("hyperloglog: estimate, merge and serialize") {
+    using namespace components::table;
+
+    hyperloglog_t left;
+    hyperloglog_t right;
+    for (uint64_t i = 0; i < 100000; i++) {
+        (i % 2 == 0 ? left : right).add_hash(hyperloglog_t::mix_hash(i));
+        left.add_hash(hyperloglog_t::mix_hash(i % 1000)); // duplicates do not count
+    }
+    CHECK(left.estimate() == Approx(50000 + 500).epsilon(0.05));
+
+    left.merge(right);
+    CHECK(left.estimate() == Approx(100000).epsilon(0.05));
+
+    auto restored = hyperloglog_t::deserialize(left.serialize());
+    REQUIRE(restored.has_value());
+    CHECK(restored->precision() == left.precision());
+    CHECK(restored->estimate() == left.estimate());
+
+    CHECK_FALSE(hyperloglog_t::deserialize("").has_value());
+    CHECK_FALSE(hyperloglog_t::deserialize("11:000").has_value());
+    CHECK_FALSE(hyperloglog_t::deserialize("x:0").has_value());
+
+    hyperloglog_t small;
+    for (uint64_t i = 0; i < 10; i++) {
+        small.add_hash(hyperloglog_t::mix_hash(i));
+    }
+    CHECK(small.estimate() == 10);
+}
+
+TEST_CASE("column analyzer: counts, MCVs and histogram") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+
+    std::pmr::synchronized_pool_resource resource;
+
+    SECTION("column that fits the sample is described exactly") {
+        column_analyzer_t analyzer(&resource);
+        vector_t vec(&resource, logical_type::BIGINT, 100);
+        auto data = vec.data<int64_t>();
+        for (uint64_t i = 0; i < 100; i++) {
+            if (i % 10 == 0) {
+                vec.validity().set_invalid(i);
+            } else {
+                data[i] = static_cast<int64_t>(i % 3);
+            }
+        }
+        analyzer.update(vec, 100);
+
+        auto result = analyzer.finish();
+        CHECK(result.row_count == 100);
+        CHECK(result.null_count == 10);
+        CHECK(result.distinct_count == 3);
+        REQUIRE(result.mcv_values.size() == 3);
+        uint64_t total = 0;
+        for (auto c : result.mcv_counts) {
+            total += c;
+        }
+        CHECK(total == 90);
+        CHECK(result.histogram.empty());
+    }
+
+    SECTION("skewed column larger than the sample") {
+        column_analyzer_t analyzer(&resource, 1000);
+        const uint64_t rows = 20000;
+        for (uint64_t base = 0; base < rows; base += 1000) {
+            vector_t vec(&resource, logical_type::BIGINT, 1000);
+            auto data = vec.data<int64_t>();
+            for (uint64_t i = 0; i < 1000; i++) {
+                const uint64_t row = base + i;
+                data[i] = row % 2 == 0 ? -1 : static_cast<int64_t>(row);
+            }
+            analyzer.update(vec, 1000);
+        }
+
+        auto result = analyzer.finish(10, 10);
+        CHECK(result.row_count == rows);
+        CHECK(result.null_count == 0);
+        CHECK(result.distinct_count == Approx(rows / 2 + 1).epsilon(0.05));
+        REQUIRE_FALSE(result.mcv_values.empty());
+        CHECK(result.mcv_values.front().value<int64_t>() == -1);
+        CHECK(result.mcv_counts.front() == Approx(rows / 2).epsilon(0.1));
+        REQUIRE(result.histogram.size() == 11);
+        for (size_t i = 1; i < result.histogram.size(); i++) {
+            CHECK(result.histogram[i - 1].value<int64_t>() <= result.histogram[i].value<int64_t>());
+            CHECK(result.histogram[i].value<int64_t>() != -1);
+        }
+    }
+
+    SECTION("strings go through add()") {
+        column_analyzer_t analyzer(&resource);
+        for (int i = 0; i < 30; i++) {
+            analyzer.add(logical_value_t(&resource, std::string(i < 20 ? "x" : "y" + std::to_string(i))));
+        }
+        analyzer.add(logical_value_t(&resource, nullptr));
+
+        auto result = analyzer.finish(4, 1);
+        CHECK(result.row_count == 31);
+        CHECK(result.null_count == 1);
+        CHECK(result.distinct_count == 11);
+        REQUIRE(result.mcv_values.size() == 1);
+        CHECK(result.mcv_values.front().value<std::string_view>() == "x");
+        CHECK(result.mcv_counts.front() == 20);
+        REQUIRE(result.histogram.size() == 5);
+        CHECK(result.histogram.front().value<std::string_view>() == "y20");
+        CHECK(result.histogram.back().value<std::string_view>() == "y29");
+    }
+}
@@ -107,6 +107,11 @@ namespace components::table {
             pg_catalog_appends.clear();
             pg_catalog_delete_tables.clear();
         }
+        // True once an earlier statement of this txn wrote pg_catalog: its
+        // resolves must scan the catalog to see those uncommitted rows.
+        bool has_pg_catalog_pending() const {
+            return !pg_catalog_appends.empty() || !pg_catalog_delete_tables.empty();
+        }
 
         // ALTER COLUMN backfill markers parked inside an explicit txn;
         // operator_commit_transaction_t drains them post-commit_id and patches the rows.
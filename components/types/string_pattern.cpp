@@ -0,0 +1,214 @@
+#include "string_pattern.hpp"
+
+#include <cstring>
+
+namespace components::types {
+
+    namespace {
+        // ECMAScript syntax characters: unescaped, each of them needs the regex engine.
+        bool is_syntax_char(char c) {
+            switch (c) {
+                case '^':
+                case '$':
+                case '\\':
+                case '.':
+                case '*':
+                case '+':
+                case '?':
+                case '(':
+                case ')':
+                case '[':
+                case ']':
+                case '{':
+                case '}':
+                case '|':
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        bool has_line_terminator(std::string_view text) {
+            return std::memchr(text.data(), '\n', text.size()) != nullptr ||
+                   std::memchr(text.data(), '\r', text.size()) != nullptr;
+        }
+    } // namespace
+
+    core::result_wrapper_t<string_pattern_t> string_pattern_t::compile(std::pmr::memory_resource* resource,
+                                                                       std::string_view pattern) {
+        string_pattern_t result;
+        result.pattern_ = std::string(pattern);
+        if (result.lower(pattern)) {
+            return result;
+        }
+        try {
+            result.kind_ = kind_t::regex;
+            result.segments_.clear();
+            result.regex_ = std::make_shared<const std::regex>(result.pattern_,
+                                                               std::regex::ECMAScript | std::regex::optimize);
+        } catch (const std::regex_error& e) {
+            return core::error_t(core::error_code_t::invalid_parameter,
+                                 std::pmr::string{std::string("invalid regular expression: ") + e.what(), resource});
+        }
+        return result;
+    }
+
+    bool string_pattern_t::lower(std::string_view pattern) {
+        bool anchored_start = false;
+        bool anchored_end = false;
+        bool wildcard = false;
+        std::vector<segment_t> segments(1);
+        auto append = [&segments](char c, bool any) {
+            auto& segment = segments.back();
+            segment.chars.push_back(c);
+            segment.any.push_back(any);
+            segment.has_any = segment.has_any || any;
+        };
+
+        size_t i = 0;
+        if (!pattern.empty() && pattern.front() == '^') {
+            anchored_start = true;
+            i = 1;
+        }
+        while (i < pattern.size()) {
+            const char c = pattern[i];
+            const char next = i + 1 < pattern.size() ? pattern[i + 1] : '\0';
+            if (c == '$' && i + 1 == pattern.size()) {
+                anchored_end = true;
+                ++i;
+            } else if (c == '\\') {
+                // only escaped syntax characters are literals; \d, \b, \n and friends are classes
+                if (!is_syntax_char(next)) {
+                    return false;
+                }
+                append(next, false);
+                i += 2;
+            } else if (c == '.' && next == '*') {
+                segments.emplace_back();
+                wildcard = true;
+                i += 2;
+            } else if (c == '.') {
+                append(c, true);
+                wildcard = true;
+                ++i;
+            } else if (is_syntax_char(c) || c == '\n' || c == '\r') {
+                // a literal line terminator would let a match span lines, which
+                // the glob's line-terminator shortcut below does not model
+                return false;
+            } else {
+                append(c, false);
+                ++i;
+            }
+        }
+
+        if (!wildcard) {
+            literal_ = std::move(segments.front().chars);
+            if (anchored_start && anchored_end) {
+                kind_ = kind_t::exact;
+            } else if (anchored_start) {
+                kind_ = kind_t::prefix;
+            } else if (anchored_end) {
+                kind_ = kind_t::suffix;
+            } else {
+                kind_ = kind_t::contains;
+            }
+            return true;
+        }
+        // An unanchored '.' or '.*' may start or end at any line, the anchored
+        // form always spans the whole (single-line) text.
+        if (!anchored_start || !anchored_end) {
+            return false;
+        }
+        kind_ = kind_t::glob;
+        segments_ = std::move(segments);
+        return true;
+    }
+
+    bool string_pattern_t::matches(std::string_view text) const {
+        switch (kind_) {
+            case kind_t::exact:
+                return text == literal_;
+            case kind_t::prefix:
+                return text.starts_with(literal_);
+            case kind_t::suffix:
+                return text.ends_with(literal_);
+            case kind_t::contains:
+                return text.find(literal_) != std::string_view::npos;
+            case kind_t::glob:
+                return match_glob(text);
+            case kind_t::regex:
+                return std::regex_search(text.begin(), text.end(), *regex_);
+        }
+        return false;
+    }
+
+    std::string_view string_pattern_t::required_prefix() const noexcept {
+        switch (kind_) {
+            case kind_t::exact:
+            case kind_t::prefix:
+                return literal_;
+            case kind_t::glob:
+                return segments_.front().has_any ? std::string_view() : std::string_view(segments_.front().chars);
+            default:
+                return {};
+        }
+    }
+
+    bool string_pattern_t::match_glob(std::string_view text) const {
+        // '.' and '.*' never match a line terminator and the pattern holds no
+        // literal one, so a text containing one cannot match the anchored form.
+        if (has_line_terminator(text)) {
+            return false;
+        }
+        auto matches_at = [text](size_t pos, const segment_t& segment) {
+            if (!segment.has_any) {
+                return text.compare(pos, segment.chars.size(), segment.chars) == 0;
+            }
+            for (size_t i = 0; i < segment.chars.size(); ++i) {
+                if (!segment.any[i] && text[pos + i] != segment.chars[i]) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        const auto& first = segments_.front();
+        if (segments_.size() == 1) {
+            return text.size() == first.chars.size() && matches_at(0, first);
+        }
+        const auto& last = segments_.back();
+        if (text.size() < first.chars.size() + last.chars.size()) {
+            return false;
+        }
+        const size_t end = text.size() - last.chars.size();
+        if (!matches_at(0, first) || !matches_at(end, last)) {
+            return false;
+        }
+        // Middle segments are placed leftmost: any later placement only leaves
+        // less room for the segments after it.
+        size_t pos = first.chars.size();
+        const auto window = text.substr(0, end);
+        for (size_t s = 1; s + 1 < segments_.size(); ++s) {
+            const auto& segment = segments_[s];
+            if (segment.chars.empty()) {
+                continue;
+            }
+            if (!segment.has_any) {
+                pos = window.find(segment.chars, pos);
+                if (pos == std::string_view::npos) {
+                    return false;
+                }
+            } else {
+                while (pos + segment.chars.size() <= end && !matches_at(pos, segment)) {
+                    ++pos;
+                }
+                if (pos + segment.chars.size() > end) {
+                    return false;
+                }
+            }
+            pos += segment.chars.size();
+        }
+        return true;
+    }
+
+} // namespace components::types
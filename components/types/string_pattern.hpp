@@ -0,0 +1,74 @@
+#pragma once
+
+#include <core/result_wrapper.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace components::types {
+
+    // A regex predicate compiled once and matched against many strings, with
+    // std::regex_search semantics (ECMAScript, unanchored unless the pattern
+    // says otherwise).
+    //
+    // Patterns that need no regex engine are lowered to byte kernels:
+    //  - a plain literal, optionally ^/$-anchored: contains / prefix / suffix /
+    //    exact, via memchr-driven find and memcmp-based compares;
+    //  - a ^...$-anchored mix of literals, '.' and '.*' — the shape
+    //    sql::transformer::like_to_regex emits for LIKE — as a glob: the '.*'
+    //    separated segments are anchored at the ends and found leftmost in
+    //    between, linear in the text for literal segments.
+    // Everything else runs a std::regex built once in compile().
+    class string_pattern_t {
+    public:
+        enum class kind_t : uint8_t
+        {
+            exact,
+            prefix,
+            suffix,
+            contains,
+            glob,
+            regex,
+        };
+
+        // invalid_parameter on a pattern std::regex rejects.
+        static core::result_wrapper_t<string_pattern_t> compile(std::pmr::memory_resource* resource,
+                                                                std::string_view pattern);
+
+        bool matches(std::string_view text) const;
+
+        kind_t kind() const noexcept { return kind_; }
+        const std::string& pattern() const noexcept { return pattern_; }
+        // The literal every match starts with: the whole literal of an exact or
+        // prefix pattern, the leading literal segment of a glob (LIKE 'abc%').
+        // Empty when a match may start anywhere.
+        std::string_view required_prefix() const noexcept;
+
+    private:
+        // A run of literals and '.' between two '.*'; '.' positions are flagged
+        // in `any` and hold an arbitrary byte in `chars`.
+        struct segment_t {
+            std::string chars;
+            std::vector<bool> any;
+            bool has_any{false};
+        };
+
+        string_pattern_t() = default;
+
+        bool lower(std::string_view pattern);
+        bool match_glob(std::string_view text) const;
+
+        kind_t kind_{kind_t::regex};
+        std::string pattern_;
+        std::string literal_;
+        std::vector<segment_t> segments_;
+        // shared so the compiled pattern copies cheaply into predicates
+        std::shared_ptr<const std::regex> regex_;
+    };
+
+} // namespace components::types
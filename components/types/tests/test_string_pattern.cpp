@@ -0,0 +1,71 @@
+#include <catch2/catch.hpp>
+#include <components/types/string_pattern.hpp>
+
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace components::types;
+
+namespace {
+    bool reference_match(const std::string& pattern, const std::string& text) {
+        return std::regex_search(text, std::regex(pattern));
+    }
+} // namespace
+
+TEST_CASE("components::types::string_pattern::lowering") {
+    auto* resource = std::pmr::get_default_resource();
+    auto kind_of = [&](std::string_view pattern) {
+        auto compiled = string_pattern_t::compile(resource, pattern);
+        REQUIRE_FALSE(compiled.has_error());
+        return compiled.value().kind();
+    };
+    REQUIRE(kind_of("timeout") == string_pattern_t::kind_t::contains);
+    REQUIRE(kind_of("^abc") == string_pattern_t::kind_t::prefix);
+    REQUIRE(kind_of("abc$") == string_pattern_t::kind_t::suffix);
+    REQUIRE(kind_of("^a\\.c$") == string_pattern_t::kind_t::exact);
+    REQUIRE(kind_of("^.*timeout.*$") == string_pattern_t::kind_t::glob);
+    REQUIRE(kind_of("^a.c.*d$") == string_pattern_t::kind_t::glob);
+    REQUIRE(kind_of("a.c") == string_pattern_t::kind_t::regex);
+    REQUIRE(kind_of("^ab*c$") == string_pattern_t::kind_t::regex);
+    REQUIRE(kind_of("\\d+") == string_pattern_t::kind_t::regex);
+
+    REQUIRE(string_pattern_t::compile(resource, "(unclosed").has_error());
+
+    auto prefix_of = [&](std::string_view pattern) {
+        auto compiled = string_pattern_t::compile(resource, pattern);
+        REQUIRE_FALSE(compiled.has_error());
+        return std::string(compiled.value().required_prefix());
+    };
+    REQUIRE(prefix_of("^abc") == "abc");
+    REQUIRE(prefix_of("^a\\.c$") == "a.c");
+    REQUIRE(prefix_of("^http://.*$") == "http://");
+    REQUIRE(prefix_of("^ab.d.*$").empty());
+    REQUIRE(prefix_of("^.*timeout.*$").empty());
+    REQUIRE(prefix_of("timeout").empty());
+    REQUIRE(prefix_of("abc$").empty());
+}
+
+TEST_CASE("components::types::string_pattern::matches_like_std_regex") {
+    auto* resource = std::pmr::get_default_resource();
+    const std::vector<std::string> patterns = {
+        "",          "timeout",      "^abc",      "abc$",       "^abc$",    "^$",        "^.*timeout.*$",
+        "^.*$",      "^a.c$",        "^a.*c$",    "^.*a.*b.*$", "^ab.*ab$", "^.b.*b.$",  "^a\\.c.*$",
+        "^\\$.*\\*$", "^.*a.a.*$",   "^...$",     "^a.*\\.b$",  "a.c",      "^ab*c$",    "[0-9]+",
+        "^(a|b).*$", "^a.*c.*$",     "^.*$abc",   "^x\\\\y$",
+    };
+    const std::vector<std::string> texts = {
+        "",          "abc",       "a.c",          "axc",       "abcabc",   "xabc",          "abcx",
+        "timeout",   "a timeout", "timeout\n",    "time out",  "ab",       "abab",          "abxab",
+        "aab",       "bab",       "ba.b",         "a\nc",      "a\rc",     "$x*",           "$*",
+        "aXa",       "aXaXa",     "x\\y",         "123",       "a.cd.b",   "abcabcabcabc",  std::string("a\0c", 3),
+    };
+    for (const auto& pattern : patterns) {
+        auto compiled = string_pattern_t::compile(resource, pattern);
+        REQUIRE_FALSE(compiled.has_error());
+        for (const auto& text : texts) {
+            INFO("pattern: " << pattern << " text: " << text);
+            REQUIRE(compiled.value().matches(text) == reference_match(pattern, text));
+        }
+    }
+}
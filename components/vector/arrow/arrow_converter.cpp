@@ -1,5 +1,6 @@
 #include "arrow_converter.hpp"
 
+#include "appender/append_data.hpp"
 #include "arrow_appender.hpp"
 #include "scaner/arrow_conversion.hpp"
 #include "scaner/arrow_type_extension.hpp"
@@ -7,6 +8,8 @@
 #include <components/types/types.hpp>
 #include <components/vector/data_chunk.hpp>
 
+#include <array>
+#include <bit>
 #include <cassert>
 #include <list>
 #include <memory>
@@ -19,10 +22,107 @@ namespace components::vector::arrow {
     using types::complex_logical_type;
     using types::logical_type;
 
+    namespace {
+
+        // A column exported without copying: the child array points into the vector's own data and
+        // validity, kept alive by the copy of the vector held here (a copy shares the data buffer).
+        struct borrowed_column_t {
+            explicit borrowed_column_t(const vector_t& source)
+                : vector(source) {}
+
+            vector_t vector;
+            std::array<const void*, 2> buffers{{nullptr, nullptr}};
+        };
+
+        void release_borrowed_column(ArrowArray* array) {
+            if (!array || !array->release) {
+                return;
+            }
+            array->release = nullptr;
+            delete static_cast<borrowed_column_t*>(array->private_data);
+        }
+
+        // Arrow's layout for a fixed-width primitive is ours for a flat vector: the values back to back
+        // and, on little-endian targets, the validity words read as Arrow's LSB-first bitmap. Only data
+        // the vector owns is shared; a vector over a pinned block or into another vector is copied.
+        bool is_borrowable(vector_t& vector, uint64_t size) {
+            if constexpr (std::endian::native != std::endian::little) {
+                return false;
+            }
+            if (size == 0 || vector.get_vector_type() != vector_type::FLAT) {
+                return false;
+            }
+            if (auto buffer = vector.get_buffer(); !buffer || buffer->data() != vector.data()) {
+                return false;
+            }
+            if (!vector.validity().all_valid() && vector.validity().count() < size) {
+                return false;
+            }
+            switch (vector.type().type()) {
+                case logical_type::TINYINT:
+                case logical_type::SMALLINT:
+                case logical_type::INTEGER:
+                case logical_type::BIGINT:
+                case logical_type::UTINYINT:
+                case logical_type::USMALLINT:
+                case logical_type::UINTEGER:
+                case logical_type::UBIGINT:
+                case logical_type::FLOAT:
+                case logical_type::DOUBLE:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        ArrowArray borrow_column(const vector_t& vector, uint64_t size) {
+            auto holder = std::make_unique<borrowed_column_t>(vector);
+            const auto& validity = holder->vector.validity();
+
+            ArrowArray result;
+            result.length = static_cast<int64_t>(size);
+            result.null_count = validity.all_valid() ? 0 : static_cast<int64_t>(size - validity.count_valid(size));
+            result.offset = 0;
+            result.n_buffers = 2;
+            result.n_children = 0;
+            result.children = nullptr;
+            result.dictionary = nullptr;
+            holder->buffers[0] = result.null_count > 0 ? validity.data() : nullptr;
+            holder->buffers[1] = holder->vector.data();
+            result.buffers = holder->buffers.data();
+            result.private_data = holder.release();
+            result.release = release_borrowed_column;
+            return result;
+        }
+
+    } // namespace
+
     void to_arrow_array(data_chunk_t& input, ArrowArray* out_array) {
-        arrow_appender_t appender(input.types(), input.size());
-        appender.append(input, 0, input.size(), input.size());
-        *out_array = appender.finalize();
+        const auto size = input.size();
+        auto root_holder = std::make_unique<appender::arrow_append_data_t>();
+        arrow_appender_t::add_children(*root_holder, input.column_count());
+
+        for (uint64_t i = 0; i < input.column_count(); i++) {
+            auto& vector = input.data[i];
+            if (is_borrowable(vector, size)) {
+                root_holder->child_arrays[i] = borrow_column(vector, size);
+                continue;
+            }
+            auto append_data = arrow_appender_t::initialize_child(vector.type(), size);
+            append_data->append_vector(*append_data, vector, 0, size, size);
+            root_holder->child_arrays[i] = *arrow_appender_t::finalize_child(vector.type(), std::move(append_data));
+        }
+
+        out_array->length = static_cast<int64_t>(size);
+        out_array->null_count = 0;
+        out_array->offset = 0;
+        out_array->n_buffers = 1;
+        out_array->buffers = root_holder->buffers.data();
+        out_array->n_children = static_cast<int64_t>(input.column_count());
+        out_array->children = root_holder->child_pointers.data();
+        out_array->dictionary = nullptr;
+        out_array->private_data = root_holder.release();
+        out_array->release = arrow_appender_t::release_array;
     }
 
     std::unique_ptr<char[]> add_name(const std::string& name) {
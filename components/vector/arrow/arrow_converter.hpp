@@ -12,6 +12,9 @@
 namespace components::vector::arrow {
 
     void to_arrow_schema(ArrowSchema* out_schema, const std::pmr::vector<types::complex_logical_type>& types);
+    // Flat fixed-width numeric columns are exported without copying: their child arrays share the
+    // vectors' data and validity, so `input` must not be written to while `out_array` is alive. Every
+    // other column is copied through the arrow appender.
     void to_arrow_array(data_chunk_t& input, ArrowArray* out_array);
     [[nodiscard]] core::error_t populate_arrow_table_schema(std::pmr::memory_resource* resource,
                                                             arrow_table_schema_t& arrow_table,
@@ -215,6 +215,16 @@ namespace components::vector {
 
     } // anonymous namespace
 
+    bool is_binary_serializable(const types::complex_logical_type& type) {
+        auto physical_type = type.to_physical_type();
+        if (fixed_type_size(physical_type) == 0 && !is_variable_type(physical_type)) {
+            return false;
+        }
+        auto* extension = type.extension();
+        return !extension || extension->type() == types::logical_type_extension::extension_type::GENERIC ||
+               extension->type() == types::logical_type_extension::extension_type::DECIMAL;
+    }
+
     // -----------------------------------------------------------------------
     // serialize_binary
     // -----------------------------------------------------------------------
@@ -28,4 +28,9 @@ namespace components::vector {
     /// Sets \p ok to true on success.
     data_chunk_t deserialize_binary(const char* data, size_t len, std::pmr::memory_resource* resource, bool& ok);
 
+    /// True when a flat column of \p type survives serialize_binary / deserialize_binary
+    /// unchanged: a fixed-width or string physical type whose extension, if any, the type
+    /// header records (alias, DECIMAL). Nested, enum and user types are not covered.
+    bool is_binary_serializable(const types::complex_logical_type& type);
+
 } // namespace components::vector
@@ -307,3 +307,57 @@ TEST_CASE("components::vector::data_chunk_to_arrow::datetime") {
     }
     schema.release(&schema);
 }
+
+TEST_CASE("components::vector::data_chunk_to_arrow::zero_copy") {
+    constexpr size_t chunk_size = 100;
+
+    auto resource = std::pmr::synchronized_pool_resource();
+    std::pmr::vector<complex_logical_type> types(&resource);
+    types.emplace_back(logical_type::BIGINT, "bigint");
+    types.emplace_back(logical_type::DOUBLE, "double");
+    types.emplace_back(logical_type::STRING_LITERAL, "string");
+
+    ArrowArray arrow_array;
+    {
+        data_chunk_t chunk(&resource, types, chunk_size);
+        chunk.set_cardinality(chunk_size);
+        for (size_t i = 0; i < chunk_size; i++) {
+            if (i % 7 == 0) {
+                chunk.set_value(0, i, logical_value_t{&resource, complex_logical_type{logical_type::NA}});
+            } else {
+                chunk.set_value(0, i, logical_value_t{&resource, static_cast<int64_t>(i)});
+            }
+            chunk.set_value(1, i, logical_value_t{&resource, static_cast<double>(i) / 2});
+            chunk.set_value(2, i, logical_value_t{&resource, std::string{"row_" + std::to_string(i)}});
+        }
+
+        to_arrow_array(chunk, &arrow_array);
+        REQUIRE(arrow_array.length == chunk_size);
+        REQUIRE(arrow_array.n_children == 3);
+        // flat numeric columns share the vectors' buffers, the string column is copied
+        REQUIRE(arrow_array.children[0]->buffers[1] == chunk.data[0].data());
+        REQUIRE(arrow_array.children[1]->buffers[1] == chunk.data[1].data());
+        REQUIRE(arrow_array.children[1]->buffers[0] == nullptr);
+        REQUIRE(arrow_array.children[2]->buffers[1] != chunk.data[2].data());
+    }
+
+    // the chunk is gone: the array keeps the shared buffers alive on its own
+    auto* bigint = arrow_array.children[0];
+    REQUIRE(bigint->null_count == (chunk_size + 6) / 7);
+    auto* validity = static_cast<const uint8_t*>(bigint->buffers[0]);
+    auto* values = static_cast<const int64_t*>(bigint->buffers[1]);
+    for (size_t i = 0; i < chunk_size; i++) {
+        const bool valid = (validity[i / 8] >> (i % 8)) & 1;
+        REQUIRE(valid == (i % 7 != 0));
+        if (valid) {
+            REQUIRE(values[i] == static_cast<int64_t>(i));
+        }
+    }
+    auto* doubles = static_cast<const double*>(arrow_array.children[1]->buffers[1]);
+    for (size_t i = 0; i < chunk_size; i++) {
+        REQUIRE(doubles[i] == static_cast<double>(i) / 2);
+    }
+
+    arrow_array.release(&arrow_array);
+    REQUIRE(arrow_array.release == nullptr);
+}
@@ -192,3 +192,17 @@ TEST_CASE("validity_mask_t: slice() at non-zero offset on a pointer-constructed
     REQUIRE(ptr_mask.data() != buffer); // sliced into a private allocation
     REQUIRE(buffer[0] == components::vector::validity_data_t::MAX_ENTRY);
 }
+
+TEST_CASE("validity_mask_t: count_valid() over a partial last entry", "[validity-mask]") {
+    // The rows of the last, partial entry are counted one by one: each valid
+    // bit adds one, whatever its position in the entry.
+    auto resource = std::pmr::synchronized_pool_resource();
+    validity_mask_t mask(&resource, test_capacity);
+    mask.set_invalid(uint64_t(3));
+    mask.set_invalid(uint64_t(70));
+
+    REQUIRE(mask.count_valid(100) == 98);
+    REQUIRE(mask.count_valid(64) == 63);
+    REQUIRE(mask.count_valid(70) == 69);
+    REQUIRE(mask.count_valid(71) == 69);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace core {
+
+    // murmur3 fmix64 finalizer: a bijection that spreads every input bit over the
+    // whole word. Hash tables, radix partitioning and bloom filters take bits from
+    // the top of the result, which stay zero in the raw hash of a small integer.
+    constexpr uint64_t fmix64(uint64_t hash) noexcept {
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xff51afd7ed558ccd);
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+} // namespace core
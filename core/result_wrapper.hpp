@@ -63,6 +63,7 @@ namespace core {
         data_corruption, // block checksum mismatch on read (disk reload / spill read)
         io_error,        // file create/open/header/read/write failure
         write_conflict,  // MVCC write-write conflict
+        query_cancelled, // the client closed a streaming cursor before its statement finished
     };
 
     struct error_t {
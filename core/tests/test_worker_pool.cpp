@@ -0,0 +1,35 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include <core/worker_pool/worker_pool.hpp>
+
+TEST_CASE("core::worker_pool::run") {
+    auto& pool = core::worker_pool_t::shared();
+
+    SECTION("every worker runs once") {
+        for (uint64_t workers : {1, 2, 7}) {
+            std::vector<std::atomic<int>> runs(workers);
+            pool.run(workers, [&](uint64_t w) { runs[w]++; });
+            for (auto& r : runs) {
+                REQUIRE(r.load() == 1);
+            }
+        }
+    }
+
+    SECTION("rounds reuse the pool") {
+        std::atomic<uint64_t> total{0};
+        for (int round = 0; round < 200; round++) {
+            pool.run(4, [&](uint64_t w) { total += w; });
+        }
+        REQUIRE(total.load() == 200 * (0 + 1 + 2 + 3));
+    }
+
+    SECTION("nested runs do not wait on a busy pool") {
+        std::atomic<uint64_t> inner{0};
+        pool.run(4, [&](uint64_t) { pool.run(4, [&](uint64_t) { inner++; }); });
+        REQUIRE(inner.load() == 16);
+    }
+}
@@ -0,0 +1,78 @@
+#include "worker_pool.hpp"
+
+namespace core {
+
+    worker_pool_t& worker_pool_t::shared() {
+        static worker_pool_t pool;
+        return pool;
+    }
+
+    worker_pool_t::~worker_pool_t() {
+        {
+            std::lock_guard guard(mutex_);
+            stop_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    void worker_pool_t::run(uint64_t workers, const std::function<void(uint64_t)>& body) {
+        if (workers <= 1) {
+            body(0);
+            return;
+        }
+        uint64_t pending = workers - 1;
+        {
+            std::lock_guard guard(mutex_);
+            grow_(workers - 1);
+            for (uint64_t w = 1; w < workers; w++) {
+                tasks_.emplace_back([this, &body, &pending, w] {
+                    body(w);
+                    std::lock_guard done(mutex_);
+                    if (--pending == 0) {
+                        done_cv_.notify_all();
+                    }
+                });
+            }
+        }
+        work_cv_.notify_all();
+        body(0);
+
+        std::unique_lock lock(mutex_);
+        while (pending != 0) {
+            if (tasks_.empty()) {
+                done_cv_.wait(lock);
+                continue;
+            }
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    void worker_pool_t::grow_(std::size_t threads) {
+        while (threads_.size() < threads) {
+            threads_.emplace_back([this] { worker_loop_(); });
+        }
+    }
+
+    void worker_pool_t::worker_loop_() {
+        std::unique_lock lock(mutex_);
+        while (true) {
+            work_cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            auto task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+} // namespace core
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace core {
+
+    // Process-wide helper threads for intra-operator parallelism (morsel-parallel
+    // scans, GROUP BY pre-aggregation). Threads are started on first use and kept,
+    // so a parallel round costs a queue push per worker instead of a thread
+    // spawn and join.
+    class worker_pool_t final {
+    public:
+        static worker_pool_t& shared();
+
+        ~worker_pool_t();
+
+        worker_pool_t(const worker_pool_t&) = delete;
+        worker_pool_t& operator=(const worker_pool_t&) = delete;
+        worker_pool_t(worker_pool_t&&) = delete;
+        worker_pool_t& operator=(worker_pool_t&&) = delete;
+
+        // Runs body(w) for every w in [0, workers) and returns once all of them
+        // finished. The caller runs worker 0 itself; while it waits for the
+        // others it runs queued tasks too, so a run() nested inside a body (or
+        // several callers sharing the pool) never waits on a busy pool.
+        void run(uint64_t workers, const std::function<void(uint64_t)>& body);
+
+    private:
+        worker_pool_t() = default;
+
+        void grow_(std::size_t threads);
+        void worker_loop_();
+
+        std::mutex mutex_;
+        std::condition_variable work_cv_;
+        std::condition_variable done_cv_;
+        std::deque<std::function<void()>> tasks_;
+        std::vector<std::thread> threads_;
+        bool stop_{false};
+    };
+
+} // namespace core
@@ -1,5 +1,6 @@
 #include "otterbrix.h"
 
+#include <components/cursor/arrow_stream.hpp>
 #include <components/cursor/cursor.hpp>
 #include <components/logical_plan/node_create_collection.hpp>
 #include <components/logical_plan/node_drop.hpp>
@@ -31,6 +32,11 @@ namespace {
         boost::intrusive_ptr<cursor_t> cursor;
     };
 
+    struct statement_storage_t {
+        state_t state;
+        otterbrix::prepared_statement_ptr statement;
+    };
+
     struct value_storage_t {
         state_t state;
         logical_value_t value{std::pmr::null_memory_resource(),
@@ -61,6 +67,13 @@ namespace {
         return storage;
     }
 
+    statement_storage_t* convert_statement(prepared_statement_ptr ptr) {
+        assert(ptr != nullptr);
+        auto storage = reinterpret_cast<statement_storage_t*>(ptr);
+        assert(storage->state == state_t::created);
+        return storage;
+    }
+
     value_storage_t* convert_value(value_ptr ptr) {
         assert(ptr != nullptr);
         auto storage = reinterpret_cast<value_storage_t*>(ptr);
@@ -112,6 +125,44 @@ namespace {
         }
         return std::string(sv.data, sv.size);
     }
+
+    std::vector<std::pair<size_t, logical_value_t>>
+    convert_params(std::pmr::memory_resource* resource, const sql_param_t* params, size_t param_count) {
+        std::vector<std::pair<size_t, logical_value_t>> bound;
+        bound.reserve(param_count);
+        for (size_t i = 0; i < param_count; ++i) {
+            const sql_param_t& p = params[i];
+            if (p.index < 1) {
+                throw std::invalid_argument("sql_param_t: index must be >= 1 (e.g. $1 -> 1)");
+            }
+            const size_t id = static_cast<size_t>(p.index);
+            switch (p.kind) {
+                case SQL_PARAM_NULL:
+                    bound.emplace_back(id, logical_value_t(resource, nullptr));
+                    break;
+                case SQL_PARAM_BOOL:
+                    bound.emplace_back(id, logical_value_t(resource, p.bool_value != 0));
+                    break;
+                case SQL_PARAM_INT64:
+                    bound.emplace_back(id, logical_value_t(resource, p.int64_value));
+                    break;
+                case SQL_PARAM_UINT64:
+                    bound.emplace_back(id, logical_value_t(resource, p.uint64_value));
+                    break;
+                case SQL_PARAM_DOUBLE:
+                    bound.emplace_back(id, logical_value_t(resource, p.double_value));
+                    break;
+                case SQL_PARAM_STRING: {
+                    std::string s = string_view_to_string(p.string_value);
+                    bound.emplace_back(id, logical_value_t(resource, std::move(s)));
+                    break;
+                }
+                default:
+                    throw std::invalid_argument("sql_param_t: unknown kind");
+            }
+        }
+        return bound;
+    }
 } // namespace
 
 extern "C" otterbrix_ptr otterbrix_create(config_t cfg) {
@@ -122,6 +173,7 @@ extern "C" otterbrix_ptr otterbrix_create(config_t cfg) {
         config.wal.path = std::pmr::string(cfg.wal_path.data, cfg.wal_path.size);
         config.disk.path = std::pmr::string(cfg.disk_path.data, cfg.disk_path.size);
         config.main_path = std::pmr::string(cfg.main_path.data, cfg.main_path.size);
+        config.spill.path = config.main_path / "spill";
         config.wal.on = cfg.wal_on;
         config.wal.sync_to_disk = cfg.sync_to_disk;
         config.disk.on = cfg.disk_on;
@@ -157,6 +209,21 @@ extern "C" cursor_ptr execute_sql(otterbrix_ptr ptr, string_view_t query_raw) {
     }
 }
 
+extern "C" cursor_ptr execute_sql_with_budget(otterbrix_ptr ptr, string_view_t query_raw, uint64_t memory_budget) {
+    pod_space_t* pod_space = nullptr;
+    try {
+        pod_space = convert_otterbrix(ptr);
+        auto session = otterbrix::session_id_t();
+        std::string query = string_view_to_string(query_raw);
+        auto cursor = pod_space->space->dispatcher()->execute_sql_with_budget(session, query, memory_budget);
+        return store_cursor(std::move(cursor));
+    } catch (const std::exception& ex) {
+        return exception_cursor(pod_space, ex);
+    } catch (...) {
+        return unknown_exception_cursor(pod_space);
+    }
+}
+
 extern "C" cursor_ptr
 execute_sql_params(otterbrix_ptr ptr, string_view_t query_raw, const sql_param_t* params, size_t param_count) {
     pod_space_t* pod_space = nullptr;
@@ -165,39 +232,7 @@ execute_sql_params(otterbrix_ptr ptr, string_view_t query_raw, const sql_param_t
         auto session = otterbrix::session_id_t();
         std::string query = string_view_to_string(query_raw);
         auto* resource = pod_space->space->dispatcher()->resource();
-        std::vector<std::pair<size_t, logical_value_t>> bound;
-        bound.reserve(param_count);
-        for (size_t i = 0; i < param_count; ++i) {
-            const sql_param_t& p = params[i];
-            if (p.index < 1) {
-                throw std::invalid_argument("sql_param_t: index must be >= 1 (e.g. $1 -> 1)");
-            }
-            const size_t id = static_cast<size_t>(p.index);
-            switch (p.kind) {
-                case SQL_PARAM_NULL:
-                    bound.emplace_back(id, logical_value_t(resource, nullptr));
-                    break;
-                case SQL_PARAM_BOOL:
-                    bound.emplace_back(id, logical_value_t(resource, p.bool_value != 0));
-                    break;
-                case SQL_PARAM_INT64:
-                    bound.emplace_back(id, logical_value_t(resource, p.int64_value));
-                    break;
-                case SQL_PARAM_UINT64:
-                    bound.emplace_back(id, logical_value_t(resource, p.uint64_value));
-                    break;
-                case SQL_PARAM_DOUBLE:
-                    bound.emplace_back(id, logical_value_t(resource, p.double_value));
-                    break;
-                case SQL_PARAM_STRING: {
-                    std::string s = string_view_to_string(p.string_value);
-                    bound.emplace_back(id, logical_value_t(resource, std::move(s)));
-                    break;
-                }
-                default:
-                    throw std::invalid_argument("sql_param_t: unknown kind");
-            }
-        }
+        auto bound = convert_params(resource, params, param_count);
         auto cursor = pod_space->space->dispatcher()->execute_sql_with_params(session, query, bound);
         return store_cursor(std::move(cursor));
     } catch (const std::exception& ex) {
@@ -207,6 +242,71 @@ execute_sql_params(otterbrix_ptr ptr, string_view_t query_raw, const sql_param_t
     }
 }
 
+extern "C" cursor_ptr prepare_sql(otterbrix_ptr ptr, string_view_t query_raw, prepared_statement_ptr* statement) {
+    pod_space_t* pod_space = nullptr;
+    try {
+        pod_space = convert_otterbrix(ptr);
+        assert(statement != nullptr);
+        *statement = nullptr;
+        std::string query = string_view_to_string(query_raw);
+        auto* dispatcher = pod_space->space->dispatcher();
+        auto prepared = dispatcher->prepare(query);
+        if (prepared.has_error()) {
+            return store_cursor(components::cursor::make_cursor(dispatcher->resource(), prepared.error()));
+        }
+        auto storage = std::make_unique<statement_storage_t>();
+        storage->statement = std::move(prepared.value());
+        storage->state = state_t::created;
+        *statement = reinterpret_cast<prepared_statement_ptr>(storage.release());
+        return store_cursor(components::cursor::make_cursor(dispatcher->resource()));
+    } catch (const std::exception& ex) {
+        return exception_cursor(pod_space, ex);
+    } catch (...) {
+        return unknown_exception_cursor(pod_space);
+    }
+}
+
+extern "C" cursor_ptr execute_prepared(otterbrix_ptr ptr,
+                                       prepared_statement_ptr statement,
+                                       const sql_param_t* params,
+                                       size_t param_count) {
+    pod_space_t* pod_space = nullptr;
+    try {
+        pod_space = convert_otterbrix(ptr);
+        auto storage = convert_statement(statement);
+        auto session = otterbrix::session_id_t();
+        auto* resource = pod_space->space->dispatcher()->resource();
+        auto bound = convert_params(resource, params, param_count);
+        auto cursor = pod_space->space->dispatcher()->execute_prepared(session, storage->statement, bound);
+        return store_cursor(std::move(cursor));
+    } catch (const std::exception& ex) {
+        return exception_cursor(pod_space, ex);
+    } catch (...) {
+        return unknown_exception_cursor(pod_space);
+    }
+}
+
+extern "C" cursor_ptr execute_sql_stream(otterbrix_ptr ptr, string_view_t query_raw) {
+    pod_space_t* pod_space = nullptr;
+    try {
+        pod_space = convert_otterbrix(ptr);
+        auto session = otterbrix::session_id_t();
+        std::string query = string_view_to_string(query_raw);
+        auto cursor = pod_space->space->dispatcher()->execute_sql_stream(session, query);
+        return store_cursor(std::move(cursor));
+    } catch (const std::exception& ex) {
+        return exception_cursor(pod_space, ex);
+    } catch (...) {
+        return unknown_exception_cursor(pod_space);
+    }
+}
+
+extern "C" void release_prepared(prepared_statement_ptr ptr) {
+    auto storage = convert_statement(ptr);
+    storage->state = state_t::destroyed;
+    delete storage;
+}
+
 extern "C" cursor_ptr create_database(otterbrix_ptr ptr, string_view_t database_name) {
     pod_space_t* pod_space = nullptr;
     try {
@@ -375,7 +475,9 @@ extern "C" value_ptr cursor_get_value(cursor_ptr ptr, int32_t row_index, int32_t
     auto storage = convert_cursor(ptr);
     auto& cursor = *storage->cursor;
 
-    if (row_index < 0 || column_index < 0 || static_cast<size_t>(row_index) >= cursor.size() ||
+    // A streaming cursor only holds its current chunk: rows before it are gone, rows after it
+    // have not arrived yet.
+    if (row_index < 0 || column_index < 0 || !cursor.holds_row(static_cast<uint64_t>(row_index)) ||
         static_cast<size_t>(column_index) >= cursor.column_count()) {
         return nullptr;
     }
@@ -400,6 +502,40 @@ extern "C" value_ptr cursor_get_value_by_name(cursor_ptr ptr, int32_t row_index,
     return nullptr;
 }
 
+extern "C" bool cursor_next_chunk(cursor_ptr ptr) {
+    auto storage = convert_cursor(ptr);
+    return storage->cursor->next_chunk();
+}
+
+extern "C" int32_t cursor_chunk_size(cursor_ptr ptr) {
+    auto storage = convert_cursor(ptr);
+    return static_cast<int32_t>(storage->cursor->current_chunk().size());
+}
+
+extern "C" value_ptr cursor_chunk_get_value(cursor_ptr ptr, int32_t row_index, int32_t column_index) {
+    auto storage = convert_cursor(ptr);
+    const auto& chunk = storage->cursor->current_chunk();
+
+    if (row_index < 0 || column_index < 0 || static_cast<uint64_t>(row_index) >= chunk.size() ||
+        static_cast<uint64_t>(column_index) >= chunk.column_count()) {
+        return nullptr;
+    }
+
+    auto value_storage = std::make_unique<value_storage_t>();
+    value_storage->state = state_t::created;
+    value_storage->value = chunk.value(static_cast<uint64_t>(column_index), static_cast<uint64_t>(row_index));
+    return reinterpret_cast<void*>(value_storage.release());
+}
+
+extern "C" bool cursor_arrow_stream(cursor_ptr ptr, struct ArrowArrayStream* out) {
+    auto storage = convert_cursor(ptr);
+    if (out == nullptr || storage->cursor->is_error()) {
+        return false;
+    }
+    components::cursor::to_arrow_stream(storage->cursor, out);
+    return true;
+}
+
 extern "C" void release_value(value_ptr ptr) {
     auto storage = convert_value(ptr);
     storage->state = state_t::destroyed;
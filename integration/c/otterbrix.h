@@ -8,6 +8,57 @@
 extern "C" {
 #endif
 
+/* Arrow C data and C stream interfaces (https://arrow.apache.org/docs/format/CStreamInterface.html), verbatim from the
+ * specification; the guards let this header sit next to any other copy of them. */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+    int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+    int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+    const char* (*get_last_error)(struct ArrowArrayStream*);
+    void (*release)(struct ArrowArrayStream*);
+    void* private_data;
+};
+
+#endif // ARROW_C_STREAM_INTERFACE
+
 typedef struct string_view_t {
     const char* data;
     size_t size;
@@ -34,6 +85,7 @@ typedef enum state_t
 typedef void* otterbrix_ptr;
 typedef void* cursor_ptr;
 typedef void* value_ptr;
+typedef void* prepared_statement_ptr;
 
 typedef struct error_message {
     int32_t code;
@@ -45,6 +97,10 @@ void otterbrix_destroy(otterbrix_ptr);
 
 cursor_ptr execute_sql(otterbrix_ptr ptr, string_view_t query);
 
+/* Runs `query` with a spill budget of `memory_budget` bytes for its sorts, aggregates and hash joins, in place of the
+ * engine-wide one; 0 keeps the engine-wide budget. */
+cursor_ptr execute_sql_with_budget(otterbrix_ptr ptr, string_view_t query, uint64_t memory_budget);
+
 typedef enum sql_param_kind_t
 {
     SQL_PARAM_NULL = 0,
@@ -67,6 +123,21 @@ typedef struct sql_param_t {
 
 cursor_ptr execute_sql_params(otterbrix_ptr ptr, string_view_t query, const sql_param_t* params, size_t param_count);
 
+/* Parses `query` once for repeated execution with execute_prepared; only the $N bindings change between calls.
+ * Returns an error cursor and sets *statement to NULL if `query` does not parse. A statement stays valid across
+ * DDL and must be released with release_prepared before the database is destroyed. */
+cursor_ptr prepare_sql(otterbrix_ptr ptr, string_view_t query, prepared_statement_ptr* statement);
+cursor_ptr execute_prepared(otterbrix_ptr ptr,
+                            prepared_statement_ptr statement,
+                            const sql_param_t* params,
+                            size_t param_count);
+void release_prepared(prepared_statement_ptr ptr);
+
+/* Streams the result of `query`: chunks arrive while the statement runs, and a reader that falls behind pauses it.
+ * Read with cursor_next_chunk / cursor_chunk_size / cursor_chunk_get_value; cursor_size counts the rows received so
+ * far. cursor_is_error turns true when the statement fails midway. Releasing the cursor early stops the statement. */
+cursor_ptr execute_sql_stream(otterbrix_ptr ptr, string_view_t query);
+
 cursor_ptr create_database(otterbrix_ptr ptr, string_view_t database_name);
 cursor_ptr create_collection(otterbrix_ptr ptr, string_view_t database_name, string_view_t collection_name);
 cursor_ptr drop_database(otterbrix_ptr ptr, string_view_t database_name);
@@ -87,6 +158,19 @@ value_ptr cursor_get_value(cursor_ptr ptr, int32_t row_index, int32_t column_ind
 
 value_ptr cursor_get_value_by_name(cursor_ptr ptr, int32_t row_index, string_view_t column_name);
 
+/* Chunk-at-a-time reading of any cursor: moves to the next non-empty chunk, false past the last one. Rows of the
+ * current chunk are numbered from 0. */
+bool cursor_next_chunk(cursor_ptr ptr);
+int32_t cursor_chunk_size(cursor_ptr ptr);
+value_ptr cursor_chunk_get_value(cursor_ptr ptr, int32_t row_index, int32_t column_index);
+
+/* Exports the cursor's result as an Arrow C stream, one record batch per chunk: the columnar alternative to reading
+ * cell by cell. Fixed-width numeric columns are handed over without copying. A cursor from execute_sql_stream is read
+ * as the statement runs. The stream holds its own reference to the result, so the cursor may be released at once;
+ * release the stream with out->release before destroying the database. Returns false, leaving *out untouched, for an
+ * error cursor; a statement that fails while streaming makes get_next fail with the error in get_last_error. */
+bool cursor_arrow_stream(cursor_ptr ptr, struct ArrowArrayStream* out);
+
 void release_value(value_ptr ptr);
 bool value_is_null(value_ptr ptr);
 bool value_is_bool(value_ptr ptr);
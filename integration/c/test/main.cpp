@@ -380,3 +380,311 @@ TEST_CASE("c-api: cursor_get_value returns nullptr for OOB row/column", "[c-api]
 
     release_cursor(cur);
 }
+
+// --------------------------------------------------------------------------
+// Prepared statements: parsed once, executed with fresh bindings, and still
+// valid after DDL changes the table they read. A parse error comes back as
+// an error cursor with no statement handle.
+// --------------------------------------------------------------------------
+
+TEST_CASE("c-api: prepared statement re-executes with new bindings", "[c-api][params]") {
+    test_db_t t("prepared");
+    REQUIRE(t.ptr != nullptr);
+
+    run_ok(t.ptr, "CREATE DATABASE db;");
+    run_ok(t.ptr, "CREATE TABLE db.t (num bigint, name string);");
+    run_ok(t.ptr, "INSERT INTO db.t (num, name) VALUES (1, 'one'), (2, 'two'), (3, 'three');");
+
+    prepared_statement_ptr stmt = nullptr;
+    cursor_ptr prepared = prepare_sql(t.ptr, sv(std::string("SELECT name FROM db.t WHERE num = $1;")), &stmt);
+    REQUIRE(prepared != nullptr);
+    REQUIRE(cursor_is_success(prepared));
+    release_cursor(prepared);
+    REQUIRE(stmt != nullptr);
+
+    auto name_for = [&](int64_t num) {
+        sql_param_t param{};
+        param.index = 1;
+        param.kind = SQL_PARAM_INT64;
+        param.int64_value = num;
+        cursor_ptr cur = execute_prepared(t.ptr, stmt, &param, 1);
+        REQUIRE(cur != nullptr);
+        REQUIRE(cursor_is_success(cur));
+        REQUIRE(cursor_size(cur) == 1);
+        value_ptr val = cursor_get_value(cur, 0, 0);
+        char* str = value_get_string(val);
+        std::string result(str);
+        otterbrix_free_string(str);
+        release_value(val);
+        release_cursor(cur);
+        return result;
+    };
+
+    REQUIRE(name_for(2) == "two");
+    REQUIRE(name_for(3) == "three");
+    run_ok(t.ptr, "ALTER TABLE db.t ADD COLUMN extra bigint;");
+    REQUIRE(name_for(1) == "one");
+    release_prepared(stmt);
+
+    stmt = nullptr;
+    cursor_ptr broken = prepare_sql(t.ptr, sv(std::string("SELEC name FROM db.t;")), &stmt);
+    REQUIRE(broken != nullptr);
+    REQUIRE(cursor_is_error(broken));
+    REQUIRE(stmt == nullptr);
+    release_cursor(broken);
+}
+
+// --------------------------------------------------------------------------
+// Streaming cursors: chunks arrive while the statement runs, a failure
+// surfaces on the cursor, and releasing a cursor early stops its statement
+// without holding up the next one.
+// --------------------------------------------------------------------------
+
+TEST_CASE("c-api: execute_sql_stream reads the result chunk by chunk", "[c-api][stream]") {
+    test_db_t t("stream");
+    REQUIRE(t.ptr != nullptr);
+
+    run_ok(t.ptr, "CREATE DATABASE db;");
+    run_ok(t.ptr, "CREATE TABLE db.t (num bigint);");
+    constexpr int64_t rows = 10000;
+    std::string insert = "INSERT INTO db.t (num) VALUES ";
+    for (int64_t i = 0; i < rows; ++i) {
+        insert += (i == 0 ? "(" : ", (") + std::to_string(i) + ")";
+    }
+    run_ok(t.ptr, insert + ";");
+
+    cursor_ptr cur = execute_sql_stream(t.ptr, sv(std::string("SELECT num FROM db.t;")));
+    REQUIRE(cur != nullptr);
+    REQUIRE(cursor_is_success(cur));
+    REQUIRE(cursor_column_count(cur) == 1);
+    int64_t seen = 0;
+    int64_t sum = 0;
+    int32_t chunks = 0;
+    while (cursor_next_chunk(cur)) {
+        ++chunks;
+        const int32_t size = cursor_chunk_size(cur);
+        REQUIRE(size > 0);
+        REQUIRE(cursor_chunk_get_value(cur, size, 0) == nullptr);
+        if (chunks > 1) {
+            // Rows of the chunks already read through are gone.
+            REQUIRE(cursor_get_value(cur, 0, 0) == nullptr);
+        }
+        for (int32_t row = 0; row < size; ++row) {
+            value_ptr val = cursor_chunk_get_value(cur, row, 0);
+            sum += value_get_int(val);
+            release_value(val);
+        }
+        seen += size;
+    }
+    REQUIRE(chunks > 1);
+    REQUIRE(seen == rows);
+    REQUIRE(sum == rows * (rows - 1) / 2);
+    REQUIRE(cursor_size(cur) == rows);
+    REQUIRE(cursor_is_success(cur));
+    release_cursor(cur);
+
+    cursor_ptr limited = execute_sql_stream(t.ptr, sv(std::string("SELECT num FROM db.t LIMIT 5;")));
+    seen = 0;
+    while (cursor_next_chunk(limited)) {
+        seen += cursor_chunk_size(limited);
+    }
+    REQUIRE(seen == 5);
+    release_cursor(limited);
+
+    cursor_ptr early = execute_sql_stream(t.ptr, sv(std::string("SELECT num FROM db.t;")));
+    REQUIRE(cursor_next_chunk(early));
+    release_cursor(early);
+    run_ok(t.ptr, "INSERT INTO db.t (num) VALUES (-1);");
+
+    cursor_ptr missing = execute_sql_stream(t.ptr, sv(std::string("SELECT num FROM db.missing;")));
+    REQUIRE(cursor_is_error(missing));
+    REQUIRE_FALSE(cursor_next_chunk(missing));
+    release_cursor(missing);
+}
+
+TEST_CASE("c-api: statements run while a stream waits unread", "[c-api][stream]") {
+    test_db_t t("stream_unread");
+    REQUIRE(t.ptr != nullptr);
+
+    run_ok(t.ptr, "CREATE DATABASE db;");
+    run_ok(t.ptr, "CREATE TABLE db.t (num bigint);");
+    constexpr int64_t rows = 50000;
+    std::string insert = "INSERT INTO db.t (num) VALUES ";
+    for (int64_t i = 0; i < rows; ++i) {
+        insert += (i == 0 ? "(" : ", (") + std::to_string(i) + ")";
+    }
+    run_ok(t.ptr, insert + ";");
+
+    // Far more chunks than the stream holds: its statement parks until read.
+    cursor_ptr paused = execute_sql_stream(t.ptr, sv(std::string("SELECT num FROM db.t;")));
+    REQUIRE(cursor_is_success(paused));
+
+    // Every statement gets a session of its own, hashed over all executors,
+    // the paused stream's included.
+    for (int i = 0; i < 16; ++i) {
+        cursor_ptr few = execute_sql(t.ptr, sv(std::string("SELECT num FROM db.t WHERE num < 10;")));
+        REQUIRE(cursor_is_success(few));
+        REQUIRE(cursor_size(few) == 10);
+        release_cursor(few);
+    }
+    run_ok(t.ptr, "INSERT INTO db.t (num) VALUES (-1);");
+
+    int64_t seen = 0;
+    while (cursor_next_chunk(paused)) {
+        seen += cursor_chunk_size(paused);
+    }
+    // Its snapshot predates the INSERT above.
+    REQUIRE(seen == rows);
+    REQUIRE(cursor_is_success(paused));
+    release_cursor(paused);
+}
+
+TEST_CASE("c-api: cursor_arrow_stream hands the result over as Arrow batches", "[c-api][arrow]") {
+    test_db_t t("arrow");
+    REQUIRE(t.ptr != nullptr);
+
+    run_ok(t.ptr, "CREATE DATABASE db;");
+    run_ok(t.ptr, "CREATE TABLE db.t (num bigint, name string);");
+    constexpr int64_t rows = 5000;
+    std::string insert = "INSERT INTO db.t (num, name) VALUES ";
+    for (int64_t i = 0; i < rows; ++i) {
+        insert += (i == 0 ? "(" : ", (") + std::to_string(i) + ", " +
+                  (i % 10 == 0 ? std::string("NULL") : "'name_" + std::to_string(i) + "'") + ")";
+    }
+    run_ok(t.ptr, insert + ";");
+
+    // Reads every batch: sums `num`, counts null and non-null `name`s and checks each string.
+    struct totals_t {
+        int64_t rows = 0;
+        int64_t sum = 0;
+        int64_t null_names = 0;
+        int32_t batches = 0;
+    };
+    auto drain = [](ArrowArrayStream& stream, totals_t& totals) {
+        ArrowArray batch;
+        int code;
+        while ((code = stream.get_next(&stream, &batch)) == 0 && batch.release) {
+            REQUIRE(batch.n_children == 2);
+            const ArrowArray* num = batch.children[0];
+            const ArrowArray* name = batch.children[1];
+            auto* nums = static_cast<const int64_t*>(num->buffers[1]);
+            auto* validity = static_cast<const uint8_t*>(name->buffers[0]);
+            auto* offsets = static_cast<const int64_t*>(name->buffers[1]); // "U": large utf8
+            auto* chars = static_cast<const char*>(name->buffers[2]);
+            for (int64_t row = 0; row < batch.length; ++row) {
+                const int64_t value = nums[num->offset + row];
+                totals.sum += value;
+                const int64_t at = name->offset + row;
+                if (validity && !((validity[at / 8] >> (at % 8)) & 1)) {
+                    REQUIRE(value % 10 == 0);
+                    ++totals.null_names;
+                } else {
+                    REQUIRE(std::string(chars + offsets[at], chars + offsets[at + 1]) ==
+                            "name_" + std::to_string(value));
+                }
+            }
+            totals.rows += batch.length;
+            ++totals.batches;
+            batch.release(&batch);
+        }
+        return code;
+    };
+
+    cursor_ptr cur = execute_sql(t.ptr, sv(std::string("SELECT num, name FROM db.t;")));
+    REQUIRE(cursor_is_success(cur));
+    ArrowArrayStream stream;
+    REQUIRE(cursor_arrow_stream(cur, &stream));
+    release_cursor(cur); // the stream keeps the result
+
+    ArrowSchema schema;
+    REQUIRE(stream.get_schema(&stream, &schema) == 0);
+    REQUIRE(schema.n_children == 2);
+    REQUIRE(std::string(schema.children[0]->name) == "num");
+    REQUIRE(std::string(schema.children[0]->format) == "l");
+    REQUIRE(std::string(schema.children[1]->name) == "name");
+    REQUIRE(std::string(schema.children[1]->format) == "U");
+    schema.release(&schema);
+
+    totals_t totals;
+    REQUIRE(drain(stream, totals) == 0);
+    REQUIRE(totals.batches > 1);
+    REQUIRE(totals.rows == rows);
+    REQUIRE(totals.sum == rows * (rows - 1) / 2);
+    REQUIRE(totals.null_names == rows / 10);
+    stream.release(&stream);
+    REQUIRE(stream.release == nullptr);
+
+    // A streamed statement is exported batch by batch while it runs.
+    cursor_ptr streamed = execute_sql_stream(t.ptr, sv(std::string("SELECT num, name FROM db.t;")));
+    REQUIRE(cursor_arrow_stream(streamed, &stream));
+    release_cursor(streamed);
+    totals = {};
+    REQUIRE(drain(stream, totals) == 0);
+    REQUIRE(totals.rows == rows);
+    REQUIRE(totals.sum == rows * (rows - 1) / 2);
+    stream.release(&stream);
+
+    cursor_ptr missing = execute_sql(t.ptr, sv(std::string("SELECT num FROM db.missing;")));
+    REQUIRE(cursor_is_error(missing));
+    REQUIRE_FALSE(cursor_arrow_stream(missing, &stream));
+    release_cursor(missing);
+}
+
+// --------------------------------------------------------------------------
+// Per-query spill budget: execute_sql_with_budget lowers the budget of one
+// statement only. The join spills under it and returns the in-memory result.
+// --------------------------------------------------------------------------
+
+namespace {
+
+    // The EXPLAIN ANALYZE plan of `query` under `memory_budget`, one line per row.
+    std::string explain_analyze(otterbrix_ptr db, const std::string& query, uint64_t memory_budget) {
+        cursor_ptr cur = execute_sql_with_budget(db, sv("EXPLAIN ANALYZE " + query), memory_budget);
+        REQUIRE(cursor_is_success(cur));
+        std::string plan;
+        for (int32_t row = 0; row < cursor_size(cur); ++row) {
+            value_ptr val = cursor_get_value(cur, row, 0);
+            char* line = value_get_string(val);
+            plan += std::string(line) + '\n';
+            otterbrix_free_string(line);
+            release_value(val);
+        }
+        release_cursor(cur);
+        return plan;
+    }
+
+} // namespace
+
+TEST_CASE("c-api: execute_sql_with_budget spills one query", "[c-api][spill]") {
+    test_db_t t("budget");
+    REQUIRE(t.ptr != nullptr);
+
+    run_ok(t.ptr, "CREATE DATABASE db;");
+    run_ok(t.ptr, "CREATE TABLE db.l (k bigint, lv bigint);");
+    run_ok(t.ptr, "CREATE TABLE db.r (k bigint, rv bigint);");
+    constexpr int64_t rows = 6000;
+    std::string left = "INSERT INTO db.l (k, lv) VALUES ";
+    std::string right = "INSERT INTO db.r (k, rv) VALUES ";
+    for (int64_t i = 0; i < rows; ++i) {
+        left += (i == 0 ? "(" : ", (") + std::to_string(i) + ", " + std::to_string(i * 10) + ")";
+        right += (i == 0 ? "(" : ", (") + std::to_string(i + rows / 2) + ", " + std::to_string(i) + ")";
+    }
+    run_ok(t.ptr, left + ";");
+    run_ok(t.ptr, right + ";");
+
+    const std::string join = "SELECT SUM(r.rv) FROM db.l INNER JOIN db.r ON l.k = r.k;";
+    // Right rows i < rows / 2 find a left key.
+    constexpr int64_t expected = (rows / 2) * (rows / 2 - 1) / 2;
+    for (uint64_t budget : {uint64_t{0}, uint64_t{16 * 1024}}) {
+        cursor_ptr cur = execute_sql_with_budget(t.ptr, sv(join), budget);
+        REQUIRE(cursor_is_success(cur));
+        value_ptr val = cursor_get_value(cur, 0, 0);
+        REQUIRE(value_get_int(val) == expected);
+        release_value(val);
+        release_cursor(cur);
+    }
+
+    REQUIRE(explain_analyze(t.ptr, join, 16 * 1024).find("spill partitions=") != std::string::npos);
+    // 0 leaves the engine-wide budget, which this join fits; the 16 KiB one did not outlive its statement.
+    REQUIRE(explain_analyze(t.ptr, join, 0).find("spill partitions=") == std::string::npos);
+}
@@ -3,6 +3,7 @@
 #include <actor-zeta/spawn.hpp>
 #include <components/catalog/catalog_oids.hpp>
 #include <components/logical_plan/node_checkpoint.hpp>
+#include <components/physical_plan/operators/spill/spill_file.hpp>
 #include <core/executor.hpp>
 #include <core/file/file_handle.hpp>
 #include <core/file/local_file_system.hpp>
@@ -128,9 +129,14 @@ namespace otterbrix {
         // guards in dispatcher and disk manager skip every WAL round-trip at no cost.
         auto effective_wal_address = config.wal.on ? manager_wal_address : actor_zeta::address_t::empty_address();
 
+        // Sort runs of a previous process are garbage: no query survives a restart.
+        components::spill::spill_file_t::remove_stale(config.spill.path);
+
         manager_dispatcher_->sync(services::dispatcher::manager_dispatcher_t::sync_pack{effective_wal_address,
                                                                                         manager_disk_address,
-                                                                                        manager_index_address});
+                                                                                        manager_index_address,
+                                                                                        config.spill,
+                                                                                        config.statistics});
 
         wal_ptr->sync(services::wal::wal_sync_pack_t{actor_zeta::address_t(manager_disk_address),
                                                      manager_dispatcher_->address(),
@@ -483,6 +489,8 @@ namespace otterbrix {
         // Checkpoint all disk tables before shutdown
         if (wrapper_dispatcher_) {
             try {
+                // An open result stream holds its session's executor until it is closed.
+                wrapper_dispatcher_->close_streams();
                 auto session = components::session::session_id_t();
                 auto checkpoint_node = components::logical_plan::make_node_checkpoint(&resource);
                 wrapper_dispatcher_->execute_plan(
@@ -27,4 +27,10 @@ namespace otterbrix {
     auto execute_sql(const otterbrix_ptr& ptr, const std::string& query) -> components::cursor::cursor_t_ptr {
         return base_execute_sql(ptr.get(), query);
     }
+
+    auto execute_sql_stream(const otterbrix_ptr& ptr, const std::string& query) -> components::cursor::cursor_t_ptr {
+        assert(ptr);
+        assert(!query.empty());
+        return ptr->dispatcher()->execute_sql_stream(otterbrix::session_id_t(), query);
+    }
 } // namespace otterbrix
\ No newline at end of file
@@ -21,4 +21,7 @@ namespace otterbrix {
     auto make_otterbrix() -> otterbrix_ptr;
     auto make_otterbrix(configuration::config) -> otterbrix_ptr;
     auto execute_sql(const otterbrix_ptr& otterbrix, const std::string& query) -> components::cursor::cursor_t_ptr;
+    // The result arrives while the statement runs; see wrapper_dispatcher_t::execute_sql_stream.
+    auto execute_sql_stream(const otterbrix_ptr& otterbrix, const std::string& query)
+        -> components::cursor::cursor_t_ptr;
 } // namespace otterbrix
\ No newline at end of file
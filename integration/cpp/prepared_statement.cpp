@@ -0,0 +1,118 @@
+#include "prepared_statement.hpp"
+
+#include <components/sql/parser/parser.h>
+
+#include <cctype>
+#include <exception>
+#include <string>
+
+namespace otterbrix {
+
+    namespace {
+        bool is_space(char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; }
+
+        std::string_view trim(std::string_view query) {
+            while (!query.empty() && is_space(query.front())) {
+                query.remove_prefix(1);
+            }
+            while (!query.empty() && is_space(query.back())) {
+                query.remove_suffix(1);
+            }
+            return query;
+        }
+    } // namespace
+
+    prepared_statement_t::prepared_statement_t(std::pmr::memory_resource* resource, std::string query)
+        : query_(std::move(query))
+        , arena_(resource) {}
+
+    auto prepared_statement_t::parse(std::pmr::memory_resource* resource,
+                                     std::string query,
+                                     const components::sql::parser::parser_extension_registry_t& extensions)
+        -> core::result_wrapper_t<std::shared_ptr<const prepared_statement_t>> {
+        auto statement = std::make_shared<prepared_statement_t>(resource, std::move(query));
+        void* parse_result;
+        try {
+            parse_result = linitial(raw_parser(&statement->arena_, statement->query_.c_str(), extensions));
+        } catch (const std::exception& exception) {
+            return core::error_t(core::error_code_t::sql_parse_error, std::pmr::string{exception.what(), resource});
+        }
+        if (!parse_result) {
+            return core::error_t(core::error_code_t::sql_parse_error,
+                                 std::pmr::string{"unknown parser error", resource});
+        }
+        statement->node_ = reinterpret_cast<Node*>(parse_result);
+        statement->extensions_generation_ = extensions.generation();
+        statement->plan_key_ = std::to_string(statement->extensions_generation_) + ':' + statement->query_;
+        return std::shared_ptr<const prepared_statement_t>(std::move(statement));
+    }
+
+    std::string normalize_sql(std::string_view query) {
+        query = trim(query);
+        std::string normalized;
+        normalized.reserve(query.size());
+        char quote = 0;
+        for (size_t i = 0; i < query.size(); ++i) {
+            const char c = query[i];
+            if (quote != 0) {
+                // a doubled quote is an escaped quote and simply re-enters the literal
+                if (c == quote) {
+                    quote = 0;
+                }
+                normalized.push_back(c);
+                continue;
+            }
+            const char next = i + 1 < query.size() ? query[i + 1] : '\0';
+            if (c == '\\' || (c == '-' && next == '-') || (c == '/' && next == '*') ||
+                (c == '$' && !std::isdigit(static_cast<unsigned char>(next)))) {
+                return std::string(query);
+            }
+            if (c == '\'' || c == '"') {
+                quote = c;
+            } else if (is_space(c)) {
+                if (!is_space(next)) {
+                    normalized.push_back(' ');
+                }
+                continue;
+            }
+            normalized.push_back(c);
+        }
+        return normalized;
+    }
+
+    auto statement_cache_t::get_or_parse(std::pmr::memory_resource* resource,
+                                         std::string_view query,
+                                         const components::sql::parser::parser_extension_registry_t& extensions)
+        -> core::result_wrapper_t<prepared_statement_ptr> {
+        auto key = normalize_sql(query);
+        const auto generation = extensions.generation();
+        {
+            std::lock_guard guard(mutex_);
+            if (auto it = statements_.find(key);
+                it != statements_.end() && it->second->extensions_generation() == generation) {
+                return it->second;
+            }
+        }
+        // Parsed outside the lock; a racing miss on the same text parses twice
+        // and keeps whichever current statement landed first.
+        auto parsed = prepared_statement_t::parse(resource, key, extensions);
+        if (parsed.has_error()) {
+            return parsed;
+        }
+        std::lock_guard guard(mutex_);
+        if (auto it = statements_.find(key);
+            it != statements_.end() && it->second->extensions_generation() == parsed.value()->extensions_generation()) {
+            return it->second;
+        }
+        if (statements_.size() >= max_entries) {
+            statements_.clear();
+        }
+        return statements_.insert_or_assign(std::move(key), std::move(parsed.value())).first->second;
+    }
+
+    std::size_t statement_cache_t::size() const {
+        std::lock_guard guard(mutex_);
+        return statements_.size();
+    }
+
+} // namespace otterbrix
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include <components/sql/parser/extension.hpp>
+#include <core/result_wrapper.hpp>
+
+struct Node;
+
+namespace otterbrix {
+
+    // A SQL statement parsed once and transformed on every execution. Owns the
+    // parser arena its parse tree lives in, plus the query text the tree's
+    // locations point into. The transformer only reads the tree, so one
+    // statement can be executed from several threads at once.
+    //
+    // The logical plan a transform yields is still resolved, validated and
+    // rewritten in place by the executor, so each execution transforms afresh.
+    // Its plan_key() lets an executor keep the optimized result of a SELECT
+    // and skip those steps the next time (see executor_t::plan_cache_); the
+    // executor tags that entry with the catalog version it was planned under.
+    // Parse trees do not depend on the catalog, only on the parser extensions.
+    class prepared_statement_t {
+    public:
+        static auto parse(std::pmr::memory_resource* resource,
+                          std::string query,
+                          const components::sql::parser::parser_extension_registry_t& extensions)
+            -> core::result_wrapper_t<std::shared_ptr<const prepared_statement_t>>;
+
+        prepared_statement_t(std::pmr::memory_resource* resource, std::string query);
+
+        const std::string& query() const noexcept { return query_; }
+        Node& node() const noexcept { return *node_; }
+        // parser_extension_registry_t::generation() the statement was parsed under.
+        uint64_t extensions_generation() const noexcept { return extensions_generation_; }
+        // Identifies the statement to the executors' plan caches
+        // (execution_plan_t::cache_key): the extension generation and the text.
+        const std::string& plan_key() const noexcept { return plan_key_; }
+
+    private:
+        std::string query_;
+        uint64_t extensions_generation_{0};
+        std::string plan_key_;
+        std::pmr::monotonic_buffer_resource arena_;
+        Node* node_{nullptr};
+    };
+
+    using prepared_statement_ptr = std::shared_ptr<const prepared_statement_t>;
+
+    // Collapses runs of whitespace outside quoted literals and identifiers and
+    // trims both ends, so the same statement formatted differently shares a
+    // cache entry. Text with comments, backslashes or dollar quoting is only
+    // trimmed: collapsing it without a full lexer could change its meaning.
+    std::string normalize_sql(std::string_view query);
+
+    // Prepared statements keyed by normalized SQL text, shared by every session
+    // of a database instance. A statement parsed under an older generation of
+    // the parser extensions is parsed again. Thread-safe.
+    class statement_cache_t {
+    public:
+        // A full cache is dropped wholesale, as the catalog cache does: a
+        // workload with this many distinct statements is not re-executing them.
+        static constexpr std::size_t max_entries = 1024;
+
+        auto get_or_parse(std::pmr::memory_resource* resource,
+                          std::string_view query,
+                          const components::sql::parser::parser_extension_registry_t& extensions)
+            -> core::result_wrapper_t<prepared_statement_ptr>;
+
+        std::size_t size() const;
+
+    private:
+        mutable std::mutex mutex_;
+        std::map<std::string, prepared_statement_ptr, std::less<>> statements_;
+    };
+
+} // namespace otterbrix
@@ -0,0 +1,118 @@
+#include "test_config.hpp"
+#include <catch2/catch.hpp>
+
+#include <sstream>
+#include <string>
+
+// ANALYZE writes per-column statistics to pg_statistic; the planner reads them
+// back for its selectivity estimates and to skip an index whose predicate keeps
+// most of the table. Whichever plan it picks, results must not change.
+
+static const std::string db = "test_analyze_db";
+
+TEST_CASE("integration::cpp::analyze") {
+    auto config = test_create_config("/tmp/test_analyze/base");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto dispatcher = space.dispatcher();
+    auto session = otterbrix::session_id_t();
+
+    auto run = [&](const std::string& sql) { return dispatcher->execute_sql(session, sql); };
+
+    REQUIRE(run("CREATE DATABASE " + db + ";")->is_success());
+    REQUIRE(run("CREATE TABLE " + db + ".events (id bigint, kind bigint, name string);")->is_success());
+    REQUIRE(run("CREATE INDEX events_kind ON " + db + ".events (kind);")->is_success());
+
+    // kind is skewed: 900 rows of 42, then 100 rows spread over 0..9.
+    const int n = 1000;
+    {
+        std::stringstream insert;
+        insert << "INSERT INTO " << db << ".events (id, kind, name) VALUES ";
+        for (int i = 0; i < n; ++i) {
+            const int kind = i < 900 ? 42 : i % 10;
+            insert << "(" << i << ", " << kind << ", 'n" << i % 7 << "')" << (i == n - 1 ? ";" : ", ");
+        }
+        REQUIRE(run(insert.str())->is_success());
+    }
+
+    INFO("ANALYZE forms") {
+        REQUIRE(run("ANALYZE " + db + ".events;")->is_success());
+        REQUIRE(run("ANALYZE " + db + ".events (kind);")->is_success());
+        REQUIRE(run("ANALYZE;")->is_success());
+    }
+
+    INFO("unknown targets") {
+        REQUIRE(run("ANALYZE " + db + ".missing;")->is_error());
+        REQUIRE(run("ANALYZE " + db + ".events (missing);")->is_error());
+    }
+
+    INFO("queries over an analyzed table") {
+        // The common value: a full scan is cheaper than the index.
+        auto common = run("SELECT * FROM " + db + ".events WHERE kind = 42;");
+        REQUIRE(common->is_success());
+        REQUIRE(common->size() == 900);
+        // A rare value still goes through the index.
+        auto rare = run("SELECT * FROM " + db + ".events WHERE kind = 3;");
+        REQUIRE(rare->is_success());
+        REQUIRE(rare->size() == 10);
+        for (size_t row = 0; row < rare->size(); ++row) {
+            REQUIRE(rare->value(1, row).value<int64_t>() == 3);
+            REQUIRE(rare->value(0, row).value<int64_t>() % 10 == 3);
+        }
+        auto range = run("SELECT * FROM " + db + ".events WHERE kind < 5;");
+        REQUIRE(range->is_success());
+        REQUIRE(range->size() == 50);
+        auto none = run("SELECT * FROM " + db + ".events WHERE kind = 1000;");
+        REQUIRE(none->is_success());
+        REQUIRE(none->size() == 0);
+    }
+
+    INFO("statistics follow later writes") {
+        REQUIRE(run("DELETE FROM " + db + ".events WHERE kind = 42;")->is_success());
+        REQUIRE(run("ANALYZE " + db + ".events;")->is_success());
+        auto cur = run("SELECT * FROM " + db + ".events WHERE kind = 42;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 0);
+        auto rest = run("SELECT * FROM " + db + ".events;");
+        REQUIRE(rest->is_success());
+        REQUIRE(rest->size() == 100);
+    }
+
+    INFO("DROP TABLE removes the statistics with the table") {
+        REQUIRE(run("DROP TABLE " + db + ".events;")->is_success());
+        REQUIRE(run("ANALYZE;")->is_success());
+    }
+}
+
+TEST_CASE("integration::cpp::analyze::auto_analyze") {
+    auto config = test_create_config("/tmp/test_analyze/auto");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    config.statistics.auto_analyze_rows = 100;
+    test_spaces space(config);
+    auto dispatcher = space.dispatcher();
+    auto session = otterbrix::session_id_t();
+
+    auto run = [&](const std::string& sql) { return dispatcher->execute_sql(session, sql); };
+
+    REQUIRE(run("CREATE DATABASE " + db + ";")->is_success());
+    REQUIRE(run("CREATE TABLE " + db + ".log (id bigint, level bigint);")->is_success());
+
+    // Every INSERT crosses the threshold, so each one is followed by an ANALYZE.
+    for (int batch = 0; batch < 3; ++batch) {
+        std::stringstream insert;
+        insert << "INSERT INTO " << db << ".log (id, level) VALUES ";
+        for (int i = 0; i < 150; ++i) {
+            const int id = batch * 150 + i;
+            insert << "(" << id << ", " << id % 3 << ")" << (i == 149 ? ";" : ", ");
+        }
+        REQUIRE(run(insert.str())->is_success());
+    }
+
+    auto cur = run("SELECT * FROM " + db + ".log WHERE level = 1;");
+    REQUIRE(cur->is_success());
+    REQUIRE(cur->size() == 150);
+}
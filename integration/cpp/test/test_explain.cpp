@@ -0,0 +1,181 @@
+#include "test_config.hpp"
+#include <catch2/catch.hpp>
+
+#include <sstream>
+#include <string>
+
+// EXPLAIN answers with the optimized plan instead of running the statement;
+// EXPLAIN ANALYZE runs it and reports per-operator rows, batches, time and peak
+// memory. Both come back as rows of one "QUERY PLAN" column.
+
+static const std::string db = "test_explain_db";
+
+namespace {
+
+    std::string plan_text(const components::cursor::cursor_t_ptr& cur) {
+        std::string text;
+        for (size_t row = 0; row < cur->size(); ++row) {
+            text += std::string(cur->value(0, row).value<std::string_view>());
+            text += '\n';
+        }
+        return text;
+    }
+
+} // namespace
+
+TEST_CASE("integration::cpp::explain") {
+    auto config = test_create_config("/tmp/test_explain/base");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto dispatcher = space.dispatcher();
+    auto session = otterbrix::session_id_t();
+
+    auto run = [&](const std::string& sql) { return dispatcher->execute_sql(session, sql); };
+
+    REQUIRE(run("CREATE DATABASE " + db + ";")->is_success());
+    REQUIRE(run("CREATE TABLE " + db + ".items (id bigint, kind bigint);")->is_success());
+    REQUIRE(run("CREATE TABLE " + db + ".kinds (kind bigint, name string);")->is_success());
+
+    const int n = 100;
+    {
+        std::stringstream insert;
+        insert << "INSERT INTO " << db << ".items (id, kind) VALUES ";
+        for (int i = 0; i < n; ++i) {
+            insert << "(" << i << ", " << i % 4 << ")" << (i == n - 1 ? ";" : ", ");
+        }
+        REQUIRE(run(insert.str())->is_success());
+        REQUIRE(run("INSERT INTO " + db + ".kinds (kind, name) VALUES (0, 'a'), (1, 'b'), (2, 'c'), (3, 'd');")
+                    ->is_success());
+    }
+
+    INFO("EXPLAIN does not run the statement") {
+        auto cur = run("EXPLAIN SELECT * FROM " + db + ".items WHERE kind = 1 ORDER BY id;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() >= 2);
+        const auto text = plan_text(cur);
+        REQUIRE(text.rfind("logical: ", 0) == 0);
+        REQUIRE(text.find("-> sort") != std::string::npos);
+        REQUIRE(text.find("rows in=") == std::string::npos);
+
+        REQUIRE(run("EXPLAIN DELETE FROM " + db + ".items WHERE kind = 1;")->is_success());
+        auto count = run("SELECT * FROM " + db + ".items;");
+        REQUIRE(count->is_success());
+        REQUIRE(count->size() == n);
+    }
+
+    INFO("EXPLAIN ANALYZE reports what each operator did") {
+        auto cur = run("EXPLAIN ANALYZE SELECT * FROM " + db + ".items ORDER BY id;");
+        REQUIRE(cur->is_success());
+        const auto text = plan_text(cur);
+        REQUIRE(text.find("-> sort (rows in=100 out=100") != std::string::npos);
+        REQUIRE(text.find("peak memory=") != std::string::npos);
+
+        auto join = run("EXPLAIN ANALYZE SELECT * FROM " + db + ".items INNER JOIN " + db +
+                        ".kinds ON items.kind = kinds.kind;");
+        REQUIRE(join->is_success());
+        // Every item has a kind, whichever side the join order builds on.
+        const auto join_text = plan_text(join);
+        const auto join_line = join_text.find("join (rows in=");
+        REQUIRE(join_line != std::string::npos);
+        REQUIRE(join_text.substr(join_line, join_text.find('\n', join_line) - join_line).find(" out=100,") !=
+                std::string::npos);
+    }
+
+    INFO("EXPLAIN ANALYZE of a DML statement applies it") {
+        auto cur = run("EXPLAIN ANALYZE DELETE FROM " + db + ".items WHERE kind = 3;");
+        REQUIRE(cur->is_success());
+        REQUIRE(plan_text(cur).find("-> remove") != std::string::npos);
+        auto rest = run("SELECT * FROM " + db + ".items;");
+        REQUIRE(rest->is_success());
+        REQUIRE(rest->size() == 75);
+    }
+
+    INFO("FORMAT JSON") {
+        auto cur = run("EXPLAIN (ANALYZE, FORMAT JSON) SELECT * FROM " + db + ".items ORDER BY id;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 1);
+        const auto json = plan_text(cur);
+        REQUIRE(json.rfind("{\"logical\":\"", 0) == 0);
+        REQUIRE(json.find("\"analyze\":true") != std::string::npos);
+        REQUIRE(json.find("\"operator\":\"sort\",\"rows_in\":75,\"rows_out\":75") != std::string::npos);
+        REQUIRE(json.find("\"children\":[") != std::string::npos);
+    }
+
+    INFO("errors") {
+        REQUIRE(run("EXPLAIN (FORMAT XML) SELECT * FROM " + db + ".items;")->is_error());
+        REQUIRE(run("EXPLAIN SELECT * FROM " + db + ".missing;")->is_error());
+    }
+}
+
+TEST_CASE("integration::cpp::explain::top_n") {
+    auto config = test_create_config("/tmp/test_explain/top_n");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto dispatcher = space.dispatcher();
+    auto session = otterbrix::session_id_t();
+
+    auto run = [&](const std::string& sql) { return dispatcher->execute_sql(session, sql); };
+
+    REQUIRE(run("CREATE DATABASE " + db + ";")->is_success());
+    REQUIRE(run("CREATE TABLE " + db + ".events (id bigint, kind bigint);")->is_success());
+
+    const int n = 40000;
+    const int per_insert = 5000;
+    for (int from = 0; from < n; from += per_insert) {
+        std::stringstream insert;
+        insert << "INSERT INTO " << db << ".events (id, kind) VALUES ";
+        for (int i = from; i < from + per_insert; ++i) {
+            insert << "(" << i << ", " << i % 7 << ")" << (i == from + per_insert - 1 ? ";" : ", ");
+        }
+        REQUIRE(run(insert.str())->is_success());
+    }
+
+    INFO("ORDER BY ... LIMIT keeps only the head") {
+        auto cur = run("SELECT id FROM " + db + ".events ORDER BY id LIMIT 10;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 10);
+        for (size_t row = 0; row < cur->size(); ++row) {
+            REQUIRE(cur->value(0, row).value<int64_t>() == static_cast<int64_t>(row));
+        }
+
+        auto desc = run("SELECT id FROM " + db + ".events ORDER BY id DESC LIMIT 5 OFFSET 3;");
+        REQUIRE(desc->is_success());
+        REQUIRE(desc->size() == 5);
+        for (size_t row = 0; row < desc->size(); ++row) {
+            REQUIRE(desc->value(0, row).value<int64_t>() == static_cast<int64_t>(n - 4 - row));
+        }
+    }
+
+    INFO("the sort's bound prunes the scan") {
+        // Once the sort holds its first LIMIT rows, later vectors of the ascending ids fail the
+        // published bound inside storage and never reach the pipeline.
+        auto cur = run("EXPLAIN ANALYZE SELECT id FROM " + db + ".events ORDER BY id LIMIT 10;");
+        REQUIRE(cur->is_success());
+        const auto text = plan_text(cur);
+        const auto scan_line = text.find("-> transfer_scan (rows in=");
+        REQUIRE(scan_line != std::string::npos);
+        const auto out = text.find(" out=", scan_line);
+        REQUIRE(out != std::string::npos);
+        REQUIRE(std::stoll(text.substr(out + 5)) < n / 2);
+        REQUIRE(text.find("-> sort (rows in=") != std::string::npos);
+    }
+
+    INFO("NULL keys sort first under DESC and are never pruned") {
+        REQUIRE(run("INSERT INTO " + db + ".events (id, kind) VALUES (NULL, 0);")->is_success());
+        auto cur = run("SELECT id FROM " + db + ".events ORDER BY id DESC LIMIT 3;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 3);
+        REQUIRE(cur->value(0, 0).is_null());
+        REQUIRE(cur->value(0, 1).value<int64_t>() == n - 1);
+        REQUIRE(cur->value(0, 2).value<int64_t>() == n - 2);
+
+        auto asc = run("SELECT id FROM " + db + ".events ORDER BY id LIMIT 2;");
+        REQUIRE(asc->is_success());
+        REQUIRE(asc->size() == 2);
+        REQUIRE(asc->value(0, 1).value<int64_t>() == 1);
+    }
+}
@@ -18,6 +18,7 @@
 
 #include <memory_resource>
 #include <sstream>
+#include <tuple>
 #include <vector>
 
 using namespace components;
@@ -29,7 +30,7 @@ using operators::operator_type;
 // ----------------------------------------------------------------------------
 // Part 1 — substitution: the optimizer's rewrite_hash_joins must stamp a node_join_t
 // with algo()==hash (lowered to operator_hash_join_t by create_plan_join) exactly
-// when the condition is a single eq(left.key, right.key) on an inner/left/right/full
+// when the condition has an eq(left.key, right.key) conjunct on an inner/left/right/full
 // join, and leave it algo()==nested (lowered to operator_join_t) otherwise.
 //
 // We hand-build a logical join node whose ON-condition keys already carry
@@ -103,6 +104,49 @@ TEST_CASE("integration::cpp::hash_join::substitution") {
         CHECK(plan_type(join_type::inner, compare_type::eq, side_t::left, side_t::left) == operator_type::join);
     }
 
+    // AND of the given (cmp, left side, right side) comparisons over columns 0 and 1.
+    auto plan_type_and = [&](join_type jt, std::vector<std::tuple<compare_type, side_t, side_t>> conjuncts) {
+        auto cond = expressions::make_compare_union_expression(res, compare_type::union_and);
+        size_t col = 0;
+        for (const auto& [cmp, ls, rs] : conjuncts) {
+            cond->append_child(
+                expressions::make_compare_expression(res,
+                                                     cmp,
+                                                     expressions::param_storage{make_key(res, "l", ls, col)},
+                                                     expressions::param_storage{make_key(res, "r", rs, col)}));
+            col = (col + 1) % 2;
+        }
+        auto join = logical_plan::make_node_join(res, core::dbname_t{}, core::relname_t{}, jt);
+        join->append_child(logical_plan::make_node_raw_data(res, build_two_int_chunk(res)));
+        join->append_child(logical_plan::make_node_raw_data(res, build_two_int_chunk(res)));
+        join->append_expression(cond);
+        auto optimized = planner::optimizer::rewrite_hash_joins(res, join);
+        const auto* annotated = static_cast<const logical_plan::node_join_t*>(optimized.get());
+        auto plan =
+            services::planner::create_plan(context, registry, optimized, logical_plan::limit_t::unlimit(), nullptr);
+        REQUIRE(plan);
+        return std::make_tuple(plan->type(), annotated->left_cols().size(), annotated->residual() != nullptr);
+    };
+
+    INFO("composite keys and equi + residual conditions are rewritten to hash_join") {
+        using parts = std::vector<std::tuple<compare_type, side_t, side_t>>;
+        // l.0 = r.0 AND l.1 = r.1 — two-column key, no residual.
+        CHECK(plan_type_and(join_type::inner,
+                            parts{{compare_type::eq, side_t::left, side_t::right},
+                                  {compare_type::eq, side_t::right, side_t::left}}) ==
+              std::make_tuple(operator_type::hash_join, size_t{2}, false));
+        // l.0 = r.0 AND l.1 > r.1 — one key column, the gt is the residual.
+        CHECK(plan_type_and(join_type::left,
+                            parts{{compare_type::eq, side_t::left, side_t::right},
+                                  {compare_type::gt, side_t::left, side_t::right}}) ==
+              std::make_tuple(operator_type::hash_join, size_t{1}, true));
+        // No equi conjunct at all keeps the nested loop.
+        CHECK(std::get<0>(plan_type_and(join_type::inner,
+                                        parts{{compare_type::gt, side_t::left, side_t::right},
+                                              {compare_type::ne, side_t::left, side_t::right}})) ==
+              operator_type::join);
+    }
+
     INFO("cross join is never a hash join") {
         CHECK(plan_type(join_type::cross, compare_type::eq, side_t::left, side_t::right) == operator_type::join);
     }
@@ -215,6 +259,55 @@ TEST_CASE("integration::cpp::hash_join::correctness") {
               static_cast<size_t>(n));
     }
 
+    INFO("skewed build side — long duplicate chains next to unique keys") {
+        create("kl");
+        create("kr");
+        const int n = 3000;
+        std::stringstream l, r;
+        l << "INSERT INTO " << db << ".kl (k, lv) VALUES (0, 0), (1, 1), (" << n << ", 2);";
+        r << "INSERT INTO " << db << ".kr (k, rv) VALUES ";
+        for (int i = 0; i < n; ++i) {
+            // every third row is key 0, the rest are unique keys >= 1
+            r << "(" << (i % 3 == 0 ? 0 : i) << ", " << i << ")" << (i == n - 1 ? ";" : ", ");
+        }
+        REQUIRE(run(l.str())->is_success());
+        REQUIRE(run(r.str())->is_success());
+        // key 0 → n/3 build rows, key 1 → one, key n → none.
+        CHECK(run("SELECT * FROM " + db + ".kl INNER JOIN " + db + ".kr ON kl.k = kr.k;")->size() ==
+              static_cast<size_t>(n / 3 + 1));
+        CHECK(run("SELECT * FROM " + db + ".kl LEFT JOIN " + db + ".kr ON kl.k = kr.k;")->size() ==
+              static_cast<size_t>(n / 3 + 2));
+    }
+
+    INFO("composite keys and residual conditions") {
+        create("cl");
+        create("cr");
+        REQUIRE(run("INSERT INTO " + db + ".cl (a, b, lv) VALUES (1, 1, 10), (1, 2, 20), (2, 1, 30), (3, 3, 40);")
+                    ->is_success());
+        REQUIRE(run("INSERT INTO " + db + ".cr (a, b, rv) VALUES (1, 1, 5), (1, 1, 50), (1, 2, 15), (2, 2, 25);")
+                    ->is_success());
+        // (1,1) → 2 build rows, (1,2) → 1, (2,1) and (3,3) → none.
+        CHECK(run("SELECT * FROM " + db + ".cl INNER JOIN " + db + ".cr ON cl.a = cr.a AND cl.b = cr.b;")->size() ==
+              3);
+        CHECK(run("SELECT * FROM " + db + ".cl LEFT JOIN " + db + ".cr ON cl.a = cr.a AND cl.b = cr.b;")->size() ==
+              5);
+        // FULL adds the unmatched (2,2) build row.
+        CHECK(run("SELECT * FROM " + db + ".cl FULL JOIN " + db + ".cr ON cl.a = cr.a AND cl.b = cr.b;")->size() ==
+              6);
+        // Residual: of the key-matched pairs only rv > lv survive — (1,1,10)×(1,1,50).
+        CHECK(run("SELECT * FROM " + db + ".cl INNER JOIN " + db + ".cr ON cl.a = cr.a AND cl.b = cr.b AND cr.rv > "
+                  "cl.lv;")
+                  ->size() == 1);
+        // A pair failing the residual is not a match: LEFT pads (1,2,20) and the rest.
+        CHECK(run("SELECT * FROM " + db + ".cl LEFT JOIN " + db + ".cr ON cl.a = cr.a AND cl.b = cr.b AND cr.rv > "
+                  "cl.lv;")
+                  ->size() == 4);
+        // RIGHT keeps every build row: 1 match + 3 unmatched.
+        CHECK(run("SELECT * FROM " + db + ".cl RIGHT JOIN " + db + ".cr ON cl.a = cr.a AND cl.b = cr.b AND cr.rv > "
+                  "cl.lv;")
+                  ->size() == 4);
+    }
+
     INFO("string join keys") {
         create("sl");
         create("sr");
@@ -224,3 +317,176 @@ TEST_CASE("integration::cpp::hash_join::correctness") {
         CHECK(run("SELECT * FROM " + db + ".sl INNER JOIN " + db + ".sr ON sl.s = sr.s;")->size() == 2);
     }
 }
+
+// ----------------------------------------------------------------------------
+// Part 3 — grace partitioning: a tiny spill budget forces the build side to be
+// radix-partitioned to disk; results must match the in-memory join.
+// ----------------------------------------------------------------------------
+namespace {
+
+    // A number on the hash_join line of an EXPLAIN ANALYZE plan, read after `name`.
+    uint64_t hash_join_metric(const components::cursor::cursor_t_ptr& cur, const std::string& name) {
+        std::string plan;
+        for (size_t row = 0; row < cur->size(); ++row) {
+            plan += std::string(cur->value(0, row).value<std::string_view>()) + '\n';
+        }
+        const auto join = plan.find("-> hash_join");
+        REQUIRE(join != std::string::npos);
+        const auto line = plan.substr(join, plan.find('\n', join) - join);
+        const auto at = line.find(name);
+        REQUIRE(at != std::string::npos);
+        return std::stoull(line.substr(at + name.size()));
+    }
+
+} // namespace
+
+TEST_CASE("integration::cpp::hash_join::spilled_partitions") {
+    constexpr uint64_t budget = 256 * 1024;
+    auto config = test_create_config("/tmp/test_hash_join/spill");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    config.spill.memory_budget = budget;
+    test_spaces space(config);
+    auto dispatcher = space.dispatcher();
+    auto session = otterbrix::session_id_t();
+
+    dispatcher->execute_sql(session, "CREATE DATABASE " + db + ";");
+    auto run = [&](const std::string& sql) { return dispatcher->execute_sql(session, sql); };
+    REQUIRE(run("CREATE TABLE " + db + ".gl();")->is_success());
+    REQUIRE(run("CREATE TABLE " + db + ".gr();")->is_success());
+
+    // left keys [0, n), right keys [n/2, n + n/2) with every right key twice.
+    const int n = 6000;
+    std::stringstream l, r;
+    l << "INSERT INTO " << db << ".gl (k, lv) VALUES ";
+    r << "INSERT INTO " << db << ".gr (k, rv) VALUES ";
+    for (int i = 0; i < n; ++i) {
+        l << "(" << i << ", " << i * 10 << ")" << (i == n - 1 ? ";" : ", ");
+        r << "(" << (i / 2 + n / 2) << ", " << i << "), (" << (i / 2 + n / 2 + n / 2) << ", " << i << ")"
+          << (i == n - 1 ? ";" : ", ");
+    }
+    REQUIRE(run(l.str())->is_success());
+    REQUIRE(run(r.str())->is_success());
+
+    // Right keys cover [n/2, 3n/2) with 2 rows each; n/2 of them overlap the left.
+    CHECK(run("SELECT * FROM " + db + ".gl INNER JOIN " + db + ".gr ON gl.k = gr.k;")->size() ==
+          static_cast<size_t>(n));
+    CHECK(run("SELECT * FROM " + db + ".gl LEFT JOIN " + db + ".gr ON gl.k = gr.k;")->size() ==
+          static_cast<size_t>(n + n / 2));
+    CHECK(run("SELECT * FROM " + db + ".gl RIGHT JOIN " + db + ".gr ON gl.k = gr.k;")->size() ==
+          static_cast<size_t>(2 * n));
+    CHECK(run("SELECT * FROM " + db + ".gl FULL JOIN " + db + ".gr ON gl.k = gr.k;")->size() ==
+          static_cast<size_t>(2 * n + n / 2));
+
+    auto sum = run("SELECT SUM(gr.rv) FROM " + db + ".gl INNER JOIN " + db + ".gr ON gl.k = gr.k;");
+    REQUIRE(sum->is_success());
+    // Matched right rows are those with k < n: i / 2 + n / 2 < n, i.e. i < n, from the
+    // first tuple of each pair.
+    CHECK(sum->value(0, 0).value<int64_t>() == static_cast<int64_t>(n) * (n - 1) / 2);
+
+    // Small consecutive integer keys must still spread over the partitions, and
+    // one resident partition plus the batch in flight must fit the budget.
+    auto plan = run("EXPLAIN ANALYZE SELECT * FROM " + db + ".gl INNER JOIN " + db + ".gr ON gl.k = gr.k;");
+    REQUIRE(plan->is_success());
+    CHECK(hash_join_metric(plan, "spill partitions=") > 1);
+    CHECK(hash_join_metric(plan, "peak memory=") < budget);
+}
+
+// ----------------------------------------------------------------------------
+// Part 4 — runtime join filters: the build side's key range and Bloom filter are
+// pushed onto the probe-side scan, so the scan hands the join only rows that may
+// match. EXPLAIN ANALYZE shows what the probe scan emitted.
+// ----------------------------------------------------------------------------
+namespace {
+
+    // Rows out of the probe-side scan: the first full_scan under the hash_join.
+    uint64_t probe_scan_rows(const components::cursor::cursor_t_ptr& cur) {
+        std::string plan;
+        for (size_t row = 0; row < cur->size(); ++row) {
+            plan += std::string(cur->value(0, row).value<std::string_view>()) + '\n';
+        }
+        const auto join = plan.find("-> hash_join");
+        REQUIRE(join != std::string::npos);
+        const auto scan = plan.find("-> full_scan (rows in=", join);
+        REQUIRE(scan != std::string::npos);
+        return std::stoull(plan.substr(plan.find(" out=", scan) + 5));
+    }
+
+} // namespace
+
+TEST_CASE("integration::cpp::hash_join::runtime_filter") {
+    auto config = test_create_config("/tmp/test_hash_join/runtime_filter");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto dispatcher = space.dispatcher();
+    auto session = otterbrix::session_id_t();
+
+    dispatcher->execute_sql(session, "CREATE DATABASE " + db + ";");
+    auto run = [&](const std::string& sql) { return dispatcher->execute_sql(session, sql); };
+    REQUIRE(run("CREATE TABLE " + db + ".fact (k bigint, v bigint);")->is_success());
+    REQUIRE(run("CREATE TABLE " + db + ".dim (k bigint, name string);")->is_success());
+    REQUIRE(run("CREATE TABLE " + db + ".nodim (k bigint, name string);")->is_success());
+
+    const int n = 3000;
+    std::stringstream fact;
+    fact << "INSERT INTO " << db << ".fact (k, v) VALUES ";
+    for (int i = 0; i < n; ++i) {
+        fact << "(" << i << ", " << i % 10 << ")" << (i == n - 1 ? ";" : ", ");
+    }
+    REQUIRE(run(fact.str())->is_success());
+    // The key range spans the whole fact table; only the Bloom bits reject rows.
+    REQUIRE(run("INSERT INTO " + db + ".dim (k, name) VALUES (0, 'a'), (700, 'b'), (1500, 'c'), (2999, 'd'), "
+                "(5000, 'e');")
+                ->is_success());
+    REQUIRE(run("INSERT INTO " + db + ".nodim (k, name) VALUES (NULL, 'x');")->is_success());
+
+    INFO("inner join: the probe scan drops rows without a build key") {
+        auto joined = run("SELECT * FROM " + db + ".fact INNER JOIN " + db + ".dim ON fact.k = dim.k;");
+        REQUIRE(joined->is_success());
+        CHECK(joined->size() == 4);
+
+        auto plan =
+            run("EXPLAIN ANALYZE SELECT * FROM " + db + ".fact INNER JOIN " + db + ".dim ON fact.k = dim.k;");
+        REQUIRE(plan->is_success());
+        const auto rows = probe_scan_rows(plan);
+        CHECK(rows >= 4);
+        CHECK(rows < static_cast<uint64_t>(n) / 10);
+    }
+
+    INFO("the scan predicate and the runtime filter combine") {
+        auto joined =
+            run("SELECT * FROM " + db + ".fact INNER JOIN " + db + ".dim ON fact.k = dim.k WHERE fact.v = 0;");
+        REQUIRE(joined->is_success());
+        CHECK(joined->size() == 3);
+    }
+
+    INFO("right join keeps unmatched build rows") {
+        auto joined = run("SELECT * FROM " + db + ".fact RIGHT JOIN " + db + ".dim ON fact.k = dim.k;");
+        REQUIRE(joined->is_success());
+        CHECK(joined->size() == 5);
+    }
+
+    INFO("left join is not filtered") {
+        auto joined = run("SELECT * FROM " + db + ".fact LEFT JOIN " + db + ".dim ON fact.k = dim.k;");
+        REQUIRE(joined->is_success());
+        CHECK(joined->size() == static_cast<size_t>(n));
+
+        auto plan = run("EXPLAIN ANALYZE SELECT * FROM " + db + ".fact LEFT JOIN " + db + ".dim ON fact.k = dim.k;");
+        REQUIRE(plan->is_success());
+        CHECK(probe_scan_rows(plan) == static_cast<uint64_t>(n));
+    }
+
+    INFO("a build side without keys matches nothing") {
+        auto joined = run("SELECT * FROM " + db + ".fact INNER JOIN " + db + ".nodim ON fact.k = nodim.k;");
+        REQUIRE(joined->is_success());
+        CHECK(joined->size() == 0);
+
+        auto plan =
+            run("EXPLAIN ANALYZE SELECT * FROM " + db + ".fact INNER JOIN " + db + ".nodim ON fact.k = nodim.k;");
+        REQUIRE(plan->is_success());
+        CHECK(probe_scan_rows(plan) == 0);
+    }
+}
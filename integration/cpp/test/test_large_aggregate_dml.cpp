@@ -258,3 +258,67 @@ TEST_CASE("integration::cpp::large_aggregate_dml::cascade_delete_over_1024_child
         REQUIRE(kept->value(0, 0).value<int64_t>() == 3);
     }
 }
+
+// ----------------------------------------------------------------------------
+// E) High-cardinality GROUP BY: partitioned, parallel and spilled.
+//
+// 20000 distinct keys crosses the radix-partitioning threshold; with four
+// operator threads the batches are pre-aggregated in parallel, and the tiny
+// spill budget evicts partial states to disk between rounds. Every group must
+// still come out exactly once with its full aggregate.
+// ----------------------------------------------------------------------------
+TEST_CASE("integration::cpp::large_aggregate_dml::group_by_partitioned_spill") {
+    auto config = test_create_config("/tmp/test_large_aggregate_dml_group_by_spill");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    config.spill.memory_budget = 64 * 1024;
+    config.spill.operator_threads = 4;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    constexpr unsigned kGroups = 20000;
+    REQUIRE(exec(dispatcher, "CREATE DATABASE AggDb;")->is_success());
+    REQUIRE(exec(dispatcher, "CREATE TABLE AggDb.t (k bigint, v bigint);")->is_success());
+
+    // Rows 2k and 2k + 1 belong to key k → COUNT(*) == 2, SUM(v) == 4k + 1.
+    insert_in_batches(dispatcher, "AggDb.t (k, v)", kGroups * 2, 2000, [](unsigned i) {
+        return "(" + std::to_string(i / 2) + ", " + std::to_string(i) + ")";
+    });
+
+    auto counts = exec(dispatcher, "SELECT k, COUNT(*) AS c FROM AggDb.t GROUP BY k;");
+    INFO("GROUP BY error: " << (counts->is_error() ? counts->get_error().what : "none"));
+    REQUIRE(counts->is_success());
+    REQUIRE(counts->size() == static_cast<std::size_t>(kGroups));
+    REQUIRE(group_value_for_key(counts, 0) == 2);
+    REQUIRE(group_value_for_key(counts, 12345) == 2);
+    REQUIRE(group_value_for_key(counts, kGroups - 1) == 2);
+
+    auto sums = exec(dispatcher, "SELECT k, SUM(v) AS s FROM AggDb.t GROUP BY k;");
+    REQUIRE(sums->is_success());
+    REQUIRE(sums->size() == static_cast<std::size_t>(kGroups));
+    int64_t total = 0;
+    for (uint64_t r = 0; r < sums->size(); ++r) {
+        const auto key = sums->value(0, r).value<int64_t>();
+        REQUIRE(sums->value(1, r).value<int64_t>() == 4 * key + 1);
+        total += key;
+    }
+    // Each key exactly once.
+    REQUIRE(total == static_cast<int64_t>(kGroups) * (kGroups - 1) / 2);
+
+    // The dense keys 0..kGroups-1 must spread over the radix partitions rather
+    // than all spilling through one.
+    auto plan = exec(dispatcher, "EXPLAIN ANALYZE SELECT k, COUNT(*) AS c FROM AggDb.t GROUP BY k;");
+    REQUIRE(plan->is_success());
+    std::string text;
+    for (uint64_t r = 0; r < plan->size(); ++r) {
+        text += std::string(plan->value(0, r).value<std::string_view>()) + '\n';
+    }
+    const auto aggregate = text.find("-> aggregate");
+    REQUIRE(aggregate != std::string::npos);
+    const auto line = text.substr(aggregate, text.find('\n', aggregate) - aggregate);
+    const auto at = line.find("spill partitions=");
+    INFO(line);
+    REQUIRE(at != std::string::npos);
+    CHECK(std::stoull(line.substr(at + std::string("spill partitions=").size())) > 1);
+}
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include <components/types/logical_value.hpp>
+#include <services/collection/executor.hpp>
 
 using namespace components;
 using namespace components::cursor;
@@ -572,3 +573,115 @@ TEST_CASE("integration::cpp::params::error_code_contracts") {
         // message, so we assert only the error code contract here.
     }
 }
+
+TEST_CASE("integration::cpp::params::prepared_statement") {
+    auto space = make_space("prepared_statement");
+    auto* dispatcher = space.dispatcher();
+    auto* resource = dispatcher->resource();
+
+    {
+        auto session = otterbrix::session_id_t();
+        REQUIRE(dispatcher->execute_sql(session, "CREATE DATABASE ParamDb;")->is_success());
+    }
+    {
+        auto session = otterbrix::session_id_t();
+        REQUIRE(dispatcher->execute_sql(session, "CREATE TABLE ParamDb.Items (k bigint, v string);")->is_success());
+    }
+    {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "INSERT INTO ParamDb.Items (k, v) VALUES (1, 'a'), (2, 'b');");
+        REQUIRE(cur->is_success());
+    }
+
+    INFO("formatting differences share one parse") {
+        auto first = dispatcher->prepare("SELECT v FROM ParamDb.Items WHERE k = $1;");
+        auto second = dispatcher->prepare("  SELECT v\n  FROM ParamDb.Items   WHERE k = $1; ");
+        REQUIRE_FALSE(first.has_error());
+        REQUIRE_FALSE(second.has_error());
+        REQUIRE(first.value() == second.value());
+        auto literal = dispatcher->prepare("SELECT v FROM ParamDb.Items WHERE v = 'a  b';");
+        REQUIRE_FALSE(literal.has_error());
+        REQUIRE(literal.value()->query() == "SELECT v FROM ParamDb.Items WHERE v = 'a  b';");
+    }
+
+    INFO("re-execution rebinds parameters, across DDL") {
+        auto statement = dispatcher->prepare("SELECT v FROM ParamDb.Items WHERE k = $1;");
+        REQUIRE_FALSE(statement.has_error());
+        auto lookup = [&](int64_t k) {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_prepared(session,
+                                                    statement.value(),
+                                                    params_t{{1, types::logical_value_t{resource, k}}});
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 1);
+            return std::string(cur->value(0, 0).value<std::string_view>());
+        };
+        REQUIRE(lookup(1) == "a");
+        REQUIRE(lookup(2) == "b");
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session, "ALTER TABLE ParamDb.Items ADD COLUMN extra bigint;");
+            REQUIRE(cur->is_success());
+        }
+        REQUIRE(lookup(1) == "a");
+    }
+
+    INFO("re-executions reuse the optimized plan until the catalog changes") {
+        auto statement = dispatcher->prepare("SELECT v FROM ParamDb.Items WHERE k = $1;");
+        REQUIRE_FALSE(statement.has_error());
+        // A session's statements all run on the same executor, and so meet its plan cache.
+        auto session = otterbrix::session_id_t();
+        auto lookup = [&](int64_t k) {
+            auto cur = dispatcher->execute_prepared(session,
+                                                    statement.value(),
+                                                    params_t{{1, types::logical_value_t{resource, k}}});
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 1);
+            return std::string(cur->value(0, 0).value<std::string_view>());
+        };
+        REQUIRE(lookup(1) == "a");
+        const auto hits = services::collection::executor::plan_cache_hits();
+        REQUIRE(lookup(2) == "b");
+        REQUIRE(lookup(1) == "a");
+        REQUIRE(services::collection::executor::plan_cache_hits() == hits + 2);
+        {
+            auto ddl_session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(ddl_session, "ALTER TABLE ParamDb.Items ADD COLUMN note string;");
+            REQUIRE(cur->is_success());
+        }
+        REQUIRE(lookup(2) == "b");
+        REQUIRE(services::collection::executor::plan_cache_hits() == hits + 2);
+        REQUIRE(lookup(1) == "a");
+        REQUIRE(services::collection::executor::plan_cache_hits() == hits + 3);
+    }
+
+    INFO("a comma join is transformed from the same parse tree every time") {
+        {
+            auto session = otterbrix::session_id_t();
+            REQUIRE(dispatcher->execute_sql(session, "CREATE TABLE ParamDb.Tags (k bigint, tag string);")
+                        ->is_success());
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session, "INSERT INTO ParamDb.Tags (k, tag) VALUES (1, 'x'), (1, 'y');");
+            REQUIRE(cur->is_success());
+        }
+        auto statement =
+            dispatcher->prepare("SELECT * FROM ParamDb.Items, ParamDb.Tags WHERE Items.k = Tags.k AND Items.k = $1;");
+        REQUIRE_FALSE(statement.has_error());
+        auto session = otterbrix::session_id_t();
+        for (int64_t k : {1, 2, 1, 2}) {
+            auto cur = dispatcher->execute_prepared(session,
+                                                    statement.value(),
+                                                    params_t{{1, types::logical_value_t{resource, k}}});
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == (k == 1 ? 2 : 0));
+        }
+    }
+
+    INFO("parse errors are reported and not cached") {
+        auto statement = dispatcher->prepare("SELEC v FROM ParamDb.Items;");
+        REQUIRE(statement.has_error());
+        REQUIRE(statement.error().type == core::error_code_t::sql_parse_error);
+    }
+}
@@ -4505,3 +4505,147 @@ TEST_CASE("integration::cpp::test_sql_features::ddl statements return an empty c
         }
     }
 }
+
+// Resolves of repeated statements are served from the shared catalog cache; a
+// committed DDL must invalidate it, and a txn's own uncommitted DDL must stay
+// visible to that txn (and only to it) although the cache holds the old schema.
+TEST_CASE("integration::cpp::test_sql_features::catalog_cache_follows_ddl") {
+    auto config = test_create_config("/tmp/test_sql_features/catalog_cache_follows_ddl");
+    test_clear_directory(config);
+    config.disk.on = true;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    auto select_all = [&](otterbrix::session_id_t session) {
+        auto cur = dispatcher->execute_sql(session, "SELECT * FROM TestDatabase.items;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 2);
+        return cur->column_count();
+    };
+
+    INFO("setup") {
+        {
+            auto session = otterbrix::session_id_t();
+            REQUIRE(dispatcher->execute_sql(session, "CREATE DATABASE TestDatabase;")->is_success());
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            REQUIRE(dispatcher->execute_sql(session, "CREATE TABLE TestDatabase.items (id bigint, val bigint);")
+                        ->is_success());
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur =
+                dispatcher->execute_sql(session, "INSERT INTO TestDatabase.items (id, val) VALUES (1, 10), (2, 20);");
+            REQUIRE(cur->is_success());
+        }
+    }
+
+    INFO("repeated reads see the same schema") {
+        REQUIRE(select_all(otterbrix::session_id_t()) == 2);
+        REQUIRE(select_all(otterbrix::session_id_t()) == 2);
+    }
+
+    INFO("committed ALTER invalidates the cached table") {
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session, "ALTER TABLE TestDatabase.items ADD COLUMN extra bigint;");
+            REQUIRE(cur->is_success());
+        }
+        REQUIRE(select_all(otterbrix::session_id_t()) == 3);
+        REQUIRE(select_all(otterbrix::session_id_t()) == 3);
+    }
+
+    INFO("uncommitted ALTER is seen only by its own txn") {
+        auto session = otterbrix::session_id_t();
+        REQUIRE(dispatcher->execute_sql(session, "BEGIN;")->is_success());
+        REQUIRE(dispatcher->execute_sql(session, "ALTER TABLE TestDatabase.items ADD COLUMN more bigint;")
+                    ->is_success());
+        REQUIRE(select_all(session) == 4);
+        REQUIRE(select_all(otterbrix::session_id_t()) == 3);
+        REQUIRE(dispatcher->execute_sql(session, "ROLLBACK;")->is_success());
+        REQUIRE(select_all(otterbrix::session_id_t()) == 3);
+    }
+
+    INFO("DROP TABLE invalidates the cached table") {
+        {
+            auto session = otterbrix::session_id_t();
+            REQUIRE(dispatcher->execute_sql(session, "DROP TABLE TestDatabase.items;")->is_success());
+        }
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "SELECT * FROM TestDatabase.items;");
+        REQUIRE(cur->is_error());
+    }
+}
+
+TEST_CASE("integration::cpp::test_sql_features::external_sort") {
+    auto config = test_create_config("/tmp/test_sql_features/external_sort");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    // A few batches' worth: the sort spills several runs and merges them.
+    config.spill.memory_budget = 32 * 1024;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    constexpr int64_t row_count = 10000;
+    INFO("initialization") {
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->execute_sql(session, "CREATE DATABASE TestDatabase;");
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->execute_sql(session, "CREATE TABLE TestDatabase.TestCollection (name string, value bigint);");
+        }
+        {
+            // 7919 is coprime with row_count: every value appears once, out of order.
+            std::stringstream query;
+            query << "INSERT INTO TestDatabase.TestCollection (name, value) VALUES ";
+            for (int64_t i = 0; i < row_count; ++i) {
+                const int64_t value = (i * 7919) % row_count;
+                query << "('Name " << value << "', " << value << ")" << (i + 1 == row_count ? ";" : ", ");
+            }
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session, query.str());
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == row_count);
+        }
+    }
+
+    INFO("full order") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT name, value FROM TestDatabase.TestCollection ORDER BY value DESC;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == row_count);
+        for (int64_t i = 0; i < row_count; ++i) {
+            const int64_t value = row_count - 1 - i;
+            REQUIRE(cur->value(1, i).value<int64_t>() == value);
+            REQUIRE(cur->value(0, i).value<std::string_view>() == "Name " + std::to_string(value));
+        }
+    }
+
+    INFO("limit and offset across runs") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT value FROM TestDatabase.TestCollection "
+                                           "ORDER BY value LIMIT 5 OFFSET 4321;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 5);
+        for (int64_t i = 0; i < 5; ++i) {
+            REQUIRE(cur->value(0, i).value<int64_t>() == 4321 + i);
+        }
+    }
+
+    INFO("runs are removed after the query") {
+        size_t leftovers = 0;
+        if (std::filesystem::exists(config.spill.path)) {
+            for (const auto& entry : std::filesystem::directory_iterator(config.spill.path)) {
+                leftovers += entry.path().extension() == ".spill";
+            }
+        }
+        REQUIRE(leftovers == 0);
+    }
+}
@@ -90,30 +90,103 @@ namespace otterbrix {
 
     cursor_t_ptr wrapper_dispatcher_t::execute_sql(const components::session::session_id_t& session,
                                                    const std::string& query) {
+        trace(log_, "wrapper_dispatcher_t::execute sql session: {}", session.data());
+        if (auto result = transform_sql(query); result.has_error()) {
+            return make_cursor(resource(), result.error());
+        } else {
+            return execute_plan(session, std::move(result.value()));
+        }
+    }
+
+    cursor_t_ptr wrapper_dispatcher_t::execute_sql_with_budget(const components::session::session_id_t& session,
+                                                               const std::string& query,
+                                                               uint64_t memory_budget) {
+        trace(log_, "wrapper_dispatcher_t::execute sql session: {}, memory budget: {}", session.data(), memory_budget);
+        if (auto result = transform_sql(query); result.has_error()) {
+            return make_cursor(resource(), result.error());
+        } else {
+            result.value().memory_budget = memory_budget;
+            return execute_plan(session, std::move(result.value()));
+        }
+    }
+
+    auto wrapper_dispatcher_t::transform_sql(const std::string& query)
+        -> core::result_wrapper_t<components::logical_plan::execution_plan_t> {
         using namespace components::sql::transform;
 
-        trace(log_, "wrapper_dispatcher_t::execute sql session: {}", session.data());
         std::pmr::monotonic_buffer_resource parser_arena(resource());
         void* parse_result;
         try {
             parse_result = linitial(raw_parser(&parser_arena, query.c_str(), parser_extensions_));
         } catch (const std::exception& exception) {
-            return make_cursor(
-                resource(),
-                core::error_t(core::error_code_t::sql_parse_error, std::pmr::string{exception.what(), resource()}));
+            return core::error_t(core::error_code_t::sql_parse_error, std::pmr::string{exception.what(), resource()});
         }
 
         if (!parse_result) {
-            return make_cursor(resource(),
-                               core::error_t(core::error_code_t::sql_parse_error,
-                                             std::pmr::string{"unknown parser error", resource()}));
+            return core::error_t(core::error_code_t::sql_parse_error,
+                                 std::pmr::string{"unknown parser error", resource()});
         }
         transformer local_transformer(resource(), query.c_str(), &parser_extensions_);
-        if (auto result = local_transformer.transform(pg_cell_to_node_cast(parse_result)).finalize();
-            result.has_error()) {
+        return local_transformer.transform(pg_cell_to_node_cast(parse_result)).finalize();
+    }
+
+    cursor_t_ptr wrapper_dispatcher_t::execute_sql_stream(const components::session::session_id_t& session,
+                                                          const std::string& query) {
+        trace(log_, "wrapper_dispatcher_t::execute sql (stream) session: {}", session.data());
+        if (auto result = transform_sql(query); result.has_error()) {
             return make_cursor(resource(), result.error());
         } else {
-            return execute_plan(session, std::move(result.value()));
+            return execute_plan_stream(session, std::move(result.value()));
+        }
+    }
+
+    cursor_t_ptr wrapper_dispatcher_t::execute_plan_stream(const session_id_t& session,
+                                                           components::logical_plan::execution_plan_t plan) {
+        if (!plan.parameters) {
+            plan.parameters = components::logical_plan::make_parameter_node(resource());
+        }
+        close_stream(session);
+        trace(log_, "wrapper_dispatcher_t::execute_plan_stream session: {}", session.data());
+
+        auto stream = make_chunk_stream();
+        plan.stream = stream;
+        auto [_, future] = actor_zeta::otterbrix::send(manager_dispatcher_->address(),
+                                                       &services::dispatcher::manager_dispatcher_t::execute_plan,
+                                                       session,
+                                                       std::move(plan));
+        {
+            std::lock_guard lock(streams_mutex_);
+            // Streams that ended since are forgotten here: their reply is in, nothing waits on it.
+            std::erase_if(open_streams_, [](auto& entry) { return entry.second.future.is_ready(); });
+            open_streams_.insert_or_assign(session, open_stream_t{stream, std::move(future)});
+        }
+        // Blocks until the first chunk or the statement's failure is known.
+        return make_cursor(resource(), std::move(stream));
+    }
+
+    void wrapper_dispatcher_t::close_stream(const session_id_t& session) {
+        std::unique_lock lock(streams_mutex_);
+        auto it = open_streams_.find(session);
+        if (it == open_streams_.end()) {
+            return;
+        }
+        auto open = std::move(it->second);
+        open_streams_.erase(it);
+        lock.unlock();
+        // The statement may be parked on a full stream: release it, then let it finish before the
+        // session sends anything else.
+        open.stream->cancel();
+        wait_future(open.future);
+    }
+
+    void wrapper_dispatcher_t::close_streams() {
+        std::unique_lock lock(streams_mutex_);
+        auto open_streams = std::move(open_streams_);
+        open_streams_.clear();
+        lock.unlock();
+        for (auto& [session, open] : open_streams) {
+            open.stream->cancel();
+            wait_future(open.future);
         }
     }
 
@@ -121,26 +194,27 @@ namespace otterbrix {
         const components::session::session_id_t& session,
         const std::string& query,
         const std::vector<std::pair<size_t, components::types::logical_value_t>>& params) {
-        using namespace components::sql::transform;
-
         trace(log_, "wrapper_dispatcher_t::execute sql (params) session: {}", session.data());
-        std::pmr::monotonic_buffer_resource parser_arena(resource());
-        void* parse_result;
-        try {
-            parse_result = linitial(raw_parser(&parser_arena, query.c_str(), parser_extensions_));
-        } catch (const std::exception& exception) {
-            return make_cursor(
-                resource(),
-                core::error_t(core::error_code_t::sql_parse_error, std::pmr::string{exception.what(), resource()}));
+        auto statement = prepare(query);
+        if (statement.has_error()) {
+            return make_cursor(resource(), statement.error());
         }
+        return execute_prepared(session, statement.value(), params);
+    }
 
-        if (!parse_result) {
-            return make_cursor(resource(),
-                               core::error_t(core::error_code_t::sql_parse_error,
-                                             std::pmr::string{"unknown parser error", resource()}));
-        }
-        transformer local_transformer(resource(), query.c_str(), &parser_extensions_);
-        auto binder = local_transformer.transform(pg_cell_to_node_cast(parse_result));
+    auto wrapper_dispatcher_t::prepare(const std::string& query) -> core::result_wrapper_t<prepared_statement_ptr> {
+        return statements_.get_or_parse(resource(), query, parser_extensions_);
+    }
+
+    cursor_t_ptr wrapper_dispatcher_t::execute_prepared(
+        const components::session::session_id_t& session,
+        const prepared_statement_ptr& statement,
+        const std::vector<std::pair<size_t, components::types::logical_value_t>>& params) {
+        using namespace components::sql::transform;
+
+        trace(log_, "wrapper_dispatcher_t::execute prepared session: {}", session.data());
+        transformer local_transformer(resource(), statement->query().c_str(), &parser_extensions_);
+        auto binder = local_transformer.transform(statement->node());
         try {
             for (const auto& [id, value] : params) {
                 binder.bind(id, value);
@@ -156,6 +230,7 @@ namespace otterbrix {
             return make_cursor(resource(), finalized.error());
         }
         auto& plan = std::move(finalized).value();
+        plan.cache_key.assign(statement->plan_key());
         return execute_plan(session, std::move(plan));
     }
 
@@ -183,6 +258,7 @@ namespace otterbrix {
               session.data(),
               plan.sub_queries.back()->to_string());
         assert(plan.parameters);
+        close_stream(session);
 
         auto [_, future] = actor_zeta::otterbrix::send(manager_dispatcher_->address(),
                                                        &services::dispatcher::manager_dispatcher_t::execute_plan,
@@ -4,6 +4,7 @@
 #include <condition_variable>
 #include <functional>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -27,6 +28,8 @@
 
 #include <services/dispatcher/dispatcher.hpp>
 
+#include "prepared_statement.hpp"
+
 namespace otterbrix {
 
     using components::session::session_id_t;
@@ -63,8 +66,30 @@ namespace otterbrix {
                                      const std::string& query,
                                      const std::vector<std::pair<size_t, components::types::logical_value_t>>& params)
             -> components::cursor::cursor_t_ptr;
+        // Runs `query` with its own spill budget in bytes in place of config_spill::memory_budget;
+        // 0 keeps the engine-wide budget.
+        auto execute_sql_with_budget(const session_id_t& session, const std::string& query, uint64_t memory_budget)
+            -> components::cursor::cursor_t_ptr;
+        // Parses `query` once per distinct normalized text; the statement is
+        // shared by every session and re-executed with execute_prepared.
+        auto prepare(const std::string& query) -> core::result_wrapper_t<prepared_statement_ptr>;
+        auto execute_prepared(const session_id_t& session,
+                              const prepared_statement_ptr& statement,
+                              const std::vector<std::pair<size_t, components::types::logical_value_t>>& params)
+            -> components::cursor::cursor_t_ptr;
         auto set_timezone(const session_id_t& session, std::string timezone_name) -> components::cursor::cursor_t_ptr;
 
+        // Streaming variants: the returned cursor hands out the result while the statement still
+        // runs (next_chunk(), or has_next()/advance() row by row) and a client that reads slowly
+        // pauses it. A session has one open stream at a time: its next statement closes the
+        // previous stream first, as does dropping the cursor.
+        auto execute_plan_stream(const session_id_t& session, components::logical_plan::execution_plan_t plan)
+            -> components::cursor::cursor_t_ptr;
+        auto execute_sql_stream(const session_id_t& session, const std::string& query)
+            -> components::cursor::cursor_t_ptr;
+        // Closes every open stream and waits for their statements; called before shutdown.
+        void close_streams();
+
         auto add_parser_extension(components::sql::parser::parser_extension_t extension)
             -> core::result_wrapper_t<const components::sql::parser::parser_extension_t*>;
 
@@ -74,17 +99,30 @@ namespace otterbrix {
         actor_zeta::scheduler_raw scheduler_;
         log_t log_;
         components::sql::parser::parser_extension_registry_t parser_extensions_;
+        statement_cache_t statements_;
         std::atomic_int i = 0;
 
         std::mutex event_loop_mutex_;
         std::condition_variable event_loop_cv_;
 
+        // Statements whose result is being streamed, by session: the stream to cancel and the
+        // dispatcher's reply, which arrives once the statement is over.
+        struct open_stream_t {
+            components::cursor::chunk_stream_ptr stream;
+            unique_future<components::cursor::cursor_t_ptr> future;
+        };
+        std::mutex streams_mutex_;
+        std::unordered_map<session_id_t, open_stream_t> open_streams_;
+
         template<typename T>
         T wait_future(unique_future<T>& future);
         void wait_future_void(unique_future<void>& future);
 
         auto send_plan(const session_id_t& session, components::logical_plan::execution_plan_t node)
             -> components::cursor::cursor_t_ptr;
+        auto transform_sql(const std::string& query) -> core::result_wrapper_t<components::logical_plan::execution_plan_t>;
+        // Cancels the session's open stream, if any, and waits for its statement to end.
+        void close_stream(const session_id_t& session);
     };
 
     template<typename T>
@@ -2,6 +2,8 @@ namespace Duckstax.Otterbrix
 {
     using System;
     using System.Runtime.InteropServices;
+    using Apache.Arrow.C;
+    using Apache.Arrow.Ipc;
 
     public class CursorWrapper : IDisposable
     {
@@ -43,6 +45,10 @@ namespace Duckstax.Otterbrix
         [DllImport(libotterbrix, EntryPoint="cursor_get_value_by_name", ExactSpelling=false, CallingConvention=CallingConvention.Cdecl)]
         private static extern IntPtr CursorGetValueByName(IntPtr ptr, int rowIndex, StringPasser columnName);
 
+        [DllImport(libotterbrix, EntryPoint="cursor_arrow_stream", ExactSpelling=false, CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        private static extern unsafe bool CursorArrowStream(IntPtr ptr, CArrowArrayStream* stream);
+
         public CursorWrapper(IntPtr cursorStoragePtr) { this.cursorStoragePtr = cursorStoragePtr; }
 
         ~CursorWrapper() { Dispose(false); }
@@ -91,6 +97,21 @@ namespace Duckstax.Otterbrix
             return new ValueWrapper(CursorGetValueByName(cursorStoragePtr, rowIndex, new StringPasser(ref columnName)));
         }
 
+        // The result as Arrow record batches, one per chunk, imported through the Arrow C stream
+        // interface: no per-cell calls, and fixed-width numeric columns arrive without a copy. The
+        // stream holds its own reference to the result and outlives this cursor, not the database.
+        public unsafe IArrowArrayStream ArrowStream() {
+            CArrowArrayStream* stream = CArrowArrayStream.Create();
+            try {
+                if (!CursorArrowStream(cursorStoragePtr, stream)) {
+                    throw new InvalidOperationException(GetError().what);
+                }
+                return CArrowArrayStreamImporter.ImportArrayStream(stream);
+            } finally {
+                CArrowArrayStream.Free(stream);
+            }
+        }
+
         private IntPtr cursorStoragePtr;
     }
 }
\ No newline at end of file
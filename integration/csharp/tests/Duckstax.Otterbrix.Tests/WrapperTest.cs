@@ -1,5 +1,7 @@
 namespace Duckstax.Otterbrix.Tests;
 
+using Apache.Arrow;
+using Apache.Arrow.Ipc;
 using Duckstax.Otterbrix;
 
 public class Tests
@@ -271,4 +273,42 @@ public class Tests
             }
         }
     }
+
+    // [Test]
+    public void ArrowStream() {
+        OtterbrixWrapper otterbrix = new OtterbrixWrapper(Config.CreateConfig(System.Environment.CurrentDirectory + "/ArrowStream"));
+        {
+            Assert.IsTrue(otterbrix.CreateDatabase("TestDatabase").IsSuccess());
+            Assert.IsTrue(otterbrix.CreateCollection("TestDatabase", "TestCollection").IsSuccess());
+        }
+        {
+            string query = "INSERT INTO TestDatabase.TestCollection (name, count) VALUES ";
+            for (int num = 0; num < 100; ++num) {
+                query += ("('Name " + num + "', " + num + ")" +
+                          (num == 99 ? ";" : ", "));
+            }
+            CursorWrapper cursor = otterbrix.Execute(query);
+            Assert.IsTrue(cursor.IsSuccess());
+        }
+        {
+            string query = "SELECT * FROM TestDatabase.TestCollection ORDER BY count;";
+            CursorWrapper cursor = otterbrix.Execute(query);
+            Assert.IsTrue(cursor.IsSuccess());
+
+            using IArrowArrayStream stream = cursor.ArrowStream();
+            long expected = 0;
+            RecordBatch? batch;
+            while ((batch = stream.ReadNextRecordBatchAsync().Result) != null) {
+                using (batch) {
+                    Int64Array counts = (Int64Array) batch.Column(batch.Schema.GetFieldIndex("count"));
+                    LargeStringArray names = (LargeStringArray) batch.Column(batch.Schema.GetFieldIndex("name"));
+                    for (int index = 0; index < batch.Length; ++index, ++expected) {
+                        Assert.IsTrue(counts.GetValue(index) == expected);
+                        Assert.IsTrue(names.GetString(index) == "Name " + expected.ToString());
+                    }
+                }
+            }
+            Assert.IsTrue(expected == 100);
+        }
+    }
 }
\ No newline at end of file
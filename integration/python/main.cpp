@@ -44,7 +44,8 @@ PYBIND11_MODULE(OTTERBRIX_PYTHON_LIB_NAME, m) {
         .def(pybind11::init([]() { return new wrapper_client(spaces::get_instance()); }))
         .def(pybind11::init(
             [](const pybind11::str& s) { return new wrapper_client(spaces::get_instance(std::string(s))); }))
-        .def("execute", &wrapper_client::execute, pybind11::arg("query"));
+        .def("execute", &wrapper_client::execute, pybind11::arg("query"), pybind11::arg("params") = pybind11::none())
+        .def("execute_stream", &wrapper_client::execute_stream, pybind11::arg("query"));
 
     pybind11::class_<wrapper_connection>(m, "Connection")
         .def(pybind11::init([](wrapper_client* client) { return new wrapper_connection(client); }))
@@ -73,6 +74,7 @@ PYBIND11_MODULE(OTTERBRIX_PYTHON_LIB_NAME, m) {
         .def("fetchone", &wrapper_cursor::fetchone)
         .def("fetchmany", &wrapper_cursor::fetchmany, pybind11::arg("size") = 1)
         .def("fetchall", &wrapper_cursor::fetchall)
+        .def("fetch_chunk", &wrapper_cursor::fetch_chunk)
         .def_property_readonly("description", &wrapper_cursor::description)
         .def_property_readonly("rowcount", &wrapper_cursor::rowcount);
 
@@ -3,6 +3,7 @@
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
 
+#include "convert.hpp"
 #include "spaces.hpp"
 #include <utility>
 
@@ -20,10 +21,28 @@ namespace otterbrix {
 
     wrapper_client::~wrapper_client() { trace(log_, "delete wrapper_client"); }
 
-    wrapper_cursor_ptr wrapper_client::execute(const std::string& query) {
+    wrapper_cursor_ptr wrapper_client::execute(const std::string& query, const py::object& params) {
         debug(log_, "wrapper_client::execute");
         auto session = otterbrix::session_id_t();
+        auto* dispatcher = ptr_->dispatcher();
+        if (params.is_none()) {
+            return wrapper_cursor_ptr(new wrapper_cursor{dispatcher->execute_sql(session, query), dispatcher});
+        }
+        std::vector<std::pair<size_t, components::types::logical_value_t>> bound;
+        size_t id = 0;
+        for (const auto& param : params) {
+            bound.emplace_back(++id, to_value(dispatcher->resource(), param));
+        }
         return wrapper_cursor_ptr(
-            new wrapper_cursor{ptr_->dispatcher()->execute_sql(session, query), ptr_->dispatcher()});
+            new wrapper_cursor{dispatcher->execute_sql_with_params(session, query, bound), dispatcher});
+    }
+
+    wrapper_cursor_ptr wrapper_client::execute_stream(const std::string& query) {
+        debug(log_, "wrapper_client::execute_stream");
+        auto* dispatcher = ptr_->dispatcher();
+        // The first chunk may take a while: let other Python threads run meanwhile.
+        py::gil_scoped_release release;
+        return wrapper_cursor_ptr(
+            new wrapper_cursor{dispatcher->execute_sql_stream(otterbrix::session_id_t(), query), dispatcher});
     }
 } // namespace otterbrix
\ No newline at end of file
@@ -22,7 +22,12 @@ namespace otterbrix {
     public:
         wrapper_client(spaces_ptr space);
         ~wrapper_client();
-        auto execute(const std::string& query) -> wrapper_cursor_ptr;
+        // `params` binds $1, $2, ... in order; statements executed with
+        // parameters are parsed once per distinct text and reused.
+        auto execute(const std::string& query, const py::object& params = py::none()) -> wrapper_cursor_ptr;
+        // The cursor receives the result while the statement runs; read it with
+        // fetch_chunk() or the fetch* methods.
+        auto execute_stream(const std::string& query) -> wrapper_cursor_ptr;
 
     private:
         friend class wrapper_connection;
@@ -93,7 +93,11 @@ wrapper_cursor::wrapper_cursor(pointer cursor, otterbrix::wrapper_dispatcher_t*
     : ptr_(std::move(cursor))
     , dispatcher_(dispatcher) {}
 
-void wrapper_cursor::close() { close_ = true; }
+void wrapper_cursor::close() {
+    close_ = true;
+    // stops a streaming statement that has not been read to the end
+    ptr_->close();
+}
 
 bool wrapper_cursor::has_next() { return ptr_->has_next(); }
 
@@ -160,6 +164,10 @@ py::tuple wrapper_cursor::get_error() const {
             type = "create_physical_plan_error";
             break;
 
+        case error_code_t::query_cancelled:
+            type = "query_cancelled";
+            break;
+
         case error_code_t::other_error:
             type = "other_error";
             break;
@@ -242,6 +250,27 @@ py::list wrapper_cursor::fetchall() {
     return result;
 }
 
+py::list wrapper_cursor::fetch_chunk() {
+    py::list result;
+    bool has_chunk;
+    {
+        py::gil_scoped_release release;
+        has_chunk = ptr_->next_chunk();
+    }
+    if (!has_chunk) {
+        return result;
+    }
+    const auto& chunk = ptr_->current_chunk();
+    for (uint64_t row = 0; row < chunk.size(); ++row) {
+        py::tuple values(chunk.column_count());
+        for (uint64_t col = 0; col < chunk.column_count(); ++col) {
+            values[col] = from_value(chunk.value(col, row));
+        }
+        result.append(values);
+    }
+    return result;
+}
+
 py::object wrapper_cursor::description() const {
     if (ptr_->size() == 0 && ptr_->column_count() == 0) {
         return py::none();
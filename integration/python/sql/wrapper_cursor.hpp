@@ -34,6 +34,8 @@ public:
     py::object fetchone();
     py::list fetchmany(int size);
     py::list fetchall();
+    // Rows of the next chunk as tuples; an empty list past the last chunk.
+    py::list fetch_chunk();
     py::object description() const;
     int64_t rowcount() const;
 
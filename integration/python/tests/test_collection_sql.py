@@ -75,4 +75,41 @@ def test_collection_sql():
 
     c = client.execute("SELECT * FROM schema.table WHERE count = 1000;")
     assert len(c) == 20
-    c.close()
\ No newline at end of file
+    c.close()
+
+def test_collection_sql_params():
+    client.execute("CREATE TABLE schema.params (k bigint, v string);")
+    for k in range(10):
+        c = client.execute("INSERT INTO schema.params (k, v) VALUES ($1, $2);", [k, "v" + str(k)])
+        assert c.is_success()
+        c.close()
+
+    for k in (3, 7, 3):
+        c = client.execute("SELECT * FROM schema.params WHERE k = $1;", (k,))
+        assert len(c) == 1
+        assert c["v"] == "v" + str(k)
+        c.close()
+
+def test_collection_sql_stream():
+    client.execute("CREATE TABLE schema.stream (k bigint);")
+    query = "INSERT INTO schema.stream (k) VALUES " + ", ".join("(" + str(k) + ")" for k in range(5000)) + ";"
+    client.execute(query).close()
+
+    c = client.execute_stream("SELECT k FROM schema.stream;")
+    assert c.is_success()
+    rows = []
+    chunk = c.fetch_chunk()
+    while chunk:
+        rows.extend(chunk)
+        chunk = c.fetch_chunk()
+    assert sorted(k for (k,) in rows) == list(range(5000))
+    assert c.is_success()
+    c.close()
+
+    c = client.execute_stream("SELECT k FROM schema.stream WHERE k < 10;")
+    assert len(c.fetchall()) == 10
+    c.close()
+
+    c = client.execute_stream("SELECT k FROM schema.missing;")
+    assert c.is_error()
+    c.close()
@@ -1,3 +1,5 @@
+use crate::database::query_error;
+use crate::error::Result;
 use crate::utils::{make_sv, string_from_c};
 use crate::value::Value;
 use std::fmt;
@@ -115,6 +117,75 @@ impl<'db> Cursor<'db> {
         Value::from_raw(ptr)
     }
 
+    /// Moves to the next non-empty chunk of the result, `Ok(None)` past the
+    /// last one.
+    ///
+    /// This is how a cursor from
+    /// [`Database::execute_stream`](crate::Database::execute_stream) is read;
+    /// it works on any cursor.
+    ///
+    /// # Errors
+    ///
+    /// Returns [`Error::Query`](crate::Error::Query) when a streamed statement
+    /// failed after its first chunk.
+    pub fn next_chunk(&mut self) -> Result<Option<Chunk<'_, 'db>>> {
+        if unsafe { otterbrix_sys::cursor_next_chunk(self.ptr) } {
+            return Ok(Some(Chunk { cursor: self }));
+        }
+        if unsafe { otterbrix_sys::cursor_is_error(self.ptr) } {
+            return Err(query_error(self.ptr));
+        }
+        Ok(None)
+    }
+
+    /// Exports the result as an Arrow C stream, one record batch per chunk.
+    ///
+    /// This is the columnar way out of the engine: a batch is a single FFI
+    /// call instead of one per cell, and fixed-width numeric columns are
+    /// handed over without copying. A cursor from
+    /// [`Database::execute_stream`](crate::Database::execute_stream) is read
+    /// while its statement runs. The stream takes the cursor over: both
+    /// would read the same result, so the cursor is consumed rather than left
+    /// to move on underneath the stream.
+    ///
+    /// # Errors
+    ///
+    /// Returns [`Error::Query`](crate::Error::Query) if the cursor holds an
+    /// error.
+    ///
+    /// # Example
+    ///
+    /// With the `arrow` crate, which reads the same C structures:
+    ///
+    /// ```ignore
+    /// use arrow::ffi_stream::{ArrowArrayStreamReader, FFI_ArrowArrayStream};
+    ///
+    /// let mut stream = db.execute("SELECT * FROM app.t;")?.arrow_stream()?;
+    /// let reader = unsafe {
+    ///     ArrowArrayStreamReader::from_raw(stream.as_mut_ptr() as *mut FFI_ArrowArrayStream)?
+    /// };
+    /// for batch in reader {
+    ///     println!("{} rows", batch?.num_rows());
+    /// }
+    /// ```
+    pub fn arrow_stream(self) -> Result<ArrowStream<'db>> {
+        let mut raw = otterbrix_sys::ArrowArrayStream {
+            get_schema: None,
+            get_next: None,
+            get_last_error: None,
+            release: None,
+            private_data: std::ptr::null_mut(),
+        };
+        // The stream keeps its own reference to the result; `self` drops ours.
+        if unsafe { otterbrix_sys::cursor_arrow_stream(self.ptr, &mut raw) } {
+            return Ok(ArrowStream {
+                raw,
+                _db: PhantomData,
+            });
+        }
+        Err(query_error(self.ptr))
+    }
+
     /// Returns an iterator over the rows of the result set.
     ///
     /// The iterator yields [`Row`] handles, each of which can read individual
@@ -150,6 +221,81 @@ impl Drop for Cursor<'_> {
 // two threads (which is enforced by `&mut self` requirement on iteration).
 unsafe impl Send for Cursor<'_> {}
 
+/// The chunk [`Cursor::next_chunk`] moved to.
+///
+/// Rows are numbered from 0 within the chunk. The chunk borrows the cursor
+/// mutably, so it is gone before the cursor moves on.
+pub struct Chunk<'a, 'db> {
+    cursor: &'a Cursor<'db>,
+}
+
+impl Chunk<'_, '_> {
+    /// Number of rows in this chunk.
+    pub fn size(&self) -> i32 {
+        unsafe { otterbrix_sys::cursor_chunk_size(self.cursor.ptr) }
+    }
+
+    /// Reads the cell at (`row`, `column`) of this chunk.
+    ///
+    /// Returns [`Value::Null`] for out-of-range coordinates and for null cells.
+    pub fn get(&self, row: i32, column: i32) -> Value {
+        let ptr = unsafe { otterbrix_sys::cursor_chunk_get_value(self.cursor.ptr, row, column) };
+        Value::from_raw(ptr)
+    }
+}
+
+impl fmt::Debug for Chunk<'_, '_> {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("Chunk").field("size", &self.size()).finish()
+    }
+}
+
+/// An Arrow C stream over a result, produced by [`Cursor::arrow_stream`].
+///
+/// The stream follows the
+/// [Arrow C stream interface](https://arrow.apache.org/docs/format/CStreamInterface.html):
+/// hand [`ArrowStream::as_mut_ptr`] to any Arrow implementation that imports
+/// it, which takes the stream over. A stream nobody took over is released on
+/// drop. Like a cursor, it cannot outlive its database.
+pub struct ArrowStream<'db> {
+    raw: otterbrix_sys::ArrowArrayStream,
+    _db: PhantomData<&'db ()>,
+}
+
+impl ArrowStream<'_> {
+    /// Pointer to the raw stream, for an importer to take over.
+    pub fn as_mut_ptr(&mut self) -> *mut otterbrix_sys::ArrowArrayStream {
+        &mut self.raw
+    }
+
+    /// Whether the stream was released, or taken over by an importer.
+    pub fn is_released(&self) -> bool {
+        self.raw.release.is_none()
+    }
+}
+
+impl fmt::Debug for ArrowStream<'_> {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("ArrowStream")
+            .field("released", &self.is_released())
+            .finish()
+    }
+}
+
+impl Drop for ArrowStream<'_> {
+    fn drop(&mut self) {
+        if let Some(release) = self.raw.release {
+            unsafe { release(&mut self.raw) };
+        }
+    }
+}
+
+// SAFETY: the stream holds the only reader of its result: `arrow_stream`
+// consumes the Cursor it was made from, so no Cursor left on another thread
+// can move the same result on. The stream itself is read through `&mut self`
+// (`as_mut_ptr`), i.e. from one thread at a time.
+unsafe impl Send for ArrowStream<'_> {}
+
 /// A handle to a single row produced by [`Cursor::rows`].
 ///
 /// `Row` borrows from its [`Cursor`]; calling [`Row::get`] or
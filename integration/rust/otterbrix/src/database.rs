@@ -146,23 +146,29 @@ impl fmt::Debug for Database {
     }
 }
 
+/// The error an error cursor carries, as [`Error::Query`].
+pub(crate) fn query_error(ptr: otterbrix_sys::cursor_ptr) -> Error {
+    let err = unsafe { otterbrix_sys::cursor_get_error(ptr) };
+    let message = unsafe { string_from_c(err.message) };
+    let message = if message.is_empty() {
+        format!("error code {}", err.code)
+    } else {
+        message
+    };
+    Error::Query {
+        code: err.code,
+        message,
+    }
+}
+
 fn cursor_or_error<'db>(ptr: otterbrix_sys::cursor_ptr) -> Result<Cursor<'db>> {
     if ptr.is_null() {
         return Err(Error::NullPointer);
     }
     if unsafe { otterbrix_sys::cursor_is_error(ptr) } {
-        let err = unsafe { otterbrix_sys::cursor_get_error(ptr) };
-        let message = unsafe { string_from_c(err.message) };
-        let message = if message.is_empty() {
-            format!("error code {}", err.code)
-        } else {
-            message
-        };
+        let err = query_error(ptr);
         unsafe { otterbrix_sys::release_cursor(ptr) };
-        return Err(Error::Query {
-            code: err.code,
-            message,
-        });
+        return Err(err);
     }
     Ok(Cursor {
         ptr,
@@ -235,6 +241,36 @@ impl Database {
         cursor_or_error(ptr)
     }
 
+    /// Executes a SQL statement and streams its result.
+    ///
+    /// The cursor receives the result chunk by chunk while the statement is
+    /// still running; read it with [`Cursor::next_chunk`]. A reader that falls
+    /// behind pauses the statement instead of the result piling up in memory,
+    /// and dropping the cursor early stops it. [`Cursor::size`] counts the rows
+    /// received so far.
+    ///
+    /// # Errors
+    ///
+    /// Same as [`Database::execute`] for failures known before the first
+    /// chunk; a failure midway is returned by [`Cursor::next_chunk`].
+    ///
+    /// # Examples
+    ///
+    /// ```no_run
+    /// use otterbrix::{Config, Database};
+    /// # let db = Database::open(Config::new("./data")).unwrap();
+    /// let mut cursor = db.execute_stream("SELECT id FROM app.t;").unwrap();
+    /// while let Some(chunk) = cursor.next_chunk().unwrap() {
+    ///     for row in 0..chunk.size() {
+    ///         let _id = chunk.get(row, 0);
+    ///     }
+    /// }
+    /// ```
+    pub fn execute_stream(&self, sql: &str) -> Result<Cursor<'_>> {
+        let ptr = unsafe { otterbrix_sys::execute_sql_stream(self.ptr, make_sv(sql)) };
+        cursor_or_error(ptr)
+    }
+
     /// Executes a parameterised SQL statement.
     ///
     /// Placeholders in `sql` use the `$N` syntax (1-based). Each [`SqlParam`]
@@ -269,6 +305,41 @@ impl Database {
         cursor_or_error(ptr)
     }
 
+    /// Parses `sql` once for repeated execution.
+    ///
+    /// Each [`Statement::execute`] call only binds its parameters and plans
+    /// the already-parsed statement, skipping the SQL parser. The engine also
+    /// shares parses across calls of [`Database::execute_with_params`] with
+    /// the same text, so preparing is only needed to hold on to a statement
+    /// explicitly. A statement stays valid across schema changes.
+    ///
+    /// # Errors
+    ///
+    /// Returns [`Error::Query`] if `sql` does not parse and
+    /// [`Error::NullPointer`] on an internal failure.
+    ///
+    /// # Examples
+    ///
+    /// ```no_run
+    /// use otterbrix::{Config, Database, SqlParam, SqlParamValue};
+    /// # let db = Database::open(Config::new("./data")).unwrap();
+    /// let stmt = db.prepare("SELECT name FROM app.t WHERE id = $1;").unwrap();
+    /// for id in 0..10 {
+    ///     let param = SqlParam { index: 1, value: SqlParamValue::Int64(id) };
+    ///     let cursor = stmt.execute(&[param]).unwrap();
+    ///     # drop(cursor);
+    /// }
+    /// ```
+    pub fn prepare(&self, sql: &str) -> Result<Statement<'_>> {
+        let mut handle: otterbrix_sys::prepared_statement_ptr = std::ptr::null_mut();
+        let ptr = unsafe { otterbrix_sys::prepare_sql(self.ptr, make_sv(sql), &mut handle) };
+        cursor_or_error(ptr)?;
+        if handle.is_null() {
+            return Err(Error::NullPointer);
+        }
+        Ok(Statement { db: self, handle })
+    }
+
     /// Creates a new logical database.
     ///
     /// Uses the engine's dedicated `create_database` entry point — preferable
@@ -326,6 +397,44 @@ impl Database {
     }
 }
 
+/// A SQL statement parsed once by [`Database::prepare`].
+///
+/// Borrows its [`Database`], so it cannot outlive it; the parsed statement is
+/// released on drop.
+pub struct Statement<'db> {
+    db: &'db Database,
+    handle: otterbrix_sys::prepared_statement_ptr,
+}
+
+impl fmt::Debug for Statement<'_> {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("Statement")
+            .field("handle", &self.handle)
+            .finish()
+    }
+}
+
+impl<'db> Statement<'db> {
+    /// Executes the statement with `params` bound to its `$N` placeholders.
+    ///
+    /// # Errors
+    ///
+    /// Same as [`Database::execute_with_params`].
+    pub fn execute(&self, params: &[SqlParam<'_>]) -> Result<Cursor<'db>> {
+        let raw = raw_sql_params(params);
+        let ptr = unsafe {
+            otterbrix_sys::execute_prepared(self.db.ptr, self.handle, raw.as_ptr(), raw.len())
+        };
+        cursor_or_error(ptr)
+    }
+}
+
+impl Drop for Statement<'_> {
+    fn drop(&mut self) {
+        unsafe { otterbrix_sys::release_prepared(self.handle) };
+    }
+}
+
 impl Drop for Database {
     fn drop(&mut self) {
         unsafe { otterbrix_sys::otterbrix_destroy(self.ptr) };
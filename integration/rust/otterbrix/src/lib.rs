@@ -98,11 +98,11 @@ mod value;
 
 pub use config::{Config, ConfigBuilder};
 pub use cursor::{
-    Cursor, LogicalType, Row, Rows, LOGICAL_TYPE_BIGINT, LOGICAL_TYPE_BOOLEAN, LOGICAL_TYPE_DOUBLE,
-    LOGICAL_TYPE_FLOAT, LOGICAL_TYPE_INTEGER, LOGICAL_TYPE_NA, LOGICAL_TYPE_SMALLINT,
-    LOGICAL_TYPE_STRING_LITERAL, LOGICAL_TYPE_TINYINT, LOGICAL_TYPE_UBIGINT, LOGICAL_TYPE_UINTEGER,
-    LOGICAL_TYPE_USMALLINT, LOGICAL_TYPE_UTINYINT,
+    ArrowStream, Chunk, Cursor, LogicalType, Row, Rows, LOGICAL_TYPE_BIGINT, LOGICAL_TYPE_BOOLEAN,
+    LOGICAL_TYPE_DOUBLE, LOGICAL_TYPE_FLOAT, LOGICAL_TYPE_INTEGER, LOGICAL_TYPE_NA,
+    LOGICAL_TYPE_SMALLINT, LOGICAL_TYPE_STRING_LITERAL, LOGICAL_TYPE_TINYINT, LOGICAL_TYPE_UBIGINT,
+    LOGICAL_TYPE_UINTEGER, LOGICAL_TYPE_USMALLINT, LOGICAL_TYPE_UTINYINT,
 };
-pub use database::{Database, SqlParam, SqlParamValue};
+pub use database::{Database, SqlParam, SqlParamValue, Statement};
 pub use error::{Error, Result};
 pub use value::{FromValue, Value};
@@ -47,3 +47,94 @@ fn column_name_returns_none_for_out_of_bounds_index() {
     assert_eq!(cur.column_count(), 1);
     assert_eq!(cur.column_name(100), None);
 }
+
+#[test]
+fn execute_stream_reads_the_result_chunk_by_chunk() {
+    let db = common::open_test_db();
+    db.execute("CREATE DATABASE db;").unwrap();
+    db.execute("CREATE TABLE db.t (n bigint);").unwrap();
+    let values: Vec<String> = (0..5000).map(|n| format!("({n})")).collect();
+    db.execute(&format!(
+        "INSERT INTO db.t (n) VALUES {};",
+        values.join(", ")
+    ))
+    .unwrap();
+
+    let mut cursor = db.execute_stream("SELECT n FROM db.t;").unwrap();
+    let mut chunks = 0;
+    let mut sum = 0;
+    let mut rows = 0;
+    while let Some(chunk) = cursor.next_chunk().unwrap() {
+        chunks += 1;
+        for row in 0..chunk.size() {
+            sum += chunk.get(row, 0).as_int().unwrap();
+        }
+        rows += chunk.size();
+    }
+    assert!(chunks > 1, "5000 rows must arrive in more than one chunk");
+    assert_eq!(rows, 5000);
+    assert_eq!(sum, 5000 * 4999 / 2);
+    assert_eq!(cursor.size(), 5000);
+}
+
+#[test]
+fn execute_stream_can_be_dropped_before_the_end() {
+    let db = common::open_test_db();
+    db.execute("CREATE DATABASE db;").unwrap();
+    db.execute("CREATE TABLE db.t (n bigint);").unwrap();
+    let values: Vec<String> = (0..5000).map(|n| format!("({n})")).collect();
+    db.execute(&format!(
+        "INSERT INTO db.t (n) VALUES {};",
+        values.join(", ")
+    ))
+    .unwrap();
+
+    let mut cursor = db.execute_stream("SELECT n FROM db.t;").unwrap();
+    assert!(cursor.next_chunk().unwrap().is_some());
+    drop(cursor);
+    let count = db.execute("SELECT n FROM db.t;").unwrap();
+    assert_eq!(count.size(), 5000);
+    assert!(db.execute_stream("SELECT n FROM db.missing;").is_err());
+}
+
+#[test]
+fn arrow_stream_hands_over_the_result_as_batches() {
+    let db = common::open_test_db();
+    db.execute("CREATE DATABASE db;").unwrap();
+    db.execute("CREATE TABLE db.t (n bigint);").unwrap();
+    let values: Vec<String> = (0..5000).map(|n| format!("({n})")).collect();
+    db.execute(&format!(
+        "INSERT INTO db.t (n) VALUES {};",
+        values.join(", ")
+    ))
+    .unwrap();
+
+    let mut stream = db
+        .execute("SELECT n FROM db.t;")
+        .unwrap()
+        .arrow_stream()
+        .unwrap();
+    let raw = unsafe { &mut *stream.as_mut_ptr() };
+    let mut batches = 0;
+    let mut rows = 0;
+    let mut sum = 0;
+    loop {
+        let mut batch: otterbrix_sys::ArrowArray = unsafe { std::mem::zeroed() };
+        assert_eq!(unsafe { raw.get_next.unwrap()(raw, &mut batch) }, 0);
+        let Some(release) = batch.release else {
+            break;
+        };
+        let column = unsafe { &**batch.children };
+        let data = unsafe { *column.buffers.add(1) } as *const i64;
+        for row in 0..column.length {
+            sum += unsafe { *data.offset((column.offset + row) as isize) };
+        }
+        rows += batch.length;
+        batches += 1;
+        unsafe { release(&mut batch) };
+    }
+    assert!(batches > 1);
+    assert_eq!(rows, 5000);
+    assert_eq!(sum, 5000 * 4999 / 2);
+    assert!(!stream.is_released());
+}
@@ -460,3 +460,28 @@ fn injection_with_comment_marker_in_string() {
         "literal \"a'--\" must not match \"a\" — comment marker must NOT terminate the predicate"
     );
 }
+
+#[test]
+fn prepared_statement_rebinds_across_executions() {
+    let db = common::open_test_db();
+    db.create_database("db").unwrap();
+    db.execute("CREATE TABLE db.t (id bigint, name string);")
+        .unwrap();
+    db.execute("INSERT INTO db.t (id, name) VALUES (1, 'one'), (2, 'two');")
+        .unwrap();
+
+    let stmt = db.prepare("SELECT name FROM db.t WHERE id = $1;").unwrap();
+    for (id, expected) in [(1, "one"), (2, "two"), (1, "one")] {
+        let cur = stmt.execute(&[p(1, SqlParamValue::Int64(id))]).unwrap();
+        assert_eq!(cur.size(), 1);
+        let name: String = cur.get_value_by_name(0, "name").get().unwrap();
+        assert_eq!(name, expected);
+    }
+
+    db.execute("ALTER TABLE db.t ADD COLUMN extra bigint;")
+        .unwrap();
+    let cur = stmt.execute(&[p(1, SqlParamValue::Int64(2))]).unwrap();
+    assert_eq!(cur.size(), 1);
+
+    assert!(db.prepare("SELEC name FROM db.t;").is_err());
+}
@@ -8,6 +8,8 @@
 #include <components/logical_plan/node_catalog_resolve.hpp>
 #include <components/logical_plan/param_storage.hpp>
 #include <components/physical_plan/operators/operator_data.hpp>
+#include <components/planner/optimizer/statistics.hpp>
+#include <filesystem>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -30,9 +32,23 @@ namespace services {
         // column names + relkind.
         std::unordered_map<components::catalog::oid_t, const components::logical_plan::resolved_table_metadata_t*>
             table_metadata;
+        // Statistics of the plan's tables (row counts, min/max, pg_statistic);
+        // create_plan_match skips an index whose predicate keeps too much of an
+        // analyzed table.
+        components::planner::optimizer::statistics_map_t statistics;
         // Slot pointers for recursive CTE working sets. Keyed by CTE name.
         // Each entry points into the owning operator_recursive_cte_t's working_set_ field.
         std::pmr::unordered_map<std::pmr::string, components::operators::operator_data_ptr*> cte_working_sets;
+        // Set by the executor for the catalog-resolve front-pass; lifted onto
+        // pipeline::context_t::use_catalog_cache for the resolve operators.
+        bool use_catalog_cache = false;
+        // Spill settings of the statement, lifted onto pipeline::context_t for
+        // blocking operators. memory_budget 0 = never spill.
+        uint64_t memory_budget = 0;
+        std::filesystem::path spill_path;
+        uint64_t worker_threads = 1;
+        // EXPLAIN ANALYZE, lifted onto pipeline::context_t::profile.
+        bool profile = false;
 
         context_storage_t(std::pmr::memory_resource* resource,
                           log_t log,
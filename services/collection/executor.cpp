@@ -1,7 +1,11 @@
 #include "executor.hpp"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <limits>
+#include <thread>
 
 #include <components/catalog/catalog_codes.hpp>
 #include <components/context/execution_context.hpp>
@@ -12,6 +16,7 @@
 #include <components/logical_plan/forward.hpp>
 #include <components/logical_plan/node_allocate_oids.hpp>
 #include <components/logical_plan/node_alter_column.hpp>
+#include <components/logical_plan/node_analyze.hpp>
 #include <components/logical_plan/node_catalog_resolve.hpp>
 #include <components/logical_plan/node_create_collection.hpp>
 #include <components/logical_plan/node_create_constraint.hpp>
@@ -29,6 +34,8 @@
 // The executor only sees the base operator_t: each operator's DML I/O
 // intercept lives in its own await_async_and_resume, not here. The commit
 // pipeline's commit_id comes back via pipeline::context_t::committed_id.
+#include <components/physical_plan/operators/explain.hpp>
+#include <components/physical_plan/operators/runtime_filter.hpp>
 #include <components/physical_plan_generator/create_plan.hpp>
 #include <core/executor.hpp>
 // catalog-resolve helpers (services::catalog_resolve) let the executor drive
@@ -42,6 +49,7 @@
 #include <components/logical_plan/node_match.hpp>
 #include <components/logical_plan/node_transaction.hpp>
 #include <components/planner/optimizer.hpp>
+#include <components/planner/optimizer/rules/join_order.hpp>
 #include <services/dispatcher/dispatcher.hpp>
 #include <services/dispatcher/enrich_logical_plan.hpp>
 #include <services/dispatcher/plan_resolve_index.hpp>
@@ -60,10 +68,12 @@ namespace services::collection::executor {
     namespace {
         std::atomic<uint64_t> g_streaming_pipeline_runs{0};
         std::atomic<uint64_t> g_dml_appends_reverted{0};
+        std::atomic<uint64_t> g_plan_cache_hits{0};
     } // namespace
 
     uint64_t streaming_pipeline_runs() noexcept { return g_streaming_pipeline_runs.load(std::memory_order_relaxed); }
     uint64_t dml_appends_reverted() noexcept { return g_dml_appends_reverted.load(std::memory_order_relaxed); }
+    uint64_t plan_cache_hits() noexcept { return g_plan_cache_hits.load(std::memory_order_relaxed); }
 #endif
 
     // ---- behavior/dispatch_traits sync check ----
@@ -110,6 +120,51 @@ namespace services::collection::executor {
                       "add a case to behavior() AND an entry to kBehaviorHandledIds");
     } // namespace
 
+    // EXPLAIN ANALYZE bookkeeping for execute_pipeline; only called when the
+    // pipeline context asks for a profile.
+    namespace {
+        using profile_clock = std::chrono::steady_clock;
+
+        // Reads the clock only when profiling, so a plain run pays no timer calls per batch.
+        profile_clock::time_point profile_start(bool profiling) {
+            return profiling ? profile_clock::now() : profile_clock::time_point{};
+        }
+
+        uint64_t nanoseconds_since(profile_clock::time_point start) {
+            return static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(profile_clock::now() - start).count());
+        }
+
+        void profile_input(components::operators::operator_t* op, const components::vector::data_chunk_t& batch) {
+            auto& profile = op->profile();
+            profile.rows_in += batch.size();
+            ++profile.batches_in;
+            profile.peak_bytes = std::max(profile.peak_bytes, op->memory_usage() + batch.allocation_size());
+        }
+
+        void profile_output(components::operators::operator_t* op, const components::vector::data_chunk_t& batch) {
+            auto& profile = op->profile();
+            profile.rows_out += batch.size();
+            ++profile.batches_out;
+        }
+
+        void profile_output(components::operators::operator_t* op,
+                            const components::operators::chunks_vector_t& batches) {
+            for (const auto& batch : batches) {
+                profile_output(op, batch);
+            }
+            op->profile().peak_bytes = std::max(op->profile().peak_bytes, op->memory_usage());
+        }
+
+        // An operator driven through await_async_and_resume reports its rows
+        // via output_ rather than through the pump.
+        void profile_async_output(components::operators::operator_t* op) {
+            if (op->output() && op->profile().batches_out == 0) {
+                profile_output(op, op->output()->chunks());
+            }
+        }
+    } // namespace
+
     plan_t::plan_t(std::stack<components::operators::operator_ptr>&& sub_plans,
                    const components::logical_plan::storage_parameters* parameters,
                    services::context_storage_t&& context_storage,
@@ -124,6 +179,9 @@ namespace services::collection::executor {
                            actor_zeta::address_t wal_address,
                            actor_zeta::address_t disk_address,
                            actor_zeta::address_t index_address,
+                           components::catalog_cache_t* catalog_cache,
+                           components::analyze_tracker_t* analyze_tracker,
+                           configuration::config_spill spill,
                            log_t&& log)
         : actor_zeta::basic_actor<executor_t>{resource}
         , parent_address_(std::move(parent_address))
@@ -131,7 +189,10 @@ namespace services::collection::executor {
         , disk_address_(std::move(disk_address))
         , index_address_(std::move(index_address))
         , log_(log)
-        , function_registry_(resource) {
+        , function_registry_(resource)
+        , catalog_cache_(catalog_cache)
+        , analyze_tracker_(analyze_tracker)
+        , spill_(std::move(spill)) {
         register_default_functions(function_registry_);
     }
 
@@ -210,6 +271,14 @@ namespace services::collection::executor {
         // pointer is consumed only at plan-build time (inside create_plan),
         // before the move into plan_data below.
         context_storage.parameters = &plan.parameters->parameters();
+        const auto explain = plan.explain;
+        // The statement itself, without the catalog-resolve wrap.
+        std::string logical_text;
+        if (explain != explain_mode::none) {
+            const node_t* explained = services::catalog_resolve::effective_root_node(plan.sub_queries.back().get());
+            logical_text = explained ? explained->to_string() : plan.sub_queries.back()->to_string();
+        }
+        context_storage.profile = explain == explain_mode::analyze;
         components::operators::operator_ptr node = planner::create_plan(context_storage,
                                                                         function_registry_,
                                                                         plan.sub_queries.back(),
@@ -226,10 +295,30 @@ namespace services::collection::executor {
 
         node->set_as_root();
 
+        // EXPLAIN renders the plan without running it. EXPLAIN ANALYZE runs it
+        // with profiling on and, when it succeeds, answers with the profiled
+        // tree instead of its rows; a DML statement's effects still commit.
+        if (explain == explain_mode::plan) {
+            node->prepare();
+            co_return execute_result_t{make_cursor(
+                resource(),
+                components::operators::render_explain(resource(), logical_text, *node, false, plan.explain_json))};
+        }
+        const components::operators::operator_ptr explain_root = explain == explain_mode::analyze ? node : nullptr;
+
         auto plan_data = traverse_plan_(std::move(node), plan.parameters->parameters(), std::move(context_storage));
         plan_data.limit = limit;
+        // EXPLAIN ANALYZE answers with the profiled tree, not the rows: never stream those.
+        if (explain == explain_mode::none) {
+            plan_data.result_stream = plan.stream.get();
+        }
 
         auto result = co_await execute_sub_plan_(session, std::move(plan_data), txn_data, lowest_active_start_time);
+        if (explain_root && result.cursor->is_success()) {
+            result.cursor = make_cursor(
+                resource(),
+                components::operators::render_explain(resource(), logical_text, *explain_root, true, plan.explain_json));
+        }
 
         // Raw pipeline result. Three cases, distinguished by the vector state
         // and resolved by execute_plan_full's accumulate/commit tail:
@@ -253,6 +342,50 @@ namespace services::collection::executor {
     executor_t::unique_future<execute_result_t>
     executor_t::execute_plan_full(components::session::session_id_t session,
                                   components::logical_plan::execution_plan_t plan) {
+        // A streaming statement's client already holds its cursor. Whatever the
+        // root pipeline did not stream (DDL and EXPLAIN output, DML RETURNING
+        // rows) follows through the stream, which then closes with the
+        // statement's status; the returned cursor keeps only that status.
+        auto stream = plan.stream;
+        auto result = co_await execute_statement_(session, std::move(plan));
+        if (stream) {
+            if (result.cursor->is_success()) {
+                components::operators::chunks_vector_t rest{resource()};
+                for (auto& chunk : result.cursor->chunks()) {
+                    if (chunk.column_count() > 0) {
+                        rest.push_back(std::move(chunk));
+                    }
+                }
+                co_await stream_out_(stream.get(), rest);
+            }
+            stream->finish(result.cursor->get_error());
+            result.cursor = make_cursor(resource(), result.cursor->get_error());
+        }
+        co_return result;
+    }
+
+    namespace {
+        // The bound parameters have exactly the ids and types a cached plan was
+        // validated against.
+        bool same_parameter_types(
+            const std::vector<std::pair<core::parameter_id_t, components::types::complex_logical_type>>& types,
+            const components::logical_plan::storage_parameters& parameters) {
+            if (types.size() != parameters.parameters.size()) {
+                return false;
+            }
+            for (const auto& [id, type] : types) {
+                auto it = parameters.parameters.find(id);
+                if (it == parameters.parameters.end() || !(it->second.type() == type)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace
+
+    executor_t::unique_future<execute_result_t>
+    executor_t::execute_statement_(components::session::session_id_t session,
+                                   components::logical_plan::execution_plan_t plan) {
         // Full per-query pipeline: session-context fetch, optimize, resolve
         // wrap, catalog resolve, view splice, validate, enrich, planner
         // rewrites, operator pipeline, then the DML/DDL commit (or abort)
@@ -351,6 +484,60 @@ namespace services::collection::executor {
             pending_set_tz_name.assign(tz_node->timezone_name().c_str(), tz_node->timezone_name().size());
         }
 
+        // Executor-owned plan context. session_tz arrives from the dispatcher
+        // (the sole owner of default_tz_cat_) in the session-context bundle.
+        auto make_context_storage = [this, &plan, &session_ctx] {
+            services::context_storage_t context_storage(resource(), log_.clone(), session_ctx.session_tz);
+            context_storage.memory_budget = plan.memory_budget != 0 ? plan.memory_budget : spill_.memory_budget;
+            context_storage.spill_path = spill_.path;
+            context_storage.worker_threads = spill_.operator_threads == 0
+                                                 ? std::max(1u, std::thread::hardware_concurrency())
+                                                 : spill_.operator_threads;
+            return context_storage;
+        };
+
+        // Prepared SELECT seen before under this catalog: skip straight to the
+        // operator pipeline with the plan optimized last time (see plan_cache_).
+        // The cache only serves snapshots that see exactly the committed catalog,
+        // so a txn with its own catalog writes always plans afresh.
+        const bool plan_cacheable = !plan.cache_key.empty() && plan.sub_queries.size() == 1 &&
+                                    original_type == node_type::aggregate_t && catalog_cache_ != nullptr &&
+                                    !session_ctx.has_catalog_writes;
+        if (plan_cacheable) {
+            const auto catalog_version = catalog_cache_->admitted_version(resolve_txn);
+            auto it = plan_cache_.find(std::string_view(plan.cache_key));
+            if (catalog_version && it != plan_cache_.end() && it->second.catalog_version == *catalog_version &&
+                it->second.session_timezone == session_ctx.session_tz &&
+                same_parameter_types(it->second.parameter_types, plan.parameters->parameters())) {
+                const auto& cached = it->second;
+                auto context_storage = make_context_storage();
+                context_storage.known_oids = cached.known_oids;
+                context_storage.table_metadata = cached.table_metadata;
+                context_storage.indexed_keys.assign(cached.indexed_keys.begin(), cached.indexed_keys.end());
+                context_storage.indexed_descriptions.assign(cached.indexed_descriptions.begin(),
+                                                            cached.indexed_descriptions.end());
+                context_storage.statistics = cached.statistics;
+                plan.sub_queries.back() = cached.root;
+#ifdef DEV_MODE
+                g_plan_cache_hits.fetch_add(1, std::memory_order_relaxed);
+#endif
+                trace(log_, "executor::execute_plan_full: cached plan, session: {}", session.data());
+                auto exec_result = co_await execute_plan(session,
+                                                         plan,
+                                                         std::move(context_storage),
+                                                         resolve_txn,
+                                                         session_ctx.lowest_active_start_time);
+                // Same read-only release as the full path's tail below.
+                if (!session_ctx.is_explicit) {
+                    auto [_rl, rlf] = actor_zeta::send(parent_address_,
+                                                       &services::dispatcher::manager_dispatcher_t::txn_abort_msg,
+                                                       session);
+                    co_await std::move(rlf);
+                }
+                co_return std::move(exec_result);
+            }
+        }
+
         // (O1) The optimizer used to run here, early, before resolve. It now
         // runs as a SINGLE pass AFTER the planner rewrite — see the
         // components::planner::optimize(...) call just before the execute_plan
@@ -502,9 +689,7 @@ namespace services::collection::executor {
             }
         }
 
-        // Executor-owned plan context. session_tz arrives from the dispatcher
-        // (the sole owner of default_tz_cat_) in the session-context bundle.
-        services::context_storage_t context_storage(resource(), log_.clone(), session_ctx.session_tz);
+        auto context_storage = make_context_storage();
 
         // Which commit tail runs after the pipeline. DDL needs a real txn so a
         // mid-DDL crash → WAL replay rolls back partially-written pg_catalog
@@ -519,16 +704,17 @@ namespace services::collection::executor {
             original_type == node_type::create_matview_t;
         const bool needs_dml_txn = original_type == node_type::insert_t || original_type == node_type::update_t ||
                                    original_type == node_type::delete_t;
-        // SET TIMEZONE and VACUUM are append/delete-shaped catalog writers that
-        // are neither DDL nor DML but still produce committable pg_catalog
-        // ranges (SET TIMEZONE → pg_settings append; VACUUM → pg_computed_column
-        // tombstone deletes). They ride the SAME append-shaped unified DML tail
+        // SET TIMEZONE, VACUUM and ANALYZE are append/delete-shaped catalog
+        // writers that are neither DDL nor DML but still produce committable
+        // pg_catalog ranges (SET TIMEZONE → pg_settings append; VACUUM →
+        // pg_computed_column tombstone deletes; ANALYZE → pg_statistic
+        // delete + append). They ride the SAME append-shaped unified DML tail
         // (accumulate + implicit commit / revert) rather than the DDL tail,
         // which carries no base append/delete handling. Kept as a separate bool
         // (not merged into needs_dml_txn) so the trace text and the dml_*
         // semantics stay literally about INSERT/UPDATE/DELETE.
-        const bool needs_commit_txn =
-            original_type == node_type::set_timezone_t || original_type == node_type::vacuum_t;
+        const bool needs_commit_txn = original_type == node_type::set_timezone_t ||
+                                      original_type == node_type::vacuum_t || original_type == node_type::analyze_t;
 
         // Run the catalog_resolve_*_t front-children through their operators via
         // co_await this->execute_plan (not a sync inter-actor call): those
@@ -557,6 +743,10 @@ namespace services::collection::executor {
             }
             auto params = components::logical_plan::make_parameter_node(resource());
             services::context_storage_t cstor{resource(), log_.clone(), context_storage.session_timezone};
+            // Resolves may take the shared catalog cache unless this txn already
+            // wrote pg_catalog in an earlier statement (the cache only holds
+            // committed metadata).
+            cstor.use_catalog_cache = !session_ctx.has_catalog_writes;
             co_return co_await this->execute_plan(session,
                                                   components::logical_plan::execution_plan_t{resource(), root, params},
                                                   std::move(cstor),
@@ -611,9 +801,13 @@ namespace services::collection::executor {
         // filters/projections/joins on top of v) are not yet handled.
         //
         // The sub-plan's fresh resolves run via `co_await this->execute_plan`,
-        // safe by the same reasoning as the outer resolve loop.
+        // safe by the same reasoning as the outer resolve loop. A spliced plan
+        // is not kept in plan_cache_: the splice merges the body's constants
+        // into the statement's parameters.
+        bool expanded_view = false;
         if (plan.sub_queries.back()) {
             if (auto* view_node = services::catalog_resolve::find_first_view_resolve(plan.sub_queries.back().get())) {
+                expanded_view = true;
                 auto exp =
                     services::catalog_resolve::expand_view_body(resource(), view_node->resolved_metadata()->view_sql);
                 if (exp.error) {
@@ -700,7 +894,8 @@ namespace services::collection::executor {
                                             static_cast<const std::string&>(d->relname())};
                 }
                 case node_type::alter_column_t:
-                case node_type::alter_table_t: {
+                case node_type::alter_table_t:
+                case node_type::analyze_t: {
                     auto names = services::catalog_resolve::drop_target_names_from_resolves(plan_root_for_drop_names);
                     return qualified_name_t{names.first, names.second};
                 }
@@ -773,6 +968,8 @@ namespace services::collection::executor {
         table_id id(resource(),
                     build_id_cfn(services::catalog_resolve::effective_root_node(plan.sub_queries.back().get())));
         cursor_t_ptr error;
+        // ANALYZE target for the auto-analyze reset; INVALID_OID = every table.
+        components::catalog::oid_t analyze_target_oid = components::catalog::INVALID_OID;
         // Existence checks read from the explicit dispatcher_idx populated
         // above (mirrors the dispatcher's pre-execute pass).
         switch (original_type) {
@@ -991,6 +1188,48 @@ namespace services::collection::executor {
                 break;
             case node_type::alter_table_t:
                 break;
+            case node_type::analyze_t: {
+                // Bare ANALYZE covers every table; a named one must be a regular
+                // table with the listed columns.
+                if (id.get_namespace().empty()) {
+                    break;
+                }
+                if (auto err = services::dispatcher::check_collection_exists(resource(), &dispatcher_idx, id);
+                    err.contains_error()) {
+                    error = make_cursor(resource(), err);
+                    break;
+                }
+                const auto* tbl = services::catalog_resolve::tbl_md_for(&dispatcher_idx,
+                                                                        std::string_view(id.get_namespace().front()),
+                                                                        std::string_view(id.table_name()));
+                if (tbl && tbl->relkind != components::catalog::relkind::regular) {
+                    error = make_cursor(resource(),
+                                        core::error_t{core::error_code_t::schema_error,
+                                                      std::pmr::string{"ANALYZE supports only regular tables",
+                                                                       resource()}});
+                    break;
+                }
+                if (tbl) {
+                    analyze_target_oid = tbl->table_oid;
+                }
+                const auto* analyze = static_cast<const components::logical_plan::node_analyze_t*>(
+                    services::catalog_resolve::effective_root_node(plan.sub_queries.back().get()));
+                for (const auto& name : analyze->columns()) {
+                    const bool known =
+                        tbl && std::any_of(tbl->columns.begin(), tbl->columns.end(), [&](const auto& col) {
+                            return std::string_view(col.attname) == std::string_view(name);
+                        });
+                    if (!known) {
+                        error = make_cursor(
+                            resource(),
+                            core::error_t{core::error_code_t::schema_error,
+                                          std::pmr::string{"column \"" + std::string(name.data(), name.size()) + "\" does not exist",
+                                                           resource()}});
+                        break;
+                    }
+                }
+                break;
+            }
             case node_type::create_constraint_t: {
                 if (auto err = services::dispatcher::check_collection_exists(resource(), &dispatcher_idx, id);
                     err.contains_error()) {
@@ -1363,10 +1602,134 @@ namespace services::collection::executor {
         // (O1) Single optimizer pass — runs HERE, after every planner rewrite
         // (DML constraint-wrap + DDL lowering), so the schema stamps
         // key.side()/key.path() and table OIDs are present. const-fold +
-        // pushdown_filter + hash-join selection; a no-op on DDL sequences.
+        // pushdown_filter + join ordering + hash-join selection; a no-op on DDL
+        // sequences.
         // The execute_plan delegate below lowers this optimized tree.
-        plan.sub_queries.back() =
-            components::planner::optimize(resource(), std::move(plan.sub_queries.back()), plan.parameters.get());
+        //
+        // Join ordering estimates cardinalities from the row counts and per-column
+        // min/max/NULL counts of the joined tables, fetched from the disk manager.
+        // Tables with pg_statistic rows (ANALYZE) add distinct counts, MCVs and
+        // histograms; those are wanted for every user table a reading statement
+        // touches, so create_plan_match can weigh an index against a full scan.
+        // They come from the shared catalog cache, which drops them whenever the
+        // catalog changes (an ANALYZE commit included); only the tables it
+        // misses are probed, in one batched pg_statistic lookup.
+        components::planner::optimizer::statistics_map_t join_statistics;
+        if (disk_address_ != actor_zeta::address_t::empty_address()) {
+            const auto join_leaves = components::planner::optimizer::join_leaf_tables(plan.sub_queries.back());
+            std::vector<components::catalog::oid_t> table_oids = join_leaves;
+            if (!needs_ddl_txn && !needs_commit_txn) {
+                for (const auto& [oid, md] : context_storage.table_metadata) {
+                    if (md && md->relkind == components::catalog::relkind::regular &&
+                        !components::catalog::is_catalog_table(oid) &&
+                        std::find(table_oids.begin(), table_oids.end(), oid) == table_oids.end()) {
+                        table_oids.push_back(oid);
+                    }
+                }
+            }
+            // The cache holds committed statistics only: a txn with its own
+            // catalog writes (possibly an uncommitted ANALYZE) reads them itself.
+            const bool use_cache = catalog_cache_ != nullptr && !session_ctx.has_catalog_writes;
+            std::vector<components::planner::optimizer::table_stats_estimate_t> analyzed(table_oids.size());
+            std::vector<std::size_t> missing;
+            for (std::size_t i = 0; i < table_oids.size(); ++i) {
+                auto cached = use_cache ? catalog_cache_->find_statistics(resolve_txn, table_oids[i]) : std::nullopt;
+                if (cached) {
+                    analyzed[i] = std::move(*cached);
+                } else {
+                    missing.push_back(i);
+                }
+            }
+            if (!missing.empty()) {
+                std::pmr::vector<std::pmr::vector<components::types::logical_value_t>> keys(resource());
+                for (auto i : missing) {
+                    std::pmr::vector<components::types::logical_value_t> key(resource());
+                    key.emplace_back(resource(), static_cast<std::uint32_t>(table_oids[i]));
+                    keys.push_back(std::move(key));
+                }
+                std::pmr::vector<std::string> key_cols(resource());
+                key_cols.emplace_back("starelid");
+                auto [_ps, psf] =
+                    actor_zeta::send(disk_address_,
+                                     &services::disk::manager_disk_t::read_chunks_by_keys,
+                                     components::execution_context_t{session, resolve_txn, session_ctx.session_tz},
+                                     components::catalog::well_known_oid::pg_statistic_table,
+                                     std::move(key_cols),
+                                     components::operators::make_keys_chunk(resource(), keys));
+                auto pg_statistic_rows = co_await std::move(psf);
+                for (std::size_t k = 0; k < missing.size(); ++k) {
+                    const auto i = missing[k];
+                    if (k < pg_statistic_rows.size()) {
+                        for (const auto& chunk : pg_statistic_rows[k]) {
+                            components::planner::optimizer::merge_pg_statistic(resource(), analyzed[i], chunk);
+                        }
+                    }
+                    if (use_cache) {
+                        catalog_cache_->store_statistics(resolve_txn, table_oids[i], analyzed[i]);
+                    }
+                }
+            }
+            for (std::size_t i = 0; i < table_oids.size(); ++i) {
+                const auto table_oid = table_oids[i];
+                if (!analyzed[i].analyzed &&
+                    std::find(join_leaves.begin(), join_leaves.end(), table_oid) == join_leaves.end()) {
+                    continue;
+                }
+                auto [_st, stf] = actor_zeta::send(disk_address_,
+                                                   &services::disk::manager_disk_t::storage_statistics,
+                                                   session,
+                                                   table_oid);
+                auto table_stats = co_await std::move(stf);
+                components::planner::optimizer::table_stats_estimate_t stats{table_stats.row_count, {}};
+                stats.columns.reserve(table_stats.columns.size());
+                for (const auto& column : table_stats.columns) {
+                    stats.columns.push_back(components::planner::optimizer::column_statistics_t{column.min_value(),
+                                                                                              column.max_value(),
+                                                                                              column.null_count()});
+                }
+                components::planner::optimizer::merge_analyzed(stats, analyzed[i]);
+                join_statistics.emplace(table_oid, std::move(stats));
+            }
+        }
+        bool folded_constants = false;
+        plan.sub_queries.back() = components::planner::optimize(resource(),
+                                                                std::move(plan.sub_queries.back()),
+                                                                plan.parameters.get(),
+                                                                &join_statistics,
+                                                                &folded_constants);
+        context_storage.statistics = std::move(join_statistics);
+
+        // Keep the plan for the statement's next execution. Computed tables are
+        // left out for the reason the catalog cache leaves them out: their
+        // storage positions move with DML, not only with DDL.
+        if (plan_cacheable && !expanded_view && !folded_constants) {
+            const bool reads_computed =
+                std::any_of(context_storage.table_metadata.begin(),
+                            context_storage.table_metadata.end(),
+                            [](const auto& entry) {
+                                return !entry.second || entry.second->relkind == components::catalog::relkind::computed;
+                            });
+            const auto catalog_version = catalog_cache_->admitted_version(resolve_txn);
+            if (catalog_version && !reads_computed) {
+                if (plan_cache_.size() >= max_cached_plans) {
+                    plan_cache_.clear();
+                }
+                cached_plan_t cached{*catalog_version,
+                                     session_ctx.session_tz,
+                                     {},
+                                     plan.sub_queries.back(),
+                                     context_storage.known_oids,
+                                     context_storage.table_metadata,
+                                     decltype(cached_plan_t::indexed_keys)(context_storage.indexed_keys, resource()),
+                                     decltype(cached_plan_t::indexed_descriptions)(context_storage.indexed_descriptions,
+                                                                                   resource()),
+                                     context_storage.statistics};
+                for (const auto& [id, value] : plan.parameters->parameters().parameters) {
+                    cached.parameter_types.emplace_back(id, value.type());
+                }
+                plan_cache_.insert_or_assign(std::string(plan.cache_key), std::move(cached));
+            }
+        }
 
         trace(log_, "executor::execute_plan_full: delegating to execute_plan, session: {}", session.data());
         // Operator-pipeline run, forwarding resolve_txn so the operator path
@@ -1468,8 +1831,17 @@ namespace services::collection::executor {
         // SQL COMMIT statement for explicit txns. The operator drains, batch-
         // publishes storage, commits the index mirrors per table, writes the
         // WAL marker and crosses the ProcArray barrier — in that order.
+        // Set when an autocommitted INSERT takes its table past the
+        // auto-analyze threshold; the ANALYZE runs after the INSERT replies.
+        bool auto_analyze = false;
         if (needs_dml_txn || needs_commit_txn) {
             if (exec_result.cursor->is_success()) {
+                std::vector<std::pair<components::catalog::oid_t, uint64_t>> inserted_rows;
+                if (original_type == node_type::insert_t && !session_ctx.is_explicit) {
+                    for (const auto& app : exec_result.dml_appends) {
+                        inserted_rows.emplace_back(app.table_oid, app.row_count);
+                    }
+                }
                 services::dispatcher::txn_accumulate_payload_t payload;
                 payload.base_appends.reserve(exec_result.dml_appends.size());
                 for (const auto& app : exec_result.dml_appends) {
@@ -1524,6 +1896,14 @@ namespace services::collection::executor {
                         exec_result.cursor = std::move(commit_result.cursor);
                     }
                 }
+                if (analyze_tracker_ && exec_result.cursor->is_success()) {
+                    for (const auto& [table_oid, rows] : inserted_rows) {
+                        auto_analyze |= analyze_tracker_->record_appends(table_oid, rows);
+                    }
+                    if (original_type == node_type::analyze_t) {
+                        analyze_tracker_->reset(analyze_target_oid);
+                    }
+                }
             } else {
                 // Failed DML statement: revert this statement's local ranges and
                 // abort the txn (also ends a failed statement's explicit txn).
@@ -1748,6 +2128,25 @@ namespace services::collection::executor {
             co_await std::move(rlf);
         }
 
+        // ===== auto-analyze =====
+        // Handed back as a statement of its own: the dispatcher starts it once
+        // this INSERT has replied, so the INSERT never waits for the ANALYZE and
+        // an ANALYZE failure leaves its result alone.
+        if (auto_analyze && !id.get_namespace().empty()) {
+            auto root = boost::intrusive_ptr<node_t>(new node_sequence_t(resource()));
+            const std::string dbname(id.get_namespace().front().data(), id.get_namespace().front().size());
+            root->append_child(
+                components::logical_plan::make_node_catalog_resolve_namespace(resource(), core::dbname_t{dbname}));
+            root->append_child(components::logical_plan::make_node_catalog_resolve_table(
+                resource(),
+                core::dbname_t{dbname},
+                core::relname_t{std::string(id.table_name().data(), id.table_name().size())}));
+            root->append_child(components::logical_plan::make_node_analyze(resource()));
+            exec_result.auto_analyze.emplace(resource(),
+                                             std::move(root),
+                                             components::logical_plan::make_parameter_node(resource()));
+        }
+
         co_return std::move(exec_result);
     }
 
@@ -1757,6 +2156,8 @@ namespace services::collection::executor {
         std::string name = function->name();
         auto signatures = function->get_signatures();
         auto res = function_registry_.add_function(std::move(function));
+        // A new overload may bind the calls of a cached plan differently.
+        plan_cache_.clear();
         co_return std::make_unique<function_result_t>(std::move(res));
     }
 
@@ -1787,6 +2188,39 @@ namespace services::collection::executor {
         return plan_t{std::move(sub_plans), &parameters, std::move(context_storage)};
     }
 
+    executor_t::unique_future<core::error_t>
+    executor_t::stream_out_(components::cursor::chunk_stream_t* stream,
+                            components::operators::chunks_vector_t& chunks) {
+        using push_result_t = components::cursor::chunk_stream_t::push_result_t;
+        for (auto& chunk : chunks) {
+            while (true) {
+                const auto pushed = stream->try_push(chunk);
+                if (pushed == push_result_t::pushed) {
+                    break;
+                }
+                if (pushed == push_result_t::cancelled) {
+                    chunks.clear();
+                    co_return core::error_t(core::error_code_t::query_cancelled,
+                                            std::pmr::string{"result stream closed by the client", resource()});
+                }
+                // Full: the dispatcher answers once this stream's client has made room (or cancelled). With
+                // no dispatcher (test topologies) there is nobody to park on: block instead.
+                if (parent_address_ == actor_zeta::address_t::empty_address()) {
+                    if (stream->push(std::move(chunk))) {
+                        break;
+                    }
+                    continue;
+                }
+                auto [_sw, swf] = actor_zeta::send(parent_address_,
+                                                   &services::dispatcher::manager_dispatcher_t::stream_wait_msg,
+                                                   components::cursor::chunk_stream_ptr{stream});
+                co_await std::move(swf);
+            }
+        }
+        chunks.clear();
+        co_return core::error_t::no_error();
+    }
+
     executor_t::unique_future<core::result_wrapper_t<components::operators::chunks_vector_t>>
     executor_t::execute_pipeline(components::operators::operator_ptr root, components::pipeline::context_t* ctx) {
         namespace ops = components::operators;
@@ -1847,6 +2281,33 @@ namespace services::collection::executor {
         }
 
         ops::chunks_vector_t output{resource()};
+        const bool profiling = ctx->profile;
+
+        // A streaming statement's root hands every result chunk to the client as soon as it
+        // leaves the chain instead of collecting it into `output`: emit() queues it on
+        // `streamed`, which stream_out_ hands over after each pumped batch, pausing this
+        // pipeline while the client is behind; once the LIMIT is reached the source stops
+        // being pumped. The first chunk goes out even when empty: it carries the column shape.
+        auto* stream = root->is_root() ? ctx->result_stream : nullptr;
+        uint64_t stream_remaining = ctx->result_limit > 0 ? ctx->result_limit : std::numeric_limits<uint64_t>::max();
+        bool stream_started = false;
+        ops::chunks_vector_t streamed{resource()};
+        auto emit = [&](components::vector::data_chunk_t&& chunk) -> core::error_t {
+            if (!stream) {
+                output.push_back(std::move(chunk));
+                return core::error_t::no_error();
+            }
+            if (stream_remaining == 0 || (chunk.size() == 0 && stream_started)) {
+                return core::error_t::no_error();
+            }
+            if (chunk.size() > stream_remaining) {
+                chunk.set_cardinality(stream_remaining);
+            }
+            stream_remaining -= chunk.size();
+            stream_started = true;
+            streamed.push_back(std::move(chunk));
+            return core::error_t::no_error();
+        };
 
         // Push one batch up through chain[op_start..]: a streaming op transforms its input
         // into the next stage; a sink op folds it into bounded state and emits nothing.
@@ -1857,15 +2318,28 @@ namespace services::collection::executor {
             for (std::size_t i = op_start; i < chain.size(); ++i) {
                 ops::chunks_vector_t produced{resource()};
                 for (auto& in : stage) {
+                    if (profiling) {
+                        profile_input(chain[i], in);
+                    }
+                    const auto started = profile_start(profiling);
                     auto err = chain[i]->push(ctx, std::move(in), produced);
+                    if (profiling) {
+                        chain[i]->profile().push_ns += nanoseconds_since(started);
+                    }
                     if (err.contains_error()) {
                         return err;
                     }
                 }
+                if (profiling) {
+                    profile_output(chain[i], produced);
+                }
                 stage = std::move(produced);
             }
             for (auto& c : stage) {
-                output.push_back(std::move(c));
+                auto err = emit(std::move(c));
+                if (err.contains_error()) {
+                    return err;
+                }
             }
             return core::error_t::no_error();
         };
@@ -1880,7 +2354,12 @@ namespace services::collection::executor {
             // commit the executor's bottom-up async-finalize pass drives — so the
             // FLUSH/async-finalize passes below operate only on the ANCESTORS.
             if (chain.front()->needs_async_finalize()) {
+                const auto started = profile_start(profiling);
                 co_await chain.front()->await_async_and_resume(ctx);
+                if (profiling) {
+                    chain.front()->profile().await_ns += nanoseconds_since(started);
+                    profile_async_output(chain.front());
+                }
                 if (chain.front()->has_error()) {
                     co_return core::result_wrapper_t<ops::chunks_vector_t>(chain.front()->get_error());
                 }
@@ -1905,6 +2384,9 @@ namespace services::collection::executor {
             if (pumpable_ancestors && chain.front()->output()) {
                 for (const auto& c : chain.front()->output()->chunks()) {
                     auto err = pump_one(c.partial_copy(resource(), 0, c.size()));
+                    if (!err.contains_error() && !streamed.empty()) {
+                        err = co_await stream_out_(stream, streamed);
+                    }
                     if (err.contains_error()) {
                         co_return core::result_wrapper_t<ops::chunks_vector_t>(std::move(err));
                     }
@@ -1913,7 +2395,11 @@ namespace services::collection::executor {
         } else if (start == 0) {
             ops::operator_t* source = chain.front();
             while (true) {
+                const auto started = profile_start(profiling);
                 auto next = co_await source->source_next(ctx);
+                if (profiling) {
+                    source->profile().source_ns += nanoseconds_since(started);
+                }
                 if (next.has_error()) {
                     co_return next.convert_error<ops::chunks_vector_t>();
                 }
@@ -1922,7 +2408,16 @@ namespace services::collection::executor {
                     break; // 0-column drain sentinel (a schema'd 0-row batch is real input, e.g.
                            // the empty-guard a scalar aggregate needs to emit COUNT=0)
                 }
+                if (stream_remaining == 0) {
+                    break; // a streamed LIMIT is complete: nothing further reaches the client
+                }
+                if (profiling) {
+                    profile_output(source, batch);
+                }
                 auto err = pump_one(std::move(batch));
+                if (!err.contains_error() && !streamed.empty()) {
+                    err = co_await stream_out_(stream, streamed);
+                }
                 if (err.contains_error()) {
                     co_return core::result_wrapper_t<ops::chunks_vector_t>(std::move(err));
                 }
@@ -1935,6 +2430,9 @@ namespace services::collection::executor {
             // moving its chunks out would empty it for the other reader.
             for (const auto& c : chain[start - 1]->output()->chunks()) {
                 auto err = pump_one(c.partial_copy(resource(), 0, c.size()));
+                if (!err.contains_error() && !streamed.empty()) {
+                    err = co_await stream_out_(stream, streamed);
+                }
                 if (err.contains_error()) {
                     co_return core::result_wrapper_t<ops::chunks_vector_t>(std::move(err));
                 }
@@ -1948,7 +2446,12 @@ namespace services::collection::executor {
         // since i < j is processed first). Streaming operators finalize to a no-op.
         for (std::size_t i = op_start; i < chain.size(); ++i) {
             ops::chunks_vector_t fin{resource()};
+            const auto finalize_started = profile_start(profiling);
             auto err = chain[i]->finalize(ctx, fin);
+            if (profiling) {
+                chain[i]->profile().finalize_ns += nanoseconds_since(finalize_started);
+                profile_output(chain[i], fin);
+            }
             if (err.contains_error()) {
                 co_return core::result_wrapper_t<ops::chunks_vector_t>(std::move(err));
             }
@@ -1958,15 +2461,34 @@ namespace services::collection::executor {
                 for (std::size_t j = i + 1; j < chain.size(); ++j) {
                     ops::chunks_vector_t produced{resource()};
                     for (auto& in : stage) {
+                        if (profiling) {
+                            profile_input(chain[j], in);
+                        }
+                        const auto started = profile_start(profiling);
                         auto e = chain[j]->push(ctx, std::move(in), produced);
+                        if (profiling) {
+                            chain[j]->profile().push_ns += nanoseconds_since(started);
+                        }
                         if (e.contains_error()) {
                             co_return core::result_wrapper_t<ops::chunks_vector_t>(std::move(e));
                         }
                     }
+                    if (profiling) {
+                        profile_output(chain[j], produced);
+                    }
                     stage = std::move(produced);
                 }
                 for (auto& s : stage) {
-                    output.push_back(std::move(s));
+                    auto emit_err = emit(std::move(s));
+                    if (emit_err.contains_error()) {
+                        co_return core::result_wrapper_t<ops::chunks_vector_t>(std::move(emit_err));
+                    }
+                }
+                if (!streamed.empty()) {
+                    auto stream_err = co_await stream_out_(stream, streamed);
+                    if (stream_err.contains_error()) {
+                        co_return core::result_wrapper_t<ops::chunks_vector_t>(std::move(stream_err));
+                    }
                 }
             }
         }
@@ -1993,7 +2515,12 @@ namespace services::collection::executor {
             if (!op->needs_async_finalize()) {
                 continue;
             }
+            const auto started = profile_start(profiling);
             co_await op->await_async_and_resume(ctx);
+            if (profiling) {
+                op->profile().await_ns += nanoseconds_since(started);
+                profile_async_output(op);
+            }
             if (op->has_error()) {
                 co_return core::result_wrapper_t<ops::chunks_vector_t>(op->get_error());
             }
@@ -2023,6 +2550,9 @@ namespace services::collection::executor {
                 }
             }
         }
+        // Every build side is in place and the source has not started: hand the probe scans
+        // their runtime join filters.
+        ops::push_runtime_filters(root.get());
         co_return core::error_t::no_error();
     }
 
@@ -2128,6 +2658,17 @@ namespace services::collection::executor {
             // run a child sub-plan through this SAME streaming executor reaches us
             // via ctx->runner->run_subplan (intra-actor; see subplan_runner_t).
             pipeline_context.runner = this;
+            pipeline_context.catalog_cache = catalog_cache_;
+            pipeline_context.use_catalog_cache = plan_data.context_storage_.use_catalog_cache;
+            pipeline_context.memory_budget = plan_data.context_storage_.memory_budget;
+            pipeline_context.spill_path = plan_data.context_storage_.spill_path;
+            pipeline_context.worker_threads = plan_data.context_storage_.worker_threads;
+            pipeline_context.profile = plan_data.context_storage_.profile;
+            if (plan->is_root() && plan_data.result_stream) {
+                pipeline_context.result_stream = plan_data.result_stream;
+                pipeline_context.result_limit =
+                    plan_data.limit.limit() > 0 ? static_cast<uint64_t>(plan_data.limit.limit()) : 0;
+            }
 
             // Prepare the operator tree (connects children in aggregation, etc.)
             plan->prepare();
@@ -3,12 +3,16 @@
 #include <components/base/collection_full_name.hpp>
 #include <components/catalog/catalog_oids.hpp>
 #include <components/compute/function.hpp>
+#include <components/configuration/configuration.hpp>
+#include <components/context/analyze_tracker.hpp>
 #include <components/context/pg_catalog_swap.hpp>
 #include <components/context/subplan_runner.hpp>
 #include <components/logical_plan/execution_plan.hpp>
 #include <components/logical_plan/node_limit.hpp>
 #include <components/physical_plan/operators/operator.hpp>
 #include <components/vector/data_chunk.hpp>
+#include <map>
+#include <optional>
 #include <set>
 
 #include <actor-zeta/actor/actor_mixin.hpp>
@@ -45,6 +49,11 @@ namespace services::collection::executor {
     // + relaxed: coarse instrumentation, not a synchronization primitive; off every hot
     // path. DEV_MODE-only, like streaming_pipeline_runs().
     uint64_t dml_appends_reverted() noexcept;
+
+    // Test-observable count of statements served from an executor's plan cache
+    // (executor_t::plan_cache_) instead of being resolved, validated, enriched and
+    // optimized again. DEV_MODE-only, like streaming_pipeline_runs().
+    uint64_t plan_cache_hits() noexcept;
 #endif
 
     // One range per (table, DML fragment), accumulated across sub-plans.
@@ -68,8 +77,8 @@ namespace services::collection::executor {
         // tail before the result crosses the mailbox back to the dispatcher —
         // implicit DML publishes them inline (per-range + index mirrors),
         // explicit DML / DDL ships them to the dispatcher's transaction_t via
-        // txn_accumulate_msg. The dispatcher reads ONLY cursor and
-        // applied_timezone.
+        // txn_accumulate_msg. The dispatcher reads ONLY cursor,
+        // applied_timezone and auto_analyze.
         std::vector<components::pg_catalog_append_range_t> pg_catalog_appends{};
         std::set<components::catalog::oid_t> pg_catalog_delete_tables{};
         // markers emitted by ALTER COLUMN ADD/DROP/RENAME; ride to
@@ -99,8 +108,11 @@ namespace services::collection::executor {
         uint64_t commit_id{0};
         // Non-empty => a SET TIMEZONE statement persisted this zone name to
         // pg_settings; the dispatcher refreshes its default_tz_cat_ from it.
-        // The ONLY post-execute signal the dispatcher consumes besides cursor.
         std::string applied_timezone{};
+        // Set => an autocommitted INSERT took its table past the auto-analyze
+        // threshold: the ANALYZE plan for that table, which the dispatcher runs
+        // on a fresh session after replying to the INSERT.
+        std::optional<components::logical_plan::execution_plan_t> auto_analyze{};
     };
 
     using function_result_t = core::result_wrapper_t<components::compute::function_uid>;
@@ -114,6 +126,9 @@ namespace services::collection::executor {
         const components::logical_plan::storage_parameters* parameters;
         services::context_storage_t context_storage_;
         components::logical_plan::limit_t limit;
+        // Non-owning: the execute_plan frame's execution_plan_t::stream, when the
+        // client reads the result while the statement runs.
+        components::cursor::chunk_stream_t* result_stream{nullptr};
 
         explicit plan_t(std::stack<components::operators::operator_ptr>&& sub_plans,
                         const components::logical_plan::storage_parameters* parameters,
@@ -170,6 +185,9 @@ namespace services::collection::executor {
                    actor_zeta::address_t wal_address,
                    actor_zeta::address_t disk_address,
                    actor_zeta::address_t index_address,
+                   components::catalog_cache_t* catalog_cache,
+                   components::analyze_tracker_t* analyze_tracker,
+                   configuration::config_spill spill,
                    log_t&& log);
         ~executor_t() = default;
 
@@ -216,6 +234,11 @@ namespace services::collection::executor {
         actor_zeta::behavior_t behavior(actor_zeta::mailbox::message* msg);
 
     private:
+        // execute_plan_full's body; execute_plan_full itself only closes a
+        // streaming statement's result stream around it.
+        unique_future<execute_result_t> execute_statement_(components::session::session_id_t session,
+                                                           components::logical_plan::execution_plan_t plan);
+
         plan_t traverse_plan_(components::operators::operator_ptr&& plan,
                               const components::logical_plan::storage_parameters& parameters,
                               services::context_storage_t&& context_storage);
@@ -236,6 +259,12 @@ namespace services::collection::executor {
         unique_future<core::result_wrapper_t<components::operators::chunks_vector_t>>
         execute_pipeline(components::operators::operator_ptr root, components::pipeline::context_t* ctx);
 
+        // Hands `chunks` (emptied) to a streaming statement's client. While the stream is full the
+        // coroutine parks on the dispatcher (stream_wait_msg) until the client makes room, instead of
+        // blocking the scheduler thread. query_cancelled once the client closed the stream.
+        unique_future<core::error_t> stream_out_(components::cursor::chunk_stream_t* stream,
+                                                 components::operators::chunks_vector_t& chunks);
+
         // Drive ONE prepared sub-plan root to completion through the streaming seam
         // (execute_pipeline). On return `root` is executed with its output_ set
         // (unless an error occurred). Shared by execute_sub_plan_ (which then reads
@@ -254,8 +283,9 @@ namespace services::collection::executor {
         // recursive-CTE recursive term JOIN(scan, cte_scan)), so the build side would be
         // un-materialized at first push(). This walks the left-chain and recursively
         // drives any un-executed right subtree via drive_subplan_ — a no-op when the
-        // build sides were already split out (is_executed() short-circuits). Returns the
-        // first error; no_error() on success.
+        // build sides were already split out (is_executed() short-circuits). Then pushes
+        // the runtime join filters onto the probe scans (push_runtime_filters). Returns
+        // the first error; no_error() on success.
         unique_future<core::error_t> materialize_build_sides_(components::operators::operator_ptr root,
                                                               components::pipeline::context_t* ctx);
 
@@ -278,6 +308,40 @@ namespace services::collection::executor {
         actor_zeta::address_t index_address_ = actor_zeta::address_t::empty_address();
         log_t log_;
         components::compute::function_registry_t function_registry_;
+        // Dispatcher-owned, shared with the other executors; published on every
+        // pipeline context (context_t::catalog_cache).
+        components::catalog_cache_t* catalog_cache_;
+        // Dispatcher-owned, shared with the other executors: auto-analyze row
+        // counts (see analyze_tracker_t).
+        components::analyze_tracker_t* analyze_tracker_;
+        // Default spill budget and directory; a plan's own memory_budget wins.
+        configuration::config_spill spill_;
+
+        // An optimized SELECT plan and the plan context it was built with.
+        // Logical nodes are only read from here on (the physical plan is built
+        // afresh per execution), so one tree serves any number of executions.
+        struct cached_plan_t {
+            uint64_t catalog_version;
+            core::date::timezone_offset_t session_timezone;
+            std::vector<std::pair<core::parameter_id_t, components::types::complex_logical_type>> parameter_types;
+            components::logical_plan::node_ptr root;
+            std::unordered_set<components::catalog::oid_t> known_oids;
+            // Point into the resolve nodes of `root`.
+            std::unordered_map<components::catalog::oid_t, const components::logical_plan::resolved_table_metadata_t*>
+                table_metadata;
+            std::pmr::vector<components::index::keys_base_storage_t> indexed_keys;
+            std::pmr::vector<components::index::index_description_t> indexed_descriptions;
+            components::planner::optimizer::statistics_map_t statistics;
+        };
+        // Prepared statements' plans by execution_plan_t::cache_key. An entry is
+        // reused only under the catalog version it was planned against (see
+        // catalog_cache_t::admitted_version), the same session timezone and the
+        // same parameter types; plans that depend on parameter values (folded
+        // constants) or on a view body are never stored. Per executor since
+        // function uids come from this executor's function_registry_. Dropped
+        // wholesale when full, like the catalog cache, and on register_udf.
+        static constexpr std::size_t max_cached_plans = 1024;
+        std::map<std::string, cached_plan_t, std::less<>> plan_cache_;
     };
 
     using executor_ptr = std::unique_ptr<executor_t, actor_zeta::pmr::deleter_t>;
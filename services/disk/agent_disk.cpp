@@ -1,7 +1,9 @@
 #include "agent_disk.hpp"
 #include "inline_scan.hpp" // services::disk::detail::inline_scan (catalog DDL on the agent)
+#include "key_probe.hpp"   // services::disk::detail::key_probe_set_t (batched keyed reads)
 #include "manager_disk.hpp"
 #include <components/vector/vector_operations.hpp>
+#include <algorithm>
 #include <fstream>
 #include <services/dispatcher/dispatcher.hpp>
 #include <unordered_set>
@@ -385,6 +387,10 @@ namespace services::disk {
                 co_await actor_zeta::dispatch(this, &agent_disk_t::storage_total_rows_inner, msg);
                 break;
             }
+            case actor_zeta::msg_id<agent_disk_t, &agent_disk_t::storage_statistics_inner>: {
+                co_await actor_zeta::dispatch(this, &agent_disk_t::storage_statistics_inner, msg);
+                break;
+            }
             case actor_zeta::msg_id<agent_disk_t, &agent_disk_t::checkpoint_inner>: {
                 co_await actor_zeta::dispatch(this, &agent_disk_t::checkpoint_inner, msg);
                 break;
@@ -1058,12 +1064,14 @@ namespace services::disk {
     }
 
     // Streaming fetch-next scan source (STEP 3 / phase B). POSITION-ONLY index-resume: the cursor
-    // in active_scans_ stores ONLY the absolute resume position + the scan params; every fetch
-    // re-seeks a TRANSIENT scan state from that position (storage_t::fetch_next_batch), reads ONE
-    // batch, advances the stored position, and lets the pins destruct — so peak scan memory is one
-    // batch and ZERO pins survive this round-trip. cursor_id==0 OPENs (minting a (session,counter)
-    // id, capping the matched-row head at offset+limit); non-zero ADVANCEs the same cursor. The
-    // cursor is GC'd (erased) the moment it drains or hits the matched-row limit.
+    // in active_scans_ stores ONLY the absolute resume position + the scan params + a bounded queue
+    // of already-scanned batches; a refill re-seeks a TRANSIENT scan state from that position
+    // (storage_t::fetch_next_batches), reads up to scan_read_ahead_ batches through it, advances the
+    // stored position, and lets the pins destruct — so peak scan memory is one read-ahead window
+    // and ZERO pins survive this round-trip. Each reply ships up to scan_read_ahead_ batches.
+    // cursor_id==0 OPENs (minting a (session,counter) id, capping the matched-row head at
+    // offset+limit); non-zero ADVANCEs the same cursor. The cursor is GC'd (erased) the moment it
+    // drains or hits the matched-row limit.
     agent_disk_t::unique_future<core::result_wrapper_t<fetch_batch_t>>
     agent_disk_t::storage_fetch_next_batch_inner(session_id_t session,
                                                  components::catalog::oid_t table_oid,
@@ -1124,8 +1132,9 @@ namespace services::disk {
         }
         auto& scan = cit->second;
 
-        // Position exhausted or matched-row limit already met: GC and reply drained.
-        if (scan.pos.drained ||
+        // Position exhausted (and no buffered window left) or matched-row limit already met: GC and
+        // reply drained.
+        if ((scan.pos.drained && scan.ready.empty()) ||
             (scan.matched_limit >= 0 && scan.matched_emitted >= static_cast<uint64_t>(scan.matched_limit))) {
             active_scans_.erase(cit);
             co_return make_drained(cursor_id);
@@ -1140,43 +1149,81 @@ namespace services::disk {
         }
         auto* storage = storage_it->second->storage.get();
 
-        // Construct the projected output chunk, then re-seek + read ONE batch from the stored
-        // position. fetch_next_batch builds a transient scan state, pins only one batch's segments,
-        // and releases them before returning — nothing pinned survives this handler.
-        auto all_types = storage->types();
         const std::vector<size_t>* projected_ptr = scan.projected_cols.empty() ? nullptr : &scan.projected_cols;
-        auto batch =
-            projected_ptr
-                ? std::make_unique<components::vector::data_chunk_t>(resource(),
-                                                                    all_types,
-                                                                    *projected_ptr,
-                                                                    components::vector::DEFAULT_VECTOR_CAPACITY)
-                : std::make_unique<components::vector::data_chunk_t>(resource(),
-                                                                    all_types,
-                                                                    components::vector::DEFAULT_VECTOR_CAPACITY);
-        auto fetch_r = storage->fetch_next_batch(*batch, scan.pos, scan.filter.get(), projected_ptr, scan.txn);
-        if (fetch_r.has_error()) {
-            active_scans_.erase(cit);
-            co_return fetch_r.convert_error<fetch_batch_t>();
+
+        // Refill the bounded read-ahead queue once it runs dry. An unbounded scan with more than one
+        // morsel left scans a window of up to scan_threads_ morsels at once (one per worker), merged
+        // back in row order. Otherwise one scan state reads a range of scan_read_ahead_ vectors; with
+        // a LIMIT the range is capped at the vectors the remaining budget could still need (matched
+        // rows never exceed source rows), so a small LIMIT never reads past its head.
+        if (scan.ready.empty()) {
+            const bool parallel =
+                scan_threads_ > 1 && scan.matched_limit < 0 &&
+                scan.pos.max_row - scan.pos.next_row > static_cast<int64_t>(components::table::MORSEL_ROW_COUNT);
+            uint64_t read_ahead = scan_read_ahead_;
+            if (scan.matched_limit >= 0) {
+                constexpr uint64_t capacity = components::vector::DEFAULT_VECTOR_CAPACITY;
+                const uint64_t budget = static_cast<uint64_t>(scan.matched_limit) - scan.matched_emitted;
+                read_ahead = std::clamp<uint64_t>((budget + capacity - 1) / capacity, 1, read_ahead);
+            }
+            std::pmr::vector<components::vector::data_chunk_t> window(resource());
+            while (window.empty() && !scan.pos.drained) {
+                auto fetch_r =
+                    parallel ? storage->fetch_next_morsels(window,
+                                                           scan.pos,
+                                                           scan.filter.get(),
+                                                           projected_ptr,
+                                                           scan.txn,
+                                                           scan_threads_,
+                                                           scan_threads_)
+                             : storage->fetch_next_batches(window,
+                                                           scan.pos,
+                                                           scan.filter.get(),
+                                                           projected_ptr,
+                                                           scan.txn,
+                                                           read_ahead);
+                if (fetch_r.has_error()) {
+                    active_scans_.erase(cit);
+                    co_return fetch_r.convert_error<fetch_batch_t>();
+                }
+            }
+            for (auto& chunk : window) {
+                scan.ready.emplace_back(std::move(chunk));
+            }
         }
 
-        // Enforce the post-filter matched-row limit across batches: trim the boundary batch to the
-        // remaining budget and stop advancing once it is spent.
-        if (scan.matched_limit >= 0) {
-            const uint64_t budget = static_cast<uint64_t>(scan.matched_limit) - scan.matched_emitted;
-            if (batch->size() >= budget) {
-                batch->set_cardinality(budget);
-                scan.pos.drained = true;
+        // Hand out up to scan_read_ahead_ queued batches in one reply, enforcing the post-filter
+        // matched-row limit across them: trim the boundary batch to the remaining budget and stop
+        // advancing once it is spent.
+        fetch_batch_t reply{nullptr, cursor_id};
+        for (std::size_t handed = 0; handed < scan_read_ahead_ && !scan.ready.empty(); handed++) {
+            auto chunk = std::move(scan.ready.front());
+            scan.ready.pop_front();
+            if (scan.matched_limit >= 0) {
+                const uint64_t budget = static_cast<uint64_t>(scan.matched_limit) - scan.matched_emitted;
+                if (chunk.size() >= budget) {
+                    chunk.set_cardinality(budget);
+                    scan.pos.drained = true;
+                    scan.ready.clear();
+                }
+            }
+            scan.matched_emitted += chunk.size();
+            if (chunk.size() == 0) {
+                break;
+            }
+            if (!reply.batch) {
+                reply.batch = std::make_unique<components::vector::data_chunk_t>(std::move(chunk));
+            } else {
+                reply.read_ahead.push_back(std::move(chunk));
             }
         }
-        scan.matched_emitted += batch->size();
 
-        if (batch->size() == 0) {
+        if (!reply.batch) {
             // No rows this round (drained, or a boundary batch trimmed to 0): GC and reply drained.
             active_scans_.erase(cit);
             co_return make_drained(cursor_id);
         }
-        co_return fetch_batch_t{std::move(batch), cursor_id};
+        co_return std::move(reply);
     }
 
     agent_disk_t::unique_future<std::pmr::vector<components::vector::data_chunk_t>>
@@ -1230,7 +1277,9 @@ namespace services::disk {
                                      components::table::transaction_data txn) {
         // result[i] = row_ids matching keys[i]; one (possibly empty) entry per key,
         // preserving input order. Name→index resolution runs once for the whole
-        // batch, then each key gets an eq-AND filtered scan.
+        // batch. A multi-key batch is answered by one pass over the key columns
+        // probed against a hash set of the keys; a single key (or a key whose type
+        // differs from its column's) gets an eq-AND filtered scan.
         std::pmr::vector<std::pmr::vector<std::int64_t>> result{resource()};
         result.reserve(keys.size());
 
@@ -1279,6 +1328,39 @@ namespace services::disk {
             }
             co_return std::move(result);
         }
+        if (nkeys >= detail::batched_probe_min_keys &&
+            detail::key_probe_set_t::comparable(keys, cols, key_col_indices)) {
+            for (std::uint64_t i = 0; i < nkeys; ++i) {
+                result.emplace_back();
+            }
+            detail::key_probe_set_t probe_set(resource(), keys);
+            if (probe_set.empty()) {
+                co_return std::move(result);
+            }
+            // Only the key columns are read; row_ids ride along with every batch.
+            const std::vector<std::size_t> projected(key_col_indices.begin(), key_col_indices.end());
+            const auto range = probe_set.range_filter(cols, key_col_indices);
+            auto scan_r = detail::for_each_batch(*entry->storage,
+                                                 range.get(),
+                                                 &projected,
+                                                 txn,
+                                                 scan_read_ahead_,
+                                                 [&](components::vector::data_chunk_t& chunk) {
+                                                     const auto* ids = chunk.row_ids.data<std::int64_t>();
+                                                     probe_set.probe(chunk,
+                                                                     key_col_indices,
+                                                                     [&](std::uint64_t key, std::uint64_t row) {
+                                                                         result[key].push_back(ids[row]);
+                                                                     });
+                                                 });
+            if (scan_r.has_error()) {
+                // Same degradation as the per-key path, for every key at once.
+                for (auto& row_ids : result) {
+                    row_ids.clear();
+                }
+            }
+            co_return std::move(result);
+        }
         for (std::uint64_t i = 0; i < nkeys; ++i) {
             std::pmr::vector<std::int64_t> row_ids{resource()};
             auto filter = std::make_unique<components::table::conjunction_and_filter_t>();
@@ -1370,8 +1452,10 @@ namespace services::disk {
                                             components::vector::data_chunk_t keys,
                                             components::table::transaction_data txn) {
         // result[i] = matched chunks for key-tuple i; one (possibly empty) entry per key,
-        // preserving input order. Name→index resolution runs once for the whole batch, then
-        // each key gets an eq-AND filtered scan via scan_local (D6: no self-send).
+        // preserving input order. Name→index resolution runs once for the whole batch. A
+        // multi-key batch is answered by one pass over the table probed against a hash set of
+        // the keys; a single key (or a key whose type differs from its column's) gets an eq-AND
+        // filtered scan via scan_local (D6: no self-send).
         std::pmr::vector<std::pmr::vector<components::vector::data_chunk_t>> result{resource()};
         result.reserve(keys.size());
 
@@ -1419,6 +1503,51 @@ namespace services::disk {
             }
             co_return std::move(result);
         }
+        if (nkeys >= detail::batched_probe_min_keys &&
+            detail::key_probe_set_t::comparable(keys, cols, key_col_indices)) {
+            for (std::uint64_t i = 0; i < nkeys; ++i) {
+                result.emplace_back();
+            }
+            detail::key_probe_set_t probe_set(resource(), keys);
+            if (probe_set.empty()) {
+                co_return std::move(result);
+            }
+            // Matches of one batch are gathered per key, then copied out as one chunk per
+            // (batch, key): each key still receives its rows in scan order, in batches.
+            std::pmr::vector<std::pmr::vector<std::uint64_t>> hits{resource()};
+            hits.resize(nkeys);
+            std::pmr::vector<std::uint64_t> touched{resource()};
+            const auto range = probe_set.range_filter(cols, key_col_indices);
+            auto scan_r = detail::for_each_batch(
+                *entry->storage,
+                range.get(),
+                nullptr,
+                txn,
+                scan_read_ahead_,
+                [&](components::vector::data_chunk_t& chunk) {
+                    probe_set.probe(chunk, key_col_indices, [&](std::uint64_t key, std::uint64_t row) {
+                        if (hits[key].empty()) {
+                            touched.push_back(key);
+                        }
+                        hits[key].push_back(static_cast<std::uint64_t>(row));
+                    });
+                    for (auto key : touched) {
+                        const auto count = static_cast<std::uint64_t>(hits[key].size());
+                        components::vector::indexing_vector_t indexing(resource(), hits[key].data());
+                        components::vector::data_chunk_t out(resource(), chunk.types(), count);
+                        chunk.copy(out, indexing, count);
+                        result[key].emplace_back(std::move(out));
+                        hits[key].clear();
+                    }
+                    touched.clear();
+                });
+            if (scan_r.has_error()) {
+                for (auto& chunks : result) {
+                    chunks.clear();
+                }
+            }
+            co_return std::move(result);
+        }
         for (std::uint64_t i = 0; i < nkeys; ++i) {
             auto filter = std::make_unique<components::table::conjunction_and_filter_t>();
             for (std::size_t ki = 0; ki < key_col_indices.size(); ++ki) {
@@ -1483,6 +1612,20 @@ namespace services::disk {
         co_return entry->storage->total_rows();
     }
 
+    agent_disk_t::unique_future<components::table::table_statistics_t>
+    agent_disk_t::storage_statistics_inner(components::catalog::oid_t table_oid) {
+        auto it = storages_.find(table_oid);
+        if (it == storages_.end() || it->second == nullptr || it->second->storage == nullptr) {
+            trace(log_,
+                  "agent_disk[{}]::storage_statistics_inner: oid {} has no live storage here",
+                  pool_idx_,
+                  static_cast<unsigned>(table_oid));
+            co_return components::table::table_statistics_t{};
+        }
+        auto& storage = *it->second->storage;
+        co_return components::table::table_statistics_t{storage.total_rows(), storage.column_statistics()};
+    }
+
     agent_disk_t::unique_future<void> agent_disk_t::fix_wal_id(wal::id_t wal_id) {
         trace(log_, "agent_disk::fix_wal_id : {}", wal_id);
         auto id = std::to_string(wal_id);
@@ -1495,9 +1638,12 @@ namespace services::disk {
     agent_disk_t::checkpoint_inner(session_id_t /*session*/, wal::id_t current_wal_id, uint64_t compact_watermark) {
         trace(log_, "agent_disk[{}]::checkpoint_inner: {} entries in local slice", pool_idx_, storages_.size());
         // Per DISK entry, crash-safe checkpoint sequence (order matters):
-        //   compact (MVCC-gated), backup .otbx → .prev, checkpoint(wal_id), persist
-        //   the .wal_id sidecar via tmp+rename, then delete the .prev backup on
-        //   success. Tally min(prev_checkpoint_wal_id_) for the manager's
+        //   compact (MVCC-gated), checkpoint(wal_id), then persist the .wal_id
+        //   sidecar via tmp+rename. The checkpoint writes only dirty row groups to
+        //   blocks the durable header does not reference and commits them with the
+        //   header swap, so the .otbx needs no backup copy: a crash or error before
+        //   the swap leaves the previous checkpoint intact in the same file.
+        //   Tally min(prev_checkpoint_wal_id_) for the manager's
         //   cross-agent std::min. IN_MEMORY twins and null entries are skipped
         //   for checkpointing, but an IN_MEMORY twin flips has_in_memory so
         //   checkpoint_all can gate WAL-floor sealing without a separate sync
@@ -1556,47 +1702,20 @@ namespace services::disk {
                   static_cast<unsigned>(tbl_oid));
 
             const auto& otbx_path = entry->otbx_path;
-            auto prev_path = otbx_path;
-            prev_path += ".prev";
-
-            // Backup current checkpoint before overwriting.
-            std::error_code copy_error;
-            if (std::filesystem::exists(otbx_path)) {
-                std::filesystem::copy_file(otbx_path,
-                                           prev_path,
-                                           std::filesystem::copy_options::overwrite_existing,
-                                           copy_error);
-                if (copy_error) {
-                    warn(log_,
-                         "agent_disk[{}]::checkpoint_inner copy {} -> {} failed: {}",
-                         pool_idx_,
-                         otbx_path.string(),
-                         prev_path.string(),
-                         copy_error.message());
-                }
-            }
 
             // checkpoint(wal_id) returns out_of_memory on a column flush pin failure; it
-            // aborts BEFORE the header swap and leaves the wal_id fields unchanged. On error,
-            // defer this entry to a later round (same as the MVCC-gate skip above): restore
-            // the .prev backup over any partial write, do NOT persist the sidecar or delete
-            // the backup, and feed the unchanged prev_checkpoint_wal_id into the min() so the
-            // WAL keeps this table's replay records.
+            // aborts BEFORE the header swap and leaves the wal_id fields unchanged. Blocks
+            // written so far are not referenced by the durable header, so the file still
+            // holds the previous checkpoint. On error, defer this entry to a later round
+            // (same as the MVCC-gate skip above): do NOT persist the sidecar, and feed the
+            // unchanged prev_checkpoint_wal_id into the min() so the WAL keeps this table's
+            // replay records.
             auto cp_r = entry->table_storage.checkpoint(current_wal_id);
             if (cp_r.has_error()) {
                 warn(log_,
                      "agent_disk[{}]::checkpoint_inner oid={} checkpoint failed (rules 2/9) — deferring this round",
                      pool_idx_,
                      static_cast<unsigned>(tbl_oid));
-                if (std::filesystem::exists(prev_path)) {
-                    std::error_code restore_error;
-                    std::filesystem::copy_file(prev_path,
-                                               otbx_path,
-                                               std::filesystem::copy_options::overwrite_existing,
-                                               restore_error);
-                    std::error_code remove_error;
-                    std::filesystem::remove(prev_path, remove_error);
-                }
                 min_prev_id = std::min(min_prev_id, entry->table_storage.prev_checkpoint_wal_id());
                 continue;
             }
@@ -1623,12 +1742,6 @@ namespace services::disk {
                 }
             }
 
-            // Delete backup only after a successful checkpoint.
-            if (std::filesystem::exists(prev_path)) {
-                std::error_code remove_error;
-                std::filesystem::remove(prev_path, remove_error);
-            }
-
             min_prev_id = std::min(min_prev_id, entry->table_storage.prev_checkpoint_wal_id());
         }
         co_return checkpoint_result_t{min_prev_id, has_in_memory};
@@ -1821,6 +1934,16 @@ namespace services::disk {
     // See header. Bootstrap-only; after scheduler.start the address is read-only.
     void agent_disk_t::set_manager_wal_sync(actor_zeta::address_t address) { manager_wal_addr_ = std::move(address); }
 
+    // See header. Bootstrap-only; clamped so a zero never disables scanning.
+    void agent_disk_t::set_scan_threads_sync(std::size_t scan_threads) {
+        scan_threads_ = std::max<std::size_t>(1, scan_threads);
+    }
+
+    // See header. Bootstrap-only; clamped so a zero still hands out one batch per round trip.
+    void agent_disk_t::set_scan_read_ahead_sync(std::size_t scan_read_ahead) {
+        scan_read_ahead_ = std::max<std::size_t>(1, scan_read_ahead);
+    }
+
     // GC-slice push-back (see header). Called pre-scheduler-start by base_spaces
     // catalog rebuild and at runtime by mark_storage_dropped_many_inner.
     void agent_disk_t::register_dropped_storage_inner_sync(components::catalog::oid_t oid,
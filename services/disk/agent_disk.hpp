@@ -19,6 +19,7 @@
 #include <core/file/local_file_system.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
 #include <memory>
 #include <memory_resource>
@@ -285,10 +286,11 @@ namespace services::disk {
         storage_scan_segment_inner(components::catalog::oid_t table_oid, int64_t start, uint64_t count);
 
         // scan_by_keys_inner — batched keyed scan for one owned table. Resolves the
-        //   key column NAMES to storage indices once, then loops the key-tuples of the
-        //   columnar `keys` chunk: per row i it builds an eq-AND filter over the shared
-        //   key columns (constant = keys.value(j, i)) and scans, collecting the matching
-        //   row_ids. result[i] == match row_ids for key-tuple i; result has one
+        //   key column NAMES to storage indices once. Two or more key-tuples are hashed
+        //   into a detail::key_probe_set_t and answered by ONE pass over the key columns
+        //   (key_probe.hpp); a single key, or keys whose physical type differs from their
+        //   column's, falls back to an eq-AND filtered scan per row i (constant =
+        //   keys.value(j, i)). result[i] == match row_ids for key-tuple i; result has one
         //   (possibly empty) entry per key. A not-owned OID / unknown column / arity
         //   mismatch yields a same-length result of empty rows (or empty when keys is
         //   empty). The whole batch is one mailbox message so name resolution happens
@@ -316,9 +318,10 @@ namespace services::disk {
         // read_chunks_by_keys_inner — batched multi-key columnar row-data scan for one owned
         //   table. `keys` is an N-row data_chunk whose column j holds key_col_names[j] and whose
         //   row i is the i-th key-tuple. The handler resolves the key column NAMES to storage
-        //   indices ONCE, then for each key row builds an eq-AND filter (constant = keys.value(j, i))
-        //   and scans, returning the matching rows as batched data_chunk_t (all columns, no row
-        //   limit). result[i] == matched chunks for key-tuple i; the outer vector always has one
+        //   indices ONCE, then answers a multi-key batch with one pass over the table probed
+        //   against a detail::key_probe_set_t (single key / mismatched key types: an eq-AND
+        //   filtered scan per key row), returning the matching rows as batched data_chunk_t (all
+        //   columns, no row limit). result[i] == matched chunks for key-tuple i; the outer vector always has one
         //   (possibly empty) entry per key in input order, so result.size() == keys.size() on
         //   EVERY path — mirroring scan_by_keys_inner. A not-owned OID / record-only marker /
         //   unknown column / arity mismatch yields a same-length vector of empty entries (or empty
@@ -338,6 +341,11 @@ namespace services::disk {
         //   either "not owned" or "empty twin" — both equivalent for callers.
         unique_future<uint64_t> storage_total_rows_inner(components::catalog::oid_t table_oid);
 
+        // storage_statistics_inner — row count + merged per-column statistics.
+        //   Empty (0 rows, no columns) when the oid is not owned here.
+        unique_future<components::table::table_statistics_t>
+        storage_statistics_inner(components::catalog::oid_t table_oid);
+
         // Fanout handlers for checkpoint_all / vacuum_all / on_horizon_advanced —
         // each agent iterates its own storages_ slice in parallel.
         //
@@ -482,6 +490,14 @@ namespace services::disk {
         // mailbox handler; single-threaded at the bootstrap call site.
         void set_manager_wal_sync(actor_zeta::address_t address);
 
+        // Bootstrap-only: worker count for morsel-parallel fetch-next scans (config_disk::scan_threads,
+        // already resolved from 0 to the hardware concurrency). 1 keeps every scan serial. Not a
+        // mailbox handler; single-threaded at the create_agent call site.
+        void set_scan_threads_sync(std::size_t scan_threads);
+        // Bootstrap-only: batches a fetch-next cursor reads ahead per round trip
+        // (config_disk::scan_read_ahead). Same call-site contract as set_scan_threads_sync.
+        void set_scan_read_ahead_sync(std::size_t scan_read_ahead);
+
         using dispatch_traits = actor_zeta::dispatch_traits<&agent_disk_t::fix_wal_id,
                                                             &agent_disk_t::storage_append_inner,
                                                             &agent_disk_t::storage_publish_commits_inner,
@@ -499,6 +515,7 @@ namespace services::disk {
                                                             &agent_disk_t::read_chunks_by_keys_inner,
                                                             &agent_disk_t::storage_types_inner,
                                                             &agent_disk_t::storage_total_rows_inner,
+                                                            &agent_disk_t::storage_statistics_inner,
                                                             &agent_disk_t::checkpoint_inner,
                                                             &agent_disk_t::vacuum_inner,
                                                             &agent_disk_t::maybe_cleanup_inner,
@@ -574,7 +591,12 @@ namespace services::disk {
             components::table::transaction_data txn{0, 0};    // MVCC snapshot for the whole scan
             int64_t matched_limit{-1};                        // post-filter matched-row cap (-1 == unbounded)
             uint64_t matched_emitted{0};                      // running matched rows handed out (enforces matched_limit)
-            explicit active_scan_t(std::pmr::memory_resource*) {}
+            // Bounded read-ahead queue: batches already scanned by the last refill (a fetch_next_batches
+            // range of scan_read_ahead vectors, or a fetch_next_morsels window of scan_threads morsels)
+            // and not yet handed out. Copies, not pins — nothing pinned outlives the refill.
+            std::pmr::deque<components::vector::data_chunk_t> ready;
+            explicit active_scan_t(std::pmr::memory_resource* resource)
+                : ready(resource) {}
         };
         std::pmr::unordered_map<uint64_t, active_scan_t> active_scans_;
         // Monotonic per-agent cursor-id counter, combined with the session at mint time so the id
@@ -595,6 +617,11 @@ namespace services::disk {
             return false;
         }
 
+        // Morsel-parallel scan workers (set_scan_threads_sync); 1 == serial fetch-next.
+        std::size_t scan_threads_{1};
+        // Fetch-next read-ahead depth (set_scan_read_ahead_sync); 1 == one batch per round trip.
+        std::size_t scan_read_ahead_{1};
+
         // Per-agent GC slice — sole owner of GC state. Populated by
         // register_dropped_storage_inner_sync; on_horizon_advanced_inner removes entries
         // whose dropped_at_commit_id < new_horizon and acks on_subscriber_empty
@@ -18,6 +18,7 @@
 #include <components/logical_plan/node.hpp>
 #include <components/physical_plan/operators/operator_write_data.hpp>
 #include <components/session/session.hpp>
+#include <components/table/base_statistics.hpp>
 #include <components/table/column_definition.hpp>
 #include <components/table/column_state.hpp>
 #include <components/table/row_version_manager.hpp>
@@ -48,9 +49,14 @@ namespace services::disk {
     // default-constructible — actor_zeta::otterbrix::send's null-target / ready-future
     // machinery requires a default-constructible reply payload (data_chunk_t has no
     // default ctor), the same reason storage_fetch ships unique_ptr<data_chunk_t>.
+    //
+    // `read_ahead` carries the batches that follow `batch` in scan order when the agent read
+    // several ahead in one round trip (config_disk::scan_read_ahead); the source operator hands
+    // them out before its next ADVANCE. Empty on a drained reply.
     struct fetch_batch_t {
         std::unique_ptr<components::vector::data_chunk_t> batch;
         uint64_t cursor_id{0};
+        std::vector<components::vector::data_chunk_t> read_ahead;
 
         fetch_batch_t() = default;
         fetch_batch_t(std::unique_ptr<components::vector::data_chunk_t>&& b, uint64_t id)
@@ -117,7 +123,8 @@ namespace services::disk {
         // Keys are columnar: `keys` is a data_chunk whose column j holds key_col_names[j]
         // and whose row i is the i-th key-tuple, so no row-major logical_value_t crosses
         // the boundary. All keys share the same table_oid (and therefore the same owning
-        // agent), so the per-key loop runs intra-agent via a single scan_by_keys_inner.
+        // agent), so the whole batch is answered intra-agent by a single scan_by_keys_inner
+        // (one table pass for a multi-key batch).
         actor_zeta::unique_future<std::pmr::vector<std::pmr::vector<std::int64_t>>>
         scan_by_keys(execution_context_t ctx,
                      components::catalog::oid_t table_oid,
@@ -139,8 +146,8 @@ namespace services::disk {
         // for key-tuple i (each chunk <= DEFAULT_VECTOR_CAPACITY rows). `keys` is an N-row
         // columnar carrier (column j == key_col_names[j], row i == i-th key-tuple), so no
         // row-major logical_value_t crosses the boundary. All keys share `table_oid` (one owning
-        // agent), so the per-key loop runs intra-agent via a single read_chunks_by_keys_inner
-        // message. The outer vector always has one (possibly empty) entry per key in input
+        // agent), so the whole batch is answered intra-agent by a single read_chunks_by_keys_inner
+        // message (one table pass for a multi-key batch). The outer vector always has one (possibly empty) entry per key in input
         // order, so result.size() == keys.size(). Callers read cells via chunk.value(col, row).
         actor_zeta::unique_future<std::pmr::vector<std::pmr::vector<components::vector::data_chunk_t>>>
         read_chunks_by_keys(execution_context_t ctx,
@@ -177,6 +184,8 @@ namespace services::disk {
         storage_types(session_id_t session, components::catalog::oid_t table_oid);
         actor_zeta::unique_future<uint64_t> storage_total_rows(session_id_t session,
                                                                components::catalog::oid_t table_oid);
+        actor_zeta::unique_future<components::table::table_statistics_t>
+        storage_statistics(session_id_t session, components::catalog::oid_t table_oid);
         // Storage data operations.
         // Returns a vector of chunks and applies index-based column projection at the
         // disk layer. Empty `projected_cols` means "read all columns" (pass-through). The
@@ -303,6 +312,7 @@ namespace services::disk {
                                                             // Storage queries
                                                             &disk_contract::storage_types,
                                                             &disk_contract::storage_total_rows,
+                                                            &disk_contract::storage_statistics,
                                                             // Storage data operations
                                                             &disk_contract::storage_scan,
                                                             &disk_contract::storage_fetch_next_batch,
@@ -0,0 +1,217 @@
+#pragma once
+
+// Batched keyed probe for the disk service. scan_by_keys_inner and
+// read_chunks_by_keys_inner hash the distinct key-tuples of a batch once, then
+// answer every key from a single pass over the table instead of running one
+// eq-AND filtered scan per key. The pass carries a range filter spanning the
+// keys, so segments whose zone map misses every key are still skipped.
+
+#include <components/storage/storage.hpp>
+#include <components/table/column_state.hpp>
+#include <components/table/column_definition.hpp>
+#include <components/types/types.hpp>
+#include <components/vector/data_chunk.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+namespace services::disk::detail {
+
+    // Below this many keys the per-key filtered scan is kept: its eq bounds
+    // are tighter than the batch's range filter.
+    constexpr std::size_t batched_probe_min_keys = 2;
+
+    class key_probe_set_t {
+    public:
+        // `keys` column j holds the j-th key column, row i the i-th key-tuple.
+        // It is flattened in place and must outlive the probe set. Key-tuples
+        // with a NULL cell are left out: an eq filter never matches NULL.
+        key_probe_set_t(std::pmr::memory_resource* resource, components::vector::data_chunk_t& keys)
+            : resource_(resource)
+            , keys_(keys)
+            , buckets_(resource)
+            , groups_(resource) {
+            const uint64_t n = keys.size();
+            if (n == 0 || keys.column_count() == 0) {
+                return;
+            }
+            keys.flatten();
+            std::vector<uint64_t> cols(keys.column_count());
+            for (uint64_t j = 0; j < cols.size(); ++j) {
+                cols[j] = j;
+                key_cols_.push_back(j);
+            }
+            components::vector::vector_t hashes(resource_, components::types::logical_type::UBIGINT, n);
+            keys.hash(cols, hashes);
+            hashes.flatten(n);
+            const auto* h = hashes.data<uint64_t>();
+            for (uint64_t i = 0; i < n; ++i) {
+                if (!all_valid(keys, key_cols_, i)) {
+                    continue;
+                }
+                // Duplicate key-tuples share one group, so each distinct key is
+                // compared once per candidate row.
+                auto& bucket = buckets_[h[i]];
+                auto same = std::find_if(bucket.begin(), bucket.end(), [&](uint32_t g) {
+                    return tuples_equal(keys, key_cols_, i, groups_[g].front());
+                });
+                if (same != bucket.end()) {
+                    groups_[*same].push_back(static_cast<uint32_t>(i));
+                } else {
+                    bucket.push_back(static_cast<uint32_t>(groups_.size()));
+                    groups_.emplace_back(1, static_cast<uint32_t>(i));
+                }
+            }
+        }
+
+        // Hash and equality agree only between identical physical types; other
+        // pairings (e.g. INTEGER keys against a BIGINT column) stay on the
+        // per-key filtered scan, which coerces the constant.
+        static bool comparable(const components::vector::data_chunk_t& keys,
+                               const std::vector<components::table::column_definition_t>& cols,
+                               const std::pmr::vector<std::uint64_t>& key_col_indices) {
+            for (std::size_t j = 0; j < key_col_indices.size(); ++j) {
+                if (keys.data[j].type().to_physical_type() != cols[key_col_indices[j]].type().to_physical_type()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool empty() const noexcept { return groups_.empty(); }
+
+        // [min, max] of every key column over the probed key-tuples, ANDed, so
+        // the single pass prunes by zone map like the per-key scans do. A column
+        // whose stored type differs from the key's gets no bound: zone maps skip
+        // constants of another type anyway. nullptr when no column is bounded.
+        std::unique_ptr<components::table::table_filter_t>
+        range_filter(const std::vector<components::table::column_definition_t>& cols,
+                     const std::pmr::vector<std::uint64_t>& key_col_indices) const {
+            if (groups_.empty()) {
+                return nullptr;
+            }
+            auto filter = std::make_unique<components::table::conjunction_and_filter_t>();
+            for (std::size_t j = 0; j < key_col_indices.size(); ++j) {
+                if (keys_.data[j].type().type() != cols[key_col_indices[j]].type().type()) {
+                    continue;
+                }
+                auto min = keys_.data[j].value(groups_.front().front());
+                auto max = min;
+                for (const auto& group : groups_) {
+                    auto value = keys_.data[j].value(group.front());
+                    if (value < min) {
+                        min = std::move(value);
+                    } else if (max < value) {
+                        max = std::move(value);
+                    }
+                }
+                for (auto [cmp, bound] : {std::pair{components::expressions::compare_type::gte, &min},
+                                          std::pair{components::expressions::compare_type::lte, &max}}) {
+                    std::pmr::vector<std::uint64_t> path{resource_};
+                    path.push_back(key_col_indices[j]);
+                    filter->child_filters.push_back(
+                        std::make_unique<components::table::constant_filter_t>(cmp, *bound, std::move(path)));
+                }
+            }
+            if (filter->child_filters.empty()) {
+                return nullptr;
+            }
+            return filter;
+        }
+
+        // Calls fn(key_index, row) for every key-tuple equal to the `key_cols`
+        // cells of each row of `chunk`, rows in order.
+        template<typename Fn>
+        void probe(components::vector::data_chunk_t& chunk, const std::pmr::vector<std::uint64_t>& key_cols, Fn&& fn) {
+            const uint64_t n = chunk.size();
+            if (n == 0 || groups_.empty()) {
+                return;
+            }
+            std::vector<uint64_t> cols(key_cols.begin(), key_cols.end());
+            for (auto c : cols) {
+                chunk.data[c].flatten(n);
+            }
+            components::vector::vector_t hashes(resource_, components::types::logical_type::UBIGINT, n);
+            chunk.hash(cols, hashes);
+            hashes.flatten(n);
+            const auto* h = hashes.data<uint64_t>();
+            for (uint64_t r = 0; r < n; ++r) {
+                auto it = buckets_.find(h[r]);
+                if (it == buckets_.end() || !all_valid(chunk, key_cols, r)) {
+                    continue;
+                }
+                for (uint32_t g : it->second) {
+                    if (!tuples_equal(chunk, key_cols, r, groups_[g].front())) {
+                        continue;
+                    }
+                    for (uint32_t key : groups_[g]) {
+                        fn(static_cast<uint64_t>(key), r);
+                    }
+                    break;
+                }
+            }
+        }
+
+    private:
+        static bool all_valid(const components::vector::data_chunk_t& chunk,
+                              const std::pmr::vector<std::uint64_t>& cols,
+                              uint64_t row) {
+            return std::all_of(cols.begin(), cols.end(), [&](std::uint64_t c) {
+                return chunk.data[c].validity().row_is_valid(row);
+            });
+        }
+
+        // Equality is confirmed on logical values: it runs once per hash hit,
+        // i.e. roughly once per matching row, never per scanned row.
+        bool tuples_equal(const components::vector::data_chunk_t& chunk,
+                          const std::pmr::vector<std::uint64_t>& cols,
+                          uint64_t row,
+                          uint32_t key_row) const {
+            for (std::size_t j = 0; j < cols.size(); ++j) {
+                if (!(chunk.data[cols[j]].value(row) == keys_.data[j].value(key_row))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::pmr::memory_resource* resource_;
+        components::vector::data_chunk_t& keys_;
+        std::pmr::vector<std::uint64_t> key_cols_{resource_};
+        // key hash -> groups whose key-tuple hashed there
+        std::pmr::unordered_map<uint64_t, std::pmr::vector<uint32_t>> buckets_;
+        // one entry per distinct key-tuple: the key rows carrying it
+        std::pmr::vector<std::pmr::vector<uint32_t>> groups_;
+    };
+
+    // One pass over every committed-visible row of `storage` that passes
+    // `filter` (may be null), scan_read_ahead batches at a time; fn(chunk) sees
+    // each batch in row order.
+    template<typename Fn>
+    core::result_wrapper_t<bool> for_each_batch(components::storage::storage_t& storage,
+                                                const components::table::table_filter_t* filter,
+                                                const std::vector<std::size_t>* projected_cols,
+                                                const components::table::transaction_data& txn,
+                                                uint64_t read_ahead,
+                                                Fn&& fn) {
+        components::storage::scan_position_t pos;
+        pos.max_row = static_cast<int64_t>(storage.total_rows());
+        std::pmr::vector<components::vector::data_chunk_t> window(storage.resource());
+        while (!pos.drained) {
+            window.clear();
+            auto fetch_r = storage.fetch_next_batches(window, pos, filter, projected_cols, txn, read_ahead);
+            if (fetch_r.has_error()) {
+                return fetch_r;
+            }
+            for (auto& chunk : window) {
+                fn(chunk);
+            }
+        }
+        return true;
+    }
+
+} // namespace services::disk::detail
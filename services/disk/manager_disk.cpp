@@ -47,6 +47,7 @@ namespace services::disk {
             actor_zeta::msg_id<manager_disk_t, &manager_disk_t::drop_storage_many>,
             actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_types>,
             actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_total_rows>,
+            actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_statistics>,
             actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_scan>,
             actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_fetch_next_batch>,
             actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_fetch>,
@@ -411,6 +412,10 @@ namespace services::disk {
                 co_await actor_zeta::dispatch(this, &manager_disk_t::storage_total_rows, msg);
                 break;
             }
+            case actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_statistics>: {
+                co_await actor_zeta::dispatch(this, &manager_disk_t::storage_statistics, msg);
+                break;
+            }
             // Storage data operations
             case actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_scan>: {
                 co_await actor_zeta::dispatch(this, &manager_disk_t::storage_scan, msg);
@@ -90,6 +90,8 @@ namespace services::disk {
         [[nodiscard]] const core::error_t& construction_error() const noexcept { return construction_error_; }
 
         /// Checkpoint (disk mode only, no-op/success for in-memory).
+        /// Incremental: only row groups changed since the last checkpoint get new blocks, the rest are
+        /// referenced as they are. Shadow paging: nothing the durable header references is overwritten.
         /// W-TORN: writes data blocks + fsync, then header + fsync (2 fsync — durability before header swap).
         /// Returns out_of_memory when a column flush pin fails in
         /// data_table_t::checkpoint; true on success (or IN_MEMORY no-op).
@@ -104,7 +106,8 @@ namespace services::disk {
         /// Used by load path to seed checkpoint_wal_id_ from sidecar before WAL replay
         /// decides which records this storage already includes.
         void set_checkpoint_wal_id(wal::id_t v) noexcept { checkpoint_wal_id_ = v; }
-        /// W-TORN: previous checkpoint wal_id (the state in the .prev backup); 0 before first overwrite.
+        /// W-TORN: previous checkpoint wal_id (the state the other header slot describes); 0 before first
+        /// overwrite.
         /// Used by checkpoint_all to compute min(prev) for safe WAL truncation.
         wal::id_t prev_checkpoint_wal_id() const noexcept { return prev_checkpoint_wal_id_; }
 
@@ -451,8 +454,8 @@ namespace services::disk {
 
         // Batched keyed scan: result[i] = match row_ids for key-tuple i. Keys are
         // columnar — `keys` is a data_chunk (column j = key_col_names[j], row i = i-th
-        // key-tuple). All keys share `table_oid` (one owning agent), so the per-key loop
-        // runs intra-agent via a single scan_by_keys_inner message.
+        // key-tuple). All keys share `table_oid` (one owning agent), so the whole batch
+        // is answered intra-agent by a single scan_by_keys_inner message.
         unique_future<std::pmr::vector<std::pmr::vector<std::int64_t>>>
         scan_by_keys(execution_context_t ctx,
                      components::catalog::oid_t table_oid,
@@ -473,8 +476,8 @@ namespace services::disk {
         // Batched multi-key columnar row-data scan: result[i] = matched chunks for key-tuple i
         // (each <= DEFAULT_VECTOR_CAPACITY rows). `keys` is an N-row columnar carrier (column j =
         // key_col_names[j], row i = i-th key-tuple), so no row-major logical_value_t crosses the
-        // boundary. All keys share `table_oid` (one owning agent), so the per-key loop runs
-        // intra-agent via a single read_chunks_by_keys_inner message. result.size() ==
+        // boundary. All keys share `table_oid` (one owning agent), so the whole batch is answered
+        // intra-agent by a single read_chunks_by_keys_inner message. result.size() ==
         // keys.size() (one possibly-empty entry per key, in input order). Thin router.
         unique_future<std::pmr::vector<std::pmr::vector<components::vector::data_chunk_t>>>
         read_chunks_by_keys(execution_context_t ctx,
@@ -625,6 +628,9 @@ namespace services::disk {
         unique_future<std::pmr::vector<components::types::complex_logical_type>>
         storage_types(session_id_t session, components::catalog::oid_t table_oid);
         unique_future<uint64_t> storage_total_rows(session_id_t session, components::catalog::oid_t table_oid);
+        // Row count + per-column min/max/null count, for the optimizer's join ordering.
+        unique_future<components::table::table_statistics_t> storage_statistics(session_id_t session,
+                                                                                components::catalog::oid_t table_oid);
 
         // Storage data operations.
         // Returns a vector of chunks and applies index-based column projection at the
@@ -712,6 +718,7 @@ namespace services::disk {
                                                        // Storage queries
                                                        &manager_disk_t::storage_types,
                                                        &manager_disk_t::storage_total_rows,
+                                                       &manager_disk_t::storage_statistics,
                                                        // Storage data operations
                                                        &manager_disk_t::storage_scan,
                                                        &manager_disk_t::storage_fetch_next_batch,
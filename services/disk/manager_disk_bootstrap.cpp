@@ -131,6 +131,8 @@ namespace services::disk {
                 return components::catalog::well_known_oid::pg_rewrite_table;
             if (name == "pg_settings")
                 return components::catalog::well_known_oid::pg_settings_table;
+            if (name == "pg_statistic")
+                return components::catalog::well_known_oid::pg_statistic_table;
             return components::catalog::INVALID_OID;
         }
     } // namespace
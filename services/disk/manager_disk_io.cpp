@@ -1,5 +1,7 @@
 #include "manager_disk_impl.hpp"
 
+#include <thread>
+
 namespace services::disk {
 
     using namespace core::filesystem;
@@ -28,6 +30,9 @@ namespace services::disk {
             trace(log_, "manager_disk create_agent : {}", name_agent);
             const agent_role_t role = (slot == 0) ? agent_role_t::CATALOG : agent_role_t::USER_POOL;
             auto agent = actor_zeta::spawn<agent_disk_t>(resource(), this, config_.path, log_, role, slot);
+            agent->set_scan_threads_sync(config_.scan_threads == 0 ? std::thread::hardware_concurrency()
+                                                                   : config_.scan_threads);
+            agent->set_scan_read_ahead_sync(config_.scan_read_ahead);
             agents_.emplace_back(std::move(agent));
         }
     }
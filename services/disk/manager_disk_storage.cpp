@@ -316,6 +316,21 @@ namespace services::disk {
         co_return 0;
     }
 
+    manager_disk_t::unique_future<components::table::table_statistics_t>
+    manager_disk_t::storage_statistics(session_id_t /*session*/, catalog::oid_t table_oid) {
+        if (!agents_.empty()) {
+            const std::size_t pool_idx = pool_idx_for_oid(table_oid, agents_.size());
+            auto& agent = agents_[pool_idx];
+            auto [needs_sched, fut] =
+                actor_zeta::otterbrix::send(agent->address(), &agent_disk_t::storage_statistics_inner, table_oid);
+            if (needs_sched) {
+                scheduler_disk_->enqueue(agent.get());
+            }
+            co_return co_await std::move(fut);
+        }
+        co_return components::table::table_statistics_t{};
+    }
+
     // --- Storage data operations ---
 
     manager_disk_t::unique_future<core::result_wrapper_t<std::pmr::vector<components::vector::data_chunk_t>>>
@@ -310,3 +310,87 @@ TEST_CASE("services::disk::resolve::read_chunks_by_keys_multi_key_parity") {
         }
     }
 }
+
+// 8. scan_by_keys with a multi-key batch is answered by one table pass. Per-key
+// output must still line up with the input rows: a repeated key-tuple gets the
+// same row_ids at both positions, a key with a NULL cell matches nothing, and
+// both key columns of a composite key must match.
+TEST_CASE("services::disk::resolve::scan_by_keys_batched_composite") {
+    using components::types::complex_logical_type;
+    using components::types::logical_type;
+    using components::types::logical_value_t;
+    using components::vector::data_chunk_t;
+
+    fixture fx;
+    auto ns_oid = disk_test_helpers::test_create_namespace(fx, "ns_sbk");
+    auto table_oid = disk_test_helpers::test_create_table(fx,
+                                                          ns_oid,
+                                                          "sbk_tbl",
+                                                          std::vector<components::table::column_definition_t>{},
+                                                          catalog::relkind::regular);
+    REQUIRE(table_oid >= FIRST_USER_OID);
+    {
+        std::vector<components::table::column_definition_t> scols;
+        scols.emplace_back("a", complex_logical_type{logical_type::BIGINT});
+        scols.emplace_back("b", complex_logical_type{logical_type::STRING_LITERAL});
+        fx.invoke(&manager_disk_t::create_storage_with_columns,
+                  session_id_t{},
+                  table_oid,
+                  well_known_oid::main_database,
+                  std::move(scols));
+    }
+    // 3000 rows spanning several vectors: a = r % 10, b = "x" for even r, "y" otherwise.
+    constexpr std::uint64_t nrows = 3000;
+    {
+        std::pmr::vector<complex_logical_type> types(&fx.resource);
+        complex_logical_type ta{logical_type::BIGINT};
+        ta.set_alias("a");
+        types.push_back(std::move(ta));
+        complex_logical_type tb{logical_type::STRING_LITERAL};
+        tb.set_alias("b");
+        types.push_back(std::move(tb));
+        auto chunk = std::make_unique<data_chunk_t>(&fx.resource, types, nrows);
+        chunk->set_cardinality(nrows);
+        for (std::uint64_t r = 0; r < nrows; ++r) {
+            chunk->set_value(0, r, logical_value_t(&fx.resource, static_cast<std::int64_t>(r % 10)));
+            chunk->set_value(1, r, logical_value_t(&fx.resource, std::string(r % 2 == 0 ? "x" : "y")));
+        }
+        components::execution_context_t append_ctx{session_id_t{},
+                                                   components::table::transaction_data{0, 0},
+                                                   {},
+                                                   table_oid};
+        auto append_r =
+            fx.invoke(&manager_disk_t::storage_append, append_ctx, table_oid, to_batch(&fx.resource, std::move(chunk)));
+        REQUIRE_FALSE(append_r.has_error());
+        REQUIRE(append_r.value().second == nrows);
+    }
+
+    // (4, "x") matches every r with r % 10 == 4; (3, "x") never matches (odd a is always "y").
+    std::pmr::vector<complex_logical_type> ktypes(&fx.resource);
+    ktypes.emplace_back(logical_type::BIGINT);
+    ktypes.emplace_back(logical_type::STRING_LITERAL);
+    constexpr std::size_t N = 4;
+    data_chunk_t keys(&fx.resource, ktypes, N);
+    keys.set_value(0, 0, logical_value_t(&fx.resource, std::int64_t{4}));
+    keys.set_value(1, 0, logical_value_t(&fx.resource, std::string("x")));
+    keys.set_value(0, 1, logical_value_t(&fx.resource, std::int64_t{3}));
+    keys.set_value(1, 1, logical_value_t(&fx.resource, std::string("x")));
+    keys.set_value(0, 2, logical_value_t(&fx.resource, std::int64_t{4}));
+    keys.set_value(1, 2, logical_value_t(&fx.resource, std::string("x")));
+    keys.set_value(0, 3, logical_value_t(&fx.resource, nullptr));
+    keys.set_value(1, 3, logical_value_t(&fx.resource, std::string("y")));
+    keys.set_cardinality(N);
+    std::pmr::vector<std::string> key_cols{&fx.resource};
+    key_cols.emplace_back("a");
+    key_cols.emplace_back("b");
+    auto res = fx.invoke(&manager_disk_t::scan_by_keys, fx.ctx(), table_oid, std::move(key_cols), std::move(keys));
+
+    REQUIRE(res.size() == N);
+    REQUIRE(res[0].size() == nrows / 10);
+    REQUIRE(res[1].empty());
+    REQUIRE(res[2] == res[0]);
+    REQUIRE(res[3].empty());
+    for (auto row_id : res[0]) {
+        REQUIRE(row_id % 10 == 4);
+    }
+}
@@ -94,7 +94,10 @@ namespace services::dispatcher {
         , executors_(resource_ptr)
         , executor_addresses_(resource_ptr)
         , txn_manager_(resource_ptr)
-        , pending_void_(resource_ptr) {
+        , pending_void_(resource_ptr)
+        , pending_cursor_(resource_ptr)
+        , open_streams_(resource_ptr)
+        , parked_streams_(resource_ptr) {
         ZoneScoped;
         trace(log_, "manager_dispatcher_t::manager_dispatcher_t");
 
@@ -127,8 +130,20 @@ namespace services::dispatcher {
                     //     so pending_msg must STAY in the slot.
                     {
                         in_flight_entry_t* slot = nullptr;
+                        std::size_t parked = 0;
                         for (auto& e : in_flight) {
                             if (e.pending_msg && !e.behavior) {
+                                // A parked stream push stays parked until its
+                                // own client makes room (see stream_room_msg).
+                                if (e.pending_msg->command() ==
+                                    actor_zeta::msg_id<manager_dispatcher_t, &manager_dispatcher_t::stream_room_msg>) {
+                                    assert(parked < parked_streams_.size());
+                                    const auto it = parked_streams_.begin() + static_cast<std::ptrdiff_t>(parked++);
+                                    if (!(*it)->producer_may_resume()) {
+                                        continue;
+                                    }
+                                    parked_streams_.erase(it);
+                                }
                                 slot = &e;
                                 break;
                             }
@@ -230,6 +245,10 @@ namespace services::dispatcher {
         if (loop_thread_.joinable()) {
             loop_thread_.join();
         }
+        // The loop is gone: a client reading on must not wake it any more.
+        for (auto& stream : open_streams_) {
+            stream->set_waker({});
+        }
         // Drain any leftover inbox_ raw pointers: re-wrap each into a
         // message_ptr temporary so its PMR memory is freed (the loop is gone).
         actor_zeta::mailbox::message* raw = nullptr;
@@ -253,10 +272,25 @@ namespace services::dispatcher {
         return {false, actor_zeta::detail::enqueue_result::success};
     }
 
+    manager_dispatcher_t::unique_future<void>
+    manager_dispatcher_t::stream_wait_msg(components::cursor::chunk_stream_ptr stream) {
+        if (stream->producer_may_resume()) {
+            co_return;
+        }
+        parked_streams_.push_back(std::move(stream));
+        auto [_, future] = actor_zeta::send(address(), &manager_dispatcher_t::stream_room_msg);
+        co_await std::move(future);
+    }
+
+    manager_dispatcher_t::unique_future<void> manager_dispatcher_t::stream_room_msg() { co_return; }
+
     void manager_dispatcher_t::poll_pending() {
         pending_void_.erase(
             std::remove_if(pending_void_.begin(), pending_void_.end(), [](auto& f) { return f.is_ready(); }),
             pending_void_.end());
+        pending_cursor_.erase(
+            std::remove_if(pending_cursor_.begin(), pending_cursor_.end(), [](auto& f) { return f.is_ready(); }),
+            pending_cursor_.end());
     }
 
     actor_zeta::behavior_t manager_dispatcher_t::behavior(actor_zeta::mailbox::message* msg) {
@@ -313,6 +347,14 @@ namespace services::dispatcher {
                 co_await actor_zeta::dispatch(this, &manager_dispatcher_t::on_subscriber_empty, msg);
                 break;
             }
+            case actor_zeta::msg_id<manager_dispatcher_t, &manager_dispatcher_t::stream_wait_msg>: {
+                co_await actor_zeta::dispatch(this, &manager_dispatcher_t::stream_wait_msg, msg);
+                break;
+            }
+            case actor_zeta::msg_id<manager_dispatcher_t, &manager_dispatcher_t::stream_room_msg>: {
+                co_await actor_zeta::dispatch(this, &manager_dispatcher_t::stream_room_msg, msg);
+                break;
+            }
             default:
                 break;
         }
@@ -322,15 +364,20 @@ namespace services::dispatcher {
         wal_address_ = pack.wal;
         disk_address_ = pack.disk;
         index_address_ = pack.index;
+        analyze_tracker_.set_threshold(pack.statistics.auto_analyze_rows);
 
         executors_.reserve(executor_pool_size_);
         executor_addresses_.reserve(executor_pool_size_);
+        executor_streams_.assign(executor_pool_size_, 0);
         for (std::size_t i = 0; i < executor_pool_size_; ++i) {
             auto exec = actor_zeta::spawn<collection::executor::executor_t>(resource(),
                                                                             address(),
                                                                             wal_address_,
                                                                             disk_address_,
                                                                             index_address_,
+                                                                            &catalog_cache_,
+                                                                            &analyze_tracker_,
+                                                                            pack.spill,
                                                                             log_.clone());
             executor_addresses_.push_back(exec->address());
             executors_.push_back(std::move(exec));
@@ -428,9 +475,25 @@ namespace services::dispatcher {
         // Pure session-hash routing — no plan inspection: the executor owns
         // optimize/resolve/validate/enrich/rewrites and the commit tails. The
         // hash gives every session a sticky executor, deterministically.
+        // The exception: an executor running a streaming statement may sit
+        // paused on its client (who may be the one sending this statement), so
+        // the statement goes to the first executor without one — or waits its
+        // turn when every executor streams.
         assert(!executors_.empty());
-        const std::size_t pool_idx = std::hash<components::session::session_id_t>{}(session) % executors_.size();
+        std::size_t pool_idx = std::hash<components::session::session_id_t>{}(session) % executors_.size();
+        if (executor_streams_[pool_idx] != 0) {
+            const auto idle = std::find(executor_streams_.begin(), executor_streams_.end(), std::size_t{0});
+            if (idle != executor_streams_.end()) {
+                pool_idx = static_cast<std::size_t>(idle - executor_streams_.begin());
+            }
+        }
         trace(log_, "manager_dispatcher_t::execute_plan: routing to executor[{}]", pool_idx);
+        auto stream = plan.stream;
+        if (stream) {
+            ++executor_streams_[pool_idx];
+            open_streams_.push_back(stream);
+            stream->set_waker([this] { pump_cv_.notify_one(); });
+        }
         auto [needs_sched, future] = actor_zeta::otterbrix::send(executor_addresses_[pool_idx],
                                                                  &collection::executor::executor_t::execute_plan_full,
                                                                  session,
@@ -439,6 +502,11 @@ namespace services::dispatcher {
             scheduler_->enqueue(executors_[pool_idx].get());
         }
         auto exec_result = co_await std::move(future);
+        if (stream) {
+            stream->set_waker({});
+            open_streams_.erase(std::find(open_streams_.begin(), open_streams_.end(), stream));
+            --executor_streams_[pool_idx];
+        }
 
         // The ONLY post-execute bookkeeping left on the dispatcher: a
         // successful SET TIMEZONE surfaces the persisted zone name by value;
@@ -471,6 +539,17 @@ namespace services::dispatcher {
                 try_trigger_cleanup_if_horizon_advanced();
             }
         }
+
+        // Auto-analyze: self-sent as a statement of its own on a fresh session,
+        // so it runs after the INSERT's reply instead of in front of it. Parked
+        // like the other fire-and-forget futures; poll_pending reaps it.
+        if (exec_result.auto_analyze) {
+            auto [_aa, aa_fut] = actor_zeta::send(address(),
+                                                  &manager_dispatcher_t::execute_plan,
+                                                  components::session::session_id_t(),
+                                                  std::move(*exec_result.auto_analyze));
+            pending_cursor_.emplace_back(std::move(aa_fut));
+        }
         co_return std::move(exec_result.cursor);
     }
 
@@ -629,6 +708,7 @@ namespace services::dispatcher {
         out.txn = txn.data();
         out.session_tz = session_tz(session);
         out.is_explicit = txn.is_explicit();
+        out.has_catalog_writes = txn.has_pg_catalog_pending();
         out.lowest_active_start_time = txn_manager_.lowest_active_start_time();
         trace(log_,
               "manager_dispatcher_t::txn_begin_session_msg, session: {}, txn: {}, explicit: {}",
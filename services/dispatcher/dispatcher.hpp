@@ -24,6 +24,9 @@
 #include <components/catalog/catalog_oids.hpp>
 #include <components/catalog/session_catalog.hpp>
 #include <components/compute/function.hpp>
+#include <components/configuration/configuration.hpp>
+#include <components/context/analyze_tracker.hpp>
+#include <components/context/catalog_cache.hpp>
 #include <components/cursor/cursor.hpp>
 #include <components/log/log.hpp>
 #include <components/logical_plan/execution_plan.hpp>
@@ -47,17 +50,23 @@ namespace services::dispatcher {
     //                     publish horizon, and every transaction_t body) —
     //                     reachable ONLY through the txn_*_msg handlers below;
     //   - default_tz_cat_ (session timezone catalog);
+    //   - catalog_cache_  (resolve cache the executors share);
+    //   - analyze_tracker_ (auto-analyze row counts the executors share);
     //   - the executor pool and the DROP-GC subscriber flags.
     class manager_dispatcher_t final : public actor_zeta::actor::actor_mixin<manager_dispatcher_t> {
     public:
         template<typename T>
         using unique_future = actor_zeta::unique_future<T>;
 
-        // Bootstrap address bundle (plain named struct — no std::tuple).
+        // Bootstrap address bundle (plain named struct — no std::tuple), plus
+        // the spill settings every executor hands to its blocking operators and
+        // the auto-analyze threshold.
         struct sync_pack {
             actor_zeta::address_t wal = actor_zeta::address_t::empty_address();
             actor_zeta::address_t disk = actor_zeta::address_t::empty_address();
             actor_zeta::address_t index = actor_zeta::address_t::empty_address();
+            configuration::config_spill spill{};
+            configuration::config_statistics statistics{};
         };
 
         // One in-flight message in the event loop. behavior is created lazily;
@@ -161,6 +170,18 @@ namespace services::dispatcher {
         unique_future<void> on_drop_resource_marked(uint8_t subscriber_kind);
         unique_future<void> on_subscriber_empty(uint8_t subscriber_kind);
 
+        // Parking spot of an executor whose streaming statement found the
+        // client's `stream` full: returns at once if the client made room
+        // meanwhile, else parks on a stream_room_msg for that stream, so the
+        // executor's coroutine waits suspended instead of holding a scheduler
+        // thread. The executor retries its push either way.
+        unique_future<void> stream_wait_msg(components::cursor::chunk_stream_ptr stream);
+        // Self-sent by stream_wait_msg, one per entry of parked_streams_ and
+        // in the same order: the loop starts the k-th unstarted one (an empty
+        // co_return) only once parked_streams_[k] has room for its producer,
+        // so a client reading on wakes its own executor and no other.
+        unique_future<void> stream_room_msg();
+
         using dispatch_traits = actor_zeta::dispatch_traits<&manager_dispatcher_t::execute_plan,
                                                             &manager_dispatcher_t::register_udf,
                                                             &manager_dispatcher_t::unregister_udf,
@@ -173,7 +194,9 @@ namespace services::dispatcher {
                                                             &manager_dispatcher_t::txn_publish_msg,
                                                             &manager_dispatcher_t::txn_compact_watermark_msg,
                                                             &manager_dispatcher_t::on_drop_resource_marked,
-                                                            &manager_dispatcher_t::on_subscriber_empty>;
+                                                            &manager_dispatcher_t::on_subscriber_empty,
+                                                            &manager_dispatcher_t::stream_wait_msg,
+                                                            &manager_dispatcher_t::stream_room_msg>;
 
     private:
         // Reads txn_manager_.lowest_active_snapshot_horizon() (commit-id value
@@ -191,6 +214,13 @@ namespace services::dispatcher {
 
         static constexpr std::size_t executor_pool_size_ = 4;
 
+        // Resolve cache shared by every executor (see catalog_cache_t). Declared
+        // before executors_ so it outlives them.
+        components::catalog_cache_t catalog_cache_;
+        // Rows appended per table since its last ANALYZE (auto-analyze), shared
+        // by every executor the same way.
+        components::analyze_tracker_t analyze_tracker_;
+
         std::pmr::vector<services::collection::executor::executor_ptr> executors_;
         std::pmr::vector<actor_zeta::address_t> executor_addresses_;
 
@@ -235,8 +265,20 @@ namespace services::dispatcher {
         // only the event loop appends (broadcast/register sends) and drains it
         // via poll_pending().
         std::pmr::vector<actor_zeta::unique_future<void>> pending_void_;
+        // Same for the self-sent auto-analyze statements (execute_plan).
+        std::pmr::vector<actor_zeta::unique_future<components::cursor::cursor_t_ptr>> pending_cursor_;
 
         void poll_pending();
+
+        // Streams of the streaming statements in flight, and how many each
+        // executor runs. Loop-thread-private. A paused stream holds its
+        // executor until the client reads on, so execute_plan routes around
+        // executors that run one.
+        std::pmr::vector<components::cursor::chunk_stream_ptr> open_streams_;
+        std::vector<std::size_t> executor_streams_;
+        // Streams whose producer waits on a stream_room_msg, in send order.
+        // Loop-thread-private.
+        std::pmr::vector<components::cursor::chunk_stream_ptr> parked_streams_;
     };
 
 } // namespace services::dispatcher
@@ -509,7 +509,8 @@ namespace services::catalog_resolve {
                         // table_oid set at construction time — re-stamping
                         // from a sibling resolve here is a no-op for them.
                         case node_type::alter_table_t:
-                        case node_type::alter_column_t: {
+                        case node_type::alter_column_t:
+                        case node_type::analyze_t: {
                             if (rt && rt->table_oid() != components::catalog::INVALID_OID) {
                                 c->set_table_oid(rt->table_oid());
                             }
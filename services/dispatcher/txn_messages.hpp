@@ -28,10 +28,13 @@ namespace services::dispatcher {
     //   is_explicit — whether a prior SQL BEGIN marked this txn explicit; the
     //              executor's DML tail uses it to pick accumulate-vs-publish.
     //   lowest_active_start_time — VACUUM/MVCC GC gate value for pipeline ctx.
+    //   has_catalog_writes — a prior statement of this txn wrote pg_catalog;
+    //              the executor then resolves without the shared catalog cache.
     struct txn_session_context_t {
         components::table::transaction_data txn{0, 0};
         core::date::timezone_offset_t session_tz{};
         bool is_explicit{false};
+        bool has_catalog_writes{false};
         uint64_t lowest_active_start_time{0};
     };
 
@@ -117,8 +117,17 @@ namespace services::wal {
                 // (a) Create a behavior for the next entry that needs one. pending_msg
                 //     STAYS in its slot: the coroutine holds a raw pointer to the
                 //     message across suspension points, so it must outlive the behavior.
+                //     Group-commit syncs (sync_commit_group) wait here until their group
+                //     closes, then start back to back so one worker fsync covers them all.
+                const bool release_group = release_commit_group_(in_flight);
                 for (auto& e : in_flight) {
                     if (e.pending_msg && !e.behavior) {
+                        if (is_commit_group_sync_(e)) {
+                            if (!release_group) {
+                                continue;
+                            }
+                            --commit_group_release_;
+                        }
                         e.behavior = behavior(e.pending_msg.get());
                         made_progress = true;
                         break;
@@ -232,6 +241,10 @@ namespace services::wal {
                 co_await actor_zeta::dispatch(this, &manager_wal_replicate_t::run_auto_checkpoint, msg);
                 break;
             }
+            case actor_zeta::msg_id<manager_wal_replicate_t, &manager_wal_replicate_t::sync_commit_group>: {
+                co_await actor_zeta::dispatch(this, &manager_wal_replicate_t::sync_commit_group, msg);
+                break;
+            }
             case actor_zeta::msg_id<manager_wal_replicate_t, &manager_wal_replicate_t::write_physical_insert>: {
                 co_await actor_zeta::dispatch(this, &manager_wal_replicate_t::write_physical_insert, msg);
                 break;
@@ -380,17 +393,39 @@ namespace services::wal {
 
         auto* worker = get_or_create_worker(database_oid);
         auto wal_id = next_wal_id();
-        auto [needs_sched, fut] = actor_zeta::otterbrix::send(worker->address(),
-                                                              &wal_worker_t::commit_txn,
-                                                              session,
-                                                              txn_id,
-                                                              sync_mode,
-                                                              wal_id,
-                                                              commit_id);
-        if (needs_sched) {
-            scheduler_->enqueue(worker);
+        wal::id_t result{0};
+        if (sync_mode == wal_sync_mode::FULL && group_commit_enabled_()) {
+            // Group commit: append unsynced, then join the open group. The reply still waits for
+            // the fsync that covers this COMMIT record, so FULL keeps its durability contract.
+            ++commits_appending_;
+            auto [needs_sched, fut] = actor_zeta::otterbrix::send(worker->address(),
+                                                                  &wal_worker_t::append_commit,
+                                                                  session,
+                                                                  txn_id,
+                                                                  wal_id,
+                                                                  commit_id);
+            if (needs_sched) {
+                scheduler_->enqueue(worker);
+            }
+            result = co_await std::move(fut);
+            --commits_appending_;
+            // needs_sched is always false for a self-send (see run_auto_checkpoint below).
+            auto [_g, group_fut] =
+                actor_zeta::send(address(), &manager_wal_replicate_t::sync_commit_group, session, database_oid, wal_id);
+            co_await std::move(group_fut);
+        } else {
+            auto [needs_sched, fut] = actor_zeta::otterbrix::send(worker->address(),
+                                                                  &wal_worker_t::commit_txn,
+                                                                  session,
+                                                                  txn_id,
+                                                                  sync_mode,
+                                                                  wal_id,
+                                                                  commit_id);
+            if (needs_sched) {
+                scheduler_->enqueue(worker);
+            }
+            result = co_await std::move(fut);
         }
-        auto result = co_await std::move(fut);
         // Track WAL bytes for auto-checkpoint threshold.
         wal_bytes_since_checkpoint_.store(total_wal_bytes(), std::memory_order_relaxed);
 
@@ -419,6 +454,64 @@ namespace services::wal {
         co_return result;
     }
 
+    // -----------------------------------------------------------------------
+    // Contract: sync_commit_group
+    //
+    // Started by the loop only once the group closed (release_commit_group_).
+    // Every member forwards its own wal id; the worker fsyncs for the first one
+    // and answers the rest from synced_through_, since all of them appended
+    // before the group closed.
+    // -----------------------------------------------------------------------
+
+    manager_wal_replicate_t::unique_future<wal::id_t>
+    manager_wal_replicate_t::sync_commit_group(session_id_t session,
+                                               components::catalog::oid_t database_oid,
+                                               wal::id_t wal_id) {
+        auto* worker = get_or_create_worker(database_oid);
+        auto [needs_sched, fut] =
+            actor_zeta::otterbrix::send(worker->address(), &wal_worker_t::sync_commits, session, wal_id);
+        if (needs_sched) {
+            scheduler_->enqueue(worker);
+        }
+        co_return co_await std::move(fut);
+    }
+
+    bool manager_wal_replicate_t::is_commit_group_sync_(const in_flight_entry_t& entry) {
+        return entry.pending_msg &&
+               entry.pending_msg->command() ==
+                   actor_zeta::msg_id<manager_wal_replicate_t, &manager_wal_replicate_t::sync_commit_group>;
+    }
+
+    bool manager_wal_replicate_t::release_commit_group_(const std::pmr::list<in_flight_entry_t>& in_flight) {
+        if (commit_group_release_ > 0) {
+            return true;
+        }
+        std::size_t held = 0;
+        for (const auto& e : in_flight) {
+            if (!e.behavior && is_commit_group_sync_(e)) {
+                ++held;
+            }
+        }
+        if (held == 0) {
+            commit_group_opened_ = {};
+            return false;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (commit_group_opened_ == std::chrono::steady_clock::time_point{}) {
+            commit_group_opened_ = now;
+        }
+        // Close when nothing else can join soon (no commit mid-append), when full, or when the
+        // window elapsed — a lone committer never waits for the window.
+        if (commits_appending_ == 0 || held >= config_.group_commit_max_size ||
+            now - commit_group_opened_ >= std::chrono::microseconds(config_.group_commit_window_us)) {
+            trace(log_, "manager_wal_replicate::commit group closed , commits : {}", held);
+            commit_group_opened_ = {};
+            commit_group_release_ = held;
+            return true;
+        }
+        return false;
+    }
+
     std::uintmax_t manager_wal_replicate_t::total_wal_bytes() const noexcept {
         if (!enabled_ || config_.path.empty())
             return 0;
@@ -18,6 +18,7 @@
 #include <boost/lockfree/queue.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <list>
@@ -88,6 +89,12 @@ namespace services::wal {
         // M1.1 truncation/replay-gate invariant.
         unique_future<void> run_auto_checkpoint(session_id_t session);
 
+        // Group commit (config_wal::group_commit_*). FULL commit_txn appends its COMMIT record
+        // unsynced, then self-sends this; the loop holds it until the group closes (see
+        // release_commit_group_), so the fsync it forwards to the worker covers the group.
+        unique_future<wal::id_t>
+        sync_commit_group(session_id_t session, components::catalog::oid_t database_oid, wal::id_t wal_id);
+
         // Writes ONE physical-insert record covering [row_start, row_start + row_count).
         // The chunks are concatenated into a single payload in vector order.
         unique_future<wal::id_t> write_physical_insert(session_id_t session,
@@ -136,6 +143,7 @@ namespace services::wal {
                                                        &manager_wal_replicate_t::truncate_before,
                                                        &manager_wal_replicate_t::current_wal_id,
                                                        &manager_wal_replicate_t::run_auto_checkpoint,
+                                                       &manager_wal_replicate_t::sync_commit_group,
                                                        &manager_wal_replicate_t::write_physical_insert,
                                                        &manager_wal_replicate_t::write_physical_delete,
                                                        &manager_wal_replicate_t::write_physical_update,
@@ -207,6 +215,20 @@ namespace services::wal {
         std::pmr::vector<unique_future<void>> pending_auto_checkpoint_{resource_};
         void poll_auto_checkpoint_();
 
+        // Group-commit state, loop-thread only. commits_appending_ counts FULL commits between
+        // their append_commit send and their sync_commit_group self-send — while non-zero, more
+        // commits may still join the open group. commit_group_opened_ is when the loop first saw
+        // a held sync_commit_group (zero = no open group); commit_group_release_ is how many held
+        // entries the loop still has to start for a group it closed.
+        std::size_t commits_appending_{0};
+        std::chrono::steady_clock::time_point commit_group_opened_{};
+        std::size_t commit_group_release_{0};
+        bool group_commit_enabled_() const noexcept { return config_.group_commit_max_size > 1; }
+        static bool is_commit_group_sync_(const in_flight_entry_t& entry);
+        // Whether held sync_commit_group entries may start now; closes the group when it is full,
+        // no commit is mid-append, or the window elapsed.
+        bool release_commit_group_(const std::pmr::list<in_flight_entry_t>& in_flight);
+
         // Event loop runs on its own thread. Senders only deliver into inbox_;
         // ALL message processing (behavior creation, coroutine resume, cleanup)
         // happens on loop_thread_. See manager_dispatcher_t for the same model.
@@ -814,3 +814,47 @@ TEST_CASE("wal_worker::disk_full_error", "[.][todo]") {
     // Mark as TODO for integration-test coverage.
     SUCCEED("Skipped -- disk-full simulation not implemented");
 }
+
+// ===========================================================================
+//  12. worker_group_commit
+//      Concurrent FULL commits share fsyncs (config_wal::group_commit_*): the
+//      burst needs fewer fsyncs than commits. Every commit still resolves with
+//      its own wal id, in commit order, and the COMMIT records load back intact.
+// ===========================================================================
+TEST_CASE("wal_worker::group_commit") {
+    test_wal_worker env(base_wal_worker_path / "group_commit");
+    REQUIRE(env.config_.group_commit_max_size > 1);
+
+    constexpr uint64_t commits = 16;
+    const auto fsyncs_before = services::wal::commit_fsyncs();
+    std::vector<actor_zeta::unique_future<services::wal::id_t>> inserts;
+    std::vector<actor_zeta::unique_future<services::wal::id_t>> commit_futures;
+    for (uint64_t i = 0; i < commits; ++i) {
+        inserts.push_back(env.send_insert(/*txn_id=*/1200 + i, /*row_count=*/3));
+        commit_futures.push_back(env.send_commit(1200 + i, wal_sync_mode::FULL));
+    }
+    for (auto& fut : inserts) {
+        REQUIRE(await_ready(fut) > 0);
+    }
+    services::wal::id_t previous = 0;
+    for (auto& fut : commit_futures) {
+        auto wal_id = await_ready(fut);
+        REQUIRE(wal_id > previous);
+        previous = wal_id;
+    }
+    const auto fsyncs = services::wal::commit_fsyncs() - fsyncs_before;
+    INFO("fsyncs : " << fsyncs);
+    REQUIRE(fsyncs > 0);
+    REQUIRE(fsyncs < commits);
+
+    auto fut_records = env.send_load(0);
+    auto records = await_ready(fut_records);
+    uint64_t commit_markers = 0;
+    for (const auto& r : records) {
+        REQUIRE_FALSE(r.is_corrupt);
+        if (r.is_commit_marker() && r.transaction_id >= 1200 && r.transaction_id < 1200 + commits) {
+            ++commit_markers;
+        }
+    }
+    REQUIRE(commit_markers == commits);
+}
@@ -8,6 +8,14 @@
 
 namespace services::wal {
 
+#ifdef DEV_MODE
+    namespace {
+        std::atomic<uint64_t> g_commit_fsyncs{0};
+    } // namespace
+
+    uint64_t commit_fsyncs() noexcept { return g_commit_fsyncs.load(std::memory_order_relaxed); }
+#endif
+
     // -----------------------------------------------------------------------
     // Segment file naming
     //
@@ -77,6 +85,14 @@ namespace services::wal {
                 co_await actor_zeta::dispatch(this, &wal_worker_t::commit_txn, msg);
                 break;
             }
+            case actor_zeta::msg_id<wal_worker_t, &wal_worker_t::append_commit>: {
+                co_await actor_zeta::dispatch(this, &wal_worker_t::append_commit, msg);
+                break;
+            }
+            case actor_zeta::msg_id<wal_worker_t, &wal_worker_t::sync_commits>: {
+                co_await actor_zeta::dispatch(this, &wal_worker_t::sync_commits, msg);
+                break;
+            }
             case actor_zeta::msg_id<wal_worker_t, &wal_worker_t::truncate_before>: {
                 co_await actor_zeta::dispatch(this, &wal_worker_t::truncate_before, msg);
                 break;
@@ -270,6 +286,11 @@ namespace services::wal {
 
         if (sync_mode == wal_sync_mode::FULL) {
             writer_->flush_and_sync();
+#ifdef DEV_MODE
+            g_commit_fsyncs.fetch_add(1, std::memory_order_relaxed);
+#endif
+            // The fsync also covers any group still waiting for its sync_commits.
+            synced_through_ = std::max(wal_id, deferred_through_);
         } else {
             // NORMAL: flush buffered page to disk, but no fsync.
             writer_->flush();
@@ -278,6 +299,56 @@ namespace services::wal {
         co_return wal_id;
     }
 
+    // -----------------------------------------------------------------------
+    // append_commit / sync_commits
+    //
+    // Group commit for FULL mode. The mailbox serializes appends, so the CRC
+    // chain and commit order are exactly those of commit_txn; only the fsync is
+    // split off. Commits appended while an fsync is pending queue their
+    // sync_commits behind it, and the first of them syncs the whole group —
+    // the rest find their wal id already covered and return at once.
+    // -----------------------------------------------------------------------
+
+    wal_worker_t::unique_future<wal::id_t> wal_worker_t::append_commit(session_id_t /*session*/,
+                                                                       uint64_t transaction_id,
+                                                                       wal::id_t wal_id,
+                                                                       uint64_t commit_id) {
+        id_.store(wal_id, std::memory_order_relaxed);
+
+        trace(log_,
+              "wal_worker::append_commit , wal_id : {} , txn : {} , commit_id : {}",
+              wal_id,
+              transaction_id,
+              commit_id);
+
+        encode_buf_.clear();
+        last_crc_ = encode_commit(encode_buf_, last_crc_, wal_id, transaction_id, commit_id);
+
+        ensure_writer();
+        writer_->append(encode_buf_.data(), encode_buf_.size(), wal_id);
+        writer_->flush();
+        deferred_through_ = wal_id;
+
+        co_return wal_id;
+    }
+
+    wal_worker_t::unique_future<wal::id_t> wal_worker_t::sync_commits(session_id_t /*session*/, wal::id_t wal_id) {
+        if (synced_through_ >= wal_id) {
+            co_return synced_through_;
+        }
+
+        trace(log_, "wal_worker::sync_commits , wal_id : {} , through : {}", wal_id, deferred_through_);
+
+        ensure_writer();
+        writer_->flush_and_sync();
+#ifdef DEV_MODE
+        g_commit_fsyncs.fetch_add(1, std::memory_order_relaxed);
+#endif
+        synced_through_ = std::max(wal_id, deferred_through_);
+
+        co_return synced_through_;
+    }
+
     // -----------------------------------------------------------------------
     // load
     //
@@ -465,8 +536,18 @@ namespace services::wal {
             std::error_code ec;
             auto sz = std::filesystem::file_size(seg, ec);
             if (!ec && sz >= config_.max_segment_size) {
-                // Flush + close current writer, open a new segment.
-                writer_->flush();
+                // Flush + close current writer, open a new segment. A commit group still waiting
+                // for its fsync lives in this segment; sync it now, sync_commits only reaches the
+                // next one.
+                if (deferred_through_ > synced_through_) {
+                    writer_->flush_and_sync();
+#ifdef DEV_MODE
+                    g_commit_fsyncs.fetch_add(1, std::memory_order_relaxed);
+#endif
+                    synced_through_ = deferred_through_;
+                } else {
+                    writer_->flush();
+                }
                 writer_.reset();
                 ++current_segment_index_;
             } else {
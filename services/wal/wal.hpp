@@ -27,6 +27,14 @@ namespace services::wal {
 
     using session_id_t = components::session::session_id_t;
 
+#ifdef DEV_MODE
+    // Test-observable count of fsyncs issued for COMMIT records: a FULL commit_txn, a
+    // group's sync_commits, or a pending group synced on segment rotation. With group
+    // commit it grows slower than the number of FULL commits. Process-global + relaxed:
+    // instrumentation, not a synchronization primitive. DEV_MODE-only.
+    uint64_t commit_fsyncs() noexcept;
+#endif
+
     class wal_worker_t final : public actor_zeta::actor::basic_actor<wal_worker_t> {
     public:
         template<typename T>
@@ -60,6 +68,16 @@ namespace services::wal {
                                             wal::id_t wal_id,
                                             uint64_t commit_id);
 
+        // Group-commit halves of a FULL commit_txn (manager_wal_replicate_t drives them).
+        // append_commit writes + flushes the COMMIT record without fsync; sync_commits fsyncs
+        // every commit appended so far unless an earlier group's fsync already covered
+        // `wal_id`. Returns the highest wal id known durable.
+        unique_future<wal::id_t> append_commit(session_id_t session,
+                                               uint64_t transaction_id,
+                                               wal::id_t wal_id,
+                                               uint64_t commit_id);
+        unique_future<wal::id_t> sync_commits(session_id_t session, wal::id_t wal_id);
+
         unique_future<void> truncate_before(session_id_t session, wal::id_t checkpoint_wal_id);
 
         unique_future<wal::id_t> current_wal_id(session_id_t session);
@@ -97,6 +115,8 @@ namespace services::wal {
 
         using dispatch_traits = actor_zeta::dispatch_traits<&wal_worker_t::load,
                                                             &wal_worker_t::commit_txn,
+                                                            &wal_worker_t::append_commit,
+                                                            &wal_worker_t::sync_commits,
                                                             &wal_worker_t::truncate_before,
                                                             &wal_worker_t::current_wal_id,
                                                             &wal_worker_t::write_physical_insert,
@@ -135,6 +155,11 @@ namespace services::wal {
 
         atomic_id_t id_{0};
         crc32_t last_crc_{0};
+        /// Highest COMMIT wal id appended by append_commit (not yet necessarily fsync'ed) and the
+        /// highest wal id covered by an fsync. deferred_through_ > synced_through_ means a group is
+        /// waiting for its sync_commits.
+        wal::id_t deferred_through_{0};
+        wal::id_t synced_through_{0};
         uint32_t current_segment_index_{0};
 
         std::unique_ptr<wal_page_writer_t> writer_;
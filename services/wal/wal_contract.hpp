@@ -35,6 +35,12 @@ namespace services::wal {
         // a committer's latency path. See manager_wal_replicate_t::run_auto_checkpoint.
         actor_zeta::unique_future<void> run_auto_checkpoint(session_id_t session);
 
+        // Group-commit fsync of a FULL commit_txn whose COMMIT record is already appended.
+        // Self-sent by commit_txn; the WAL manager's loop holds these back until the group
+        // closes, then starts them together so the worker fsyncs once for all of them.
+        actor_zeta::unique_future<id_t>
+        sync_commit_group(session_id_t session, components::catalog::oid_t database_oid, id_t wal_id);
+
         // database_oid selects the target WAL worker: manager_wal_replicate
         // routes via wal_actors_[database_oid].
         actor_zeta::unique_future<id_t> write_physical_insert(session_id_t session,
@@ -85,6 +91,7 @@ namespace services::wal {
                                                             &wal_contract::truncate_before,
                                                             &wal_contract::current_wal_id,
                                                             &wal_contract::run_auto_checkpoint,
+                                                            &wal_contract::sync_commit_group,
                                                             &wal_contract::write_physical_insert,
                                                             &wal_contract::write_physical_delete,
                                                             &wal_contract::write_physical_update,